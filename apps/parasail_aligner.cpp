@@ -131,7 +131,7 @@ static void print_help(const char *progname, int status) {
             "[-d] "
             "[-M match] "
             "[-X mismatch] "
-            "[-k band size (for nw_banded)] "
+            "[-k band size (for *_banded)] "
             "[-l AOL] "
             "[-s SIM] "
             "[-i OS] "
@@ -204,8 +204,10 @@ int main(int argc, char **argv) {
     const char *funcname = "sw_stats_striped_16";
     parasail_function_t *function = NULL;
     parasail_pfunction_t *pfunction = NULL;
+    parasail_pwfunction_t *pwfunction = NULL;
     parasail_pcreator_t *pcreator = NULL;
-    int banded = 0;
+    parasail_kfunction_t *kfunction = NULL;
+    parasail_dfunction_t *dfunction = NULL;
     int kbandsize = 3;
     const char *matrixname = NULL;
     const parasail_matrix_t *matrix = NULL;
@@ -374,14 +376,17 @@ int main(int argc, char **argv) {
                 eprintf(stderr, "Specified profile creator function not found.\n");
                 exit(EXIT_FAILURE);
             }
+            /* optional, reuses per-thread scratch vectors when present */
+            pwfunction = parasail_lookup_pwfunction(funcname);
 
         }
         else {
             function = parasail_lookup_function(funcname);
-            if (NULL == function && NULL != strstr(funcname, "nw_banded")) {
-                banded = 1;
+            if (NULL == function) {
+                kfunction = parasail_lookup_kfunction(funcname);
+                dfunction = parasail_lookup_dfunction(funcname);
             }
-            if (NULL == function && 0 == banded) {
+            if (NULL == function && NULL == kfunction && NULL == dfunction) {
                 eprintf(stderr, "Specified function not found.\n");
                 exit(EXIT_FAILURE);
             }
@@ -392,6 +397,13 @@ int main(int argc, char **argv) {
         exit(EXIT_FAILURE);
     }
 
+    /* with -E only the edges are written, so a plain sw stats function
+     * can leave the stats of pairs that fail OS uncomputed */
+    bool lazy_stats = edge_output && NULL != function
+        && NULL != strstr(funcname, "sw_stats")
+        && NULL == strstr(funcname, "table")
+        && NULL == strstr(funcname, "rowcol");
+
     /* select the substitution matrix */
     if (NULL == matrixname && use_dna) {
         matrixname = "ACGT";
@@ -430,6 +442,7 @@ int main(int argc, char **argv) {
             "%20s: %d\n"
             "%20s: %s\n"
             "%20s: %s\n"
+            "%20s: %s\n"
             "%20s: %s\n",
             "funcname", funcname,
             "cutoff", cutoff,
@@ -440,6 +453,7 @@ int main(int argc, char **argv) {
             "AOL", AOL,
             "SIM", SIM,
             "OS", OS,
+            "lazy stats", lazy_stats ? "yes" : "no",
             "file", fname,
             "query", (NULL == qname) ? "<no query>" : qname,
             "output", oname
@@ -863,10 +877,24 @@ int main(int argc, char **argv) {
                 long j_end = END[j];
                 long j_len = j_end-j_beg;
                 unsigned long local_work = i_len * j_len;
-                parasail_result_t *result = function(
-                        (const char*)&T[i_beg], i_len,
-                        (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend, matrix);
+                parasail_result_t *result = NULL;
+                if (lazy_stats) {
+                    /* the same self score the edge test below uses */
+                    int self_score_ = (i_len > j_len) ?
+                        self_score((const char*)&T[i_beg], i_len, matrix) :
+                        self_score((const char*)&T[j_beg], j_len, matrix);
+                    result = parasail_sw_stats_filtered(
+                            (const char*)&T[i_beg], i_len,
+                            (const char*)&T[j_beg], j_len,
+                            gap_open, gap_extend, matrix,
+                            (OS * self_score_ + 99) / 100);
+                }
+                else {
+                    result = function(
+                            (const char*)&T[i_beg], i_len,
+                            (const char*)&T[j_beg], j_len,
+                            gap_open, gap_extend, matrix);
+                }
 #ifdef USE_CILK
                 work += local_work;
 #else
@@ -880,7 +908,7 @@ int main(int argc, char **argv) {
         }
 #endif
     }
-    else if (banded) {
+    else if (kfunction || dfunction) {
 #ifdef USE_CILK
             cilk_for (size_t index=0; index<vpairs.size(); ++index)
 #else
@@ -899,10 +927,20 @@ int main(int argc, char **argv) {
                 long j_end = END[j];
                 long j_len = j_end-j_beg;
                 unsigned long local_work = i_len * j_len;
-                parasail_result_t *result = parasail_nw_banded(
-                        (const char*)&T[i_beg], i_len,
-                        (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend, kbandsize, matrix);
+                parasail_result_t *result = NULL;
+                if (kfunction) {
+                    result = kfunction(
+                            (const char*)&T[i_beg], i_len,
+                            (const char*)&T[j_beg], j_len,
+                            gap_open, gap_extend, kbandsize, matrix);
+                }
+                else {
+                    /* no seed positions are kept, so center on the main diagonal */
+                    result = dfunction(
+                            (const char*)&T[i_beg], i_len,
+                            (const char*)&T[j_beg], j_len,
+                            gap_open, gap_extend, 0, kbandsize, matrix);
+                }
 #ifdef USE_CILK
                 work += local_work;
 #else
@@ -922,6 +960,10 @@ int main(int argc, char **argv) {
 #else
 #pragma omp parallel
         {
+            parasail_workspace_t *workspace = NULL;
+            if (pwfunction) {
+                workspace = parasail_workspace_new();
+            }
 #pragma omp for schedule(guided)
             for (long long index=0; index<(long long)vpairs.size(); ++index)
 #endif
@@ -937,9 +979,23 @@ int main(int argc, char **argv) {
                     exit(EXIT_FAILURE);
                 }
                 unsigned long local_work = profile->s1Len * j_len;
+#ifdef USE_CILK
                 parasail_result_t *result = pfunction(
                         profile, (const char*)&T[j_beg], j_len,
                         gap_open, gap_extend);
+#else
+                parasail_result_t *result = NULL;
+                if (workspace) {
+                    result = pwfunction(
+                            profile, (const char*)&T[j_beg], j_len,
+                            gap_open, gap_extend, workspace);
+                }
+                else {
+                    result = pfunction(
+                            profile, (const char*)&T[j_beg], j_len,
+                            gap_open, gap_extend);
+                }
+#endif
 #ifdef USE_CILK
                 work += local_work;
 #else
@@ -950,6 +1006,9 @@ int main(int argc, char **argv) {
             }
 #ifdef USE_CILK
 #else
+            if (workspace) {
+                parasail_workspace_free(workspace);
+            }
         }
 #endif
     }
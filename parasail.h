@@ -8,6 +8,9 @@
 #ifndef _PARASAIL_H_
 #define _PARASAIL_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -30,6 +33,52 @@ extern "C" {
 #define PARASAIL_RESTRICT_REMOVED
 #endif
 
+/* Which recurrence produced a parasail_trace_t. */
+#define PARASAIL_TRACE_NW 0
+#define PARASAIL_TRACE_SG 1
+#define PARASAIL_TRACE_SW 2
+
+/* Packed direction bits of the *_trace functions, 4 bits per cell.
+ * Query position q of column j is held in lane q/segLen of vector
+ * q%segLen; plane p of that vector in lane t is bit (4*vector+p)*lanes+t
+ * of the words of column j. Plane 0 and 1 give the source of H (00
+ * diagonal, 01 E, 10 F, 11 zero i.e. local start), plane 2 and 3 tell
+ * whether E and F extend a gap rather than open one. The *_linear
+ * functions keep no bits but the alignment itself as ops, one per
+ * column of the alignment: 'M' aligns two letters, 'I' a query letter
+ * with a gap and 'D' a gap with a reference letter. The ops end at
+ * end_query and end_ref and leave out the free overhangs of sg. */
+typedef struct parasail_trace {
+    uint64_t *bits;
+    char *ops;      /* NUL-terminated, result->length long */
+    int lanes;      /* query positions per vector */
+    int segLen;     /* vectors per column */
+    int words;      /* 64-bit words per column */
+    int type;       /* PARASAIL_TRACE_* */
+} parasail_trace_t;
+
+/* Entry type of the *_table arrays of a result. Tables hold int unless
+ * narrow tables were requested with parasail_profile_set_narrow_tables,
+ * in which case the *_table pointers address entries of the kernel's
+ * width; read them with parasail_result_get_table_value. The unsigned
+ * types come from the 8 and 16 bit sw striped functions, whose scores
+ * use the full unsigned range. */
+#define PARASAIL_TABLE_INT 0
+#define PARASAIL_TABLE_INT16 1
+#define PARASAIL_TABLE_UINT16 2
+#define PARASAIL_TABLE_INT8 3
+#define PARASAIL_TABLE_UINT8 4
+
+/* Half-open rectangle of a DP table, query rows [query_begin,query_end)
+ * by reference columns [ref_begin,ref_end). An all zero window stands
+ * for the whole table. */
+typedef struct parasail_window {
+    int query_begin;
+    int query_end;
+    int ref_begin;
+    int ref_end;
+} parasail_window_t;
+
 typedef struct parasail_result {
     int saturated;  /* for the 8-bit functions, whether score overflowed and should be discarded */
     int score;      /* alignment score */
@@ -38,6 +87,10 @@ typedef struct parasail_result {
     int length;     /* length of the alignment */
     int end_query;  /* end position of query sequence */
     int end_ref;    /* end position of reference sequence */
+    int begin_query; /* begin position of query sequence, from *_find_begin or *_linear */
+    int begin_ref;  /* begin position of reference sequence */
+    int columns;    /* reference columns computed by functions that can stop early, else 0 */
+    int width;      /* bits of the kernel a *_sat function settled on, else 0 */
     int * restrict score_table;     /* DP table of scores */
     int * restrict matches_table;   /* DP table of exact match counts */
     int * restrict similar_table;   /* DP table of similar substitution counts */
@@ -50,6 +103,9 @@ typedef struct parasail_result {
     int * restrict matches_col;     /* last col of DP table of exact match counts */
     int * restrict similar_col;     /* last col of DP table of similar substitution counts */
     int * restrict length_col;      /* last col of DP table of lengths */
+    parasail_trace_t *trace;        /* direction bits of the *_trace functions */
+    int table_type;                 /* PARASAIL_TABLE_* entry type of the *_table arrays */
+    parasail_window_t window;       /* part of the DP table the *_table arrays hold */
 } parasail_result_t;
 
 typedef struct parasail_matrix {
@@ -78,11 +134,130 @@ typedef struct parasail_profile {
     struct parasail_profile_data profile64;
     void (*free)(void * profile);
     int stop;
+    int stop_mode;  /* PARASAIL_STOP_* flags, see parasail_profile_set_stop */
+    int stop_bound; /* best local score possible against s1 */
+    int *stop_gain; /* best score each database letter can add against s1 */
+    int xdrop;      /* see parasail_profile_set_xdrop */
+    int narrow_tables; /* see parasail_profile_set_narrow_tables */
+    parasail_window_t window; /* see parasail_profile_set_window */
+    int vector_bytes; /* size of the vectors in profile8 through profile64 */
+    int layout;       /* PARASAIL_LAYOUT_* order of the vectors */
+    void *file;       /* mapping behind a profile from parasail_profile_map */
+    /* builders of the widths a _sat profile leaves out of profile8
+     * through profile64 until first use, see parasail_profile_width */
+    struct parasail_profile* (*lazy_create[4])(
+            const char * const restrict s1, const int s1Len,
+            const parasail_matrix_t *matrix);
+    struct parasail_profile *lazy[4]; /* the widths built so far */
+    /* queries side by side in a profile from parasail_profile_create_packed,
+     * query q in lanes packed_begin[q] up to packed_begin[q+1] */
+    int packed_count;
+    int *packed_begin;
+    const char **packed_s1;
+    /* s1 and matrix over alphabet indices, built by the first
+     * parasail_align_encoded call on the profile */
+    void *encoded;
 } parasail_profile_t;
 
+/* order of a profile's vectors, which decides the functions that take it */
+#define PARASAIL_LAYOUT_SERIAL 0  /* no vectors */
+#define PARASAIL_LAYOUT_STRIPED 1 /* parasail_profile_create_*, striped and scan */
+#define PARASAIL_LAYOUT_BLOCKED 2 /* parasail_profile_create_blocked_* */
+#define PARASAIL_LAYOUT_PACKED 3  /* parasail_profile_create_packed_* */
+
 extern
 void parasail_profile_free(parasail_profile_t *profile);
 
+/* stop as soon as the score reaches the cutoff */
+#define PARASAIL_STOP_REACHED 1
+/* give up as soon as the cutoff can no longer be reached */
+#define PARASAIL_STOP_UNREACHABLE 2
+
+/** Set a score cutoff on profile for the sw scan and striped profile
+ * functions; the other functions ignore it. mode is a combination of
+ * the PARASAIL_STOP_* flags. When a function stops early, the
+ * returned score is still at least stop exactly when the full
+ * alignment would be, but the score, end locations and any tables
+ * only describe the columns computed so far. */
+extern
+void parasail_profile_set_stop(parasail_profile_t *profile, int stop, int mode);
+
+/** Set an X-drop limit on profile for the sg and sw scan and striped
+ * profile functions; the other functions ignore it. They stop after
+ * the first column whose cells all fall more than xdrop below the
+ * best cell computed so far, and report in result->columns how many
+ * columns they computed. The score, end locations and any tables then
+ * only describe those columns. INT32_MAX, the default, never stops. */
+extern
+void parasail_profile_set_xdrop(parasail_profile_t *profile, int xdrop);
+
+/** Ask the 16 and 8 bit scan and striped table profile functions to keep
+ * their tables in the kernel's width instead of int, see
+ * PARASAIL_TABLE_INT16 and friends; the other functions ignore it. */
+extern
+void parasail_profile_set_narrow_tables(parasail_profile_t *profile, int narrow);
+
+/** Ask the scan and striped table profile functions to keep only the
+ * cells of window in their tables, which are then (query_end-query_begin)
+ * rows of (ref_end-ref_begin) entries; the other functions ignore it.
+ * The window is clipped to the DP table and recorded in result->window.
+ * NULL restores whole tables. */
+extern
+void parasail_profile_set_window(parasail_profile_t *profile,
+        const parasail_window_t *window);
+
+/** Window of up to radius rows and columns on each side of the end
+ * location of result, clipped to an s1Len by s2Len table. */
+extern
+parasail_window_t parasail_window_around(const parasail_result_t *result,
+        int s1Len, int s2Len, int radius);
+
+/** The _sat profile creators only build the 8 bit profile; the wider
+ * ones are built the first time a _sat function needs them, once per
+ * profile even when threads share it. Returns profile if it holds the
+ * bits wide vectors already, else copy, a shallow copy of profile that
+ * holds them. Use it to pass a _sat profile to a 16 or 32 bit function. */
+extern
+const parasail_profile_t* parasail_profile_width(
+        const parasail_profile_t *profile, int bits,
+        parasail_profile_t *copy);
+
+/** Write profile, which must come from one of the parasail_profile_create
+ * functions other than the packed ones, to fname along with its query,
+ * its layout and a hash of its matrix.
+ * Returns 0, or -1 with errno set, EINVAL for a packed profile. */
+extern
+int parasail_profile_save(const parasail_profile_t *profile, const char *fname);
+
+/** Map a profile written by parasail_profile_save without copying it.
+ * Returns NULL with errno set to EINVAL unless matrix is the one the
+ * profile was built with, layout is the PARASAIL_LAYOUT_* of the
+ * functions the caller will pass it to, and this CPU runs the profile's
+ * vector width. The profile's own settings, such as a stop score, are
+ * not saved. parasail_profile_free unmaps it. */
+extern
+parasail_profile_t* parasail_profile_map(
+        const char *fname, const parasail_matrix_t *matrix, int layout);
+
+#define PARASAIL_WORKSPACE_SLOTS 16
+
+/* Scratch vectors reused across calls to the *_ws profile functions.
+ * Each slot grows on demand and is only released by
+ * parasail_workspace_free. A workspace must not be shared by threads
+ * that align concurrently; create one per thread instead. */
+typedef struct parasail_workspace {
+    void * slot[PARASAIL_WORKSPACE_SLOTS];
+    size_t size[PARASAIL_WORKSPACE_SLOTS];
+} parasail_workspace_t;
+
+/** Create an empty workspace. */
+extern
+parasail_workspace_t* parasail_workspace_new(void);
+
+/** Deallocate workspace and all of its slots. */
+extern
+void parasail_workspace_free(parasail_workspace_t *workspace);
+
 typedef parasail_result_t* parasail_function_t(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -109,13 +284,65 @@ typedef parasail_result_t* parasail_pfunction_t(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+typedef parasail_result_t** parasail_bfunction_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix);
+
+typedef parasail_result_t* parasail_kfunction_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix);
+
+typedef parasail_result_t* parasail_dfunction_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t *matrix);
+
+typedef parasail_result_t* parasail_pwfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
 typedef parasail_profile_t* parasail_pcreator_t(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix);
 
+/* The packed functions align several short queries against one
+ * database sequence in a single pass, returning one result per query
+ * for parasail_result_free_batch. A packed profile creator takes the
+ * leading queries of s1s that fit side by side in one vector and
+ * records how many in packed_count, or returns NULL if the first alone
+ * does not fit. The functions taking s1s align every query, a query
+ * longer than a vector on its own. The _sat profile functions take a
+ * profile from an 8 bit creator. */
+typedef parasail_result_t** parasail_mfunction_t(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix);
+
+typedef parasail_result_t** parasail_mpfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+typedef parasail_profile_t* parasail_mcreator_t(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix);
+
 typedef struct parasail_pfunction_info {
     parasail_pfunction_t * pointer;
     parasail_pcreator_t * creator;
+    parasail_pwfunction_t * wpointer;
     const char * name;
     const char * alg;
     const char * type;
@@ -129,6 +356,23 @@ typedef struct parasail_pfunction_info {
     char is_ref;
 } parasail_pfunction_info_t;
 
+/* banded functions use exactly one of kpointer or dpointer */
+typedef struct parasail_kfunction_info {
+    parasail_kfunction_t * kpointer;
+    parasail_dfunction_t * dpointer;
+    const char * name;
+    const char * alg;
+    const char * type;
+    const char * isa;
+    const char * bits;
+    const char * width;
+    int lanes;
+    char is_table;
+    char is_rowcol;
+    char is_stats;
+    char is_ref;
+} parasail_kfunction_info_t;
+
 /* Run-time API version detection */
 extern
 void parasail_version(int *major, int *minor, int *patch);
@@ -137,6 +381,18 @@ void parasail_version(int *major, int *minor, int *patch);
 extern
 void parasail_result_free(parasail_result_t *result);
 
+/** Value at row i, column j of table, one of the *_table arrays of
+ * result, for a database sequence of length s2Len. Narrow tables are
+ * widened to int. For windowed tables i and j still index the whole
+ * DP table and cells outside the window read as 0. */
+extern
+int parasail_result_get_table_value(const parasail_result_t *result,
+        const int *table, int s2Len, int i, int j);
+
+/** Deallocate each result of a batch and the array holding them. */
+extern
+void parasail_result_free_batch(parasail_result_t **results, const int count);
+
 /** Lookup function by name. */
 extern
 parasail_function_t * parasail_lookup_function(const char *funcname);
@@ -145,6 +401,10 @@ parasail_function_t * parasail_lookup_function(const char *funcname);
 extern
 parasail_pfunction_t * parasail_lookup_pfunction(const char *funcname);
 
+/** Lookup workspace variant of pfunction by name. */
+extern
+parasail_pwfunction_t * parasail_lookup_pwfunction(const char *funcname);
+
 /** Lookup pcreator by name. */
 extern
 parasail_pcreator_t * parasail_lookup_pcreator(const char *funcname);
@@ -157,6 +417,69 @@ const parasail_function_info_t * parasail_lookup_function_info(const char *funcn
 extern
 const parasail_pfunction_info_t * parasail_lookup_pfunction_info(const char *funcname);
 
+/** Lookup banded global function by name. */
+extern
+parasail_kfunction_t * parasail_lookup_kfunction(const char *funcname);
+
+/** Lookup banded local or semi-global function by name. */
+extern
+parasail_dfunction_t * parasail_lookup_dfunction(const char *funcname);
+
+/** Lookup banded function info by name. */
+extern
+const parasail_kfunction_info_t * parasail_lookup_kfunction_info(const char *funcname);
+
+/** Time the score-only striped, scan, diag, blocked and short
+ * dispatchers of nw, sg and sw, at the widths that never saturate, on
+ * queries of representative lengths with the given gap penalties and
+ * matrix, and keep the fastest for each range of query lengths as the
+ * table behind parasail_{nw,sg,sw}_auto. The table is also saved to
+ * the cache file path under the CPU model, instruction set, matrix name
+ * and gap penalties, replacing an earlier table for them. A NULL path
+ * means PARASAIL_AUTOTUNE_CACHE from the environment, or else
+ * .parasail_autotune in the home directory. Takes about a second and
+ * is safe to call while other threads align. Returns 0, or -1 when
+ * tuning ran out of memory or the cache file could not be written. */
+extern
+int parasail_autotune(
+        const char *path,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Name of the function parasail_{nw,sg,sw}_auto runs for a query of
+ * s1Len, alg one of "nw", "sg" or "sw"; NULL before the table is
+ * tuned, or set by the first call to an auto function. */
+extern
+const char* parasail_autotune_choice(const char *alg, const int s1Len);
+
+/** Global alignment by the function the autotune table picks for the
+ * query length. The auto functions never tune on their own. Without a
+ * table, the first call loads the one cached in the default file for
+ * this CPU and the gap penalties and matrix of that call, or else runs
+ * the _striped_sat dispatchers until parasail_autotune is called. */
+extern
+parasail_result_t* parasail_nw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Semi-global alignment by the function the autotune table picks. */
+extern
+parasail_result_t* parasail_sg_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Local alignment by the function the autotune table picks. */
+extern
+parasail_result_t* parasail_sw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 /** Current time in seconds with nanosecond resolution. */
 extern
 double parasail_time(void);
@@ -193,6 +516,292 @@ parasail_result_t* parasail_nw_banded(
         const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
+extern
+parasail_result_t* parasail_nw_banded_table(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_rowcol(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+/** Semi-global alignment restricted to the band of cells (i,j) with
+ * |(j-i)-diag| <= k, i.e. centered on the diagonal starting at s2[diag]
+ * (or s1[-diag] when diag is negative). Cells outside of the band are
+ * never part of the alignment and are reported as 0 in tables. */
+extern
+parasail_result_t* parasail_sg_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_banded_table(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_banded_rowcol(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+/** Local alignment restricted to the band of cells (i,j) with
+ * |(j-i)-diag| <= k, i.e. centered on the diagonal starting at s2[diag]
+ * (or s1[-diag] when diag is negative). Cells outside of the band are
+ * never part of the alignment and are reported as 0 in tables. */
+extern
+parasail_result_t* parasail_sw_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_banded_table(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_banded_rowcol(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+/** Global alignment that also keeps the packed directions needed to
+ * recover the alignment, see parasail_result_get_traceback. */
+extern
+parasail_result_t* parasail_nw_trace(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Semi-global alignment that also keeps the packed directions. */
+extern
+parasail_result_t* parasail_sg_trace(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Local alignment that also keeps the packed directions. */
+extern
+parasail_result_t* parasail_sw_trace(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Global alignment in linear space, built on the rowcol kernels.
+ * Keeps the alignment as ops, see parasail_result_get_traceback. */
+extern
+parasail_result_t* parasail_nw_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Semi-global alignment in linear space. */
+extern
+parasail_result_t* parasail_sg_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Local alignment in linear space. */
+extern
+parasail_result_t* parasail_sw_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Fill result->begin_query and result->begin_ref of a semi-global
+ * result, the first query and reference positions of its alignment, by
+ * aligning the reversed prefixes that end at end_query and end_ref.
+ * The cost is that of the prefixes, not of a table function. A begin
+ * past the end means the alignment is all gap in that sequence. */
+extern
+void parasail_sg_find_begin(
+        parasail_result_t * const restrict result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Same for a local result. Results with no alignment keep 0. */
+extern
+void parasail_sw_find_begin(
+        parasail_result_t * const restrict result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/** Local alignment whose matches, similar and length are only computed
+ * when the score reaches min_score, and then only over the region of
+ * the alignment, found by a reverse pass. Below min_score they are 0. */
+extern
+parasail_result_t* parasail_sw_stats_filtered(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix,
+        const int min_score);
+
+/* Aligned sequences, gaps are '-'. comp holds the match character
+ * for identical letters, pos for other positive substitutions, neg
+ * for the remaining substitutions and ' ' across from a gap. */
+typedef struct parasail_traceback {
+    char *query;
+    char *comp;
+    char *ref;
+} parasail_traceback_t;
+
+/** Recover the alignment of a *_trace or *_linear result from the
+ * sequences and matrix it was computed with. Returns NULL if result
+ * has no trace or saturated. */
+extern
+parasail_traceback_t* parasail_result_get_traceback(
+        const parasail_result_t * const restrict result,
+        const char * const restrict seqA, const int lena,
+        const char * const restrict seqB, const int lenb,
+        const parasail_matrix_t *matrix,
+        char match, char pos, char neg);
+
+/** Deallocate traceback. */
+extern
+void parasail_traceback_free(parasail_traceback_t *traceback);
+
+/* Run-length encoded alignment in the BAM encoding, length<<4|op where
+ * op indexes "MIDNSHP=X". Only '=', 'X', 'I' and 'D' are produced. The
+ * alignment spans beg_query..end_query and beg_ref..end_ref, the free
+ * overhangs of sg are not part of it. */
+typedef struct parasail_cigar {
+    uint32_t *seq;
+    int len;
+    int beg_query;
+    int beg_ref;
+    int end_query;
+    int end_ref;
+} parasail_cigar_t;
+
+/** Run-length encoded alignment of a *_trace or *_linear result.
+ * Returns NULL if result has no trace or saturated. */
+extern
+parasail_cigar_t* parasail_result_get_cigar(
+        const parasail_result_t * const restrict result,
+        const char * const restrict seqA, const int lena,
+        const char * const restrict seqB, const int lenb);
+
+/** Deallocate cigar. */
+extern
+void parasail_cigar_free(parasail_cigar_t *cigar);
+
+/** Op character of one encoded cigar element. */
+extern
+char parasail_cigar_decode_op(uint32_t cigar_int);
+
+/** Length of one encoded cigar element. */
+extern
+uint32_t parasail_cigar_decode_len(uint32_t cigar_int);
+
+/** SAM text of cigar, e.g. "3=1X2I". Caller frees. */
+extern
+char* parasail_cigar_decode(const parasail_cigar_t *cigar);
+
+/* Database of sequences already mapped through a matrix's mapper to
+ * alphabet indices. The encoded form is one contiguous blob, a header,
+ * count+1 offsets and the residues, which parasail_db_save writes
+ * as is and parasail_db_map maps back without copying. */
+typedef struct parasail_db {
+    const void *blob;           /* header, offsets and residues */
+    size_t size;                /* bytes in blob */
+    uint64_t count;             /* number of sequences */
+    const uint64_t *offsets;    /* sequence i is residues[offsets[i],offsets[i+1]) */
+    const uint8_t *residues;    /* matrix indices, not letters */
+    const uint8_t *mapper;      /* letter to index map used to encode */
+    void *file;                 /* parasail_file_t of a mapped database */
+} parasail_db_t;
+
+/** Encode count sequences through matrix->mapper. */
+extern
+parasail_db_t* parasail_db_create(
+        const char * const * const restrict seqs,
+        const int * const restrict lens, const int count,
+        const parasail_matrix_t *matrix);
+
+/** Write the blob of db to fname. Returns 0, or -1 with errno set. */
+extern
+int parasail_db_save(const parasail_db_t *db, const char *fname);
+
+/** Map a database written by parasail_db_save. Returns NULL with errno
+ * set to EINVAL if fname does not hold a whole database with offsets
+ * that climb from 0 to its number of residues. */
+extern
+parasail_db_t* parasail_db_map(const char *fname);
+
+/** Deallocate or unmap db. */
+extern
+void parasail_db_free(parasail_db_t *db);
+
+/** Encoded residues of sequence i of db. */
+extern
+const uint8_t* parasail_db_sequence(const parasail_db_t *db, uint64_t i);
+
+/** Length of sequence i of db. */
+extern
+int parasail_db_length(const parasail_db_t *db, uint64_t i);
+
+/** Whether db was encoded with matrix's mapper and all of its residues
+ * are rows of matrix. Check once before aligning the sequences of db
+ * with profiles of matrix, in particular for a mapped file. */
+extern
+int parasail_db_matches(const parasail_db_t *db,
+        const parasail_matrix_t *matrix);
+
+/** Run any profile function on s2, a sequence already encoded for
+ * profile's matrix, e.g. one from a parasail_db_t that
+ * parasail_db_matches the matrix. The function sees the matrix with an
+ * identity mapper and an encoded s1, both kept on the profile after
+ * the first call, so a call allocates nothing of its own. Widths a _sat
+ * function builds are kept on the profile as well. */
+extern
+parasail_result_t* parasail_align_encoded(
+        parasail_pfunction_t *pfunction,
+        const parasail_profile_t * const restrict profile,
+        const uint8_t * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+/** Same, for the _ws variants of the profile functions. */
+extern
+parasail_result_t* parasail_align_encoded_ws(
+        parasail_pwfunction_t *pwfunction,
+        const parasail_profile_t * const restrict profile,
+        const uint8_t * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
 /* The following function signatures were generated by the 'names.py'
  * script located in the 'util' directory of the main distribution. */
 
@@ -9955,3555 +10564,13388 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_knc_512_32(
         const int open, const int gap);
 
 extern
-parasail_result_t* parasail_sw_blocked_sse41_128_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_blocked_sse41_128_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_profile_64(
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_profile_32(
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_profile_16(
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_profile_8(
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_scan_profile_sat(
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_profile_64(
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_profile_32(
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_profile_16(
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_profile_8(
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_striped_profile_sat(
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_profile_64(
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_profile_32(
+parasail_result_t* parasail_sg_rowcol_striped_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_profile_16(
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_profile_8(
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_profile_64(
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_profile_32(
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_profile_16(
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_profile_8(
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_table_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_profile_64(
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_profile_32(
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_profile_16(
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_profile_8(
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_profile_64(
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_profile_32(
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_profile_16(
+parasail_result_t* parasail_sg_stats_scan_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_profile_8(
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_profile_64(
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_profile_32(
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_profile_16(
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_profile_8(
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_profile_64(
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_profile_32(
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_profile_16(
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_profile_8(
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_profile_64(
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_profile_32(
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_profile_16(
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_profile_8(
+parasail_result_t* parasail_sg_stats_striped_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_profile_64(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_profile_32(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_profile_16(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_profile_8(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64(
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32(
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16(
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8(
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_profile_64(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_profile_32(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_profile_16(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_profile_8(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_profile_64(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_profile_32(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_profile_16(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_profile_8(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_profile_64(
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_profile_32(
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_profile_16(
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_profile_8(
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_profile_64(
+parasail_result_t* parasail_sg_stats_table_striped_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_profile_32(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_profile_16(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_profile_8(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_table_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_profile_64(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_profile_32(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_profile_16(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_profile_8(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_profile_64(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_profile_32(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_profile_16(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_profile_8(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_profile_64(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_profile_32(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_profile_16(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_profile_8(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_profile_64(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_profile_32(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_profile_16(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_profile_8(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_profile_64(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_profile_32(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_profile_16(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_profile_8(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_profile_64(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_profile_32(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_profile_16(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_profile_8(
+parasail_result_t* parasail_sw_scan_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
+parasail_result_t* parasail_sw_scan_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_64(
+parasail_result_t* parasail_sw_scan_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_32(
+parasail_result_t* parasail_sw_scan_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_16(
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_8(
+parasail_result_t* parasail_sw_scan_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
+parasail_result_t* parasail_sw_scan_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_64(
+parasail_result_t* parasail_sw_scan_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_32(
+parasail_result_t* parasail_sw_scan_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_16(
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_8(
+parasail_result_t* parasail_sw_scan_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sw_scan_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_profile_64(
+parasail_result_t* parasail_sw_scan_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_profile_32(
+parasail_result_t* parasail_sw_scan_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_profile_16(
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_profile_8(
+parasail_result_t* parasail_sw_scan_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_scan_profile_sat(
+parasail_result_t* parasail_sw_striped_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_profile_64(
+parasail_result_t* parasail_sw_striped_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_profile_32(
+parasail_result_t* parasail_sw_striped_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_profile_16(
+parasail_result_t* parasail_sw_striped_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_profile_8(
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_striped_profile_sat(
+parasail_result_t* parasail_sw_striped_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_profile_64(
+parasail_result_t* parasail_sw_striped_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_profile_32(
+parasail_result_t* parasail_sw_striped_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_profile_16(
+parasail_result_t* parasail_sw_striped_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_profile_8(
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_scan_profile_sat(
+parasail_result_t* parasail_sw_striped_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_profile_64(
+parasail_result_t* parasail_sw_striped_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_profile_32(
+parasail_result_t* parasail_sw_striped_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_profile_16(
+parasail_result_t* parasail_sw_striped_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_profile_8(
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_table_striped_profile_sat(
+parasail_result_t* parasail_sw_striped_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_profile_64(
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_profile_32(
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_profile_16(
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_profile_8(
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_profile_64(
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_profile_32(
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_profile_16(
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_profile_8(
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_profile_64(
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_profile_32(
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_profile_16(
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_profile_8(
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_profile_sat(
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_profile_64(
+parasail_result_t* parasail_sw_table_scan_profile_knc_512_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_profile_32(
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_profile_16(
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_profile_8(
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_profile_sat(
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_profile_64(
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_profile_32(
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_64_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_profile_16(
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace);
+
+extern
+parasail_profile_t* parasail_profile_create_sse_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_sse_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_sse_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_avx_256_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_avx_256_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_avx_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_knc_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_knc_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_stats_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_blocked_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_blocked_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_blocked_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_blocked_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_packed_sse_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_packed_sse_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_packed_avx_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_packed_avx_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_packed_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_profile_t* parasail_profile_create_packed_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_swipe_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_swipe_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_swipe_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_sse41_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_sse41_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_avx2_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_avx2_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_nw_packed_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_nw_packed_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_sse41_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_sse41_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_avx2_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_avx2_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sg_packed_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sg_packed_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_sse41_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_sse41_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_avx2_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_avx2_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t** parasail_sw_packed_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t** parasail_sw_packed_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_table_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
+
+extern
+parasail_result_t* parasail_sg_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_table_banded_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_sse_128_64(
+parasail_result_t* parasail_sg_table_banded_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_sse_128_32(
+parasail_result_t* parasail_sg_table_banded_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_sse_128_16(
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_sse_128_8(
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_sse_128_sat(
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_avx_256_64(
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_avx_256_32(
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_avx_256_16(
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_avx_256_8(
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_avx_256_sat(
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_knc_512_32(
+parasail_result_t* parasail_sg_rowcol_banded_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_64(
+parasail_result_t* parasail_sg_rowcol_banded_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_32(
+parasail_result_t* parasail_sg_rowcol_banded_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_16(
+parasail_result_t* parasail_sg_rowcol_banded_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_8(
+parasail_result_t* parasail_sw_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_sat(
+parasail_result_t* parasail_sw_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_64(
+parasail_result_t* parasail_sw_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_32(
+parasail_result_t* parasail_sw_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_16(
+parasail_result_t* parasail_sw_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_8(
+parasail_result_t* parasail_sw_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
+parasail_result_t* parasail_sw_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_64(
+parasail_result_t* parasail_sw_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_32(
+parasail_result_t* parasail_sw_banded_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_16(
+parasail_result_t* parasail_sw_banded_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_8(
+parasail_result_t* parasail_sw_banded_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
+parasail_result_t* parasail_sw_banded_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_knc_512_32(
+parasail_result_t* parasail_sw_table_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_64(
+parasail_result_t* parasail_sw_table_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_32(
+parasail_result_t* parasail_sw_table_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_16(
+parasail_result_t* parasail_sw_table_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_8(
+parasail_result_t* parasail_sw_table_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_profile_t* parasail_profile_create_stats_sat(
+parasail_result_t* parasail_sw_table_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_scan_sat(
+parasail_result_t* parasail_sw_table_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_striped_sat(
+parasail_result_t* parasail_sw_table_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_diag_sat(
+parasail_result_t* parasail_sw_table_banded_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_table_scan_sat(
+parasail_result_t* parasail_sw_table_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_table_striped_sat(
+parasail_result_t* parasail_sw_table_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_table_diag_sat(
+parasail_result_t* parasail_sw_table_banded_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_rowcol_scan_sat(
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_rowcol_striped_sat(
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_rowcol_diag_sat(
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_scan_sat(
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_striped_sat(
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_diag_sat(
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_table_scan_sat(
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_table_striped_sat(
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_table_diag_sat(
+parasail_result_t* parasail_sw_rowcol_banded_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
+parasail_result_t* parasail_sw_rowcol_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
+parasail_result_t* parasail_sw_rowcol_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
+parasail_result_t* parasail_sw_rowcol_banded_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
+        const int diag, const int k,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_scan_sat(
+parasail_result_t* parasail_nw_trace_scan_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_striped_sat(
+parasail_result_t* parasail_nw_trace_scan_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_diag_sat(
+parasail_result_t* parasail_nw_trace_scan_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_table_scan_sat(
+parasail_result_t* parasail_nw_trace_scan_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_table_striped_sat(
+parasail_result_t* parasail_nw_trace_scan_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_table_diag_sat(
+parasail_result_t* parasail_nw_trace_scan_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_rowcol_scan_sat(
+parasail_result_t* parasail_nw_trace_scan_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_rowcol_striped_sat(
+parasail_result_t* parasail_nw_trace_scan_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_rowcol_diag_sat(
+parasail_result_t* parasail_nw_trace_scan_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_scan_sat(
+parasail_result_t* parasail_nw_trace_scan_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_striped_sat(
+parasail_result_t* parasail_nw_trace_scan_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_diag_sat(
+parasail_result_t* parasail_nw_trace_scan_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_table_scan_sat(
+parasail_result_t* parasail_sg_trace_scan_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_table_striped_sat(
+parasail_result_t* parasail_sg_trace_scan_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_table_diag_sat(
+parasail_result_t* parasail_sg_trace_scan_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
+parasail_result_t* parasail_sg_trace_scan_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
+parasail_result_t* parasail_sg_trace_scan_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
+parasail_result_t* parasail_sg_trace_scan_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_scan_sat(
+parasail_result_t* parasail_sg_trace_scan_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_striped_sat(
+parasail_result_t* parasail_sg_trace_scan_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_diag_sat(
+parasail_result_t* parasail_sg_trace_scan_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_table_scan_sat(
+parasail_result_t* parasail_sg_trace_scan_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_table_striped_sat(
+parasail_result_t* parasail_sg_trace_scan_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_table_diag_sat(
+parasail_result_t* parasail_sg_trace_scan_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_rowcol_scan_sat(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_rowcol_striped_sat(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_rowcol_diag_sat(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_scan_sat(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_striped_sat(
+parasail_result_t* parasail_sw_trace_scan_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_diag_sat(
+parasail_result_t* parasail_sw_trace_scan_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_scan_sat(
+parasail_result_t* parasail_sw_trace_scan_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_striped_sat(
+parasail_result_t* parasail_sw_trace_scan_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_table_diag_sat(
+parasail_result_t* parasail_sw_trace_scan_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
+parasail_result_t* parasail_sw_trace_scan_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
+parasail_result_t* parasail_sw_trace_scan_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
 extern
-parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
+parasail_result_t* parasail_sw_trace_scan_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
-
 /* END GENERATED NAMES */
 
 #ifdef __cplusplus
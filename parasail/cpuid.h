@@ -21,6 +21,9 @@ extern int parasail_can_use_avx2();
 extern int parasail_can_use_sse41();
 extern int parasail_can_use_sse2();
 
+/* processor brand string, or "unknown" */
+extern const char* parasail_cpu_model();
+
 #ifdef __cplusplus
 }
 #endif
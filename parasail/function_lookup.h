@@ -50,6 +50,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_sse41_128_16,       "parasail_nw_diag_sse41_128_16",       "nw",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0},
 {parasail_nw_diag_sse41_128_8,        "parasail_nw_diag_sse41_128_8",        "nw",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 {parasail_nw_diag_sse41_128_sat,      "parasail_nw_diag_sse41_128_sat",      "nw",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_nw_blocked_sse41_128_32,    "parasail_nw_blocked_sse41_128_32",    "nw", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_blocked_sse41_128_16,    "parasail_nw_blocked_sse41_128_16",    "nw", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_short_sse41_128_32,      "parasail_nw_short_sse41_128_32",      "nw",   "short", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_short_sse41_128_16,      "parasail_nw_short_sse41_128_16",      "nw",   "short", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_short_sse41_128_8,       "parasail_nw_short_sse41_128_8",       "nw",   "short", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_nw_scan_avx2_256_64,        "parasail_nw_scan_avx2_256_64",        "nw",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0},
@@ -67,6 +72,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_avx2_256_16,        "parasail_nw_diag_avx2_256_16",        "nw",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0},
 {parasail_nw_diag_avx2_256_8,         "parasail_nw_diag_avx2_256_8",         "nw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 {parasail_nw_diag_avx2_256_sat,       "parasail_nw_diag_avx2_256_sat",       "nw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_nw_blocked_avx2_256_32,     "parasail_nw_blocked_avx2_256_32",     "nw", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_blocked_avx2_256_16,     "parasail_nw_blocked_avx2_256_16",     "nw", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_short_avx2_256_32,       "parasail_nw_short_avx2_256_32",       "nw",   "short", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_short_avx2_256_16,       "parasail_nw_short_avx2_256_16",       "nw",   "short", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_short_avx2_256_8,        "parasail_nw_short_avx2_256_8",        "nw",   "short", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_nw_scan_knc_512_32,         "parasail_nw_scan_knc_512_32",         "nw",    "scan", "knc",   "512", "32", 16, 0, 0, 0, 0},
@@ -88,6 +98,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_16,                 "parasail_nw_diag_16",                 "nw",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0},
 {parasail_nw_diag_8,                  "parasail_nw_diag_8",                  "nw",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 {parasail_nw_diag_sat,                "parasail_nw_diag_sat",                "nw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_nw_blocked_32,              "parasail_nw_blocked_32",              "nw", "blocked", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_blocked_16,              "parasail_nw_blocked_16",              "nw", "blocked", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_short_32,                "parasail_nw_short_32",                "nw",   "short", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_short_16,                "parasail_nw_short_16",                "nw",   "short", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_short_8,                 "parasail_nw_short_8",                 "nw",   "short", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 {parasail_sg,                         "parasail_sg",                         "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1},
 {parasail_sg_scan,                    "parasail_sg_scan",                    "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -123,6 +138,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_sse41_128_16,       "parasail_sg_diag_sse41_128_16",       "sg",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0},
 {parasail_sg_diag_sse41_128_8,        "parasail_sg_diag_sse41_128_8",        "sg",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 {parasail_sg_diag_sse41_128_sat,      "parasail_sg_diag_sse41_128_sat",      "sg",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sg_blocked_sse41_128_32,    "parasail_sg_blocked_sse41_128_32",    "sg", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_blocked_sse41_128_16,    "parasail_sg_blocked_sse41_128_16",    "sg", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_short_sse41_128_32,      "parasail_sg_short_sse41_128_32",      "sg",   "short", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_short_sse41_128_16,      "parasail_sg_short_sse41_128_16",      "sg",   "short", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_short_sse41_128_8,       "parasail_sg_short_sse41_128_8",       "sg",   "short", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sg_scan_avx2_256_64,        "parasail_sg_scan_avx2_256_64",        "sg",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0},
@@ -140,6 +160,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_avx2_256_16,        "parasail_sg_diag_avx2_256_16",        "sg",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0},
 {parasail_sg_diag_avx2_256_8,         "parasail_sg_diag_avx2_256_8",         "sg",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 {parasail_sg_diag_avx2_256_sat,       "parasail_sg_diag_avx2_256_sat",       "sg",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sg_blocked_avx2_256_32,     "parasail_sg_blocked_avx2_256_32",     "sg", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sg_blocked_avx2_256_16,     "parasail_sg_blocked_avx2_256_16",     "sg", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sg_short_avx2_256_32,       "parasail_sg_short_avx2_256_32",       "sg",   "short", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sg_short_avx2_256_16,       "parasail_sg_short_avx2_256_16",       "sg",   "short", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sg_short_avx2_256_8,        "parasail_sg_short_avx2_256_8",        "sg",   "short", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_sg_scan_knc_512_32,         "parasail_sg_scan_knc_512_32",         "sg",    "scan", "knc",   "512", "32", 16, 0, 0, 0, 0},
@@ -161,6 +186,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_16,                 "parasail_sg_diag_16",                 "sg",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0},
 {parasail_sg_diag_8,                  "parasail_sg_diag_8",                  "sg",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 {parasail_sg_diag_sat,                "parasail_sg_diag_sat",                "sg",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sg_blocked_32,              "parasail_sg_blocked_32",              "sg", "blocked", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sg_blocked_16,              "parasail_sg_blocked_16",              "sg", "blocked", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sg_short_32,                "parasail_sg_short_32",                "sg",   "short", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sg_short_16,                "parasail_sg_short_16",                "sg",   "short", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sg_short_8,                 "parasail_sg_short_8",                 "sg",   "short", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 {parasail_sw,                         "parasail_sw",                         "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1},
 {parasail_sw_scan,                    "parasail_sw_scan",                    "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -198,6 +228,9 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_sse41_128_sat,      "parasail_sw_diag_sse41_128_sat",      "sw",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0},
 {parasail_sw_blocked_sse41_128_32,    "parasail_sw_blocked_sse41_128_32",    "sw", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0},
 {parasail_sw_blocked_sse41_128_16,    "parasail_sw_blocked_sse41_128_16",    "sw", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_short_sse41_128_32,      "parasail_sw_short_sse41_128_32",      "sw",   "short", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_short_sse41_128_16,      "parasail_sw_short_sse41_128_16",      "sw",   "short", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_short_sse41_128_8,       "parasail_sw_short_sse41_128_8",       "sw",   "short", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sw_scan_avx2_256_64,        "parasail_sw_scan_avx2_256_64",        "sw",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0},
@@ -215,6 +248,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_avx2_256_16,        "parasail_sw_diag_avx2_256_16",        "sw",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0},
 {parasail_sw_diag_avx2_256_8,         "parasail_sw_diag_avx2_256_8",         "sw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 {parasail_sw_diag_avx2_256_sat,       "parasail_sw_diag_avx2_256_sat",       "sw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sw_blocked_avx2_256_32,     "parasail_sw_blocked_avx2_256_32",     "sw", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sw_blocked_avx2_256_16,     "parasail_sw_blocked_avx2_256_16",     "sw", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sw_short_avx2_256_32,       "parasail_sw_short_avx2_256_32",       "sw",   "short", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sw_short_avx2_256_16,       "parasail_sw_short_avx2_256_16",       "sw",   "short", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sw_short_avx2_256_8,        "parasail_sw_short_avx2_256_8",        "sw",   "short", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_sw_scan_knc_512_32,         "parasail_sw_scan_knc_512_32",         "sw",    "scan", "knc",   "512", "32", 16, 0, 0, 0, 0},
@@ -236,6 +274,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_16,                 "parasail_sw_diag_16",                 "sw",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0},
 {parasail_sw_diag_8,                  "parasail_sw_diag_8",                  "sw",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 {parasail_sw_diag_sat,                "parasail_sw_diag_sat",                "sw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sw_blocked_32,              "parasail_sw_blocked_32",              "sw", "blocked", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sw_blocked_16,              "parasail_sw_blocked_16",              "sw", "blocked", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sw_short_32,                "parasail_sw_short_32",                "sw",   "short", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sw_short_16,                "parasail_sw_short_16",                "sw",   "short", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sw_short_8,                 "parasail_sw_short_8",                 "sw",   "short", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 {parasail_nw_stats,                   "parasail_nw_stats",                   "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 1},
 {parasail_nw_stats_scan,              "parasail_nw_stats_scan",              "nw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0},
 #if HAVE_SSE2
@@ -490,6 +533,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_table_diag_sse41_128_16, "parasail_nw_table_diag_sse41_128_16", "nw",    "diag", "sse41", "128", "16",  8, 1, 0, 0, 0},
 {parasail_nw_table_diag_sse41_128_8,  "parasail_nw_table_diag_sse41_128_8",  "nw",    "diag", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 {parasail_nw_table_diag_sse41_128_sat, "parasail_nw_table_diag_sse41_128_sat", "nw",    "diag", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_nw_table_blocked_sse41_128_32, "parasail_nw_table_blocked_sse41_128_32", "nw", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_blocked_sse41_128_16, "parasail_nw_table_blocked_sse41_128_16", "nw", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_short_sse41_128_32, "parasail_nw_table_short_sse41_128_32", "nw",   "short", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_short_sse41_128_16, "parasail_nw_table_short_sse41_128_16", "nw",   "short", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_short_sse41_128_8, "parasail_nw_table_short_sse41_128_8", "nw",   "short", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_nw_table_scan_avx2_256_64,  "parasail_nw_table_scan_avx2_256_64",  "nw",    "scan", "avx2",  "256", "64",  4, 1, 0, 0, 0},
@@ -507,6 +555,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_table_diag_avx2_256_16,  "parasail_nw_table_diag_avx2_256_16",  "nw",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0},
 {parasail_nw_table_diag_avx2_256_8,   "parasail_nw_table_diag_avx2_256_8",   "nw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 {parasail_nw_table_diag_avx2_256_sat, "parasail_nw_table_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_nw_table_blocked_avx2_256_32, "parasail_nw_table_blocked_avx2_256_32", "nw", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_nw_table_blocked_avx2_256_16, "parasail_nw_table_blocked_avx2_256_16", "nw", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_nw_table_short_avx2_256_32, "parasail_nw_table_short_avx2_256_32", "nw",   "short", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_nw_table_short_avx2_256_16, "parasail_nw_table_short_avx2_256_16", "nw",   "short", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_nw_table_short_avx2_256_8,  "parasail_nw_table_short_avx2_256_8",  "nw",   "short", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_nw_table_scan_knc_512_32,   "parasail_nw_table_scan_knc_512_32",   "nw",    "scan", "knc",   "512", "32", 16, 1, 0, 0, 0},
@@ -528,6 +581,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_table_diag_16,           "parasail_nw_table_diag_16",           "nw",    "diag", "disp",   "NA", "16", -1, 1, 0, 0, 0},
 {parasail_nw_table_diag_8,            "parasail_nw_table_diag_8",            "nw",    "diag", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 {parasail_nw_table_diag_sat,          "parasail_nw_table_diag_sat",          "nw",    "diag", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_nw_table_blocked_32,        "parasail_nw_table_blocked_32",        "nw", "blocked", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_nw_table_blocked_16,        "parasail_nw_table_blocked_16",        "nw", "blocked", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_nw_table_short_32,          "parasail_nw_table_short_32",          "nw",   "short", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_nw_table_short_16,          "parasail_nw_table_short_16",          "nw",   "short", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_nw_table_short_8,           "parasail_nw_table_short_8",           "nw",   "short", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 {parasail_sg_table,                   "parasail_sg_table",                   "sg",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1},
 {parasail_sg_table_scan,              "parasail_sg_table_scan",              "sg",    "scan", "NA",     "32", "32",  1, 1, 0, 0, 0},
 #if HAVE_SSE2
@@ -563,6 +621,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_table_diag_sse41_128_16, "parasail_sg_table_diag_sse41_128_16", "sg",    "diag", "sse41", "128", "16",  8, 1, 0, 0, 0},
 {parasail_sg_table_diag_sse41_128_8,  "parasail_sg_table_diag_sse41_128_8",  "sg",    "diag", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 {parasail_sg_table_diag_sse41_128_sat, "parasail_sg_table_diag_sse41_128_sat", "sg",    "diag", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sg_table_blocked_sse41_128_32, "parasail_sg_table_blocked_sse41_128_32", "sg", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_blocked_sse41_128_16, "parasail_sg_table_blocked_sse41_128_16", "sg", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_short_sse41_128_32, "parasail_sg_table_short_sse41_128_32", "sg",   "short", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_short_sse41_128_16, "parasail_sg_table_short_sse41_128_16", "sg",   "short", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_short_sse41_128_8, "parasail_sg_table_short_sse41_128_8", "sg",   "short", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sg_table_scan_avx2_256_64,  "parasail_sg_table_scan_avx2_256_64",  "sg",    "scan", "avx2",  "256", "64",  4, 1, 0, 0, 0},
@@ -580,6 +643,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_table_diag_avx2_256_16,  "parasail_sg_table_diag_avx2_256_16",  "sg",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0},
 {parasail_sg_table_diag_avx2_256_8,   "parasail_sg_table_diag_avx2_256_8",   "sg",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 {parasail_sg_table_diag_avx2_256_sat, "parasail_sg_table_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sg_table_blocked_avx2_256_32, "parasail_sg_table_blocked_avx2_256_32", "sg", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sg_table_blocked_avx2_256_16, "parasail_sg_table_blocked_avx2_256_16", "sg", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sg_table_short_avx2_256_32, "parasail_sg_table_short_avx2_256_32", "sg",   "short", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sg_table_short_avx2_256_16, "parasail_sg_table_short_avx2_256_16", "sg",   "short", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sg_table_short_avx2_256_8,  "parasail_sg_table_short_avx2_256_8",  "sg",   "short", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_sg_table_scan_knc_512_32,   "parasail_sg_table_scan_knc_512_32",   "sg",    "scan", "knc",   "512", "32", 16, 1, 0, 0, 0},
@@ -601,6 +669,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_table_diag_16,           "parasail_sg_table_diag_16",           "sg",    "diag", "disp",   "NA", "16", -1, 1, 0, 0, 0},
 {parasail_sg_table_diag_8,            "parasail_sg_table_diag_8",            "sg",    "diag", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 {parasail_sg_table_diag_sat,          "parasail_sg_table_diag_sat",          "sg",    "diag", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sg_table_blocked_32,        "parasail_sg_table_blocked_32",        "sg", "blocked", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sg_table_blocked_16,        "parasail_sg_table_blocked_16",        "sg", "blocked", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sg_table_short_32,          "parasail_sg_table_short_32",          "sg",   "short", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sg_table_short_16,          "parasail_sg_table_short_16",          "sg",   "short", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sg_table_short_8,           "parasail_sg_table_short_8",           "sg",   "short", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 {parasail_sw_table,                   "parasail_sw_table",                   "sw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1},
 {parasail_sw_table_scan,              "parasail_sw_table_scan",              "sw",    "scan", "NA",     "32", "32",  1, 1, 0, 0, 0},
 #if HAVE_SSE2
@@ -638,6 +711,9 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_table_diag_sse41_128_sat, "parasail_sw_table_diag_sse41_128_sat", "sw",    "diag", "sse41", "128", "sat", 16, 1, 0, 0, 0},
 {parasail_sw_table_blocked_sse41_128_32, "parasail_sw_table_blocked_sse41_128_32", "sw", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0},
 {parasail_sw_table_blocked_sse41_128_16, "parasail_sw_table_blocked_sse41_128_16", "sw", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_short_sse41_128_32, "parasail_sw_table_short_sse41_128_32", "sw",   "short", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sw_table_short_sse41_128_16, "parasail_sw_table_short_sse41_128_16", "sw",   "short", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_short_sse41_128_8, "parasail_sw_table_short_sse41_128_8", "sw",   "short", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sw_table_scan_avx2_256_64,  "parasail_sw_table_scan_avx2_256_64",  "sw",    "scan", "avx2",  "256", "64",  4, 1, 0, 0, 0},
@@ -655,6 +731,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_table_diag_avx2_256_16,  "parasail_sw_table_diag_avx2_256_16",  "sw",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0},
 {parasail_sw_table_diag_avx2_256_8,   "parasail_sw_table_diag_avx2_256_8",   "sw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 {parasail_sw_table_diag_avx2_256_sat, "parasail_sw_table_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sw_table_blocked_avx2_256_32, "parasail_sw_table_blocked_avx2_256_32", "sw", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sw_table_blocked_avx2_256_16, "parasail_sw_table_blocked_avx2_256_16", "sw", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sw_table_short_avx2_256_32, "parasail_sw_table_short_avx2_256_32", "sw",   "short", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sw_table_short_avx2_256_16, "parasail_sw_table_short_avx2_256_16", "sw",   "short", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sw_table_short_avx2_256_8,  "parasail_sw_table_short_avx2_256_8",  "sw",   "short", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_sw_table_scan_knc_512_32,   "parasail_sw_table_scan_knc_512_32",   "sw",    "scan", "knc",   "512", "32", 16, 1, 0, 0, 0},
@@ -676,6 +757,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_table_diag_16,           "parasail_sw_table_diag_16",           "sw",    "diag", "disp",   "NA", "16", -1, 1, 0, 0, 0},
 {parasail_sw_table_diag_8,            "parasail_sw_table_diag_8",            "sw",    "diag", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 {parasail_sw_table_diag_sat,          "parasail_sw_table_diag_sat",          "sw",    "diag", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sw_table_blocked_32,        "parasail_sw_table_blocked_32",        "sw", "blocked", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sw_table_blocked_16,        "parasail_sw_table_blocked_16",        "sw", "blocked", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sw_table_short_32,          "parasail_sw_table_short_32",          "sw",   "short", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sw_table_short_16,          "parasail_sw_table_short_16",          "sw",   "short", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sw_table_short_8,           "parasail_sw_table_short_8",           "sw",   "short", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 {parasail_nw_stats_table,             "parasail_nw_stats_table",             "nw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 1, 1},
 {parasail_nw_stats_table_scan,        "parasail_nw_stats_table_scan",        "nw_stats",    "scan", "NA",     "32", "32",  1, 1, 0, 1, 0},
 #if HAVE_SSE2
@@ -930,6 +1016,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_rowcol_diag_sse41_128_16, "parasail_nw_rowcol_diag_sse41_128_16", "nw",    "diag", "sse41", "128", "16",  8, 0, 1, 0, 0},
 {parasail_nw_rowcol_diag_sse41_128_8, "parasail_nw_rowcol_diag_sse41_128_8", "nw",    "diag", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 {parasail_nw_rowcol_diag_sse41_128_sat, "parasail_nw_rowcol_diag_sse41_128_sat", "nw",    "diag", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_sse41_128_32, "parasail_nw_rowcol_blocked_sse41_128_32", "nw", "blocked", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_sse41_128_16, "parasail_nw_rowcol_blocked_sse41_128_16", "nw", "blocked", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_sse41_128_32, "parasail_nw_rowcol_short_sse41_128_32", "nw",   "short", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_sse41_128_16, "parasail_nw_rowcol_short_sse41_128_16", "nw",   "short", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_sse41_128_8, "parasail_nw_rowcol_short_sse41_128_8", "nw",   "short", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_nw_rowcol_scan_avx2_256_64, "parasail_nw_rowcol_scan_avx2_256_64", "nw",    "scan", "avx2",  "256", "64",  4, 0, 1, 0, 0},
@@ -947,6 +1038,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_rowcol_diag_avx2_256_16, "parasail_nw_rowcol_diag_avx2_256_16", "nw",    "diag", "avx2",  "256", "16", 16, 0, 1, 0, 0},
 {parasail_nw_rowcol_diag_avx2_256_8,  "parasail_nw_rowcol_diag_avx2_256_8",  "nw",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 {parasail_nw_rowcol_diag_avx2_256_sat, "parasail_nw_rowcol_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_avx2_256_32, "parasail_nw_rowcol_blocked_avx2_256_32", "nw", "blocked", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_avx2_256_16, "parasail_nw_rowcol_blocked_avx2_256_16", "nw", "blocked", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_avx2_256_32, "parasail_nw_rowcol_short_avx2_256_32", "nw",   "short", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_avx2_256_16, "parasail_nw_rowcol_short_avx2_256_16", "nw",   "short", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_avx2_256_8, "parasail_nw_rowcol_short_avx2_256_8", "nw",   "short", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_nw_rowcol_scan_knc_512_32,  "parasail_nw_rowcol_scan_knc_512_32",  "nw",    "scan", "knc",   "512", "32", 16, 0, 1, 0, 0},
@@ -968,6 +1064,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_rowcol_diag_16,          "parasail_nw_rowcol_diag_16",          "nw",    "diag", "disp",   "NA", "16", -1, 0, 1, 0, 0},
 {parasail_nw_rowcol_diag_8,           "parasail_nw_rowcol_diag_8",           "nw",    "diag", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 {parasail_nw_rowcol_diag_sat,         "parasail_nw_rowcol_diag_sat",         "nw",    "diag", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_32,       "parasail_nw_rowcol_blocked_32",       "nw", "blocked", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_16,       "parasail_nw_rowcol_blocked_16",       "nw", "blocked", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_32,         "parasail_nw_rowcol_short_32",         "nw",   "short", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_16,         "parasail_nw_rowcol_short_16",         "nw",   "short", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_8,          "parasail_nw_rowcol_short_8",          "nw",   "short", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 {parasail_sg_rowcol,                  "parasail_sg_rowcol",                  "sg",    "orig", "NA",     "32", "32",  1, 0, 1, 0, 1},
 {parasail_sg_rowcol_scan,             "parasail_sg_rowcol_scan",             "sg",    "scan", "NA",     "32", "32",  1, 0, 1, 0, 0},
 #if HAVE_SSE2
@@ -1003,6 +1104,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_rowcol_diag_sse41_128_16, "parasail_sg_rowcol_diag_sse41_128_16", "sg",    "diag", "sse41", "128", "16",  8, 0, 1, 0, 0},
 {parasail_sg_rowcol_diag_sse41_128_8, "parasail_sg_rowcol_diag_sse41_128_8", "sg",    "diag", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 {parasail_sg_rowcol_diag_sse41_128_sat, "parasail_sg_rowcol_diag_sse41_128_sat", "sg",    "diag", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_sse41_128_32, "parasail_sg_rowcol_blocked_sse41_128_32", "sg", "blocked", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_sse41_128_16, "parasail_sg_rowcol_blocked_sse41_128_16", "sg", "blocked", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_sse41_128_32, "parasail_sg_rowcol_short_sse41_128_32", "sg",   "short", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_sse41_128_16, "parasail_sg_rowcol_short_sse41_128_16", "sg",   "short", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_sse41_128_8, "parasail_sg_rowcol_short_sse41_128_8", "sg",   "short", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sg_rowcol_scan_avx2_256_64, "parasail_sg_rowcol_scan_avx2_256_64", "sg",    "scan", "avx2",  "256", "64",  4, 0, 1, 0, 0},
@@ -1020,6 +1126,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_rowcol_diag_avx2_256_16, "parasail_sg_rowcol_diag_avx2_256_16", "sg",    "diag", "avx2",  "256", "16", 16, 0, 1, 0, 0},
 {parasail_sg_rowcol_diag_avx2_256_8,  "parasail_sg_rowcol_diag_avx2_256_8",  "sg",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 {parasail_sg_rowcol_diag_avx2_256_sat, "parasail_sg_rowcol_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_avx2_256_32, "parasail_sg_rowcol_blocked_avx2_256_32", "sg", "blocked", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_avx2_256_16, "parasail_sg_rowcol_blocked_avx2_256_16", "sg", "blocked", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_avx2_256_32, "parasail_sg_rowcol_short_avx2_256_32", "sg",   "short", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_avx2_256_16, "parasail_sg_rowcol_short_avx2_256_16", "sg",   "short", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_avx2_256_8, "parasail_sg_rowcol_short_avx2_256_8", "sg",   "short", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_sg_rowcol_scan_knc_512_32,  "parasail_sg_rowcol_scan_knc_512_32",  "sg",    "scan", "knc",   "512", "32", 16, 0, 1, 0, 0},
@@ -1041,6 +1152,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_rowcol_diag_16,          "parasail_sg_rowcol_diag_16",          "sg",    "diag", "disp",   "NA", "16", -1, 0, 1, 0, 0},
 {parasail_sg_rowcol_diag_8,           "parasail_sg_rowcol_diag_8",           "sg",    "diag", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 {parasail_sg_rowcol_diag_sat,         "parasail_sg_rowcol_diag_sat",         "sg",    "diag", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_32,       "parasail_sg_rowcol_blocked_32",       "sg", "blocked", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_16,       "parasail_sg_rowcol_blocked_16",       "sg", "blocked", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_32,         "parasail_sg_rowcol_short_32",         "sg",   "short", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_16,         "parasail_sg_rowcol_short_16",         "sg",   "short", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_8,          "parasail_sg_rowcol_short_8",          "sg",   "short", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 {parasail_sw_rowcol,                  "parasail_sw_rowcol",                  "sw",    "orig", "NA",     "32", "32",  1, 0, 1, 0, 1},
 {parasail_sw_rowcol_scan,             "parasail_sw_rowcol_scan",             "sw",    "scan", "NA",     "32", "32",  1, 0, 1, 0, 0},
 #if HAVE_SSE2
@@ -1078,6 +1194,9 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_rowcol_diag_sse41_128_sat, "parasail_sw_rowcol_diag_sse41_128_sat", "sw",    "diag", "sse41", "128", "sat", 16, 0, 1, 0, 0},
 {parasail_sw_rowcol_blocked_sse41_128_32, "parasail_sw_rowcol_blocked_sse41_128_32", "sw", "blocked", "sse41", "128", "32",  4, 0, 1, 0, 0},
 {parasail_sw_rowcol_blocked_sse41_128_16, "parasail_sw_rowcol_blocked_sse41_128_16", "sw", "blocked", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_sse41_128_32, "parasail_sw_rowcol_short_sse41_128_32", "sw",   "short", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_sse41_128_16, "parasail_sw_rowcol_short_sse41_128_16", "sw",   "short", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_sse41_128_8, "parasail_sw_rowcol_short_sse41_128_8", "sw",   "short", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sw_rowcol_scan_avx2_256_64, "parasail_sw_rowcol_scan_avx2_256_64", "sw",    "scan", "avx2",  "256", "64",  4, 0, 1, 0, 0},
@@ -1095,6 +1214,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_rowcol_diag_avx2_256_16, "parasail_sw_rowcol_diag_avx2_256_16", "sw",    "diag", "avx2",  "256", "16", 16, 0, 1, 0, 0},
 {parasail_sw_rowcol_diag_avx2_256_8,  "parasail_sw_rowcol_diag_avx2_256_8",  "sw",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 {parasail_sw_rowcol_diag_avx2_256_sat, "parasail_sw_rowcol_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_avx2_256_32, "parasail_sw_rowcol_blocked_avx2_256_32", "sw", "blocked", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_avx2_256_16, "parasail_sw_rowcol_blocked_avx2_256_16", "sw", "blocked", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_avx2_256_32, "parasail_sw_rowcol_short_avx2_256_32", "sw",   "short", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_avx2_256_16, "parasail_sw_rowcol_short_avx2_256_16", "sw",   "short", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_avx2_256_8, "parasail_sw_rowcol_short_avx2_256_8", "sw",   "short", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 #endif
 #if HAVE_KNC
 {parasail_sw_rowcol_scan_knc_512_32,  "parasail_sw_rowcol_scan_knc_512_32",  "sw",    "scan", "knc",   "512", "32", 16, 0, 1, 0, 0},
@@ -1116,6 +1240,11 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_rowcol_diag_16,          "parasail_sw_rowcol_diag_16",          "sw",    "diag", "disp",   "NA", "16", -1, 0, 1, 0, 0},
 {parasail_sw_rowcol_diag_8,           "parasail_sw_rowcol_diag_8",           "sw",    "diag", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 {parasail_sw_rowcol_diag_sat,         "parasail_sw_rowcol_diag_sat",         "sw",    "diag", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_32,       "parasail_sw_rowcol_blocked_32",       "sw", "blocked", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_16,       "parasail_sw_rowcol_blocked_16",       "sw", "blocked", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_32,         "parasail_sw_rowcol_short_32",         "sw",   "short", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_16,         "parasail_sw_rowcol_short_16",         "sw",   "short", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_8,          "parasail_sw_rowcol_short_8",          "sw",   "short", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 {parasail_nw_stats_rowcol,            "parasail_nw_stats_rowcol",            "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 1, 1, 1},
 {parasail_nw_stats_rowcol_scan,       "parasail_nw_stats_rowcol_scan",       "nw_stats",    "scan", "NA",     "32", "32",  1, 0, 1, 1, 0},
 #if HAVE_SSE2
@@ -1335,911 +1464,1260 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_stats_rowcol_diag_16,    "parasail_sw_stats_rowcol_diag_16",    "sw_stats",    "diag", "disp",   "NA", "16", -1, 0, 1, 1, 0},
 {parasail_sw_stats_rowcol_diag_8,     "parasail_sw_stats_rowcol_diag_8",     "sw_stats",    "diag", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
 {parasail_sw_stats_rowcol_diag_sat,   "parasail_sw_stats_rowcol_diag_sat",   "sw_stats",    "diag", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
+{parasail_nw_trace,                   "parasail_nw_trace",                   "nw",   "trace", "NA",     "32", "32",  1, 0, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_nw_trace_scan_sse41_128_32, "parasail_nw_trace_scan_sse41_128_32", "nw", "trace_scan", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_trace_scan_sse41_128_16, "parasail_nw_trace_scan_sse41_128_16", "nw", "trace_scan", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_trace_scan_sse41_128_8,  "parasail_nw_trace_scan_sse41_128_8",  "nw", "trace_scan", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_nw_trace_scan_sse41_128_sat, "parasail_nw_trace_scan_sse41_128_sat", "nw", "trace_scan", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_nw_trace_scan_avx2_256_32,  "parasail_nw_trace_scan_avx2_256_32",  "nw", "trace_scan", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_trace_scan_avx2_256_16,  "parasail_nw_trace_scan_avx2_256_16",  "nw", "trace_scan", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_trace_scan_avx2_256_8,   "parasail_nw_trace_scan_avx2_256_8",   "nw", "trace_scan", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_nw_trace_scan_avx2_256_sat, "parasail_nw_trace_scan_avx2_256_sat", "nw", "trace_scan", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+#endif
+{parasail_nw_trace_scan_32,           "parasail_nw_trace_scan_32",           "nw", "trace_scan", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_trace_scan_16,           "parasail_nw_trace_scan_16",           "nw", "trace_scan", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_trace_scan_8,            "parasail_nw_trace_scan_8",            "nw", "trace_scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_nw_trace_scan_sat,          "parasail_nw_trace_scan_sat",          "nw", "trace_scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sg_trace,                   "parasail_sg_trace",                   "sg",   "trace", "NA",     "32", "32",  1, 0, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_sg_trace_scan_sse41_128_32, "parasail_sg_trace_scan_sse41_128_32", "sg", "trace_scan", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_trace_scan_sse41_128_16, "parasail_sg_trace_scan_sse41_128_16", "sg", "trace_scan", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_trace_scan_sse41_128_8,  "parasail_sg_trace_scan_sse41_128_8",  "sg", "trace_scan", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sg_trace_scan_sse41_128_sat, "parasail_sg_trace_scan_sse41_128_sat", "sg", "trace_scan", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_sg_trace_scan_avx2_256_32,  "parasail_sg_trace_scan_avx2_256_32",  "sg", "trace_scan", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sg_trace_scan_avx2_256_16,  "parasail_sg_trace_scan_avx2_256_16",  "sg", "trace_scan", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sg_trace_scan_avx2_256_8,   "parasail_sg_trace_scan_avx2_256_8",   "sg", "trace_scan", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_sg_trace_scan_avx2_256_sat, "parasail_sg_trace_scan_avx2_256_sat", "sg", "trace_scan", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+#endif
+{parasail_sg_trace_scan_32,           "parasail_sg_trace_scan_32",           "sg", "trace_scan", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sg_trace_scan_16,           "parasail_sg_trace_scan_16",           "sg", "trace_scan", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sg_trace_scan_8,            "parasail_sg_trace_scan_8",            "sg", "trace_scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_sg_trace_scan_sat,          "parasail_sg_trace_scan_sat",          "sg", "trace_scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sw_trace,                   "parasail_sw_trace",                   "sw",   "trace", "NA",     "32", "32",  1, 0, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_sw_trace_scan_sse41_128_32, "parasail_sw_trace_scan_sse41_128_32", "sw", "trace_scan", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_trace_scan_sse41_128_16, "parasail_sw_trace_scan_sse41_128_16", "sw", "trace_scan", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_trace_scan_sse41_128_8,  "parasail_sw_trace_scan_sse41_128_8",  "sw", "trace_scan", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sw_trace_scan_sse41_128_sat, "parasail_sw_trace_scan_sse41_128_sat", "sw", "trace_scan", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_sw_trace_scan_avx2_256_32,  "parasail_sw_trace_scan_avx2_256_32",  "sw", "trace_scan", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sw_trace_scan_avx2_256_16,  "parasail_sw_trace_scan_avx2_256_16",  "sw", "trace_scan", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sw_trace_scan_avx2_256_8,   "parasail_sw_trace_scan_avx2_256_8",   "sw", "trace_scan", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_sw_trace_scan_avx2_256_sat, "parasail_sw_trace_scan_avx2_256_sat", "sw", "trace_scan", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+#endif
+{parasail_sw_trace_scan_32,           "parasail_sw_trace_scan_32",           "sw", "trace_scan", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sw_trace_scan_16,           "parasail_sw_trace_scan_16",           "sw", "trace_scan", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sw_trace_scan_8,            "parasail_sw_trace_scan_8",            "sw", "trace_scan", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_sw_trace_scan_sat,          "parasail_sw_trace_scan_sat",          "sw", "trace_scan", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_nw_linear,                  "parasail_nw_linear",                  "nw",  "linear", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sg_linear,                  "parasail_sg_linear",                  "sg",  "linear", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sw_linear,                  "parasail_sw_linear",                  "sw",  "linear", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_nw_auto,                    "parasail_nw_auto",                    "nw",    "auto", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sg_auto,                    "parasail_sg_auto",                    "sg",    "auto", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sw_auto,                    "parasail_sw_auto",                    "sw",    "auto", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0}
 };
 
 static const parasail_pfunction_info_t pfunctions[] = {
 #if HAVE_SSE2
-{parasail_nw_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_scan_profile_sse2_128_64", "nw", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_scan_profile_sse2_128_32", "nw", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_scan_profile_sse2_128_16", "nw", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_scan_profile_sse2_128_8", "nw", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_scan_profile_sse2_128_sat", "nw", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_striped_profile_sse2_128_64", "nw", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_striped_profile_sse2_128_32", "nw", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_striped_profile_sse2_128_16", "nw", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_striped_profile_sse2_128_8", "nw", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_striped_profile_sse2_128_sat", "nw", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_nw_scan_profile_sse2_128_64_ws, "parasail_nw_scan_profile_sse2_128_64", "nw", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_nw_scan_profile_sse2_128_32_ws, "parasail_nw_scan_profile_sse2_128_32", "nw", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_nw_scan_profile_sse2_128_16_ws, "parasail_nw_scan_profile_sse2_128_16", "nw", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_nw_scan_profile_sse2_128_8_ws, "parasail_nw_scan_profile_sse2_128_8", "nw", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_scan_profile_sse2_128_sat_ws, "parasail_nw_scan_profile_sse2_128_sat", "nw", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_nw_striped_profile_sse2_128_64_ws, "parasail_nw_striped_profile_sse2_128_64", "nw", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_nw_striped_profile_sse2_128_32_ws, "parasail_nw_striped_profile_sse2_128_32", "nw", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_nw_striped_profile_sse2_128_16_ws, "parasail_nw_striped_profile_sse2_128_16", "nw", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_nw_striped_profile_sse2_128_8_ws, "parasail_nw_striped_profile_sse2_128_8", "nw", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_striped_profile_sse2_128_sat_ws, "parasail_nw_striped_profile_sse2_128_sat", "nw", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_nw_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_scan_profile_sse41_128_64", "nw", "scan_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_scan_profile_sse41_128_32", "nw", "scan_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_scan_profile_sse41_128_16", "nw", "scan_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_scan_profile_sse41_128_8", "nw", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_scan_profile_sse41_128_sat", "nw", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_striped_profile_sse41_128_64", "nw", "striped_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_striped_profile_sse41_128_32", "nw", "striped_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_striped_profile_sse41_128_16", "nw", "striped_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_striped_profile_sse41_128_8", "nw", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_striped_profile_sse41_128_sat", "nw", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_nw_scan_profile_sse41_128_64_ws, "parasail_nw_scan_profile_sse41_128_64", "nw", "scan_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_scan_profile_sse41_128_32_ws, "parasail_nw_scan_profile_sse41_128_32", "nw", "scan_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_scan_profile_sse41_128_16_ws, "parasail_nw_scan_profile_sse41_128_16", "nw", "scan_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_scan_profile_sse41_128_8_ws, "parasail_nw_scan_profile_sse41_128_8", "nw", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_scan_profile_sse41_128_sat_ws, "parasail_nw_scan_profile_sse41_128_sat", "nw", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_nw_striped_profile_sse41_128_64_ws, "parasail_nw_striped_profile_sse41_128_64", "nw", "striped_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_striped_profile_sse41_128_32_ws, "parasail_nw_striped_profile_sse41_128_32", "nw", "striped_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_striped_profile_sse41_128_16_ws, "parasail_nw_striped_profile_sse41_128_16", "nw", "striped_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_striped_profile_sse41_128_8_ws, "parasail_nw_striped_profile_sse41_128_8", "nw", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_striped_profile_sse41_128_sat_ws, "parasail_nw_striped_profile_sse41_128_sat", "nw", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_nw_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_nw_blocked_profile_sse41_128_32_ws, "parasail_nw_blocked_profile_sse41_128_32", "nw", "blocked_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_nw_blocked_profile_sse41_128_16_ws, "parasail_nw_blocked_profile_sse41_128_16", "nw", "blocked_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_short_profile_sse41_128_32_ws, "parasail_nw_short_profile_sse41_128_32", "nw", "short_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_short_profile_sse41_128_16_ws, "parasail_nw_short_profile_sse41_128_16", "nw", "short_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_short_profile_sse41_128_8_ws, "parasail_nw_short_profile_sse41_128_8", "nw", "short_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_nw_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_nw_scan_profile_avx2_256_64", "nw", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
-{parasail_nw_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_nw_scan_profile_avx2_256_32", "nw", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
-{parasail_nw_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_nw_scan_profile_avx2_256_16", "nw", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
-{parasail_nw_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_scan_profile_avx2_256_8", "nw", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
-{parasail_nw_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_scan_profile_avx2_256_sat", "nw", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
-{parasail_nw_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_nw_striped_profile_avx2_256_64", "nw", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
-{parasail_nw_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_nw_striped_profile_avx2_256_32", "nw", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
-{parasail_nw_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_nw_striped_profile_avx2_256_16", "nw", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
-{parasail_nw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
-{parasail_nw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_nw_scan_profile_avx2_256_64_ws, "parasail_nw_scan_profile_avx2_256_64", "nw", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_scan_profile_avx2_256_32_ws, "parasail_nw_scan_profile_avx2_256_32", "nw", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_scan_profile_avx2_256_16_ws, "parasail_nw_scan_profile_avx2_256_16", "nw", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_scan_profile_avx2_256_8_ws, "parasail_nw_scan_profile_avx2_256_8", "nw", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_nw_scan_profile_avx2_256_sat_ws, "parasail_nw_scan_profile_avx2_256_sat", "nw", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_nw_striped_profile_avx2_256_64_ws, "parasail_nw_striped_profile_avx2_256_64", "nw", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_striped_profile_avx2_256_32_ws, "parasail_nw_striped_profile_avx2_256_32", "nw", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_striped_profile_avx2_256_16_ws, "parasail_nw_striped_profile_avx2_256_16", "nw", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_striped_profile_avx2_256_8_ws, "parasail_nw_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_nw_striped_profile_avx2_256_sat_ws, "parasail_nw_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_nw_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_nw_blocked_profile_avx2_256_32_ws, "parasail_nw_blocked_profile_avx2_256_32", "nw", "blocked_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_nw_blocked_profile_avx2_256_16_ws, "parasail_nw_blocked_profile_avx2_256_16", "nw", "blocked_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_short_profile_avx2_256_32_ws, "parasail_nw_short_profile_avx2_256_32", "nw", "short_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_short_profile_avx2_256_16_ws, "parasail_nw_short_profile_avx2_256_16", "nw", "short_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_short_profile_avx2_256_8_ws, "parasail_nw_short_profile_avx2_256_8", "nw", "short_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_nw_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_nw_scan_profile_knc_512_32", "nw", "scan_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
-{parasail_nw_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_nw_striped_profile_knc_512_32", "nw", "striped_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
-#endif
-{parasail_nw_scan_profile_64,         parasail_profile_create_64,          "parasail_nw_scan_profile_64",         "nw", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
-{parasail_nw_scan_profile_32,         parasail_profile_create_32,          "parasail_nw_scan_profile_32",         "nw", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
-{parasail_nw_scan_profile_16,         parasail_profile_create_16,          "parasail_nw_scan_profile_16",         "nw", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
-{parasail_nw_scan_profile_8,          parasail_profile_create_8,           "parasail_nw_scan_profile_8",          "nw", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
-{parasail_nw_scan_profile_sat,        parasail_profile_create_sat,         "parasail_nw_scan_profile_sat",        "nw", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
-{parasail_nw_striped_profile_64,      parasail_profile_create_64,          "parasail_nw_striped_profile_64",      "nw", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
-{parasail_nw_striped_profile_32,      parasail_profile_create_32,          "parasail_nw_striped_profile_32",      "nw", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
-{parasail_nw_striped_profile_16,      parasail_profile_create_16,          "parasail_nw_striped_profile_16",      "nw", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
-{parasail_nw_striped_profile_8,       parasail_profile_create_8,           "parasail_nw_striped_profile_8",       "nw", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
-{parasail_nw_striped_profile_sat,     parasail_profile_create_sat,         "parasail_nw_striped_profile_sat",     "nw", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_nw_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_nw_scan_profile_knc_512_32_ws, "parasail_nw_scan_profile_knc_512_32", "nw", "scan_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
+{parasail_nw_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_nw_striped_profile_knc_512_32_ws, "parasail_nw_striped_profile_knc_512_32", "nw", "striped_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
+#endif
+{parasail_nw_scan_profile_64,         parasail_profile_create_64,          parasail_nw_scan_profile_64_ws,         "parasail_nw_scan_profile_64",         "nw", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
+{parasail_nw_scan_profile_32,         parasail_profile_create_32,          parasail_nw_scan_profile_32_ws,         "parasail_nw_scan_profile_32",         "nw", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_scan_profile_16,         parasail_profile_create_16,          parasail_nw_scan_profile_16_ws,         "parasail_nw_scan_profile_16",         "nw", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_scan_profile_8,          parasail_profile_create_8,           parasail_nw_scan_profile_8_ws,          "parasail_nw_scan_profile_8",          "nw", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_nw_scan_profile_sat,        parasail_profile_create_sat,         parasail_nw_scan_profile_sat_ws,        "parasail_nw_scan_profile_sat",        "nw", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_nw_striped_profile_64,      parasail_profile_create_64,          parasail_nw_striped_profile_64_ws,      "parasail_nw_striped_profile_64",      "nw", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
+{parasail_nw_striped_profile_32,      parasail_profile_create_32,          parasail_nw_striped_profile_32_ws,      "parasail_nw_striped_profile_32",      "nw", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_striped_profile_16,      parasail_profile_create_16,          parasail_nw_striped_profile_16_ws,      "parasail_nw_striped_profile_16",      "nw", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_striped_profile_8,       parasail_profile_create_8,           parasail_nw_striped_profile_8_ws,       "parasail_nw_striped_profile_8",       "nw", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_nw_striped_profile_sat,     parasail_profile_create_sat,         parasail_nw_striped_profile_sat_ws,     "parasail_nw_striped_profile_sat",     "nw", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_nw_blocked_profile_32,      parasail_profile_create_blocked_32,  parasail_nw_blocked_profile_32_ws,      "parasail_nw_blocked_profile_32",      "nw", "blocked_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_blocked_profile_16,      parasail_profile_create_blocked_16,  parasail_nw_blocked_profile_16_ws,      "parasail_nw_blocked_profile_16",      "nw", "blocked_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_short_profile_32,        parasail_profile_create_32,          parasail_nw_short_profile_32_ws,        "parasail_nw_short_profile_32",        "nw", "short_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_short_profile_16,        parasail_profile_create_16,          parasail_nw_short_profile_16_ws,        "parasail_nw_short_profile_16",        "nw", "short_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_short_profile_8,         parasail_profile_create_8,           parasail_nw_short_profile_8_ws,         "parasail_nw_short_profile_8",         "nw", "short_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 #if HAVE_SSE2
-{parasail_sg_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_scan_profile_sse2_128_64", "sg", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_scan_profile_sse2_128_32", "sg", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_scan_profile_sse2_128_16", "sg", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_scan_profile_sse2_128_8", "sg", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_scan_profile_sse2_128_sat", "sg", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_striped_profile_sse2_128_64", "sg", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_striped_profile_sse2_128_32", "sg", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_striped_profile_sse2_128_16", "sg", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_striped_profile_sse2_128_8", "sg", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_striped_profile_sse2_128_sat", "sg", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sg_scan_profile_sse2_128_64_ws, "parasail_sg_scan_profile_sse2_128_64", "sg", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sg_scan_profile_sse2_128_32_ws, "parasail_sg_scan_profile_sse2_128_32", "sg", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sg_scan_profile_sse2_128_16_ws, "parasail_sg_scan_profile_sse2_128_16", "sg", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sg_scan_profile_sse2_128_8_ws, "parasail_sg_scan_profile_sse2_128_8", "sg", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_scan_profile_sse2_128_sat_ws, "parasail_sg_scan_profile_sse2_128_sat", "sg", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sg_striped_profile_sse2_128_64_ws, "parasail_sg_striped_profile_sse2_128_64", "sg", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sg_striped_profile_sse2_128_32_ws, "parasail_sg_striped_profile_sse2_128_32", "sg", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sg_striped_profile_sse2_128_16_ws, "parasail_sg_striped_profile_sse2_128_16", "sg", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sg_striped_profile_sse2_128_8_ws, "parasail_sg_striped_profile_sse2_128_8", "sg", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_striped_profile_sse2_128_sat_ws, "parasail_sg_striped_profile_sse2_128_sat", "sg", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sg_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_scan_profile_sse41_128_64", "sg", "scan_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_scan_profile_sse41_128_32", "sg", "scan_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_scan_profile_sse41_128_16", "sg", "scan_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_scan_profile_sse41_128_8", "sg", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_scan_profile_sse41_128_sat", "sg", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_striped_profile_sse41_128_64", "sg", "striped_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_striped_profile_sse41_128_32", "sg", "striped_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_striped_profile_sse41_128_16", "sg", "striped_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_striped_profile_sse41_128_8", "sg", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_striped_profile_sse41_128_sat", "sg", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sg_scan_profile_sse41_128_64_ws, "parasail_sg_scan_profile_sse41_128_64", "sg", "scan_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_scan_profile_sse41_128_32_ws, "parasail_sg_scan_profile_sse41_128_32", "sg", "scan_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_scan_profile_sse41_128_16_ws, "parasail_sg_scan_profile_sse41_128_16", "sg", "scan_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_scan_profile_sse41_128_8_ws, "parasail_sg_scan_profile_sse41_128_8", "sg", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_scan_profile_sse41_128_sat_ws, "parasail_sg_scan_profile_sse41_128_sat", "sg", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sg_striped_profile_sse41_128_64_ws, "parasail_sg_striped_profile_sse41_128_64", "sg", "striped_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_striped_profile_sse41_128_32_ws, "parasail_sg_striped_profile_sse41_128_32", "sg", "striped_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_striped_profile_sse41_128_16_ws, "parasail_sg_striped_profile_sse41_128_16", "sg", "striped_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_striped_profile_sse41_128_8_ws, "parasail_sg_striped_profile_sse41_128_8", "sg", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_striped_profile_sse41_128_sat_ws, "parasail_sg_striped_profile_sse41_128_sat", "sg", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sg_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_sg_blocked_profile_sse41_128_32_ws, "parasail_sg_blocked_profile_sse41_128_32", "sg", "blocked_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_sg_blocked_profile_sse41_128_16_ws, "parasail_sg_blocked_profile_sse41_128_16", "sg", "blocked_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_short_profile_sse41_128_32_ws, "parasail_sg_short_profile_sse41_128_32", "sg", "short_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sg_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_short_profile_sse41_128_16_ws, "parasail_sg_short_profile_sse41_128_16", "sg", "short_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sg_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_short_profile_sse41_128_8_ws, "parasail_sg_short_profile_sse41_128_8", "sg", "short_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sg_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sg_scan_profile_avx2_256_64", "sg", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
-{parasail_sg_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sg_scan_profile_avx2_256_32", "sg", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
-{parasail_sg_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sg_scan_profile_avx2_256_16", "sg", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
-{parasail_sg_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_scan_profile_avx2_256_8", "sg", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
-{parasail_sg_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_scan_profile_avx2_256_sat", "sg", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
-{parasail_sg_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sg_striped_profile_avx2_256_64", "sg", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
-{parasail_sg_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sg_striped_profile_avx2_256_32", "sg", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
-{parasail_sg_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sg_striped_profile_avx2_256_16", "sg", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
-{parasail_sg_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
-{parasail_sg_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sg_scan_profile_avx2_256_64_ws, "parasail_sg_scan_profile_avx2_256_64", "sg", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_scan_profile_avx2_256_32_ws, "parasail_sg_scan_profile_avx2_256_32", "sg", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_scan_profile_avx2_256_16_ws, "parasail_sg_scan_profile_avx2_256_16", "sg", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_scan_profile_avx2_256_8_ws, "parasail_sg_scan_profile_avx2_256_8", "sg", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sg_scan_profile_avx2_256_sat_ws, "parasail_sg_scan_profile_avx2_256_sat", "sg", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sg_striped_profile_avx2_256_64_ws, "parasail_sg_striped_profile_avx2_256_64", "sg", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_striped_profile_avx2_256_32_ws, "parasail_sg_striped_profile_avx2_256_32", "sg", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_striped_profile_avx2_256_16_ws, "parasail_sg_striped_profile_avx2_256_16", "sg", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_striped_profile_avx2_256_8_ws, "parasail_sg_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sg_striped_profile_avx2_256_sat_ws, "parasail_sg_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sg_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_sg_blocked_profile_avx2_256_32_ws, "parasail_sg_blocked_profile_avx2_256_32", "sg", "blocked_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sg_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_sg_blocked_profile_avx2_256_16_ws, "parasail_sg_blocked_profile_avx2_256_16", "sg", "blocked_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sg_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_short_profile_avx2_256_32_ws, "parasail_sg_short_profile_avx2_256_32", "sg", "short_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sg_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_short_profile_avx2_256_16_ws, "parasail_sg_short_profile_avx2_256_16", "sg", "short_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sg_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_short_profile_avx2_256_8_ws, "parasail_sg_short_profile_avx2_256_8", "sg", "short_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_sg_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sg_scan_profile_knc_512_32", "sg", "scan_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
-{parasail_sg_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sg_striped_profile_knc_512_32", "sg", "striped_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
-#endif
-{parasail_sg_scan_profile_64,         parasail_profile_create_64,          "parasail_sg_scan_profile_64",         "sg", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
-{parasail_sg_scan_profile_32,         parasail_profile_create_32,          "parasail_sg_scan_profile_32",         "sg", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
-{parasail_sg_scan_profile_16,         parasail_profile_create_16,          "parasail_sg_scan_profile_16",         "sg", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
-{parasail_sg_scan_profile_8,          parasail_profile_create_8,           "parasail_sg_scan_profile_8",          "sg", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
-{parasail_sg_scan_profile_sat,        parasail_profile_create_sat,         "parasail_sg_scan_profile_sat",        "sg", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
-{parasail_sg_striped_profile_64,      parasail_profile_create_64,          "parasail_sg_striped_profile_64",      "sg", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
-{parasail_sg_striped_profile_32,      parasail_profile_create_32,          "parasail_sg_striped_profile_32",      "sg", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
-{parasail_sg_striped_profile_16,      parasail_profile_create_16,          "parasail_sg_striped_profile_16",      "sg", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
-{parasail_sg_striped_profile_8,       parasail_profile_create_8,           "parasail_sg_striped_profile_8",       "sg", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
-{parasail_sg_striped_profile_sat,     parasail_profile_create_sat,         "parasail_sg_striped_profile_sat",     "sg", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sg_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sg_scan_profile_knc_512_32_ws, "parasail_sg_scan_profile_knc_512_32", "sg", "scan_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
+{parasail_sg_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sg_striped_profile_knc_512_32_ws, "parasail_sg_striped_profile_knc_512_32", "sg", "striped_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
+#endif
+{parasail_sg_scan_profile_64,         parasail_profile_create_64,          parasail_sg_scan_profile_64_ws,         "parasail_sg_scan_profile_64",         "sg", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
+{parasail_sg_scan_profile_32,         parasail_profile_create_32,          parasail_sg_scan_profile_32_ws,         "parasail_sg_scan_profile_32",         "sg", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sg_scan_profile_16,         parasail_profile_create_16,          parasail_sg_scan_profile_16_ws,         "parasail_sg_scan_profile_16",         "sg", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sg_scan_profile_8,          parasail_profile_create_8,           parasail_sg_scan_profile_8_ws,          "parasail_sg_scan_profile_8",          "sg", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_sg_scan_profile_sat,        parasail_profile_create_sat,         parasail_sg_scan_profile_sat_ws,        "parasail_sg_scan_profile_sat",        "sg", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sg_striped_profile_64,      parasail_profile_create_64,          parasail_sg_striped_profile_64_ws,      "parasail_sg_striped_profile_64",      "sg", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
+{parasail_sg_striped_profile_32,      parasail_profile_create_32,          parasail_sg_striped_profile_32_ws,      "parasail_sg_striped_profile_32",      "sg", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sg_striped_profile_16,      parasail_profile_create_16,          parasail_sg_striped_profile_16_ws,      "parasail_sg_striped_profile_16",      "sg", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sg_striped_profile_8,       parasail_profile_create_8,           parasail_sg_striped_profile_8_ws,       "parasail_sg_striped_profile_8",       "sg", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_sg_striped_profile_sat,     parasail_profile_create_sat,         parasail_sg_striped_profile_sat_ws,     "parasail_sg_striped_profile_sat",     "sg", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sg_blocked_profile_32,      parasail_profile_create_blocked_32,  parasail_sg_blocked_profile_32_ws,      "parasail_sg_blocked_profile_32",      "sg", "blocked_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sg_blocked_profile_16,      parasail_profile_create_blocked_16,  parasail_sg_blocked_profile_16_ws,      "parasail_sg_blocked_profile_16",      "sg", "blocked_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sg_short_profile_32,        parasail_profile_create_32,          parasail_sg_short_profile_32_ws,        "parasail_sg_short_profile_32",        "sg", "short_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sg_short_profile_16,        parasail_profile_create_16,          parasail_sg_short_profile_16_ws,        "parasail_sg_short_profile_16",        "sg", "short_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sg_short_profile_8,         parasail_profile_create_8,           parasail_sg_short_profile_8_ws,         "parasail_sg_short_profile_8",         "sg", "short_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 #if HAVE_SSE2
-{parasail_sw_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_scan_profile_sse2_128_64", "sw", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_scan_profile_sse2_128_32", "sw", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_scan_profile_sse2_128_16", "sw", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_scan_profile_sse2_128_8", "sw", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_scan_profile_sse2_128_sat", "sw", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_striped_profile_sse2_128_64", "sw", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_striped_profile_sse2_128_32", "sw", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_striped_profile_sse2_128_16", "sw", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_striped_profile_sse2_128_8", "sw", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_striped_profile_sse2_128_sat", "sw", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sw_scan_profile_sse2_128_64_ws, "parasail_sw_scan_profile_sse2_128_64", "sw", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sw_scan_profile_sse2_128_32_ws, "parasail_sw_scan_profile_sse2_128_32", "sw", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sw_scan_profile_sse2_128_16_ws, "parasail_sw_scan_profile_sse2_128_16", "sw", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sw_scan_profile_sse2_128_8_ws, "parasail_sw_scan_profile_sse2_128_8", "sw", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_scan_profile_sse2_128_sat_ws, "parasail_sw_scan_profile_sse2_128_sat", "sw", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sw_striped_profile_sse2_128_64_ws, "parasail_sw_striped_profile_sse2_128_64", "sw", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sw_striped_profile_sse2_128_32_ws, "parasail_sw_striped_profile_sse2_128_32", "sw", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sw_striped_profile_sse2_128_16_ws, "parasail_sw_striped_profile_sse2_128_16", "sw", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sw_striped_profile_sse2_128_8_ws, "parasail_sw_striped_profile_sse2_128_8", "sw", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_striped_profile_sse2_128_sat_ws, "parasail_sw_striped_profile_sse2_128_sat", "sw", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sw_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_scan_profile_sse41_128_64", "sw", "scan_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_scan_profile_sse41_128_32", "sw", "scan_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_scan_profile_sse41_128_16", "sw", "scan_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_scan_profile_sse41_128_8", "sw", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_scan_profile_sse41_128_sat", "sw", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_striped_profile_sse41_128_64", "sw", "striped_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_striped_profile_sse41_128_32", "sw", "striped_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_striped_profile_sse41_128_16", "sw", "striped_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_striped_profile_sse41_128_8", "sw", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_striped_profile_sse41_128_sat", "sw", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sw_scan_profile_sse41_128_64_ws, "parasail_sw_scan_profile_sse41_128_64", "sw", "scan_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_scan_profile_sse41_128_32_ws, "parasail_sw_scan_profile_sse41_128_32", "sw", "scan_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_scan_profile_sse41_128_16_ws, "parasail_sw_scan_profile_sse41_128_16", "sw", "scan_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_scan_profile_sse41_128_8_ws, "parasail_sw_scan_profile_sse41_128_8", "sw", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_scan_profile_sse41_128_sat_ws, "parasail_sw_scan_profile_sse41_128_sat", "sw", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sw_striped_profile_sse41_128_64_ws, "parasail_sw_striped_profile_sse41_128_64", "sw", "striped_profile", "sse41", "128", "64",  2, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_striped_profile_sse41_128_32_ws, "parasail_sw_striped_profile_sse41_128_32", "sw", "striped_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_striped_profile_sse41_128_16_ws, "parasail_sw_striped_profile_sse41_128_16", "sw", "striped_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_striped_profile_sse41_128_8_ws, "parasail_sw_striped_profile_sse41_128_8", "sw", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_striped_profile_sse41_128_sat_ws, "parasail_sw_striped_profile_sse41_128_sat", "sw", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+{parasail_sw_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_sw_blocked_profile_sse41_128_32_ws, "parasail_sw_blocked_profile_sse41_128_32", "sw", "blocked_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_sw_blocked_profile_sse41_128_16_ws, "parasail_sw_blocked_profile_sse41_128_16", "sw", "blocked_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_short_profile_sse41_128_32_ws, "parasail_sw_short_profile_sse41_128_32", "sw", "short_profile", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_sw_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_short_profile_sse41_128_16_ws, "parasail_sw_short_profile_sse41_128_16", "sw", "short_profile", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_sw_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_short_profile_sse41_128_8_ws, "parasail_sw_short_profile_sse41_128_8", "sw", "short_profile", "sse41", "128",  "8", 16, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sw_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sw_scan_profile_avx2_256_64", "sw", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
-{parasail_sw_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sw_scan_profile_avx2_256_32", "sw", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
-{parasail_sw_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sw_scan_profile_avx2_256_16", "sw", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
-{parasail_sw_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_scan_profile_avx2_256_8", "sw", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
-{parasail_sw_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_scan_profile_avx2_256_sat", "sw", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
-{parasail_sw_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sw_striped_profile_avx2_256_64", "sw", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
-{parasail_sw_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sw_striped_profile_avx2_256_32", "sw", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
-{parasail_sw_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sw_striped_profile_avx2_256_16", "sw", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
-{parasail_sw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
-{parasail_sw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sw_scan_profile_avx2_256_64_ws, "parasail_sw_scan_profile_avx2_256_64", "sw", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_scan_profile_avx2_256_32_ws, "parasail_sw_scan_profile_avx2_256_32", "sw", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_scan_profile_avx2_256_16_ws, "parasail_sw_scan_profile_avx2_256_16", "sw", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_scan_profile_avx2_256_8_ws, "parasail_sw_scan_profile_avx2_256_8", "sw", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sw_scan_profile_avx2_256_sat_ws, "parasail_sw_scan_profile_avx2_256_sat", "sw", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sw_striped_profile_avx2_256_64_ws, "parasail_sw_striped_profile_avx2_256_64", "sw", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_striped_profile_avx2_256_32_ws, "parasail_sw_striped_profile_avx2_256_32", "sw", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_striped_profile_avx2_256_16_ws, "parasail_sw_striped_profile_avx2_256_16", "sw", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_striped_profile_avx2_256_8_ws, "parasail_sw_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sw_striped_profile_avx2_256_sat_ws, "parasail_sw_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+{parasail_sw_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_sw_blocked_profile_avx2_256_32_ws, "parasail_sw_blocked_profile_avx2_256_32", "sw", "blocked_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sw_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_sw_blocked_profile_avx2_256_16_ws, "parasail_sw_blocked_profile_avx2_256_16", "sw", "blocked_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sw_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_short_profile_avx2_256_32_ws, "parasail_sw_short_profile_avx2_256_32", "sw", "short_profile", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_sw_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_short_profile_avx2_256_16_ws, "parasail_sw_short_profile_avx2_256_16", "sw", "short_profile", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_sw_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_short_profile_avx2_256_8_ws, "parasail_sw_short_profile_avx2_256_8", "sw", "short_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_sw_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sw_scan_profile_knc_512_32", "sw", "scan_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
-{parasail_sw_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sw_striped_profile_knc_512_32", "sw", "striped_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
-#endif
-{parasail_sw_scan_profile_64,         parasail_profile_create_64,          "parasail_sw_scan_profile_64",         "sw", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
-{parasail_sw_scan_profile_32,         parasail_profile_create_32,          "parasail_sw_scan_profile_32",         "sw", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
-{parasail_sw_scan_profile_16,         parasail_profile_create_16,          "parasail_sw_scan_profile_16",         "sw", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
-{parasail_sw_scan_profile_8,          parasail_profile_create_8,           "parasail_sw_scan_profile_8",          "sw", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
-{parasail_sw_scan_profile_sat,        parasail_profile_create_sat,         "parasail_sw_scan_profile_sat",        "sw", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
-{parasail_sw_striped_profile_64,      parasail_profile_create_64,          "parasail_sw_striped_profile_64",      "sw", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
-{parasail_sw_striped_profile_32,      parasail_profile_create_32,          "parasail_sw_striped_profile_32",      "sw", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
-{parasail_sw_striped_profile_16,      parasail_profile_create_16,          "parasail_sw_striped_profile_16",      "sw", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
-{parasail_sw_striped_profile_8,       parasail_profile_create_8,           "parasail_sw_striped_profile_8",       "sw", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
-{parasail_sw_striped_profile_sat,     parasail_profile_create_sat,         "parasail_sw_striped_profile_sat",     "sw", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sw_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sw_scan_profile_knc_512_32_ws, "parasail_sw_scan_profile_knc_512_32", "sw", "scan_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
+{parasail_sw_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sw_striped_profile_knc_512_32_ws, "parasail_sw_striped_profile_knc_512_32", "sw", "striped_profile", "knc",   "512", "32", 16, 0, 0, 0, 0},
+#endif
+{parasail_sw_scan_profile_64,         parasail_profile_create_64,          parasail_sw_scan_profile_64_ws,         "parasail_sw_scan_profile_64",         "sw", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
+{parasail_sw_scan_profile_32,         parasail_profile_create_32,          parasail_sw_scan_profile_32_ws,         "parasail_sw_scan_profile_32",         "sw", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sw_scan_profile_16,         parasail_profile_create_16,          parasail_sw_scan_profile_16_ws,         "parasail_sw_scan_profile_16",         "sw", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sw_scan_profile_8,          parasail_profile_create_8,           parasail_sw_scan_profile_8_ws,          "parasail_sw_scan_profile_8",          "sw", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_sw_scan_profile_sat,        parasail_profile_create_sat,         parasail_sw_scan_profile_sat_ws,        "parasail_sw_scan_profile_sat",        "sw", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sw_striped_profile_64,      parasail_profile_create_64,          parasail_sw_striped_profile_64_ws,      "parasail_sw_striped_profile_64",      "sw", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 0, 0},
+{parasail_sw_striped_profile_32,      parasail_profile_create_32,          parasail_sw_striped_profile_32_ws,      "parasail_sw_striped_profile_32",      "sw", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sw_striped_profile_16,      parasail_profile_create_16,          parasail_sw_striped_profile_16_ws,      "parasail_sw_striped_profile_16",      "sw", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sw_striped_profile_8,       parasail_profile_create_8,           parasail_sw_striped_profile_8_ws,       "parasail_sw_striped_profile_8",       "sw", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_sw_striped_profile_sat,     parasail_profile_create_sat,         parasail_sw_striped_profile_sat_ws,     "parasail_sw_striped_profile_sat",     "sw", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_sw_blocked_profile_32,      parasail_profile_create_blocked_32,  parasail_sw_blocked_profile_32_ws,      "parasail_sw_blocked_profile_32",      "sw", "blocked_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sw_blocked_profile_16,      parasail_profile_create_blocked_16,  parasail_sw_blocked_profile_16_ws,      "parasail_sw_blocked_profile_16",      "sw", "blocked_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sw_short_profile_32,        parasail_profile_create_32,          parasail_sw_short_profile_32_ws,        "parasail_sw_short_profile_32",        "sw", "short_profile", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_sw_short_profile_16,        parasail_profile_create_16,          parasail_sw_short_profile_16_ws,        "parasail_sw_short_profile_16",        "sw", "short_profile", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_sw_short_profile_8,         parasail_profile_create_8,           parasail_sw_short_profile_8_ws,         "parasail_sw_short_profile_8",         "sw", "short_profile", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
 #if HAVE_SSE2
-{parasail_nw_stats_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_scan_profile_sse2_128_64", "nw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_scan_profile_sse2_128_32", "nw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_scan_profile_sse2_128_16", "nw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_scan_profile_sse2_128_8", "nw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_scan_profile_sse2_128_sat", "nw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_striped_profile_sse2_128_64", "nw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_striped_profile_sse2_128_32", "nw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_striped_profile_sse2_128_16", "nw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_striped_profile_sse2_128_8", "nw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_striped_profile_sse2_128_sat", "nw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_scan_profile_sse2_128_64_ws, "parasail_nw_stats_scan_profile_sse2_128_64", "nw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_scan_profile_sse2_128_32_ws, "parasail_nw_stats_scan_profile_sse2_128_32", "nw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_scan_profile_sse2_128_16_ws, "parasail_nw_stats_scan_profile_sse2_128_16", "nw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_scan_profile_sse2_128_8_ws, "parasail_nw_stats_scan_profile_sse2_128_8", "nw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_scan_profile_sse2_128_sat_ws, "parasail_nw_stats_scan_profile_sse2_128_sat", "nw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_striped_profile_sse2_128_64_ws, "parasail_nw_stats_striped_profile_sse2_128_64", "nw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_striped_profile_sse2_128_32_ws, "parasail_nw_stats_striped_profile_sse2_128_32", "nw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_striped_profile_sse2_128_16_ws, "parasail_nw_stats_striped_profile_sse2_128_16", "nw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_striped_profile_sse2_128_8_ws, "parasail_nw_stats_striped_profile_sse2_128_8", "nw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_striped_profile_sse2_128_sat_ws, "parasail_nw_stats_striped_profile_sse2_128_sat", "nw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_nw_stats_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_scan_profile_sse41_128_64", "nw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_scan_profile_sse41_128_32", "nw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_scan_profile_sse41_128_16", "nw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_scan_profile_sse41_128_8", "nw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_scan_profile_sse41_128_sat", "nw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_striped_profile_sse41_128_64", "nw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_striped_profile_sse41_128_32", "nw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_striped_profile_sse41_128_16", "nw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_striped_profile_sse41_128_8", "nw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_striped_profile_sse41_128_sat", "nw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_scan_profile_sse41_128_64_ws, "parasail_nw_stats_scan_profile_sse41_128_64", "nw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_scan_profile_sse41_128_32_ws, "parasail_nw_stats_scan_profile_sse41_128_32", "nw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_scan_profile_sse41_128_16_ws, "parasail_nw_stats_scan_profile_sse41_128_16", "nw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_scan_profile_sse41_128_8_ws, "parasail_nw_stats_scan_profile_sse41_128_8", "nw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_scan_profile_sse41_128_sat_ws, "parasail_nw_stats_scan_profile_sse41_128_sat", "nw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_striped_profile_sse41_128_64_ws, "parasail_nw_stats_striped_profile_sse41_128_64", "nw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_striped_profile_sse41_128_32_ws, "parasail_nw_stats_striped_profile_sse41_128_32", "nw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_striped_profile_sse41_128_16_ws, "parasail_nw_stats_striped_profile_sse41_128_16", "nw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_striped_profile_sse41_128_8_ws, "parasail_nw_stats_striped_profile_sse41_128_8", "nw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_striped_profile_sse41_128_sat_ws, "parasail_nw_stats_striped_profile_sse41_128_sat", "nw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_nw_stats_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_nw_stats_scan_profile_avx2_256_64", "nw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_nw_stats_scan_profile_avx2_256_32", "nw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_nw_stats_scan_profile_avx2_256_16", "nw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_scan_profile_avx2_256_8", "nw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_scan_profile_avx2_256_sat", "nw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_nw_stats_striped_profile_avx2_256_64", "nw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_nw_stats_striped_profile_avx2_256_32", "nw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_nw_stats_striped_profile_avx2_256_16", "nw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_nw_stats_scan_profile_avx2_256_64_ws, "parasail_nw_stats_scan_profile_avx2_256_64", "nw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_nw_stats_scan_profile_avx2_256_32_ws, "parasail_nw_stats_scan_profile_avx2_256_32", "nw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_nw_stats_scan_profile_avx2_256_16_ws, "parasail_nw_stats_scan_profile_avx2_256_16", "nw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_nw_stats_scan_profile_avx2_256_8_ws, "parasail_nw_stats_scan_profile_avx2_256_8", "nw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_nw_stats_scan_profile_avx2_256_sat_ws, "parasail_nw_stats_scan_profile_avx2_256_sat", "nw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_nw_stats_striped_profile_avx2_256_64_ws, "parasail_nw_stats_striped_profile_avx2_256_64", "nw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_nw_stats_striped_profile_avx2_256_32_ws, "parasail_nw_stats_striped_profile_avx2_256_32", "nw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_nw_stats_striped_profile_avx2_256_16_ws, "parasail_nw_stats_striped_profile_avx2_256_16", "nw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_nw_stats_striped_profile_avx2_256_8_ws, "parasail_nw_stats_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_nw_stats_striped_profile_avx2_256_sat_ws, "parasail_nw_stats_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_nw_stats_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_nw_stats_scan_profile_knc_512_32", "nw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_nw_stats_striped_profile_knc_512_32", "nw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
-#endif
-{parasail_nw_stats_scan_profile_64,   parasail_profile_create_stats_64,    "parasail_nw_stats_scan_profile_64",   "nw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_32,   parasail_profile_create_stats_32,    "parasail_nw_stats_scan_profile_32",   "nw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_16,   parasail_profile_create_stats_16,    "parasail_nw_stats_scan_profile_16",   "nw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_8,    parasail_profile_create_stats_8,     "parasail_nw_stats_scan_profile_8",    "nw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
-{parasail_nw_stats_scan_profile_sat,  parasail_profile_create_stats_sat,   "parasail_nw_stats_scan_profile_sat",  "nw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_64, parasail_profile_create_stats_64,    "parasail_nw_stats_striped_profile_64", "nw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_32, parasail_profile_create_stats_32,    "parasail_nw_stats_striped_profile_32", "nw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_16, parasail_profile_create_stats_16,    "parasail_nw_stats_striped_profile_16", "nw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_8, parasail_profile_create_stats_8,     "parasail_nw_stats_striped_profile_8", "nw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
-{parasail_nw_stats_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_nw_stats_striped_profile_sat", "nw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_nw_stats_scan_profile_knc_512_32_ws, "parasail_nw_stats_scan_profile_knc_512_32", "nw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_nw_stats_striped_profile_knc_512_32_ws, "parasail_nw_stats_striped_profile_knc_512_32", "nw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
+#endif
+{parasail_nw_stats_scan_profile_64,   parasail_profile_create_stats_64,    parasail_nw_stats_scan_profile_64_ws,   "parasail_nw_stats_scan_profile_64",   "nw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_32,   parasail_profile_create_stats_32,    parasail_nw_stats_scan_profile_32_ws,   "parasail_nw_stats_scan_profile_32",   "nw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_16,   parasail_profile_create_stats_16,    parasail_nw_stats_scan_profile_16_ws,   "parasail_nw_stats_scan_profile_16",   "nw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_8,    parasail_profile_create_stats_8,     parasail_nw_stats_scan_profile_8_ws,    "parasail_nw_stats_scan_profile_8",    "nw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_sat,  parasail_profile_create_stats_sat,   parasail_nw_stats_scan_profile_sat_ws,  "parasail_nw_stats_scan_profile_sat",  "nw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_64, parasail_profile_create_stats_64,    parasail_nw_stats_striped_profile_64_ws, "parasail_nw_stats_striped_profile_64", "nw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_32, parasail_profile_create_stats_32,    parasail_nw_stats_striped_profile_32_ws, "parasail_nw_stats_striped_profile_32", "nw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_16, parasail_profile_create_stats_16,    parasail_nw_stats_striped_profile_16_ws, "parasail_nw_stats_striped_profile_16", "nw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_8, parasail_profile_create_stats_8,     parasail_nw_stats_striped_profile_8_ws, "parasail_nw_stats_striped_profile_8", "nw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_nw_stats_striped_profile_sat_ws, "parasail_nw_stats_striped_profile_sat", "nw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
 #if HAVE_SSE2
-{parasail_sg_stats_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_scan_profile_sse2_128_64", "sg_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_scan_profile_sse2_128_32", "sg_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_scan_profile_sse2_128_16", "sg_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_scan_profile_sse2_128_8", "sg_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_scan_profile_sse2_128_sat", "sg_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_striped_profile_sse2_128_64", "sg_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_striped_profile_sse2_128_32", "sg_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_striped_profile_sse2_128_16", "sg_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_striped_profile_sse2_128_8", "sg_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_striped_profile_sse2_128_sat", "sg_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_scan_profile_sse2_128_64_ws, "parasail_sg_stats_scan_profile_sse2_128_64", "sg_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_scan_profile_sse2_128_32_ws, "parasail_sg_stats_scan_profile_sse2_128_32", "sg_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_scan_profile_sse2_128_16_ws, "parasail_sg_stats_scan_profile_sse2_128_16", "sg_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_scan_profile_sse2_128_8_ws, "parasail_sg_stats_scan_profile_sse2_128_8", "sg_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_scan_profile_sse2_128_sat_ws, "parasail_sg_stats_scan_profile_sse2_128_sat", "sg_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_striped_profile_sse2_128_64_ws, "parasail_sg_stats_striped_profile_sse2_128_64", "sg_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_striped_profile_sse2_128_32_ws, "parasail_sg_stats_striped_profile_sse2_128_32", "sg_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_striped_profile_sse2_128_16_ws, "parasail_sg_stats_striped_profile_sse2_128_16", "sg_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_striped_profile_sse2_128_8_ws, "parasail_sg_stats_striped_profile_sse2_128_8", "sg_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_striped_profile_sse2_128_sat_ws, "parasail_sg_stats_striped_profile_sse2_128_sat", "sg_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sg_stats_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_scan_profile_sse41_128_64", "sg_stats", "scan_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_scan_profile_sse41_128_32", "sg_stats", "scan_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_scan_profile_sse41_128_16", "sg_stats", "scan_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_scan_profile_sse41_128_8", "sg_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_scan_profile_sse41_128_sat", "sg_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_striped_profile_sse41_128_64", "sg_stats", "striped_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_striped_profile_sse41_128_32", "sg_stats", "striped_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_striped_profile_sse41_128_16", "sg_stats", "striped_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_striped_profile_sse41_128_8", "sg_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_striped_profile_sse41_128_sat", "sg_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_scan_profile_sse41_128_64_ws, "parasail_sg_stats_scan_profile_sse41_128_64", "sg_stats", "scan_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_scan_profile_sse41_128_32_ws, "parasail_sg_stats_scan_profile_sse41_128_32", "sg_stats", "scan_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_scan_profile_sse41_128_16_ws, "parasail_sg_stats_scan_profile_sse41_128_16", "sg_stats", "scan_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_scan_profile_sse41_128_8_ws, "parasail_sg_stats_scan_profile_sse41_128_8", "sg_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_scan_profile_sse41_128_sat_ws, "parasail_sg_stats_scan_profile_sse41_128_sat", "sg_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_striped_profile_sse41_128_64_ws, "parasail_sg_stats_striped_profile_sse41_128_64", "sg_stats", "striped_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_striped_profile_sse41_128_32_ws, "parasail_sg_stats_striped_profile_sse41_128_32", "sg_stats", "striped_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_striped_profile_sse41_128_16_ws, "parasail_sg_stats_striped_profile_sse41_128_16", "sg_stats", "striped_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_striped_profile_sse41_128_8_ws, "parasail_sg_stats_striped_profile_sse41_128_8", "sg_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_striped_profile_sse41_128_sat_ws, "parasail_sg_stats_striped_profile_sse41_128_sat", "sg_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sg_stats_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sg_stats_scan_profile_avx2_256_64", "sg_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sg_stats_scan_profile_avx2_256_32", "sg_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sg_stats_scan_profile_avx2_256_16", "sg_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_scan_profile_avx2_256_8", "sg_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_scan_profile_avx2_256_sat", "sg_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sg_stats_striped_profile_avx2_256_64", "sg_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sg_stats_striped_profile_avx2_256_32", "sg_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sg_stats_striped_profile_avx2_256_16", "sg_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sg_stats_scan_profile_avx2_256_64_ws, "parasail_sg_stats_scan_profile_avx2_256_64", "sg_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sg_stats_scan_profile_avx2_256_32_ws, "parasail_sg_stats_scan_profile_avx2_256_32", "sg_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sg_stats_scan_profile_avx2_256_16_ws, "parasail_sg_stats_scan_profile_avx2_256_16", "sg_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sg_stats_scan_profile_avx2_256_8_ws, "parasail_sg_stats_scan_profile_avx2_256_8", "sg_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sg_stats_scan_profile_avx2_256_sat_ws, "parasail_sg_stats_scan_profile_avx2_256_sat", "sg_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sg_stats_striped_profile_avx2_256_64_ws, "parasail_sg_stats_striped_profile_avx2_256_64", "sg_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sg_stats_striped_profile_avx2_256_32_ws, "parasail_sg_stats_striped_profile_avx2_256_32", "sg_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sg_stats_striped_profile_avx2_256_16_ws, "parasail_sg_stats_striped_profile_avx2_256_16", "sg_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sg_stats_striped_profile_avx2_256_8_ws, "parasail_sg_stats_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sg_stats_striped_profile_avx2_256_sat_ws, "parasail_sg_stats_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_sg_stats_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sg_stats_scan_profile_knc_512_32", "sg_stats", "scan_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sg_stats_striped_profile_knc_512_32", "sg_stats", "striped_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
-#endif
-{parasail_sg_stats_scan_profile_64,   parasail_profile_create_stats_64,    "parasail_sg_stats_scan_profile_64",   "sg_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_32,   parasail_profile_create_stats_32,    "parasail_sg_stats_scan_profile_32",   "sg_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_16,   parasail_profile_create_stats_16,    "parasail_sg_stats_scan_profile_16",   "sg_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_8,    parasail_profile_create_stats_8,     "parasail_sg_stats_scan_profile_8",    "sg_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
-{parasail_sg_stats_scan_profile_sat,  parasail_profile_create_stats_sat,   "parasail_sg_stats_scan_profile_sat",  "sg_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_64, parasail_profile_create_stats_64,    "parasail_sg_stats_striped_profile_64", "sg_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_32, parasail_profile_create_stats_32,    "parasail_sg_stats_striped_profile_32", "sg_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_16, parasail_profile_create_stats_16,    "parasail_sg_stats_striped_profile_16", "sg_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_8, parasail_profile_create_stats_8,     "parasail_sg_stats_striped_profile_8", "sg_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
-{parasail_sg_stats_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_sg_stats_striped_profile_sat", "sg_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sg_stats_scan_profile_knc_512_32_ws, "parasail_sg_stats_scan_profile_knc_512_32", "sg_stats", "scan_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sg_stats_striped_profile_knc_512_32_ws, "parasail_sg_stats_striped_profile_knc_512_32", "sg_stats", "striped_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
+#endif
+{parasail_sg_stats_scan_profile_64,   parasail_profile_create_stats_64,    parasail_sg_stats_scan_profile_64_ws,   "parasail_sg_stats_scan_profile_64",   "sg_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_32,   parasail_profile_create_stats_32,    parasail_sg_stats_scan_profile_32_ws,   "parasail_sg_stats_scan_profile_32",   "sg_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_16,   parasail_profile_create_stats_16,    parasail_sg_stats_scan_profile_16_ws,   "parasail_sg_stats_scan_profile_16",   "sg_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_8,    parasail_profile_create_stats_8,     parasail_sg_stats_scan_profile_8_ws,    "parasail_sg_stats_scan_profile_8",    "sg_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_sat,  parasail_profile_create_stats_sat,   parasail_sg_stats_scan_profile_sat_ws,  "parasail_sg_stats_scan_profile_sat",  "sg_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_64, parasail_profile_create_stats_64,    parasail_sg_stats_striped_profile_64_ws, "parasail_sg_stats_striped_profile_64", "sg_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_32, parasail_profile_create_stats_32,    parasail_sg_stats_striped_profile_32_ws, "parasail_sg_stats_striped_profile_32", "sg_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_16, parasail_profile_create_stats_16,    parasail_sg_stats_striped_profile_16_ws, "parasail_sg_stats_striped_profile_16", "sg_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_8, parasail_profile_create_stats_8,     parasail_sg_stats_striped_profile_8_ws, "parasail_sg_stats_striped_profile_8", "sg_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_sg_stats_striped_profile_sat_ws, "parasail_sg_stats_striped_profile_sat", "sg_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
 #if HAVE_SSE2
-{parasail_sw_stats_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_scan_profile_sse2_128_64", "sw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_scan_profile_sse2_128_32", "sw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_scan_profile_sse2_128_16", "sw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_scan_profile_sse2_128_8", "sw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_scan_profile_sse2_128_sat", "sw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_striped_profile_sse2_128_64", "sw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_striped_profile_sse2_128_32", "sw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_striped_profile_sse2_128_16", "sw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_striped_profile_sse2_128_8", "sw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_striped_profile_sse2_128_sat", "sw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_scan_profile_sse2_128_64_ws, "parasail_sw_stats_scan_profile_sse2_128_64", "sw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_scan_profile_sse2_128_32_ws, "parasail_sw_stats_scan_profile_sse2_128_32", "sw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_scan_profile_sse2_128_16_ws, "parasail_sw_stats_scan_profile_sse2_128_16", "sw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_scan_profile_sse2_128_8_ws, "parasail_sw_stats_scan_profile_sse2_128_8", "sw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_scan_profile_sse2_128_sat_ws, "parasail_sw_stats_scan_profile_sse2_128_sat", "sw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_striped_profile_sse2_128_64_ws, "parasail_sw_stats_striped_profile_sse2_128_64", "sw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_striped_profile_sse2_128_32_ws, "parasail_sw_stats_striped_profile_sse2_128_32", "sw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_striped_profile_sse2_128_16_ws, "parasail_sw_stats_striped_profile_sse2_128_16", "sw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_striped_profile_sse2_128_8_ws, "parasail_sw_stats_striped_profile_sse2_128_8", "sw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_striped_profile_sse2_128_sat_ws, "parasail_sw_stats_striped_profile_sse2_128_sat", "sw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 0, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sw_stats_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_scan_profile_sse41_128_64", "sw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_scan_profile_sse41_128_32", "sw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_scan_profile_sse41_128_16", "sw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_scan_profile_sse41_128_8", "sw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_scan_profile_sse41_128_sat", "sw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_striped_profile_sse41_128_64", "sw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_striped_profile_sse41_128_32", "sw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_striped_profile_sse41_128_16", "sw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_striped_profile_sse41_128_8", "sw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_striped_profile_sse41_128_sat", "sw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_scan_profile_sse41_128_64_ws, "parasail_sw_stats_scan_profile_sse41_128_64", "sw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_scan_profile_sse41_128_32_ws, "parasail_sw_stats_scan_profile_sse41_128_32", "sw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_scan_profile_sse41_128_16_ws, "parasail_sw_stats_scan_profile_sse41_128_16", "sw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_scan_profile_sse41_128_8_ws, "parasail_sw_stats_scan_profile_sse41_128_8", "sw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_scan_profile_sse41_128_sat_ws, "parasail_sw_stats_scan_profile_sse41_128_sat", "sw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_striped_profile_sse41_128_64_ws, "parasail_sw_stats_striped_profile_sse41_128_64", "sw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_striped_profile_sse41_128_32_ws, "parasail_sw_stats_striped_profile_sse41_128_32", "sw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_striped_profile_sse41_128_16_ws, "parasail_sw_stats_striped_profile_sse41_128_16", "sw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_striped_profile_sse41_128_8_ws, "parasail_sw_stats_striped_profile_sse41_128_8", "sw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_striped_profile_sse41_128_sat_ws, "parasail_sw_stats_striped_profile_sse41_128_sat", "sw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 0, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sw_stats_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sw_stats_scan_profile_avx2_256_64", "sw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sw_stats_scan_profile_avx2_256_32", "sw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sw_stats_scan_profile_avx2_256_16", "sw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_scan_profile_avx2_256_8", "sw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_scan_profile_avx2_256_sat", "sw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sw_stats_striped_profile_avx2_256_64", "sw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sw_stats_striped_profile_avx2_256_32", "sw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sw_stats_striped_profile_avx2_256_16", "sw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sw_stats_scan_profile_avx2_256_64_ws, "parasail_sw_stats_scan_profile_avx2_256_64", "sw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sw_stats_scan_profile_avx2_256_32_ws, "parasail_sw_stats_scan_profile_avx2_256_32", "sw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sw_stats_scan_profile_avx2_256_16_ws, "parasail_sw_stats_scan_profile_avx2_256_16", "sw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sw_stats_scan_profile_avx2_256_8_ws, "parasail_sw_stats_scan_profile_avx2_256_8", "sw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sw_stats_scan_profile_avx2_256_sat_ws, "parasail_sw_stats_scan_profile_avx2_256_sat", "sw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sw_stats_striped_profile_avx2_256_64_ws, "parasail_sw_stats_striped_profile_avx2_256_64", "sw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sw_stats_striped_profile_avx2_256_32_ws, "parasail_sw_stats_striped_profile_avx2_256_32", "sw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sw_stats_striped_profile_avx2_256_16_ws, "parasail_sw_stats_striped_profile_avx2_256_16", "sw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sw_stats_striped_profile_avx2_256_8_ws, "parasail_sw_stats_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sw_stats_striped_profile_avx2_256_sat_ws, "parasail_sw_stats_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_sw_stats_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sw_stats_scan_profile_knc_512_32", "sw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sw_stats_striped_profile_knc_512_32", "sw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
-#endif
-{parasail_sw_stats_scan_profile_64,   parasail_profile_create_stats_64,    "parasail_sw_stats_scan_profile_64",   "sw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_32,   parasail_profile_create_stats_32,    "parasail_sw_stats_scan_profile_32",   "sw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_16,   parasail_profile_create_stats_16,    "parasail_sw_stats_scan_profile_16",   "sw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_8,    parasail_profile_create_stats_8,     "parasail_sw_stats_scan_profile_8",    "sw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
-{parasail_sw_stats_scan_profile_sat,  parasail_profile_create_stats_sat,   "parasail_sw_stats_scan_profile_sat",  "sw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_64, parasail_profile_create_stats_64,    "parasail_sw_stats_striped_profile_64", "sw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_32, parasail_profile_create_stats_32,    "parasail_sw_stats_striped_profile_32", "sw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_16, parasail_profile_create_stats_16,    "parasail_sw_stats_striped_profile_16", "sw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_8, parasail_profile_create_stats_8,     "parasail_sw_stats_striped_profile_8", "sw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
-{parasail_sw_stats_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_sw_stats_striped_profile_sat", "sw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sw_stats_scan_profile_knc_512_32_ws, "parasail_sw_stats_scan_profile_knc_512_32", "sw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sw_stats_striped_profile_knc_512_32_ws, "parasail_sw_stats_striped_profile_knc_512_32", "sw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 0, 1, 0},
+#endif
+{parasail_sw_stats_scan_profile_64,   parasail_profile_create_stats_64,    parasail_sw_stats_scan_profile_64_ws,   "parasail_sw_stats_scan_profile_64",   "sw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_32,   parasail_profile_create_stats_32,    parasail_sw_stats_scan_profile_32_ws,   "parasail_sw_stats_scan_profile_32",   "sw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_16,   parasail_profile_create_stats_16,    parasail_sw_stats_scan_profile_16_ws,   "parasail_sw_stats_scan_profile_16",   "sw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_8,    parasail_profile_create_stats_8,     parasail_sw_stats_scan_profile_8_ws,    "parasail_sw_stats_scan_profile_8",    "sw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_sat,  parasail_profile_create_stats_sat,   parasail_sw_stats_scan_profile_sat_ws,  "parasail_sw_stats_scan_profile_sat",  "sw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_64, parasail_profile_create_stats_64,    parasail_sw_stats_striped_profile_64_ws, "parasail_sw_stats_striped_profile_64", "sw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_32, parasail_profile_create_stats_32,    parasail_sw_stats_striped_profile_32_ws, "parasail_sw_stats_striped_profile_32", "sw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_16, parasail_profile_create_stats_16,    parasail_sw_stats_striped_profile_16_ws, "parasail_sw_stats_striped_profile_16", "sw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_8, parasail_profile_create_stats_8,     parasail_sw_stats_striped_profile_8_ws, "parasail_sw_stats_striped_profile_8", "sw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_sw_stats_striped_profile_sat_ws, "parasail_sw_stats_striped_profile_sat", "sw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 0, 1, 0},
 #if HAVE_SSE2
-{parasail_nw_table_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_table_scan_profile_sse2_128_64", "nw", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_table_scan_profile_sse2_128_32", "nw", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_table_scan_profile_sse2_128_16", "nw", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_table_scan_profile_sse2_128_8", "nw", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_table_scan_profile_sse2_128_sat", "nw", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_table_striped_profile_sse2_128_64", "nw", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_table_striped_profile_sse2_128_32", "nw", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_table_striped_profile_sse2_128_16", "nw", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_table_striped_profile_sse2_128_8", "nw", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_table_striped_profile_sse2_128_sat", "nw", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_nw_table_scan_profile_sse2_128_64_ws, "parasail_nw_table_scan_profile_sse2_128_64", "nw", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_nw_table_scan_profile_sse2_128_32_ws, "parasail_nw_table_scan_profile_sse2_128_32", "nw", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_nw_table_scan_profile_sse2_128_16_ws, "parasail_nw_table_scan_profile_sse2_128_16", "nw", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_nw_table_scan_profile_sse2_128_8_ws, "parasail_nw_table_scan_profile_sse2_128_8", "nw", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_table_scan_profile_sse2_128_sat_ws, "parasail_nw_table_scan_profile_sse2_128_sat", "nw", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_nw_table_striped_profile_sse2_128_64_ws, "parasail_nw_table_striped_profile_sse2_128_64", "nw", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_nw_table_striped_profile_sse2_128_32_ws, "parasail_nw_table_striped_profile_sse2_128_32", "nw", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_nw_table_striped_profile_sse2_128_16_ws, "parasail_nw_table_striped_profile_sse2_128_16", "nw", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_nw_table_striped_profile_sse2_128_8_ws, "parasail_nw_table_striped_profile_sse2_128_8", "nw", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_table_striped_profile_sse2_128_sat_ws, "parasail_nw_table_striped_profile_sse2_128_sat", "nw", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_nw_table_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_table_scan_profile_sse41_128_64", "nw", "scan_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_table_scan_profile_sse41_128_32", "nw", "scan_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_table_scan_profile_sse41_128_16", "nw", "scan_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_table_scan_profile_sse41_128_8", "nw", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_table_scan_profile_sse41_128_sat", "nw", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_table_striped_profile_sse41_128_64", "nw", "striped_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_table_striped_profile_sse41_128_32", "nw", "striped_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_table_striped_profile_sse41_128_16", "nw", "striped_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_table_striped_profile_sse41_128_8", "nw", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_table_striped_profile_sse41_128_sat", "nw", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_nw_table_scan_profile_sse41_128_64_ws, "parasail_nw_table_scan_profile_sse41_128_64", "nw", "scan_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_table_scan_profile_sse41_128_32_ws, "parasail_nw_table_scan_profile_sse41_128_32", "nw", "scan_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_table_scan_profile_sse41_128_16_ws, "parasail_nw_table_scan_profile_sse41_128_16", "nw", "scan_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_table_scan_profile_sse41_128_8_ws, "parasail_nw_table_scan_profile_sse41_128_8", "nw", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_table_scan_profile_sse41_128_sat_ws, "parasail_nw_table_scan_profile_sse41_128_sat", "nw", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_nw_table_striped_profile_sse41_128_64_ws, "parasail_nw_table_striped_profile_sse41_128_64", "nw", "striped_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_table_striped_profile_sse41_128_32_ws, "parasail_nw_table_striped_profile_sse41_128_32", "nw", "striped_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_table_striped_profile_sse41_128_16_ws, "parasail_nw_table_striped_profile_sse41_128_16", "nw", "striped_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_table_striped_profile_sse41_128_8_ws, "parasail_nw_table_striped_profile_sse41_128_8", "nw", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_table_striped_profile_sse41_128_sat_ws, "parasail_nw_table_striped_profile_sse41_128_sat", "nw", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_nw_table_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_nw_table_blocked_profile_sse41_128_32_ws, "parasail_nw_table_blocked_profile_sse41_128_32", "nw", "blocked_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_nw_table_blocked_profile_sse41_128_16_ws, "parasail_nw_table_blocked_profile_sse41_128_16", "nw", "blocked_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_table_short_profile_sse41_128_32_ws, "parasail_nw_table_short_profile_sse41_128_32", "nw", "short_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_table_short_profile_sse41_128_16_ws, "parasail_nw_table_short_profile_sse41_128_16", "nw", "short_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_table_short_profile_sse41_128_8_ws, "parasail_nw_table_short_profile_sse41_128_8", "nw", "short_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_nw_table_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_nw_table_scan_profile_avx2_256_64", "nw", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_nw_table_scan_profile_avx2_256_32", "nw", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_nw_table_scan_profile_avx2_256_16", "nw", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_table_scan_profile_avx2_256_8", "nw", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_table_scan_profile_avx2_256_sat", "nw", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_nw_table_striped_profile_avx2_256_64", "nw", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_nw_table_striped_profile_avx2_256_32", "nw", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_nw_table_striped_profile_avx2_256_16", "nw", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_table_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_table_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_nw_table_scan_profile_avx2_256_64_ws, "parasail_nw_table_scan_profile_avx2_256_64", "nw", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_table_scan_profile_avx2_256_32_ws, "parasail_nw_table_scan_profile_avx2_256_32", "nw", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_table_scan_profile_avx2_256_16_ws, "parasail_nw_table_scan_profile_avx2_256_16", "nw", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_table_scan_profile_avx2_256_8_ws, "parasail_nw_table_scan_profile_avx2_256_8", "nw", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_nw_table_scan_profile_avx2_256_sat_ws, "parasail_nw_table_scan_profile_avx2_256_sat", "nw", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_nw_table_striped_profile_avx2_256_64_ws, "parasail_nw_table_striped_profile_avx2_256_64", "nw", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_table_striped_profile_avx2_256_32_ws, "parasail_nw_table_striped_profile_avx2_256_32", "nw", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_table_striped_profile_avx2_256_16_ws, "parasail_nw_table_striped_profile_avx2_256_16", "nw", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_table_striped_profile_avx2_256_8_ws, "parasail_nw_table_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_nw_table_striped_profile_avx2_256_sat_ws, "parasail_nw_table_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_nw_table_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_nw_table_blocked_profile_avx2_256_32_ws, "parasail_nw_table_blocked_profile_avx2_256_32", "nw", "blocked_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_nw_table_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_nw_table_blocked_profile_avx2_256_16_ws, "parasail_nw_table_blocked_profile_avx2_256_16", "nw", "blocked_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_table_short_profile_avx2_256_32_ws, "parasail_nw_table_short_profile_avx2_256_32", "nw", "short_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_table_short_profile_avx2_256_16_ws, "parasail_nw_table_short_profile_avx2_256_16", "nw", "short_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_table_short_profile_avx2_256_8_ws, "parasail_nw_table_short_profile_avx2_256_8", "nw", "short_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_nw_table_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_nw_table_scan_profile_knc_512_32", "nw", "scan_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_nw_table_striped_profile_knc_512_32", "nw", "striped_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
-#endif
-{parasail_nw_table_scan_profile_64,   parasail_profile_create_64,          "parasail_nw_table_scan_profile_64",   "nw", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_32,   parasail_profile_create_32,          "parasail_nw_table_scan_profile_32",   "nw", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_16,   parasail_profile_create_16,          "parasail_nw_table_scan_profile_16",   "nw", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_8,    parasail_profile_create_8,           "parasail_nw_table_scan_profile_8",    "nw", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
-{parasail_nw_table_scan_profile_sat,  parasail_profile_create_sat,         "parasail_nw_table_scan_profile_sat",  "nw", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_64, parasail_profile_create_64,          "parasail_nw_table_striped_profile_64", "nw", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_32, parasail_profile_create_32,          "parasail_nw_table_striped_profile_32", "nw", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_16, parasail_profile_create_16,          "parasail_nw_table_striped_profile_16", "nw", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_8, parasail_profile_create_8,           "parasail_nw_table_striped_profile_8", "nw", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
-{parasail_nw_table_striped_profile_sat, parasail_profile_create_sat,         "parasail_nw_table_striped_profile_sat", "nw", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_nw_table_scan_profile_knc_512_32_ws, "parasail_nw_table_scan_profile_knc_512_32", "nw", "scan_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_nw_table_striped_profile_knc_512_32_ws, "parasail_nw_table_striped_profile_knc_512_32", "nw", "striped_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
+#endif
+{parasail_nw_table_scan_profile_64,   parasail_profile_create_64,          parasail_nw_table_scan_profile_64_ws,   "parasail_nw_table_scan_profile_64",   "nw", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_32,   parasail_profile_create_32,          parasail_nw_table_scan_profile_32_ws,   "parasail_nw_table_scan_profile_32",   "nw", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_16,   parasail_profile_create_16,          parasail_nw_table_scan_profile_16_ws,   "parasail_nw_table_scan_profile_16",   "nw", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_8,    parasail_profile_create_8,           parasail_nw_table_scan_profile_8_ws,    "parasail_nw_table_scan_profile_8",    "nw", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{parasail_nw_table_scan_profile_sat,  parasail_profile_create_sat,         parasail_nw_table_scan_profile_sat_ws,  "parasail_nw_table_scan_profile_sat",  "nw", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_64, parasail_profile_create_64,          parasail_nw_table_striped_profile_64_ws, "parasail_nw_table_striped_profile_64", "nw", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_32, parasail_profile_create_32,          parasail_nw_table_striped_profile_32_ws, "parasail_nw_table_striped_profile_32", "nw", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_16, parasail_profile_create_16,          parasail_nw_table_striped_profile_16_ws, "parasail_nw_table_striped_profile_16", "nw", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_8, parasail_profile_create_8,           parasail_nw_table_striped_profile_8_ws, "parasail_nw_table_striped_profile_8", "nw", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{parasail_nw_table_striped_profile_sat, parasail_profile_create_sat,         parasail_nw_table_striped_profile_sat_ws, "parasail_nw_table_striped_profile_sat", "nw", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_nw_table_blocked_profile_32, parasail_profile_create_blocked_32,  parasail_nw_table_blocked_profile_32_ws, "parasail_nw_table_blocked_profile_32", "nw", "blocked_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_nw_table_blocked_profile_16, parasail_profile_create_blocked_16,  parasail_nw_table_blocked_profile_16_ws, "parasail_nw_table_blocked_profile_16", "nw", "blocked_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_32,  parasail_profile_create_32,          parasail_nw_table_short_profile_32_ws,  "parasail_nw_table_short_profile_32",  "nw", "short_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_16,  parasail_profile_create_16,          parasail_nw_table_short_profile_16_ws,  "parasail_nw_table_short_profile_16",  "nw", "short_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_nw_table_short_profile_8,   parasail_profile_create_8,           parasail_nw_table_short_profile_8_ws,   "parasail_nw_table_short_profile_8",   "nw", "short_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 #if HAVE_SSE2
-{parasail_sg_table_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_table_scan_profile_sse2_128_64", "sg", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_table_scan_profile_sse2_128_32", "sg", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_table_scan_profile_sse2_128_16", "sg", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_table_scan_profile_sse2_128_8", "sg", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_table_scan_profile_sse2_128_sat", "sg", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_table_striped_profile_sse2_128_64", "sg", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_table_striped_profile_sse2_128_32", "sg", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_table_striped_profile_sse2_128_16", "sg", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_table_striped_profile_sse2_128_8", "sg", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_table_striped_profile_sse2_128_sat", "sg", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sg_table_scan_profile_sse2_128_64_ws, "parasail_sg_table_scan_profile_sse2_128_64", "sg", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sg_table_scan_profile_sse2_128_32_ws, "parasail_sg_table_scan_profile_sse2_128_32", "sg", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sg_table_scan_profile_sse2_128_16_ws, "parasail_sg_table_scan_profile_sse2_128_16", "sg", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sg_table_scan_profile_sse2_128_8_ws, "parasail_sg_table_scan_profile_sse2_128_8", "sg", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_table_scan_profile_sse2_128_sat_ws, "parasail_sg_table_scan_profile_sse2_128_sat", "sg", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sg_table_striped_profile_sse2_128_64_ws, "parasail_sg_table_striped_profile_sse2_128_64", "sg", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sg_table_striped_profile_sse2_128_32_ws, "parasail_sg_table_striped_profile_sse2_128_32", "sg", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sg_table_striped_profile_sse2_128_16_ws, "parasail_sg_table_striped_profile_sse2_128_16", "sg", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sg_table_striped_profile_sse2_128_8_ws, "parasail_sg_table_striped_profile_sse2_128_8", "sg", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_table_striped_profile_sse2_128_sat_ws, "parasail_sg_table_striped_profile_sse2_128_sat", "sg", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sg_table_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_table_scan_profile_sse41_128_64", "sg", "scan_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_table_scan_profile_sse41_128_32", "sg", "scan_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_table_scan_profile_sse41_128_16", "sg", "scan_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_table_scan_profile_sse41_128_8", "sg", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_table_scan_profile_sse41_128_sat", "sg", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_table_striped_profile_sse41_128_64", "sg", "striped_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_table_striped_profile_sse41_128_32", "sg", "striped_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_table_striped_profile_sse41_128_16", "sg", "striped_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_table_striped_profile_sse41_128_8", "sg", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_table_striped_profile_sse41_128_sat", "sg", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sg_table_scan_profile_sse41_128_64_ws, "parasail_sg_table_scan_profile_sse41_128_64", "sg", "scan_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_table_scan_profile_sse41_128_32_ws, "parasail_sg_table_scan_profile_sse41_128_32", "sg", "scan_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_table_scan_profile_sse41_128_16_ws, "parasail_sg_table_scan_profile_sse41_128_16", "sg", "scan_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_table_scan_profile_sse41_128_8_ws, "parasail_sg_table_scan_profile_sse41_128_8", "sg", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_table_scan_profile_sse41_128_sat_ws, "parasail_sg_table_scan_profile_sse41_128_sat", "sg", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sg_table_striped_profile_sse41_128_64_ws, "parasail_sg_table_striped_profile_sse41_128_64", "sg", "striped_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_table_striped_profile_sse41_128_32_ws, "parasail_sg_table_striped_profile_sse41_128_32", "sg", "striped_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_table_striped_profile_sse41_128_16_ws, "parasail_sg_table_striped_profile_sse41_128_16", "sg", "striped_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_table_striped_profile_sse41_128_8_ws, "parasail_sg_table_striped_profile_sse41_128_8", "sg", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_table_striped_profile_sse41_128_sat_ws, "parasail_sg_table_striped_profile_sse41_128_sat", "sg", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sg_table_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_sg_table_blocked_profile_sse41_128_32_ws, "parasail_sg_table_blocked_profile_sse41_128_32", "sg", "blocked_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_sg_table_blocked_profile_sse41_128_16_ws, "parasail_sg_table_blocked_profile_sse41_128_16", "sg", "blocked_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_table_short_profile_sse41_128_32_ws, "parasail_sg_table_short_profile_sse41_128_32", "sg", "short_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_table_short_profile_sse41_128_16_ws, "parasail_sg_table_short_profile_sse41_128_16", "sg", "short_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_table_short_profile_sse41_128_8_ws, "parasail_sg_table_short_profile_sse41_128_8", "sg", "short_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sg_table_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sg_table_scan_profile_avx2_256_64", "sg", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sg_table_scan_profile_avx2_256_32", "sg", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sg_table_scan_profile_avx2_256_16", "sg", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_table_scan_profile_avx2_256_8", "sg", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_table_scan_profile_avx2_256_sat", "sg", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sg_table_striped_profile_avx2_256_64", "sg", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sg_table_striped_profile_avx2_256_32", "sg", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sg_table_striped_profile_avx2_256_16", "sg", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_table_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_table_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sg_table_scan_profile_avx2_256_64_ws, "parasail_sg_table_scan_profile_avx2_256_64", "sg", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_table_scan_profile_avx2_256_32_ws, "parasail_sg_table_scan_profile_avx2_256_32", "sg", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_table_scan_profile_avx2_256_16_ws, "parasail_sg_table_scan_profile_avx2_256_16", "sg", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_table_scan_profile_avx2_256_8_ws, "parasail_sg_table_scan_profile_avx2_256_8", "sg", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sg_table_scan_profile_avx2_256_sat_ws, "parasail_sg_table_scan_profile_avx2_256_sat", "sg", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sg_table_striped_profile_avx2_256_64_ws, "parasail_sg_table_striped_profile_avx2_256_64", "sg", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_table_striped_profile_avx2_256_32_ws, "parasail_sg_table_striped_profile_avx2_256_32", "sg", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_table_striped_profile_avx2_256_16_ws, "parasail_sg_table_striped_profile_avx2_256_16", "sg", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_table_striped_profile_avx2_256_8_ws, "parasail_sg_table_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sg_table_striped_profile_avx2_256_sat_ws, "parasail_sg_table_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sg_table_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_sg_table_blocked_profile_avx2_256_32_ws, "parasail_sg_table_blocked_profile_avx2_256_32", "sg", "blocked_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sg_table_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_sg_table_blocked_profile_avx2_256_16_ws, "parasail_sg_table_blocked_profile_avx2_256_16", "sg", "blocked_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_table_short_profile_avx2_256_32_ws, "parasail_sg_table_short_profile_avx2_256_32", "sg", "short_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_table_short_profile_avx2_256_16_ws, "parasail_sg_table_short_profile_avx2_256_16", "sg", "short_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_table_short_profile_avx2_256_8_ws, "parasail_sg_table_short_profile_avx2_256_8", "sg", "short_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_sg_table_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sg_table_scan_profile_knc_512_32", "sg", "scan_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sg_table_striped_profile_knc_512_32", "sg", "striped_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
-#endif
-{parasail_sg_table_scan_profile_64,   parasail_profile_create_64,          "parasail_sg_table_scan_profile_64",   "sg", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_32,   parasail_profile_create_32,          "parasail_sg_table_scan_profile_32",   "sg", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_16,   parasail_profile_create_16,          "parasail_sg_table_scan_profile_16",   "sg", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_8,    parasail_profile_create_8,           "parasail_sg_table_scan_profile_8",    "sg", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
-{parasail_sg_table_scan_profile_sat,  parasail_profile_create_sat,         "parasail_sg_table_scan_profile_sat",  "sg", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_64, parasail_profile_create_64,          "parasail_sg_table_striped_profile_64", "sg", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_32, parasail_profile_create_32,          "parasail_sg_table_striped_profile_32", "sg", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_16, parasail_profile_create_16,          "parasail_sg_table_striped_profile_16", "sg", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_8, parasail_profile_create_8,           "parasail_sg_table_striped_profile_8", "sg", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
-{parasail_sg_table_striped_profile_sat, parasail_profile_create_sat,         "parasail_sg_table_striped_profile_sat", "sg", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sg_table_scan_profile_knc_512_32_ws, "parasail_sg_table_scan_profile_knc_512_32", "sg", "scan_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sg_table_striped_profile_knc_512_32_ws, "parasail_sg_table_striped_profile_knc_512_32", "sg", "striped_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
+#endif
+{parasail_sg_table_scan_profile_64,   parasail_profile_create_64,          parasail_sg_table_scan_profile_64_ws,   "parasail_sg_table_scan_profile_64",   "sg", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_32,   parasail_profile_create_32,          parasail_sg_table_scan_profile_32_ws,   "parasail_sg_table_scan_profile_32",   "sg", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_16,   parasail_profile_create_16,          parasail_sg_table_scan_profile_16_ws,   "parasail_sg_table_scan_profile_16",   "sg", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_8,    parasail_profile_create_8,           parasail_sg_table_scan_profile_8_ws,    "parasail_sg_table_scan_profile_8",    "sg", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{parasail_sg_table_scan_profile_sat,  parasail_profile_create_sat,         parasail_sg_table_scan_profile_sat_ws,  "parasail_sg_table_scan_profile_sat",  "sg", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_64, parasail_profile_create_64,          parasail_sg_table_striped_profile_64_ws, "parasail_sg_table_striped_profile_64", "sg", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_32, parasail_profile_create_32,          parasail_sg_table_striped_profile_32_ws, "parasail_sg_table_striped_profile_32", "sg", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_16, parasail_profile_create_16,          parasail_sg_table_striped_profile_16_ws, "parasail_sg_table_striped_profile_16", "sg", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_8, parasail_profile_create_8,           parasail_sg_table_striped_profile_8_ws, "parasail_sg_table_striped_profile_8", "sg", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{parasail_sg_table_striped_profile_sat, parasail_profile_create_sat,         parasail_sg_table_striped_profile_sat_ws, "parasail_sg_table_striped_profile_sat", "sg", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sg_table_blocked_profile_32, parasail_profile_create_blocked_32,  parasail_sg_table_blocked_profile_32_ws, "parasail_sg_table_blocked_profile_32", "sg", "blocked_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sg_table_blocked_profile_16, parasail_profile_create_blocked_16,  parasail_sg_table_blocked_profile_16_ws, "parasail_sg_table_blocked_profile_16", "sg", "blocked_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_32,  parasail_profile_create_32,          parasail_sg_table_short_profile_32_ws,  "parasail_sg_table_short_profile_32",  "sg", "short_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_16,  parasail_profile_create_16,          parasail_sg_table_short_profile_16_ws,  "parasail_sg_table_short_profile_16",  "sg", "short_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sg_table_short_profile_8,   parasail_profile_create_8,           parasail_sg_table_short_profile_8_ws,   "parasail_sg_table_short_profile_8",   "sg", "short_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 #if HAVE_SSE2
-{parasail_sw_table_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_table_scan_profile_sse2_128_64", "sw", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_table_scan_profile_sse2_128_32", "sw", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_table_scan_profile_sse2_128_16", "sw", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_table_scan_profile_sse2_128_8", "sw", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_table_scan_profile_sse2_128_sat", "sw", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_table_striped_profile_sse2_128_64", "sw", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_table_striped_profile_sse2_128_32", "sw", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_table_striped_profile_sse2_128_16", "sw", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_table_striped_profile_sse2_128_8", "sw", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_table_striped_profile_sse2_128_sat", "sw", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sw_table_scan_profile_sse2_128_64_ws, "parasail_sw_table_scan_profile_sse2_128_64", "sw", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sw_table_scan_profile_sse2_128_32_ws, "parasail_sw_table_scan_profile_sse2_128_32", "sw", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sw_table_scan_profile_sse2_128_16_ws, "parasail_sw_table_scan_profile_sse2_128_16", "sw", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sw_table_scan_profile_sse2_128_8_ws, "parasail_sw_table_scan_profile_sse2_128_8", "sw", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_table_scan_profile_sse2_128_sat_ws, "parasail_sw_table_scan_profile_sse2_128_sat", "sw", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sw_table_striped_profile_sse2_128_64_ws, "parasail_sw_table_striped_profile_sse2_128_64", "sw", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sw_table_striped_profile_sse2_128_32_ws, "parasail_sw_table_striped_profile_sse2_128_32", "sw", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sw_table_striped_profile_sse2_128_16_ws, "parasail_sw_table_striped_profile_sse2_128_16", "sw", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sw_table_striped_profile_sse2_128_8_ws, "parasail_sw_table_striped_profile_sse2_128_8", "sw", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_table_striped_profile_sse2_128_sat_ws, "parasail_sw_table_striped_profile_sse2_128_sat", "sw", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sw_table_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_table_scan_profile_sse41_128_64", "sw", "scan_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_table_scan_profile_sse41_128_32", "sw", "scan_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_table_scan_profile_sse41_128_16", "sw", "scan_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_table_scan_profile_sse41_128_8", "sw", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_table_scan_profile_sse41_128_sat", "sw", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_table_striped_profile_sse41_128_64", "sw", "striped_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_table_striped_profile_sse41_128_32", "sw", "striped_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_table_striped_profile_sse41_128_16", "sw", "striped_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_table_striped_profile_sse41_128_8", "sw", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_table_striped_profile_sse41_128_sat", "sw", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sw_table_scan_profile_sse41_128_64_ws, "parasail_sw_table_scan_profile_sse41_128_64", "sw", "scan_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_table_scan_profile_sse41_128_32_ws, "parasail_sw_table_scan_profile_sse41_128_32", "sw", "scan_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_table_scan_profile_sse41_128_16_ws, "parasail_sw_table_scan_profile_sse41_128_16", "sw", "scan_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_table_scan_profile_sse41_128_8_ws, "parasail_sw_table_scan_profile_sse41_128_8", "sw", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_table_scan_profile_sse41_128_sat_ws, "parasail_sw_table_scan_profile_sse41_128_sat", "sw", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sw_table_striped_profile_sse41_128_64_ws, "parasail_sw_table_striped_profile_sse41_128_64", "sw", "striped_profile", "sse41", "128", "64",  2, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_table_striped_profile_sse41_128_32_ws, "parasail_sw_table_striped_profile_sse41_128_32", "sw", "striped_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_table_striped_profile_sse41_128_16_ws, "parasail_sw_table_striped_profile_sse41_128_16", "sw", "striped_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_table_striped_profile_sse41_128_8_ws, "parasail_sw_table_striped_profile_sse41_128_8", "sw", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_table_striped_profile_sse41_128_sat_ws, "parasail_sw_table_striped_profile_sse41_128_sat", "sw", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+{parasail_sw_table_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_sw_table_blocked_profile_sse41_128_32_ws, "parasail_sw_table_blocked_profile_sse41_128_32", "sw", "blocked_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sw_table_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_sw_table_blocked_profile_sse41_128_16_ws, "parasail_sw_table_blocked_profile_sse41_128_16", "sw", "blocked_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_table_short_profile_sse41_128_32_ws, "parasail_sw_table_short_profile_sse41_128_32", "sw", "short_profile", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_table_short_profile_sse41_128_16_ws, "parasail_sw_table_short_profile_sse41_128_16", "sw", "short_profile", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_table_short_profile_sse41_128_8_ws, "parasail_sw_table_short_profile_sse41_128_8", "sw", "short_profile", "sse41", "128",  "8", 16, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sw_table_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sw_table_scan_profile_avx2_256_64", "sw", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sw_table_scan_profile_avx2_256_32", "sw", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sw_table_scan_profile_avx2_256_16", "sw", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_table_scan_profile_avx2_256_8", "sw", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_table_scan_profile_avx2_256_sat", "sw", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sw_table_striped_profile_avx2_256_64", "sw", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sw_table_striped_profile_avx2_256_32", "sw", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sw_table_striped_profile_avx2_256_16", "sw", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_table_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_table_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sw_table_scan_profile_avx2_256_64_ws, "parasail_sw_table_scan_profile_avx2_256_64", "sw", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_table_scan_profile_avx2_256_32_ws, "parasail_sw_table_scan_profile_avx2_256_32", "sw", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_table_scan_profile_avx2_256_16_ws, "parasail_sw_table_scan_profile_avx2_256_16", "sw", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_table_scan_profile_avx2_256_8_ws, "parasail_sw_table_scan_profile_avx2_256_8", "sw", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sw_table_scan_profile_avx2_256_sat_ws, "parasail_sw_table_scan_profile_avx2_256_sat", "sw", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sw_table_striped_profile_avx2_256_64_ws, "parasail_sw_table_striped_profile_avx2_256_64", "sw", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_table_striped_profile_avx2_256_32_ws, "parasail_sw_table_striped_profile_avx2_256_32", "sw", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_table_striped_profile_avx2_256_16_ws, "parasail_sw_table_striped_profile_avx2_256_16", "sw", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_table_striped_profile_avx2_256_8_ws, "parasail_sw_table_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sw_table_striped_profile_avx2_256_sat_ws, "parasail_sw_table_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+{parasail_sw_table_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_sw_table_blocked_profile_avx2_256_32_ws, "parasail_sw_table_blocked_profile_avx2_256_32", "sw", "blocked_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sw_table_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_sw_table_blocked_profile_avx2_256_16_ws, "parasail_sw_table_blocked_profile_avx2_256_16", "sw", "blocked_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_table_short_profile_avx2_256_32_ws, "parasail_sw_table_short_profile_avx2_256_32", "sw", "short_profile", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_table_short_profile_avx2_256_16_ws, "parasail_sw_table_short_profile_avx2_256_16", "sw", "short_profile", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_table_short_profile_avx2_256_8_ws, "parasail_sw_table_short_profile_avx2_256_8", "sw", "short_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_sw_table_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sw_table_scan_profile_knc_512_32", "sw", "scan_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sw_table_striped_profile_knc_512_32", "sw", "striped_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
-#endif
-{parasail_sw_table_scan_profile_64,   parasail_profile_create_64,          "parasail_sw_table_scan_profile_64",   "sw", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_32,   parasail_profile_create_32,          "parasail_sw_table_scan_profile_32",   "sw", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_16,   parasail_profile_create_16,          "parasail_sw_table_scan_profile_16",   "sw", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_8,    parasail_profile_create_8,           "parasail_sw_table_scan_profile_8",    "sw", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
-{parasail_sw_table_scan_profile_sat,  parasail_profile_create_sat,         "parasail_sw_table_scan_profile_sat",  "sw", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_64, parasail_profile_create_64,          "parasail_sw_table_striped_profile_64", "sw", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_32, parasail_profile_create_32,          "parasail_sw_table_striped_profile_32", "sw", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_16, parasail_profile_create_16,          "parasail_sw_table_striped_profile_16", "sw", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_8, parasail_profile_create_8,           "parasail_sw_table_striped_profile_8", "sw", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
-{parasail_sw_table_striped_profile_sat, parasail_profile_create_sat,         "parasail_sw_table_striped_profile_sat", "sw", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sw_table_scan_profile_knc_512_32_ws, "parasail_sw_table_scan_profile_knc_512_32", "sw", "scan_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sw_table_striped_profile_knc_512_32_ws, "parasail_sw_table_striped_profile_knc_512_32", "sw", "striped_profile", "knc",   "512", "32", 16, 1, 0, 0, 0},
+#endif
+{parasail_sw_table_scan_profile_64,   parasail_profile_create_64,          parasail_sw_table_scan_profile_64_ws,   "parasail_sw_table_scan_profile_64",   "sw", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_32,   parasail_profile_create_32,          parasail_sw_table_scan_profile_32_ws,   "parasail_sw_table_scan_profile_32",   "sw", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_16,   parasail_profile_create_16,          parasail_sw_table_scan_profile_16_ws,   "parasail_sw_table_scan_profile_16",   "sw", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_8,    parasail_profile_create_8,           parasail_sw_table_scan_profile_8_ws,    "parasail_sw_table_scan_profile_8",    "sw", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{parasail_sw_table_scan_profile_sat,  parasail_profile_create_sat,         parasail_sw_table_scan_profile_sat_ws,  "parasail_sw_table_scan_profile_sat",  "sw", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_64, parasail_profile_create_64,          parasail_sw_table_striped_profile_64_ws, "parasail_sw_table_striped_profile_64", "sw", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_32, parasail_profile_create_32,          parasail_sw_table_striped_profile_32_ws, "parasail_sw_table_striped_profile_32", "sw", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_16, parasail_profile_create_16,          parasail_sw_table_striped_profile_16_ws, "parasail_sw_table_striped_profile_16", "sw", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_8, parasail_profile_create_8,           parasail_sw_table_striped_profile_8_ws, "parasail_sw_table_striped_profile_8", "sw", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{parasail_sw_table_striped_profile_sat, parasail_profile_create_sat,         parasail_sw_table_striped_profile_sat_ws, "parasail_sw_table_striped_profile_sat", "sw", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_sw_table_blocked_profile_32, parasail_profile_create_blocked_32,  parasail_sw_table_blocked_profile_32_ws, "parasail_sw_table_blocked_profile_32", "sw", "blocked_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sw_table_blocked_profile_16, parasail_profile_create_blocked_16,  parasail_sw_table_blocked_profile_16_ws, "parasail_sw_table_blocked_profile_16", "sw", "blocked_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_32,  parasail_profile_create_32,          parasail_sw_table_short_profile_32_ws,  "parasail_sw_table_short_profile_32",  "sw", "short_profile", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_16,  parasail_profile_create_16,          parasail_sw_table_short_profile_16_ws,  "parasail_sw_table_short_profile_16",  "sw", "short_profile", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_sw_table_short_profile_8,   parasail_profile_create_8,           parasail_sw_table_short_profile_8_ws,   "parasail_sw_table_short_profile_8",   "sw", "short_profile", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
 #if HAVE_SSE2
-{parasail_nw_stats_table_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_table_scan_profile_sse2_128_64", "nw_stats", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_table_scan_profile_sse2_128_32", "nw_stats", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_table_scan_profile_sse2_128_16", "nw_stats", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_table_scan_profile_sse2_128_8", "nw_stats", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_table_scan_profile_sse2_128_sat", "nw_stats", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_table_striped_profile_sse2_128_64", "nw_stats", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_table_striped_profile_sse2_128_32", "nw_stats", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_table_striped_profile_sse2_128_16", "nw_stats", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_table_striped_profile_sse2_128_8", "nw_stats", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_table_striped_profile_sse2_128_sat", "nw_stats", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_table_scan_profile_sse2_128_64_ws, "parasail_nw_stats_table_scan_profile_sse2_128_64", "nw_stats", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_table_scan_profile_sse2_128_32_ws, "parasail_nw_stats_table_scan_profile_sse2_128_32", "nw_stats", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_table_scan_profile_sse2_128_16_ws, "parasail_nw_stats_table_scan_profile_sse2_128_16", "nw_stats", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_table_scan_profile_sse2_128_8_ws, "parasail_nw_stats_table_scan_profile_sse2_128_8", "nw_stats", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_table_scan_profile_sse2_128_sat_ws, "parasail_nw_stats_table_scan_profile_sse2_128_sat", "nw_stats", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_table_striped_profile_sse2_128_64_ws, "parasail_nw_stats_table_striped_profile_sse2_128_64", "nw_stats", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_table_striped_profile_sse2_128_32_ws, "parasail_nw_stats_table_striped_profile_sse2_128_32", "nw_stats", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_table_striped_profile_sse2_128_16_ws, "parasail_nw_stats_table_striped_profile_sse2_128_16", "nw_stats", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_table_striped_profile_sse2_128_8_ws, "parasail_nw_stats_table_striped_profile_sse2_128_8", "nw_stats", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_table_striped_profile_sse2_128_sat_ws, "parasail_nw_stats_table_striped_profile_sse2_128_sat", "nw_stats", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_nw_stats_table_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_table_scan_profile_sse41_128_64", "nw_stats", "scan_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_table_scan_profile_sse41_128_32", "nw_stats", "scan_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_table_scan_profile_sse41_128_16", "nw_stats", "scan_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_table_scan_profile_sse41_128_8", "nw_stats", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_table_scan_profile_sse41_128_sat", "nw_stats", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_table_striped_profile_sse41_128_64", "nw_stats", "striped_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_table_striped_profile_sse41_128_32", "nw_stats", "striped_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_table_striped_profile_sse41_128_16", "nw_stats", "striped_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_table_striped_profile_sse41_128_8", "nw_stats", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_table_striped_profile_sse41_128_sat", "nw_stats", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_table_scan_profile_sse41_128_64_ws, "parasail_nw_stats_table_scan_profile_sse41_128_64", "nw_stats", "scan_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_table_scan_profile_sse41_128_32_ws, "parasail_nw_stats_table_scan_profile_sse41_128_32", "nw_stats", "scan_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_table_scan_profile_sse41_128_16_ws, "parasail_nw_stats_table_scan_profile_sse41_128_16", "nw_stats", "scan_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_table_scan_profile_sse41_128_8_ws, "parasail_nw_stats_table_scan_profile_sse41_128_8", "nw_stats", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_table_scan_profile_sse41_128_sat_ws, "parasail_nw_stats_table_scan_profile_sse41_128_sat", "nw_stats", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_table_striped_profile_sse41_128_64_ws, "parasail_nw_stats_table_striped_profile_sse41_128_64", "nw_stats", "striped_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_table_striped_profile_sse41_128_32_ws, "parasail_nw_stats_table_striped_profile_sse41_128_32", "nw_stats", "striped_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_table_striped_profile_sse41_128_16_ws, "parasail_nw_stats_table_striped_profile_sse41_128_16", "nw_stats", "striped_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_table_striped_profile_sse41_128_8_ws, "parasail_nw_stats_table_striped_profile_sse41_128_8", "nw_stats", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_table_striped_profile_sse41_128_sat_ws, "parasail_nw_stats_table_striped_profile_sse41_128_sat", "nw_stats", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_nw_stats_table_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_nw_stats_table_scan_profile_avx2_256_64", "nw_stats", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_nw_stats_table_scan_profile_avx2_256_32", "nw_stats", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_nw_stats_table_scan_profile_avx2_256_16", "nw_stats", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_table_scan_profile_avx2_256_8", "nw_stats", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_table_scan_profile_avx2_256_sat", "nw_stats", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_nw_stats_table_striped_profile_avx2_256_64", "nw_stats", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_nw_stats_table_striped_profile_avx2_256_32", "nw_stats", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_nw_stats_table_striped_profile_avx2_256_16", "nw_stats", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_table_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_table_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_nw_stats_table_scan_profile_avx2_256_64_ws, "parasail_nw_stats_table_scan_profile_avx2_256_64", "nw_stats", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_nw_stats_table_scan_profile_avx2_256_32_ws, "parasail_nw_stats_table_scan_profile_avx2_256_32", "nw_stats", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_nw_stats_table_scan_profile_avx2_256_16_ws, "parasail_nw_stats_table_scan_profile_avx2_256_16", "nw_stats", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_nw_stats_table_scan_profile_avx2_256_8_ws, "parasail_nw_stats_table_scan_profile_avx2_256_8", "nw_stats", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_nw_stats_table_scan_profile_avx2_256_sat_ws, "parasail_nw_stats_table_scan_profile_avx2_256_sat", "nw_stats", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_nw_stats_table_striped_profile_avx2_256_64_ws, "parasail_nw_stats_table_striped_profile_avx2_256_64", "nw_stats", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_nw_stats_table_striped_profile_avx2_256_32_ws, "parasail_nw_stats_table_striped_profile_avx2_256_32", "nw_stats", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_nw_stats_table_striped_profile_avx2_256_16_ws, "parasail_nw_stats_table_striped_profile_avx2_256_16", "nw_stats", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_nw_stats_table_striped_profile_avx2_256_8_ws, "parasail_nw_stats_table_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_nw_stats_table_striped_profile_avx2_256_sat_ws, "parasail_nw_stats_table_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_nw_stats_table_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_nw_stats_table_scan_profile_knc_512_32", "nw_stats", "scan_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_nw_stats_table_striped_profile_knc_512_32", "nw_stats", "striped_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
-#endif
-{parasail_nw_stats_table_scan_profile_64, parasail_profile_create_stats_64,    "parasail_nw_stats_table_scan_profile_64", "nw_stats", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_32, parasail_profile_create_stats_32,    "parasail_nw_stats_table_scan_profile_32", "nw_stats", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_16, parasail_profile_create_stats_16,    "parasail_nw_stats_table_scan_profile_16", "nw_stats", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_8, parasail_profile_create_stats_8,     "parasail_nw_stats_table_scan_profile_8", "nw_stats", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_scan_profile_sat, parasail_profile_create_stats_sat,   "parasail_nw_stats_table_scan_profile_sat", "nw_stats", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_64, parasail_profile_create_stats_64,    "parasail_nw_stats_table_striped_profile_64", "nw_stats", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_32, parasail_profile_create_stats_32,    "parasail_nw_stats_table_striped_profile_32", "nw_stats", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_16, parasail_profile_create_stats_16,    "parasail_nw_stats_table_striped_profile_16", "nw_stats", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_8, parasail_profile_create_stats_8,     "parasail_nw_stats_table_striped_profile_8", "nw_stats", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
-{parasail_nw_stats_table_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_nw_stats_table_striped_profile_sat", "nw_stats", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_nw_stats_table_scan_profile_knc_512_32_ws, "parasail_nw_stats_table_scan_profile_knc_512_32", "nw_stats", "scan_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_nw_stats_table_striped_profile_knc_512_32_ws, "parasail_nw_stats_table_striped_profile_knc_512_32", "nw_stats", "striped_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
+#endif
+{parasail_nw_stats_table_scan_profile_64, parasail_profile_create_stats_64,    parasail_nw_stats_table_scan_profile_64_ws, "parasail_nw_stats_table_scan_profile_64", "nw_stats", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_32, parasail_profile_create_stats_32,    parasail_nw_stats_table_scan_profile_32_ws, "parasail_nw_stats_table_scan_profile_32", "nw_stats", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_16, parasail_profile_create_stats_16,    parasail_nw_stats_table_scan_profile_16_ws, "parasail_nw_stats_table_scan_profile_16", "nw_stats", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_8, parasail_profile_create_stats_8,     parasail_nw_stats_table_scan_profile_8_ws, "parasail_nw_stats_table_scan_profile_8", "nw_stats", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_sat, parasail_profile_create_stats_sat,   parasail_nw_stats_table_scan_profile_sat_ws, "parasail_nw_stats_table_scan_profile_sat", "nw_stats", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_64, parasail_profile_create_stats_64,    parasail_nw_stats_table_striped_profile_64_ws, "parasail_nw_stats_table_striped_profile_64", "nw_stats", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_32, parasail_profile_create_stats_32,    parasail_nw_stats_table_striped_profile_32_ws, "parasail_nw_stats_table_striped_profile_32", "nw_stats", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_16, parasail_profile_create_stats_16,    parasail_nw_stats_table_striped_profile_16_ws, "parasail_nw_stats_table_striped_profile_16", "nw_stats", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_8, parasail_profile_create_stats_8,     parasail_nw_stats_table_striped_profile_8_ws, "parasail_nw_stats_table_striped_profile_8", "nw_stats", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_nw_stats_table_striped_profile_sat_ws, "parasail_nw_stats_table_striped_profile_sat", "nw_stats", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
 #if HAVE_SSE2
-{parasail_sg_stats_table_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_table_scan_profile_sse2_128_64", "sg_stats", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_table_scan_profile_sse2_128_32", "sg_stats", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_table_scan_profile_sse2_128_16", "sg_stats", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_table_scan_profile_sse2_128_8", "sg_stats", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_table_scan_profile_sse2_128_sat", "sg_stats", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_table_striped_profile_sse2_128_64", "sg_stats", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_table_striped_profile_sse2_128_32", "sg_stats", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_table_striped_profile_sse2_128_16", "sg_stats", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_table_striped_profile_sse2_128_8", "sg_stats", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_table_striped_profile_sse2_128_sat", "sg_stats", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_table_scan_profile_sse2_128_64_ws, "parasail_sg_stats_table_scan_profile_sse2_128_64", "sg_stats", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_table_scan_profile_sse2_128_32_ws, "parasail_sg_stats_table_scan_profile_sse2_128_32", "sg_stats", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_table_scan_profile_sse2_128_16_ws, "parasail_sg_stats_table_scan_profile_sse2_128_16", "sg_stats", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_table_scan_profile_sse2_128_8_ws, "parasail_sg_stats_table_scan_profile_sse2_128_8", "sg_stats", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_table_scan_profile_sse2_128_sat_ws, "parasail_sg_stats_table_scan_profile_sse2_128_sat", "sg_stats", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_table_striped_profile_sse2_128_64_ws, "parasail_sg_stats_table_striped_profile_sse2_128_64", "sg_stats", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_table_striped_profile_sse2_128_32_ws, "parasail_sg_stats_table_striped_profile_sse2_128_32", "sg_stats", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_table_striped_profile_sse2_128_16_ws, "parasail_sg_stats_table_striped_profile_sse2_128_16", "sg_stats", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_table_striped_profile_sse2_128_8_ws, "parasail_sg_stats_table_striped_profile_sse2_128_8", "sg_stats", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_table_striped_profile_sse2_128_sat_ws, "parasail_sg_stats_table_striped_profile_sse2_128_sat", "sg_stats", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sg_stats_table_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_table_scan_profile_sse41_128_64", "sg_stats", "scan_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_table_scan_profile_sse41_128_32", "sg_stats", "scan_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_table_scan_profile_sse41_128_16", "sg_stats", "scan_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_table_scan_profile_sse41_128_8", "sg_stats", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_table_scan_profile_sse41_128_sat", "sg_stats", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_table_striped_profile_sse41_128_64", "sg_stats", "striped_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_table_striped_profile_sse41_128_32", "sg_stats", "striped_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_table_striped_profile_sse41_128_16", "sg_stats", "striped_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_table_striped_profile_sse41_128_8", "sg_stats", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_table_striped_profile_sse41_128_sat", "sg_stats", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_table_scan_profile_sse41_128_64_ws, "parasail_sg_stats_table_scan_profile_sse41_128_64", "sg_stats", "scan_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_table_scan_profile_sse41_128_32_ws, "parasail_sg_stats_table_scan_profile_sse41_128_32", "sg_stats", "scan_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_table_scan_profile_sse41_128_16_ws, "parasail_sg_stats_table_scan_profile_sse41_128_16", "sg_stats", "scan_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_table_scan_profile_sse41_128_8_ws, "parasail_sg_stats_table_scan_profile_sse41_128_8", "sg_stats", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_table_scan_profile_sse41_128_sat_ws, "parasail_sg_stats_table_scan_profile_sse41_128_sat", "sg_stats", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_table_striped_profile_sse41_128_64_ws, "parasail_sg_stats_table_striped_profile_sse41_128_64", "sg_stats", "striped_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_table_striped_profile_sse41_128_32_ws, "parasail_sg_stats_table_striped_profile_sse41_128_32", "sg_stats", "striped_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_table_striped_profile_sse41_128_16_ws, "parasail_sg_stats_table_striped_profile_sse41_128_16", "sg_stats", "striped_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_table_striped_profile_sse41_128_8_ws, "parasail_sg_stats_table_striped_profile_sse41_128_8", "sg_stats", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_table_striped_profile_sse41_128_sat_ws, "parasail_sg_stats_table_striped_profile_sse41_128_sat", "sg_stats", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sg_stats_table_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sg_stats_table_scan_profile_avx2_256_64", "sg_stats", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sg_stats_table_scan_profile_avx2_256_32", "sg_stats", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sg_stats_table_scan_profile_avx2_256_16", "sg_stats", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_table_scan_profile_avx2_256_8", "sg_stats", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_table_scan_profile_avx2_256_sat", "sg_stats", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sg_stats_table_striped_profile_avx2_256_64", "sg_stats", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sg_stats_table_striped_profile_avx2_256_32", "sg_stats", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sg_stats_table_striped_profile_avx2_256_16", "sg_stats", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_table_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_table_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sg_stats_table_scan_profile_avx2_256_64_ws, "parasail_sg_stats_table_scan_profile_avx2_256_64", "sg_stats", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sg_stats_table_scan_profile_avx2_256_32_ws, "parasail_sg_stats_table_scan_profile_avx2_256_32", "sg_stats", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sg_stats_table_scan_profile_avx2_256_16_ws, "parasail_sg_stats_table_scan_profile_avx2_256_16", "sg_stats", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sg_stats_table_scan_profile_avx2_256_8_ws, "parasail_sg_stats_table_scan_profile_avx2_256_8", "sg_stats", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sg_stats_table_scan_profile_avx2_256_sat_ws, "parasail_sg_stats_table_scan_profile_avx2_256_sat", "sg_stats", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sg_stats_table_striped_profile_avx2_256_64_ws, "parasail_sg_stats_table_striped_profile_avx2_256_64", "sg_stats", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sg_stats_table_striped_profile_avx2_256_32_ws, "parasail_sg_stats_table_striped_profile_avx2_256_32", "sg_stats", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sg_stats_table_striped_profile_avx2_256_16_ws, "parasail_sg_stats_table_striped_profile_avx2_256_16", "sg_stats", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sg_stats_table_striped_profile_avx2_256_8_ws, "parasail_sg_stats_table_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sg_stats_table_striped_profile_avx2_256_sat_ws, "parasail_sg_stats_table_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_sg_stats_table_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sg_stats_table_scan_profile_knc_512_32", "sg_stats", "scan_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sg_stats_table_striped_profile_knc_512_32", "sg_stats", "striped_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
-#endif
-{parasail_sg_stats_table_scan_profile_64, parasail_profile_create_stats_64,    "parasail_sg_stats_table_scan_profile_64", "sg_stats", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_32, parasail_profile_create_stats_32,    "parasail_sg_stats_table_scan_profile_32", "sg_stats", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_16, parasail_profile_create_stats_16,    "parasail_sg_stats_table_scan_profile_16", "sg_stats", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_8, parasail_profile_create_stats_8,     "parasail_sg_stats_table_scan_profile_8", "sg_stats", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_scan_profile_sat, parasail_profile_create_stats_sat,   "parasail_sg_stats_table_scan_profile_sat", "sg_stats", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_64, parasail_profile_create_stats_64,    "parasail_sg_stats_table_striped_profile_64", "sg_stats", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_32, parasail_profile_create_stats_32,    "parasail_sg_stats_table_striped_profile_32", "sg_stats", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_16, parasail_profile_create_stats_16,    "parasail_sg_stats_table_striped_profile_16", "sg_stats", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_8, parasail_profile_create_stats_8,     "parasail_sg_stats_table_striped_profile_8", "sg_stats", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
-{parasail_sg_stats_table_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_sg_stats_table_striped_profile_sat", "sg_stats", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sg_stats_table_scan_profile_knc_512_32_ws, "parasail_sg_stats_table_scan_profile_knc_512_32", "sg_stats", "scan_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sg_stats_table_striped_profile_knc_512_32_ws, "parasail_sg_stats_table_striped_profile_knc_512_32", "sg_stats", "striped_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
+#endif
+{parasail_sg_stats_table_scan_profile_64, parasail_profile_create_stats_64,    parasail_sg_stats_table_scan_profile_64_ws, "parasail_sg_stats_table_scan_profile_64", "sg_stats", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_32, parasail_profile_create_stats_32,    parasail_sg_stats_table_scan_profile_32_ws, "parasail_sg_stats_table_scan_profile_32", "sg_stats", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_16, parasail_profile_create_stats_16,    parasail_sg_stats_table_scan_profile_16_ws, "parasail_sg_stats_table_scan_profile_16", "sg_stats", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_8, parasail_profile_create_stats_8,     parasail_sg_stats_table_scan_profile_8_ws, "parasail_sg_stats_table_scan_profile_8", "sg_stats", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_sat, parasail_profile_create_stats_sat,   parasail_sg_stats_table_scan_profile_sat_ws, "parasail_sg_stats_table_scan_profile_sat", "sg_stats", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_64, parasail_profile_create_stats_64,    parasail_sg_stats_table_striped_profile_64_ws, "parasail_sg_stats_table_striped_profile_64", "sg_stats", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_32, parasail_profile_create_stats_32,    parasail_sg_stats_table_striped_profile_32_ws, "parasail_sg_stats_table_striped_profile_32", "sg_stats", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_16, parasail_profile_create_stats_16,    parasail_sg_stats_table_striped_profile_16_ws, "parasail_sg_stats_table_striped_profile_16", "sg_stats", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_8, parasail_profile_create_stats_8,     parasail_sg_stats_table_striped_profile_8_ws, "parasail_sg_stats_table_striped_profile_8", "sg_stats", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_sg_stats_table_striped_profile_sat_ws, "parasail_sg_stats_table_striped_profile_sat", "sg_stats", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
 #if HAVE_SSE2
-{parasail_sw_stats_table_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_table_scan_profile_sse2_128_64", "sw_stats", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_table_scan_profile_sse2_128_32", "sw_stats", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_table_scan_profile_sse2_128_16", "sw_stats", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_table_scan_profile_sse2_128_8", "sw_stats", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_table_scan_profile_sse2_128_sat", "sw_stats", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_table_striped_profile_sse2_128_64", "sw_stats", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_table_striped_profile_sse2_128_32", "sw_stats", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_table_striped_profile_sse2_128_16", "sw_stats", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_table_striped_profile_sse2_128_8", "sw_stats", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_table_striped_profile_sse2_128_sat", "sw_stats", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_table_scan_profile_sse2_128_64_ws, "parasail_sw_stats_table_scan_profile_sse2_128_64", "sw_stats", "scan_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_table_scan_profile_sse2_128_32_ws, "parasail_sw_stats_table_scan_profile_sse2_128_32", "sw_stats", "scan_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_table_scan_profile_sse2_128_16_ws, "parasail_sw_stats_table_scan_profile_sse2_128_16", "sw_stats", "scan_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_table_scan_profile_sse2_128_8_ws, "parasail_sw_stats_table_scan_profile_sse2_128_8", "sw_stats", "scan_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_table_scan_profile_sse2_128_sat_ws, "parasail_sw_stats_table_scan_profile_sse2_128_sat", "sw_stats", "scan_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_table_striped_profile_sse2_128_64_ws, "parasail_sw_stats_table_striped_profile_sse2_128_64", "sw_stats", "striped_profile", "sse2",  "128", "64",  2, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_table_striped_profile_sse2_128_32_ws, "parasail_sw_stats_table_striped_profile_sse2_128_32", "sw_stats", "striped_profile", "sse2",  "128", "32",  4, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_table_striped_profile_sse2_128_16_ws, "parasail_sw_stats_table_striped_profile_sse2_128_16", "sw_stats", "striped_profile", "sse2",  "128", "16",  8, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_table_striped_profile_sse2_128_8_ws, "parasail_sw_stats_table_striped_profile_sse2_128_8", "sw_stats", "striped_profile", "sse2",  "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_table_striped_profile_sse2_128_sat_ws, "parasail_sw_stats_table_striped_profile_sse2_128_sat", "sw_stats", "striped_profile", "sse2",  "128", "sat", 16, 1, 0, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sw_stats_table_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_table_scan_profile_sse41_128_64", "sw_stats", "scan_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_table_scan_profile_sse41_128_32", "sw_stats", "scan_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_table_scan_profile_sse41_128_16", "sw_stats", "scan_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_table_scan_profile_sse41_128_8", "sw_stats", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_table_scan_profile_sse41_128_sat", "sw_stats", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_table_striped_profile_sse41_128_64", "sw_stats", "striped_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_table_striped_profile_sse41_128_32", "sw_stats", "striped_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_table_striped_profile_sse41_128_16", "sw_stats", "striped_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_table_striped_profile_sse41_128_8", "sw_stats", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_table_striped_profile_sse41_128_sat", "sw_stats", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_table_scan_profile_sse41_128_64_ws, "parasail_sw_stats_table_scan_profile_sse41_128_64", "sw_stats", "scan_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_table_scan_profile_sse41_128_32_ws, "parasail_sw_stats_table_scan_profile_sse41_128_32", "sw_stats", "scan_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_table_scan_profile_sse41_128_16_ws, "parasail_sw_stats_table_scan_profile_sse41_128_16", "sw_stats", "scan_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_table_scan_profile_sse41_128_8_ws, "parasail_sw_stats_table_scan_profile_sse41_128_8", "sw_stats", "scan_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_table_scan_profile_sse41_128_sat_ws, "parasail_sw_stats_table_scan_profile_sse41_128_sat", "sw_stats", "scan_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_table_striped_profile_sse41_128_64_ws, "parasail_sw_stats_table_striped_profile_sse41_128_64", "sw_stats", "striped_profile", "sse41", "128", "64",  2, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_table_striped_profile_sse41_128_32_ws, "parasail_sw_stats_table_striped_profile_sse41_128_32", "sw_stats", "striped_profile", "sse41", "128", "32",  4, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_table_striped_profile_sse41_128_16_ws, "parasail_sw_stats_table_striped_profile_sse41_128_16", "sw_stats", "striped_profile", "sse41", "128", "16",  8, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_table_striped_profile_sse41_128_8_ws, "parasail_sw_stats_table_striped_profile_sse41_128_8", "sw_stats", "striped_profile", "sse41", "128",  "8", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_table_striped_profile_sse41_128_sat_ws, "parasail_sw_stats_table_striped_profile_sse41_128_sat", "sw_stats", "striped_profile", "sse41", "128", "sat", 16, 1, 0, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sw_stats_table_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sw_stats_table_scan_profile_avx2_256_64", "sw_stats", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sw_stats_table_scan_profile_avx2_256_32", "sw_stats", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sw_stats_table_scan_profile_avx2_256_16", "sw_stats", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_table_scan_profile_avx2_256_8", "sw_stats", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_table_scan_profile_avx2_256_sat", "sw_stats", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sw_stats_table_striped_profile_avx2_256_64", "sw_stats", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sw_stats_table_striped_profile_avx2_256_32", "sw_stats", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sw_stats_table_striped_profile_avx2_256_16", "sw_stats", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_table_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_table_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sw_stats_table_scan_profile_avx2_256_64_ws, "parasail_sw_stats_table_scan_profile_avx2_256_64", "sw_stats", "scan_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sw_stats_table_scan_profile_avx2_256_32_ws, "parasail_sw_stats_table_scan_profile_avx2_256_32", "sw_stats", "scan_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sw_stats_table_scan_profile_avx2_256_16_ws, "parasail_sw_stats_table_scan_profile_avx2_256_16", "sw_stats", "scan_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sw_stats_table_scan_profile_avx2_256_8_ws, "parasail_sw_stats_table_scan_profile_avx2_256_8", "sw_stats", "scan_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sw_stats_table_scan_profile_avx2_256_sat_ws, "parasail_sw_stats_table_scan_profile_avx2_256_sat", "sw_stats", "scan_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sw_stats_table_striped_profile_avx2_256_64_ws, "parasail_sw_stats_table_striped_profile_avx2_256_64", "sw_stats", "striped_profile", "avx2",  "256", "64",  4, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sw_stats_table_striped_profile_avx2_256_32_ws, "parasail_sw_stats_table_striped_profile_avx2_256_32", "sw_stats", "striped_profile", "avx2",  "256", "32",  8, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sw_stats_table_striped_profile_avx2_256_16_ws, "parasail_sw_stats_table_striped_profile_avx2_256_16", "sw_stats", "striped_profile", "avx2",  "256", "16", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sw_stats_table_striped_profile_avx2_256_8_ws, "parasail_sw_stats_table_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sw_stats_table_striped_profile_avx2_256_sat_ws, "parasail_sw_stats_table_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_sw_stats_table_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sw_stats_table_scan_profile_knc_512_32", "sw_stats", "scan_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sw_stats_table_striped_profile_knc_512_32", "sw_stats", "striped_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
-#endif
-{parasail_sw_stats_table_scan_profile_64, parasail_profile_create_stats_64,    "parasail_sw_stats_table_scan_profile_64", "sw_stats", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_32, parasail_profile_create_stats_32,    "parasail_sw_stats_table_scan_profile_32", "sw_stats", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_16, parasail_profile_create_stats_16,    "parasail_sw_stats_table_scan_profile_16", "sw_stats", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_8, parasail_profile_create_stats_8,     "parasail_sw_stats_table_scan_profile_8", "sw_stats", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_scan_profile_sat, parasail_profile_create_stats_sat,   "parasail_sw_stats_table_scan_profile_sat", "sw_stats", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_64, parasail_profile_create_stats_64,    "parasail_sw_stats_table_striped_profile_64", "sw_stats", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_32, parasail_profile_create_stats_32,    "parasail_sw_stats_table_striped_profile_32", "sw_stats", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_16, parasail_profile_create_stats_16,    "parasail_sw_stats_table_striped_profile_16", "sw_stats", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_8, parasail_profile_create_stats_8,     "parasail_sw_stats_table_striped_profile_8", "sw_stats", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
-{parasail_sw_stats_table_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_sw_stats_table_striped_profile_sat", "sw_stats", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sw_stats_table_scan_profile_knc_512_32_ws, "parasail_sw_stats_table_scan_profile_knc_512_32", "sw_stats", "scan_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sw_stats_table_striped_profile_knc_512_32_ws, "parasail_sw_stats_table_striped_profile_knc_512_32", "sw_stats", "striped_profile", "knc",   "512", "32", 16, 1, 0, 1, 0},
+#endif
+{parasail_sw_stats_table_scan_profile_64, parasail_profile_create_stats_64,    parasail_sw_stats_table_scan_profile_64_ws, "parasail_sw_stats_table_scan_profile_64", "sw_stats", "scan_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_32, parasail_profile_create_stats_32,    parasail_sw_stats_table_scan_profile_32_ws, "parasail_sw_stats_table_scan_profile_32", "sw_stats", "scan_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_16, parasail_profile_create_stats_16,    parasail_sw_stats_table_scan_profile_16_ws, "parasail_sw_stats_table_scan_profile_16", "sw_stats", "scan_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_8, parasail_profile_create_stats_8,     parasail_sw_stats_table_scan_profile_8_ws, "parasail_sw_stats_table_scan_profile_8", "sw_stats", "scan_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_sat, parasail_profile_create_stats_sat,   parasail_sw_stats_table_scan_profile_sat_ws, "parasail_sw_stats_table_scan_profile_sat", "sw_stats", "scan_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_64, parasail_profile_create_stats_64,    parasail_sw_stats_table_striped_profile_64_ws, "parasail_sw_stats_table_striped_profile_64", "sw_stats", "striped_profile", "disp",   "NA", "64", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_32, parasail_profile_create_stats_32,    parasail_sw_stats_table_striped_profile_32_ws, "parasail_sw_stats_table_striped_profile_32", "sw_stats", "striped_profile", "disp",   "NA", "32", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_16, parasail_profile_create_stats_16,    parasail_sw_stats_table_striped_profile_16_ws, "parasail_sw_stats_table_striped_profile_16", "sw_stats", "striped_profile", "disp",   "NA", "16", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_8, parasail_profile_create_stats_8,     parasail_sw_stats_table_striped_profile_8_ws, "parasail_sw_stats_table_striped_profile_8", "sw_stats", "striped_profile", "disp",   "NA",  "8", -1, 1, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_sw_stats_table_striped_profile_sat_ws, "parasail_sw_stats_table_striped_profile_sat", "sw_stats", "striped_profile", "disp",   "NA", "sat", -1, 1, 0, 1, 0},
 #if HAVE_SSE2
-{parasail_nw_rowcol_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_rowcol_scan_profile_sse2_128_64", "nw", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_rowcol_scan_profile_sse2_128_32", "nw", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_rowcol_scan_profile_sse2_128_16", "nw", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_rowcol_scan_profile_sse2_128_8", "nw", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_rowcol_scan_profile_sse2_128_sat", "nw", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_rowcol_striped_profile_sse2_128_64", "nw", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_rowcol_striped_profile_sse2_128_32", "nw", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_rowcol_striped_profile_sse2_128_16", "nw", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_rowcol_striped_profile_sse2_128_8", "nw", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_rowcol_striped_profile_sse2_128_sat", "nw", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_nw_rowcol_scan_profile_sse2_128_64_ws, "parasail_nw_rowcol_scan_profile_sse2_128_64", "nw", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_nw_rowcol_scan_profile_sse2_128_32_ws, "parasail_nw_rowcol_scan_profile_sse2_128_32", "nw", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_nw_rowcol_scan_profile_sse2_128_16_ws, "parasail_nw_rowcol_scan_profile_sse2_128_16", "nw", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_nw_rowcol_scan_profile_sse2_128_8_ws, "parasail_nw_rowcol_scan_profile_sse2_128_8", "nw", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_rowcol_scan_profile_sse2_128_sat_ws, "parasail_nw_rowcol_scan_profile_sse2_128_sat", "nw", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_nw_rowcol_striped_profile_sse2_128_64_ws, "parasail_nw_rowcol_striped_profile_sse2_128_64", "nw", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_nw_rowcol_striped_profile_sse2_128_32_ws, "parasail_nw_rowcol_striped_profile_sse2_128_32", "nw", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_nw_rowcol_striped_profile_sse2_128_16_ws, "parasail_nw_rowcol_striped_profile_sse2_128_16", "nw", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_nw_rowcol_striped_profile_sse2_128_8_ws, "parasail_nw_rowcol_striped_profile_sse2_128_8", "nw", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_rowcol_striped_profile_sse2_128_sat_ws, "parasail_nw_rowcol_striped_profile_sse2_128_sat", "nw", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_nw_rowcol_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_rowcol_scan_profile_sse41_128_64", "nw", "scan_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_rowcol_scan_profile_sse41_128_32", "nw", "scan_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_rowcol_scan_profile_sse41_128_16", "nw", "scan_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_rowcol_scan_profile_sse41_128_8", "nw", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_rowcol_scan_profile_sse41_128_sat", "nw", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_nw_rowcol_striped_profile_sse41_128_64", "nw", "striped_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_nw_rowcol_striped_profile_sse41_128_32", "nw", "striped_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_nw_rowcol_striped_profile_sse41_128_16", "nw", "striped_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_nw_rowcol_striped_profile_sse41_128_8", "nw", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_nw_rowcol_striped_profile_sse41_128_sat", "nw", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_nw_rowcol_scan_profile_sse41_128_64_ws, "parasail_nw_rowcol_scan_profile_sse41_128_64", "nw", "scan_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_rowcol_scan_profile_sse41_128_32_ws, "parasail_nw_rowcol_scan_profile_sse41_128_32", "nw", "scan_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_rowcol_scan_profile_sse41_128_16_ws, "parasail_nw_rowcol_scan_profile_sse41_128_16", "nw", "scan_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_rowcol_scan_profile_sse41_128_8_ws, "parasail_nw_rowcol_scan_profile_sse41_128_8", "nw", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_rowcol_scan_profile_sse41_128_sat_ws, "parasail_nw_rowcol_scan_profile_sse41_128_sat", "nw", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_nw_rowcol_striped_profile_sse41_128_64_ws, "parasail_nw_rowcol_striped_profile_sse41_128_64", "nw", "striped_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_rowcol_striped_profile_sse41_128_32_ws, "parasail_nw_rowcol_striped_profile_sse41_128_32", "nw", "striped_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_rowcol_striped_profile_sse41_128_16_ws, "parasail_nw_rowcol_striped_profile_sse41_128_16", "nw", "striped_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_rowcol_striped_profile_sse41_128_8_ws, "parasail_nw_rowcol_striped_profile_sse41_128_8", "nw", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_nw_rowcol_striped_profile_sse41_128_sat_ws, "parasail_nw_rowcol_striped_profile_sse41_128_sat", "nw", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_nw_rowcol_blocked_profile_sse41_128_32_ws, "parasail_nw_rowcol_blocked_profile_sse41_128_32", "nw", "blocked_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_nw_rowcol_blocked_profile_sse41_128_16_ws, "parasail_nw_rowcol_blocked_profile_sse41_128_16", "nw", "blocked_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_nw_rowcol_short_profile_sse41_128_32_ws, "parasail_nw_rowcol_short_profile_sse41_128_32", "nw", "short_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_nw_rowcol_short_profile_sse41_128_16_ws, "parasail_nw_rowcol_short_profile_sse41_128_16", "nw", "short_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_nw_rowcol_short_profile_sse41_128_8_ws, "parasail_nw_rowcol_short_profile_sse41_128_8", "nw", "short_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_nw_rowcol_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_nw_rowcol_scan_profile_avx2_256_64", "nw", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_nw_rowcol_scan_profile_avx2_256_32", "nw", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_nw_rowcol_scan_profile_avx2_256_16", "nw", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_rowcol_scan_profile_avx2_256_8", "nw", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_rowcol_scan_profile_avx2_256_sat", "nw", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_nw_rowcol_striped_profile_avx2_256_64", "nw", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_nw_rowcol_striped_profile_avx2_256_32", "nw", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_nw_rowcol_striped_profile_avx2_256_16", "nw", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_rowcol_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_rowcol_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_nw_rowcol_scan_profile_avx2_256_64_ws, "parasail_nw_rowcol_scan_profile_avx2_256_64", "nw", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_rowcol_scan_profile_avx2_256_32_ws, "parasail_nw_rowcol_scan_profile_avx2_256_32", "nw", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_rowcol_scan_profile_avx2_256_16_ws, "parasail_nw_rowcol_scan_profile_avx2_256_16", "nw", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_rowcol_scan_profile_avx2_256_8_ws, "parasail_nw_rowcol_scan_profile_avx2_256_8", "nw", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_nw_rowcol_scan_profile_avx2_256_sat_ws, "parasail_nw_rowcol_scan_profile_avx2_256_sat", "nw", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_nw_rowcol_striped_profile_avx2_256_64_ws, "parasail_nw_rowcol_striped_profile_avx2_256_64", "nw", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_rowcol_striped_profile_avx2_256_32_ws, "parasail_nw_rowcol_striped_profile_avx2_256_32", "nw", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_rowcol_striped_profile_avx2_256_16_ws, "parasail_nw_rowcol_striped_profile_avx2_256_16", "nw", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_rowcol_striped_profile_avx2_256_8_ws, "parasail_nw_rowcol_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_nw_rowcol_striped_profile_avx2_256_sat_ws, "parasail_nw_rowcol_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_nw_rowcol_blocked_profile_avx2_256_32_ws, "parasail_nw_rowcol_blocked_profile_avx2_256_32", "nw", "blocked_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_nw_rowcol_blocked_profile_avx2_256_16_ws, "parasail_nw_rowcol_blocked_profile_avx2_256_16", "nw", "blocked_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_nw_rowcol_short_profile_avx2_256_32_ws, "parasail_nw_rowcol_short_profile_avx2_256_32", "nw", "short_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_nw_rowcol_short_profile_avx2_256_16_ws, "parasail_nw_rowcol_short_profile_avx2_256_16", "nw", "short_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_nw_rowcol_short_profile_avx2_256_8_ws, "parasail_nw_rowcol_short_profile_avx2_256_8", "nw", "short_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_nw_rowcol_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_nw_rowcol_scan_profile_knc_512_32", "nw", "scan_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_nw_rowcol_striped_profile_knc_512_32", "nw", "striped_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
-#endif
-{parasail_nw_rowcol_scan_profile_64,  parasail_profile_create_64,          "parasail_nw_rowcol_scan_profile_64",  "nw", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_32,  parasail_profile_create_32,          "parasail_nw_rowcol_scan_profile_32",  "nw", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_16,  parasail_profile_create_16,          "parasail_nw_rowcol_scan_profile_16",  "nw", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_8,   parasail_profile_create_8,           "parasail_nw_rowcol_scan_profile_8",   "nw", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_scan_profile_sat, parasail_profile_create_sat,         "parasail_nw_rowcol_scan_profile_sat", "nw", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_64, parasail_profile_create_64,          "parasail_nw_rowcol_striped_profile_64", "nw", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_32, parasail_profile_create_32,          "parasail_nw_rowcol_striped_profile_32", "nw", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_16, parasail_profile_create_16,          "parasail_nw_rowcol_striped_profile_16", "nw", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_8, parasail_profile_create_8,           "parasail_nw_rowcol_striped_profile_8", "nw", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
-{parasail_nw_rowcol_striped_profile_sat, parasail_profile_create_sat,         "parasail_nw_rowcol_striped_profile_sat", "nw", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_nw_rowcol_scan_profile_knc_512_32_ws, "parasail_nw_rowcol_scan_profile_knc_512_32", "nw", "scan_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_nw_rowcol_striped_profile_knc_512_32_ws, "parasail_nw_rowcol_striped_profile_knc_512_32", "nw", "striped_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
+#endif
+{parasail_nw_rowcol_scan_profile_64,  parasail_profile_create_64,          parasail_nw_rowcol_scan_profile_64_ws,  "parasail_nw_rowcol_scan_profile_64",  "nw", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_32,  parasail_profile_create_32,          parasail_nw_rowcol_scan_profile_32_ws,  "parasail_nw_rowcol_scan_profile_32",  "nw", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_16,  parasail_profile_create_16,          parasail_nw_rowcol_scan_profile_16_ws,  "parasail_nw_rowcol_scan_profile_16",  "nw", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_8,   parasail_profile_create_8,           parasail_nw_rowcol_scan_profile_8_ws,   "parasail_nw_rowcol_scan_profile_8",   "nw", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_scan_profile_sat, parasail_profile_create_sat,         parasail_nw_rowcol_scan_profile_sat_ws, "parasail_nw_rowcol_scan_profile_sat", "nw", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_64, parasail_profile_create_64,          parasail_nw_rowcol_striped_profile_64_ws, "parasail_nw_rowcol_striped_profile_64", "nw", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_32, parasail_profile_create_32,          parasail_nw_rowcol_striped_profile_32_ws, "parasail_nw_rowcol_striped_profile_32", "nw", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_16, parasail_profile_create_16,          parasail_nw_rowcol_striped_profile_16_ws, "parasail_nw_rowcol_striped_profile_16", "nw", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_8, parasail_profile_create_8,           parasail_nw_rowcol_striped_profile_8_ws, "parasail_nw_rowcol_striped_profile_8", "nw", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_striped_profile_sat, parasail_profile_create_sat,         parasail_nw_rowcol_striped_profile_sat_ws, "parasail_nw_rowcol_striped_profile_sat", "nw", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_profile_32, parasail_profile_create_blocked_32,  parasail_nw_rowcol_blocked_profile_32_ws, "parasail_nw_rowcol_blocked_profile_32", "nw", "blocked_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_blocked_profile_16, parasail_profile_create_blocked_16,  parasail_nw_rowcol_blocked_profile_16_ws, "parasail_nw_rowcol_blocked_profile_16", "nw", "blocked_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_32, parasail_profile_create_32,          parasail_nw_rowcol_short_profile_32_ws, "parasail_nw_rowcol_short_profile_32", "nw", "short_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_16, parasail_profile_create_16,          parasail_nw_rowcol_short_profile_16_ws, "parasail_nw_rowcol_short_profile_16", "nw", "short_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_short_profile_8,  parasail_profile_create_8,           parasail_nw_rowcol_short_profile_8_ws,  "parasail_nw_rowcol_short_profile_8",  "nw", "short_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 #if HAVE_SSE2
-{parasail_sg_rowcol_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_rowcol_scan_profile_sse2_128_64", "sg", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_rowcol_scan_profile_sse2_128_32", "sg", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_rowcol_scan_profile_sse2_128_16", "sg", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_rowcol_scan_profile_sse2_128_8", "sg", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_rowcol_scan_profile_sse2_128_sat", "sg", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_rowcol_striped_profile_sse2_128_64", "sg", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_rowcol_striped_profile_sse2_128_32", "sg", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_rowcol_striped_profile_sse2_128_16", "sg", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_rowcol_striped_profile_sse2_128_8", "sg", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_rowcol_striped_profile_sse2_128_sat", "sg", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sg_rowcol_scan_profile_sse2_128_64_ws, "parasail_sg_rowcol_scan_profile_sse2_128_64", "sg", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sg_rowcol_scan_profile_sse2_128_32_ws, "parasail_sg_rowcol_scan_profile_sse2_128_32", "sg", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sg_rowcol_scan_profile_sse2_128_16_ws, "parasail_sg_rowcol_scan_profile_sse2_128_16", "sg", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sg_rowcol_scan_profile_sse2_128_8_ws, "parasail_sg_rowcol_scan_profile_sse2_128_8", "sg", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_rowcol_scan_profile_sse2_128_sat_ws, "parasail_sg_rowcol_scan_profile_sse2_128_sat", "sg", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sg_rowcol_striped_profile_sse2_128_64_ws, "parasail_sg_rowcol_striped_profile_sse2_128_64", "sg", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sg_rowcol_striped_profile_sse2_128_32_ws, "parasail_sg_rowcol_striped_profile_sse2_128_32", "sg", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sg_rowcol_striped_profile_sse2_128_16_ws, "parasail_sg_rowcol_striped_profile_sse2_128_16", "sg", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sg_rowcol_striped_profile_sse2_128_8_ws, "parasail_sg_rowcol_striped_profile_sse2_128_8", "sg", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_rowcol_striped_profile_sse2_128_sat_ws, "parasail_sg_rowcol_striped_profile_sse2_128_sat", "sg", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sg_rowcol_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_rowcol_scan_profile_sse41_128_64", "sg", "scan_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_rowcol_scan_profile_sse41_128_32", "sg", "scan_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_rowcol_scan_profile_sse41_128_16", "sg", "scan_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_rowcol_scan_profile_sse41_128_8", "sg", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_rowcol_scan_profile_sse41_128_sat", "sg", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sg_rowcol_striped_profile_sse41_128_64", "sg", "striped_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sg_rowcol_striped_profile_sse41_128_32", "sg", "striped_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sg_rowcol_striped_profile_sse41_128_16", "sg", "striped_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sg_rowcol_striped_profile_sse41_128_8", "sg", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sg_rowcol_striped_profile_sse41_128_sat", "sg", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sg_rowcol_scan_profile_sse41_128_64_ws, "parasail_sg_rowcol_scan_profile_sse41_128_64", "sg", "scan_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_rowcol_scan_profile_sse41_128_32_ws, "parasail_sg_rowcol_scan_profile_sse41_128_32", "sg", "scan_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_rowcol_scan_profile_sse41_128_16_ws, "parasail_sg_rowcol_scan_profile_sse41_128_16", "sg", "scan_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_rowcol_scan_profile_sse41_128_8_ws, "parasail_sg_rowcol_scan_profile_sse41_128_8", "sg", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_rowcol_scan_profile_sse41_128_sat_ws, "parasail_sg_rowcol_scan_profile_sse41_128_sat", "sg", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sg_rowcol_striped_profile_sse41_128_64_ws, "parasail_sg_rowcol_striped_profile_sse41_128_64", "sg", "striped_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_rowcol_striped_profile_sse41_128_32_ws, "parasail_sg_rowcol_striped_profile_sse41_128_32", "sg", "striped_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_rowcol_striped_profile_sse41_128_16_ws, "parasail_sg_rowcol_striped_profile_sse41_128_16", "sg", "striped_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_rowcol_striped_profile_sse41_128_8_ws, "parasail_sg_rowcol_striped_profile_sse41_128_8", "sg", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sg_rowcol_striped_profile_sse41_128_sat_ws, "parasail_sg_rowcol_striped_profile_sse41_128_sat", "sg", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_sg_rowcol_blocked_profile_sse41_128_32_ws, "parasail_sg_rowcol_blocked_profile_sse41_128_32", "sg", "blocked_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_sg_rowcol_blocked_profile_sse41_128_16_ws, "parasail_sg_rowcol_blocked_profile_sse41_128_16", "sg", "blocked_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sg_rowcol_short_profile_sse41_128_32_ws, "parasail_sg_rowcol_short_profile_sse41_128_32", "sg", "short_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sg_rowcol_short_profile_sse41_128_16_ws, "parasail_sg_rowcol_short_profile_sse41_128_16", "sg", "short_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sg_rowcol_short_profile_sse41_128_8_ws, "parasail_sg_rowcol_short_profile_sse41_128_8", "sg", "short_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sg_rowcol_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sg_rowcol_scan_profile_avx2_256_64", "sg", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sg_rowcol_scan_profile_avx2_256_32", "sg", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sg_rowcol_scan_profile_avx2_256_16", "sg", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_rowcol_scan_profile_avx2_256_8", "sg", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_rowcol_scan_profile_avx2_256_sat", "sg", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sg_rowcol_striped_profile_avx2_256_64", "sg", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sg_rowcol_striped_profile_avx2_256_32", "sg", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sg_rowcol_striped_profile_avx2_256_16", "sg", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_rowcol_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_rowcol_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sg_rowcol_scan_profile_avx2_256_64_ws, "parasail_sg_rowcol_scan_profile_avx2_256_64", "sg", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_rowcol_scan_profile_avx2_256_32_ws, "parasail_sg_rowcol_scan_profile_avx2_256_32", "sg", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_rowcol_scan_profile_avx2_256_16_ws, "parasail_sg_rowcol_scan_profile_avx2_256_16", "sg", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_rowcol_scan_profile_avx2_256_8_ws, "parasail_sg_rowcol_scan_profile_avx2_256_8", "sg", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sg_rowcol_scan_profile_avx2_256_sat_ws, "parasail_sg_rowcol_scan_profile_avx2_256_sat", "sg", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sg_rowcol_striped_profile_avx2_256_64_ws, "parasail_sg_rowcol_striped_profile_avx2_256_64", "sg", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_rowcol_striped_profile_avx2_256_32_ws, "parasail_sg_rowcol_striped_profile_avx2_256_32", "sg", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_rowcol_striped_profile_avx2_256_16_ws, "parasail_sg_rowcol_striped_profile_avx2_256_16", "sg", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_rowcol_striped_profile_avx2_256_8_ws, "parasail_sg_rowcol_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sg_rowcol_striped_profile_avx2_256_sat_ws, "parasail_sg_rowcol_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_sg_rowcol_blocked_profile_avx2_256_32_ws, "parasail_sg_rowcol_blocked_profile_avx2_256_32", "sg", "blocked_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_sg_rowcol_blocked_profile_avx2_256_16_ws, "parasail_sg_rowcol_blocked_profile_avx2_256_16", "sg", "blocked_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sg_rowcol_short_profile_avx2_256_32_ws, "parasail_sg_rowcol_short_profile_avx2_256_32", "sg", "short_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sg_rowcol_short_profile_avx2_256_16_ws, "parasail_sg_rowcol_short_profile_avx2_256_16", "sg", "short_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sg_rowcol_short_profile_avx2_256_8_ws, "parasail_sg_rowcol_short_profile_avx2_256_8", "sg", "short_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_sg_rowcol_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sg_rowcol_scan_profile_knc_512_32", "sg", "scan_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sg_rowcol_striped_profile_knc_512_32", "sg", "striped_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
-#endif
-{parasail_sg_rowcol_scan_profile_64,  parasail_profile_create_64,          "parasail_sg_rowcol_scan_profile_64",  "sg", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_32,  parasail_profile_create_32,          "parasail_sg_rowcol_scan_profile_32",  "sg", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_16,  parasail_profile_create_16,          "parasail_sg_rowcol_scan_profile_16",  "sg", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_8,   parasail_profile_create_8,           "parasail_sg_rowcol_scan_profile_8",   "sg", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_scan_profile_sat, parasail_profile_create_sat,         "parasail_sg_rowcol_scan_profile_sat", "sg", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_64, parasail_profile_create_64,          "parasail_sg_rowcol_striped_profile_64", "sg", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_32, parasail_profile_create_32,          "parasail_sg_rowcol_striped_profile_32", "sg", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_16, parasail_profile_create_16,          "parasail_sg_rowcol_striped_profile_16", "sg", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_8, parasail_profile_create_8,           "parasail_sg_rowcol_striped_profile_8", "sg", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
-{parasail_sg_rowcol_striped_profile_sat, parasail_profile_create_sat,         "parasail_sg_rowcol_striped_profile_sat", "sg", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sg_rowcol_scan_profile_knc_512_32_ws, "parasail_sg_rowcol_scan_profile_knc_512_32", "sg", "scan_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sg_rowcol_striped_profile_knc_512_32_ws, "parasail_sg_rowcol_striped_profile_knc_512_32", "sg", "striped_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
+#endif
+{parasail_sg_rowcol_scan_profile_64,  parasail_profile_create_64,          parasail_sg_rowcol_scan_profile_64_ws,  "parasail_sg_rowcol_scan_profile_64",  "sg", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_32,  parasail_profile_create_32,          parasail_sg_rowcol_scan_profile_32_ws,  "parasail_sg_rowcol_scan_profile_32",  "sg", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_16,  parasail_profile_create_16,          parasail_sg_rowcol_scan_profile_16_ws,  "parasail_sg_rowcol_scan_profile_16",  "sg", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_8,   parasail_profile_create_8,           parasail_sg_rowcol_scan_profile_8_ws,   "parasail_sg_rowcol_scan_profile_8",   "sg", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_scan_profile_sat, parasail_profile_create_sat,         parasail_sg_rowcol_scan_profile_sat_ws, "parasail_sg_rowcol_scan_profile_sat", "sg", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_64, parasail_profile_create_64,          parasail_sg_rowcol_striped_profile_64_ws, "parasail_sg_rowcol_striped_profile_64", "sg", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_32, parasail_profile_create_32,          parasail_sg_rowcol_striped_profile_32_ws, "parasail_sg_rowcol_striped_profile_32", "sg", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_16, parasail_profile_create_16,          parasail_sg_rowcol_striped_profile_16_ws, "parasail_sg_rowcol_striped_profile_16", "sg", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_8, parasail_profile_create_8,           parasail_sg_rowcol_striped_profile_8_ws, "parasail_sg_rowcol_striped_profile_8", "sg", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_striped_profile_sat, parasail_profile_create_sat,         parasail_sg_rowcol_striped_profile_sat_ws, "parasail_sg_rowcol_striped_profile_sat", "sg", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_profile_32, parasail_profile_create_blocked_32,  parasail_sg_rowcol_blocked_profile_32_ws, "parasail_sg_rowcol_blocked_profile_32", "sg", "blocked_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_blocked_profile_16, parasail_profile_create_blocked_16,  parasail_sg_rowcol_blocked_profile_16_ws, "parasail_sg_rowcol_blocked_profile_16", "sg", "blocked_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_32, parasail_profile_create_32,          parasail_sg_rowcol_short_profile_32_ws, "parasail_sg_rowcol_short_profile_32", "sg", "short_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_16, parasail_profile_create_16,          parasail_sg_rowcol_short_profile_16_ws, "parasail_sg_rowcol_short_profile_16", "sg", "short_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sg_rowcol_short_profile_8,  parasail_profile_create_8,           parasail_sg_rowcol_short_profile_8_ws,  "parasail_sg_rowcol_short_profile_8",  "sg", "short_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 #if HAVE_SSE2
-{parasail_sw_rowcol_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_rowcol_scan_profile_sse2_128_64", "sw", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_rowcol_scan_profile_sse2_128_32", "sw", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_rowcol_scan_profile_sse2_128_16", "sw", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_rowcol_scan_profile_sse2_128_8", "sw", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_rowcol_scan_profile_sse2_128_sat", "sw", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_rowcol_striped_profile_sse2_128_64", "sw", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_rowcol_striped_profile_sse2_128_32", "sw", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_rowcol_striped_profile_sse2_128_16", "sw", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_rowcol_striped_profile_sse2_128_8", "sw", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_rowcol_striped_profile_sse2_128_sat", "sw", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sw_rowcol_scan_profile_sse2_128_64_ws, "parasail_sw_rowcol_scan_profile_sse2_128_64", "sw", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sw_rowcol_scan_profile_sse2_128_32_ws, "parasail_sw_rowcol_scan_profile_sse2_128_32", "sw", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sw_rowcol_scan_profile_sse2_128_16_ws, "parasail_sw_rowcol_scan_profile_sse2_128_16", "sw", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sw_rowcol_scan_profile_sse2_128_8_ws, "parasail_sw_rowcol_scan_profile_sse2_128_8", "sw", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_rowcol_scan_profile_sse2_128_sat_ws, "parasail_sw_rowcol_scan_profile_sse2_128_sat", "sw", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse2_128_64, parasail_profile_create_sse_128_64,  parasail_sw_rowcol_striped_profile_sse2_128_64_ws, "parasail_sw_rowcol_striped_profile_sse2_128_64", "sw", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse2_128_32, parasail_profile_create_sse_128_32,  parasail_sw_rowcol_striped_profile_sse2_128_32_ws, "parasail_sw_rowcol_striped_profile_sse2_128_32", "sw", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse2_128_16, parasail_profile_create_sse_128_16,  parasail_sw_rowcol_striped_profile_sse2_128_16_ws, "parasail_sw_rowcol_striped_profile_sse2_128_16", "sw", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse2_128_8, parasail_profile_create_sse_128_8,   parasail_sw_rowcol_striped_profile_sse2_128_8_ws, "parasail_sw_rowcol_striped_profile_sse2_128_8", "sw", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_rowcol_striped_profile_sse2_128_sat_ws, "parasail_sw_rowcol_striped_profile_sse2_128_sat", "sw", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sw_rowcol_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_rowcol_scan_profile_sse41_128_64", "sw", "scan_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_rowcol_scan_profile_sse41_128_32", "sw", "scan_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_rowcol_scan_profile_sse41_128_16", "sw", "scan_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_rowcol_scan_profile_sse41_128_8", "sw", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_rowcol_scan_profile_sse41_128_sat", "sw", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  "parasail_sw_rowcol_striped_profile_sse41_128_64", "sw", "striped_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  "parasail_sw_rowcol_striped_profile_sse41_128_32", "sw", "striped_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  "parasail_sw_rowcol_striped_profile_sse41_128_16", "sw", "striped_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   "parasail_sw_rowcol_striped_profile_sse41_128_8", "sw", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, "parasail_sw_rowcol_striped_profile_sse41_128_sat", "sw", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sw_rowcol_scan_profile_sse41_128_64_ws, "parasail_sw_rowcol_scan_profile_sse41_128_64", "sw", "scan_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_rowcol_scan_profile_sse41_128_32_ws, "parasail_sw_rowcol_scan_profile_sse41_128_32", "sw", "scan_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_rowcol_scan_profile_sse41_128_16_ws, "parasail_sw_rowcol_scan_profile_sse41_128_16", "sw", "scan_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_rowcol_scan_profile_sse41_128_8_ws, "parasail_sw_rowcol_scan_profile_sse41_128_8", "sw", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_rowcol_scan_profile_sse41_128_sat_ws, "parasail_sw_rowcol_scan_profile_sse41_128_sat", "sw", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse41_128_64, parasail_profile_create_sse_128_64,  parasail_sw_rowcol_striped_profile_sse41_128_64_ws, "parasail_sw_rowcol_striped_profile_sse41_128_64", "sw", "striped_profile", "sse41", "128", "64",  2, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_rowcol_striped_profile_sse41_128_32_ws, "parasail_sw_rowcol_striped_profile_sse41_128_32", "sw", "striped_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_rowcol_striped_profile_sse41_128_16_ws, "parasail_sw_rowcol_striped_profile_sse41_128_16", "sw", "striped_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_rowcol_striped_profile_sse41_128_8_ws, "parasail_sw_rowcol_striped_profile_sse41_128_8", "sw", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_sse_128_sat, parasail_sw_rowcol_striped_profile_sse41_128_sat_ws, "parasail_sw_rowcol_striped_profile_sse41_128_sat", "sw", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_profile_sse41_128_32, parasail_profile_create_blocked_sse_128_32, parasail_sw_rowcol_blocked_profile_sse41_128_32_ws, "parasail_sw_rowcol_blocked_profile_sse41_128_32", "sw", "blocked_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_profile_sse41_128_16, parasail_profile_create_blocked_sse_128_16, parasail_sw_rowcol_blocked_profile_sse41_128_16_ws, "parasail_sw_rowcol_blocked_profile_sse41_128_16", "sw", "blocked_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_sse41_128_32, parasail_profile_create_sse_128_32,  parasail_sw_rowcol_short_profile_sse41_128_32_ws, "parasail_sw_rowcol_short_profile_sse41_128_32", "sw", "short_profile", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_sse41_128_16, parasail_profile_create_sse_128_16,  parasail_sw_rowcol_short_profile_sse41_128_16_ws, "parasail_sw_rowcol_short_profile_sse41_128_16", "sw", "short_profile", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_sse41_128_8, parasail_profile_create_sse_128_8,   parasail_sw_rowcol_short_profile_sse41_128_8_ws, "parasail_sw_rowcol_short_profile_sse41_128_8", "sw", "short_profile", "sse41", "128",  "8", 16, 0, 1, 0, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sw_rowcol_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sw_rowcol_scan_profile_avx2_256_64", "sw", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sw_rowcol_scan_profile_avx2_256_32", "sw", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sw_rowcol_scan_profile_avx2_256_16", "sw", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_rowcol_scan_profile_avx2_256_8", "sw", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_rowcol_scan_profile_avx2_256_sat", "sw", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  "parasail_sw_rowcol_striped_profile_avx2_256_64", "sw", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  "parasail_sw_rowcol_striped_profile_avx2_256_32", "sw", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  "parasail_sw_rowcol_striped_profile_avx2_256_16", "sw", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_rowcol_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_rowcol_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sw_rowcol_scan_profile_avx2_256_64_ws, "parasail_sw_rowcol_scan_profile_avx2_256_64", "sw", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_rowcol_scan_profile_avx2_256_32_ws, "parasail_sw_rowcol_scan_profile_avx2_256_32", "sw", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_rowcol_scan_profile_avx2_256_16_ws, "parasail_sw_rowcol_scan_profile_avx2_256_16", "sw", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_rowcol_scan_profile_avx2_256_8_ws, "parasail_sw_rowcol_scan_profile_avx2_256_8", "sw", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sw_rowcol_scan_profile_avx2_256_sat_ws, "parasail_sw_rowcol_scan_profile_avx2_256_sat", "sw", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx2_256_64, parasail_profile_create_avx_256_64,  parasail_sw_rowcol_striped_profile_avx2_256_64_ws, "parasail_sw_rowcol_striped_profile_avx2_256_64", "sw", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_rowcol_striped_profile_avx2_256_32_ws, "parasail_sw_rowcol_striped_profile_avx2_256_32", "sw", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_rowcol_striped_profile_avx2_256_16_ws, "parasail_sw_rowcol_striped_profile_avx2_256_16", "sw", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_rowcol_striped_profile_avx2_256_8_ws, "parasail_sw_rowcol_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, parasail_sw_rowcol_striped_profile_avx2_256_sat_ws, "parasail_sw_rowcol_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_profile_avx2_256_32, parasail_profile_create_blocked_avx_256_32, parasail_sw_rowcol_blocked_profile_avx2_256_32_ws, "parasail_sw_rowcol_blocked_profile_avx2_256_32", "sw", "blocked_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_profile_avx2_256_16, parasail_profile_create_blocked_avx_256_16, parasail_sw_rowcol_blocked_profile_avx2_256_16_ws, "parasail_sw_rowcol_blocked_profile_avx2_256_16", "sw", "blocked_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_avx2_256_32, parasail_profile_create_avx_256_32,  parasail_sw_rowcol_short_profile_avx2_256_32_ws, "parasail_sw_rowcol_short_profile_avx2_256_32", "sw", "short_profile", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_avx2_256_16, parasail_profile_create_avx_256_16,  parasail_sw_rowcol_short_profile_avx2_256_16_ws, "parasail_sw_rowcol_short_profile_avx2_256_16", "sw", "short_profile", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_avx2_256_8, parasail_profile_create_avx_256_8,   parasail_sw_rowcol_short_profile_avx2_256_8_ws, "parasail_sw_rowcol_short_profile_avx2_256_8", "sw", "short_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
 #endif
 #if HAVE_KNC
-{parasail_sw_rowcol_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sw_rowcol_scan_profile_knc_512_32", "sw", "scan_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  "parasail_sw_rowcol_striped_profile_knc_512_32", "sw", "striped_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
-#endif
-{parasail_sw_rowcol_scan_profile_64,  parasail_profile_create_64,          "parasail_sw_rowcol_scan_profile_64",  "sw", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_32,  parasail_profile_create_32,          "parasail_sw_rowcol_scan_profile_32",  "sw", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_16,  parasail_profile_create_16,          "parasail_sw_rowcol_scan_profile_16",  "sw", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_8,   parasail_profile_create_8,           "parasail_sw_rowcol_scan_profile_8",   "sw", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_scan_profile_sat, parasail_profile_create_sat,         "parasail_sw_rowcol_scan_profile_sat", "sw", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_64, parasail_profile_create_64,          "parasail_sw_rowcol_striped_profile_64", "sw", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_32, parasail_profile_create_32,          "parasail_sw_rowcol_striped_profile_32", "sw", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_16, parasail_profile_create_16,          "parasail_sw_rowcol_striped_profile_16", "sw", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_8, parasail_profile_create_8,           "parasail_sw_rowcol_striped_profile_8", "sw", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
-{parasail_sw_rowcol_striped_profile_sat, parasail_profile_create_sat,         "parasail_sw_rowcol_striped_profile_sat", "sw", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sw_rowcol_scan_profile_knc_512_32_ws, "parasail_sw_rowcol_scan_profile_knc_512_32", "sw", "scan_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_knc_512_32, parasail_profile_create_knc_512_32,  parasail_sw_rowcol_striped_profile_knc_512_32_ws, "parasail_sw_rowcol_striped_profile_knc_512_32", "sw", "striped_profile", "knc",   "512", "32", 16, 0, 1, 0, 0},
+#endif
+{parasail_sw_rowcol_scan_profile_64,  parasail_profile_create_64,          parasail_sw_rowcol_scan_profile_64_ws,  "parasail_sw_rowcol_scan_profile_64",  "sw", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_32,  parasail_profile_create_32,          parasail_sw_rowcol_scan_profile_32_ws,  "parasail_sw_rowcol_scan_profile_32",  "sw", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_16,  parasail_profile_create_16,          parasail_sw_rowcol_scan_profile_16_ws,  "parasail_sw_rowcol_scan_profile_16",  "sw", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_8,   parasail_profile_create_8,           parasail_sw_rowcol_scan_profile_8_ws,   "parasail_sw_rowcol_scan_profile_8",   "sw", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_scan_profile_sat, parasail_profile_create_sat,         parasail_sw_rowcol_scan_profile_sat_ws, "parasail_sw_rowcol_scan_profile_sat", "sw", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_64, parasail_profile_create_64,          parasail_sw_rowcol_striped_profile_64_ws, "parasail_sw_rowcol_striped_profile_64", "sw", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_32, parasail_profile_create_32,          parasail_sw_rowcol_striped_profile_32_ws, "parasail_sw_rowcol_striped_profile_32", "sw", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_16, parasail_profile_create_16,          parasail_sw_rowcol_striped_profile_16_ws, "parasail_sw_rowcol_striped_profile_16", "sw", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_8, parasail_profile_create_8,           parasail_sw_rowcol_striped_profile_8_ws, "parasail_sw_rowcol_striped_profile_8", "sw", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_striped_profile_sat, parasail_profile_create_sat,         parasail_sw_rowcol_striped_profile_sat_ws, "parasail_sw_rowcol_striped_profile_sat", "sw", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_profile_32, parasail_profile_create_blocked_32,  parasail_sw_rowcol_blocked_profile_32_ws, "parasail_sw_rowcol_blocked_profile_32", "sw", "blocked_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_blocked_profile_16, parasail_profile_create_blocked_16,  parasail_sw_rowcol_blocked_profile_16_ws, "parasail_sw_rowcol_blocked_profile_16", "sw", "blocked_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_32, parasail_profile_create_32,          parasail_sw_rowcol_short_profile_32_ws, "parasail_sw_rowcol_short_profile_32", "sw", "short_profile", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_16, parasail_profile_create_16,          parasail_sw_rowcol_short_profile_16_ws, "parasail_sw_rowcol_short_profile_16", "sw", "short_profile", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_sw_rowcol_short_profile_8,  parasail_profile_create_8,           parasail_sw_rowcol_short_profile_8_ws,  "parasail_sw_rowcol_short_profile_8",  "sw", "short_profile", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
 #if HAVE_SSE2
-{parasail_nw_stats_rowcol_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_rowcol_scan_profile_sse2_128_64", "nw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_rowcol_scan_profile_sse2_128_32", "nw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_rowcol_scan_profile_sse2_128_16", "nw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_rowcol_scan_profile_sse2_128_8", "nw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_rowcol_scan_profile_sse2_128_sat", "nw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_rowcol_striped_profile_sse2_128_64", "nw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_rowcol_striped_profile_sse2_128_32", "nw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_rowcol_striped_profile_sse2_128_16", "nw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_rowcol_striped_profile_sse2_128_8", "nw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_rowcol_striped_profile_sse2_128_sat", "nw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_rowcol_scan_profile_sse2_128_64_ws, "parasail_nw_stats_rowcol_scan_profile_sse2_128_64", "nw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_rowcol_scan_profile_sse2_128_32_ws, "parasail_nw_stats_rowcol_scan_profile_sse2_128_32", "nw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_rowcol_scan_profile_sse2_128_16_ws, "parasail_nw_stats_rowcol_scan_profile_sse2_128_16", "nw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_rowcol_scan_profile_sse2_128_8_ws, "parasail_nw_stats_rowcol_scan_profile_sse2_128_8", "nw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_rowcol_scan_profile_sse2_128_sat_ws, "parasail_nw_stats_rowcol_scan_profile_sse2_128_sat", "nw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_rowcol_striped_profile_sse2_128_64_ws, "parasail_nw_stats_rowcol_striped_profile_sse2_128_64", "nw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_rowcol_striped_profile_sse2_128_32_ws, "parasail_nw_stats_rowcol_striped_profile_sse2_128_32", "nw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_rowcol_striped_profile_sse2_128_16_ws, "parasail_nw_stats_rowcol_striped_profile_sse2_128_16", "nw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_rowcol_striped_profile_sse2_128_8_ws, "parasail_nw_stats_rowcol_striped_profile_sse2_128_8", "nw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_rowcol_striped_profile_sse2_128_sat_ws, "parasail_nw_stats_rowcol_striped_profile_sse2_128_sat", "nw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_nw_stats_rowcol_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_rowcol_scan_profile_sse41_128_64", "nw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_rowcol_scan_profile_sse41_128_32", "nw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_rowcol_scan_profile_sse41_128_16", "nw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_rowcol_scan_profile_sse41_128_8", "nw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_rowcol_scan_profile_sse41_128_sat", "nw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_nw_stats_rowcol_striped_profile_sse41_128_64", "nw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_nw_stats_rowcol_striped_profile_sse41_128_32", "nw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_nw_stats_rowcol_striped_profile_sse41_128_16", "nw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_nw_stats_rowcol_striped_profile_sse41_128_8", "nw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_nw_stats_rowcol_striped_profile_sse41_128_sat", "nw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_rowcol_scan_profile_sse41_128_64_ws, "parasail_nw_stats_rowcol_scan_profile_sse41_128_64", "nw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_rowcol_scan_profile_sse41_128_32_ws, "parasail_nw_stats_rowcol_scan_profile_sse41_128_32", "nw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_rowcol_scan_profile_sse41_128_16_ws, "parasail_nw_stats_rowcol_scan_profile_sse41_128_16", "nw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_rowcol_scan_profile_sse41_128_8_ws, "parasail_nw_stats_rowcol_scan_profile_sse41_128_8", "nw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_rowcol_scan_profile_sse41_128_sat_ws, "parasail_nw_stats_rowcol_scan_profile_sse41_128_sat", "nw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_nw_stats_rowcol_striped_profile_sse41_128_64_ws, "parasail_nw_stats_rowcol_striped_profile_sse41_128_64", "nw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_nw_stats_rowcol_striped_profile_sse41_128_32_ws, "parasail_nw_stats_rowcol_striped_profile_sse41_128_32", "nw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_nw_stats_rowcol_striped_profile_sse41_128_16_ws, "parasail_nw_stats_rowcol_striped_profile_sse41_128_16", "nw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_nw_stats_rowcol_striped_profile_sse41_128_8_ws, "parasail_nw_stats_rowcol_striped_profile_sse41_128_8", "nw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_nw_stats_rowcol_striped_profile_sse41_128_sat_ws, "parasail_nw_stats_rowcol_striped_profile_sse41_128_sat", "nw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_nw_stats_rowcol_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_nw_stats_rowcol_scan_profile_avx2_256_64", "nw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_nw_stats_rowcol_scan_profile_avx2_256_32", "nw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_nw_stats_rowcol_scan_profile_avx2_256_16", "nw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_rowcol_scan_profile_avx2_256_8", "nw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_rowcol_scan_profile_avx2_256_sat", "nw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_nw_stats_rowcol_striped_profile_avx2_256_64", "nw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_nw_stats_rowcol_striped_profile_avx2_256_32", "nw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_nw_stats_rowcol_striped_profile_avx2_256_16", "nw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_rowcol_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_rowcol_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_nw_stats_rowcol_scan_profile_avx2_256_64_ws, "parasail_nw_stats_rowcol_scan_profile_avx2_256_64", "nw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_nw_stats_rowcol_scan_profile_avx2_256_32_ws, "parasail_nw_stats_rowcol_scan_profile_avx2_256_32", "nw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_nw_stats_rowcol_scan_profile_avx2_256_16_ws, "parasail_nw_stats_rowcol_scan_profile_avx2_256_16", "nw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_nw_stats_rowcol_scan_profile_avx2_256_8_ws, "parasail_nw_stats_rowcol_scan_profile_avx2_256_8", "nw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_nw_stats_rowcol_scan_profile_avx2_256_sat_ws, "parasail_nw_stats_rowcol_scan_profile_avx2_256_sat", "nw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_nw_stats_rowcol_striped_profile_avx2_256_64_ws, "parasail_nw_stats_rowcol_striped_profile_avx2_256_64", "nw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_nw_stats_rowcol_striped_profile_avx2_256_32_ws, "parasail_nw_stats_rowcol_striped_profile_avx2_256_32", "nw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_nw_stats_rowcol_striped_profile_avx2_256_16_ws, "parasail_nw_stats_rowcol_striped_profile_avx2_256_16", "nw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_nw_stats_rowcol_striped_profile_avx2_256_8_ws, "parasail_nw_stats_rowcol_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_nw_stats_rowcol_striped_profile_avx2_256_sat_ws, "parasail_nw_stats_rowcol_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_nw_stats_rowcol_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_nw_stats_rowcol_scan_profile_knc_512_32", "nw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_nw_stats_rowcol_striped_profile_knc_512_32", "nw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
-#endif
-{parasail_nw_stats_rowcol_scan_profile_64, parasail_profile_create_stats_64,    "parasail_nw_stats_rowcol_scan_profile_64", "nw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_32, parasail_profile_create_stats_32,    "parasail_nw_stats_rowcol_scan_profile_32", "nw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_16, parasail_profile_create_stats_16,    "parasail_nw_stats_rowcol_scan_profile_16", "nw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_8, parasail_profile_create_stats_8,     "parasail_nw_stats_rowcol_scan_profile_8", "nw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_scan_profile_sat, parasail_profile_create_stats_sat,   "parasail_nw_stats_rowcol_scan_profile_sat", "nw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_64, parasail_profile_create_stats_64,    "parasail_nw_stats_rowcol_striped_profile_64", "nw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_32, parasail_profile_create_stats_32,    "parasail_nw_stats_rowcol_striped_profile_32", "nw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_16, parasail_profile_create_stats_16,    "parasail_nw_stats_rowcol_striped_profile_16", "nw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_8, parasail_profile_create_stats_8,     "parasail_nw_stats_rowcol_striped_profile_8", "nw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
-{parasail_nw_stats_rowcol_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_nw_stats_rowcol_striped_profile_sat", "nw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_nw_stats_rowcol_scan_profile_knc_512_32_ws, "parasail_nw_stats_rowcol_scan_profile_knc_512_32", "nw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_nw_stats_rowcol_striped_profile_knc_512_32_ws, "parasail_nw_stats_rowcol_striped_profile_knc_512_32", "nw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
+#endif
+{parasail_nw_stats_rowcol_scan_profile_64, parasail_profile_create_stats_64,    parasail_nw_stats_rowcol_scan_profile_64_ws, "parasail_nw_stats_rowcol_scan_profile_64", "nw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_32, parasail_profile_create_stats_32,    parasail_nw_stats_rowcol_scan_profile_32_ws, "parasail_nw_stats_rowcol_scan_profile_32", "nw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_16, parasail_profile_create_stats_16,    parasail_nw_stats_rowcol_scan_profile_16_ws, "parasail_nw_stats_rowcol_scan_profile_16", "nw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_8, parasail_profile_create_stats_8,     parasail_nw_stats_rowcol_scan_profile_8_ws, "parasail_nw_stats_rowcol_scan_profile_8", "nw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_sat, parasail_profile_create_stats_sat,   parasail_nw_stats_rowcol_scan_profile_sat_ws, "parasail_nw_stats_rowcol_scan_profile_sat", "nw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_64, parasail_profile_create_stats_64,    parasail_nw_stats_rowcol_striped_profile_64_ws, "parasail_nw_stats_rowcol_striped_profile_64", "nw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_32, parasail_profile_create_stats_32,    parasail_nw_stats_rowcol_striped_profile_32_ws, "parasail_nw_stats_rowcol_striped_profile_32", "nw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_16, parasail_profile_create_stats_16,    parasail_nw_stats_rowcol_striped_profile_16_ws, "parasail_nw_stats_rowcol_striped_profile_16", "nw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_8, parasail_profile_create_stats_8,     parasail_nw_stats_rowcol_striped_profile_8_ws, "parasail_nw_stats_rowcol_striped_profile_8", "nw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_nw_stats_rowcol_striped_profile_sat_ws, "parasail_nw_stats_rowcol_striped_profile_sat", "nw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
 #if HAVE_SSE2
-{parasail_sg_stats_rowcol_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_rowcol_scan_profile_sse2_128_64", "sg_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_rowcol_scan_profile_sse2_128_32", "sg_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_rowcol_scan_profile_sse2_128_16", "sg_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_rowcol_scan_profile_sse2_128_8", "sg_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_rowcol_scan_profile_sse2_128_sat", "sg_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_rowcol_striped_profile_sse2_128_64", "sg_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_rowcol_striped_profile_sse2_128_32", "sg_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_rowcol_striped_profile_sse2_128_16", "sg_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_rowcol_striped_profile_sse2_128_8", "sg_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_rowcol_striped_profile_sse2_128_sat", "sg_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_rowcol_scan_profile_sse2_128_64_ws, "parasail_sg_stats_rowcol_scan_profile_sse2_128_64", "sg_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_rowcol_scan_profile_sse2_128_32_ws, "parasail_sg_stats_rowcol_scan_profile_sse2_128_32", "sg_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_rowcol_scan_profile_sse2_128_16_ws, "parasail_sg_stats_rowcol_scan_profile_sse2_128_16", "sg_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_rowcol_scan_profile_sse2_128_8_ws, "parasail_sg_stats_rowcol_scan_profile_sse2_128_8", "sg_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_rowcol_scan_profile_sse2_128_sat_ws, "parasail_sg_stats_rowcol_scan_profile_sse2_128_sat", "sg_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_rowcol_striped_profile_sse2_128_64_ws, "parasail_sg_stats_rowcol_striped_profile_sse2_128_64", "sg_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_rowcol_striped_profile_sse2_128_32_ws, "parasail_sg_stats_rowcol_striped_profile_sse2_128_32", "sg_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_rowcol_striped_profile_sse2_128_16_ws, "parasail_sg_stats_rowcol_striped_profile_sse2_128_16", "sg_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_rowcol_striped_profile_sse2_128_8_ws, "parasail_sg_stats_rowcol_striped_profile_sse2_128_8", "sg_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_rowcol_striped_profile_sse2_128_sat_ws, "parasail_sg_stats_rowcol_striped_profile_sse2_128_sat", "sg_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sg_stats_rowcol_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_rowcol_scan_profile_sse41_128_64", "sg_stats", "scan_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_rowcol_scan_profile_sse41_128_32", "sg_stats", "scan_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_rowcol_scan_profile_sse41_128_16", "sg_stats", "scan_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_rowcol_scan_profile_sse41_128_8", "sg_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_rowcol_scan_profile_sse41_128_sat", "sg_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sg_stats_rowcol_striped_profile_sse41_128_64", "sg_stats", "striped_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sg_stats_rowcol_striped_profile_sse41_128_32", "sg_stats", "striped_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sg_stats_rowcol_striped_profile_sse41_128_16", "sg_stats", "striped_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sg_stats_rowcol_striped_profile_sse41_128_8", "sg_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sg_stats_rowcol_striped_profile_sse41_128_sat", "sg_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_rowcol_scan_profile_sse41_128_64_ws, "parasail_sg_stats_rowcol_scan_profile_sse41_128_64", "sg_stats", "scan_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_rowcol_scan_profile_sse41_128_32_ws, "parasail_sg_stats_rowcol_scan_profile_sse41_128_32", "sg_stats", "scan_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_rowcol_scan_profile_sse41_128_16_ws, "parasail_sg_stats_rowcol_scan_profile_sse41_128_16", "sg_stats", "scan_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_rowcol_scan_profile_sse41_128_8_ws, "parasail_sg_stats_rowcol_scan_profile_sse41_128_8", "sg_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_rowcol_scan_profile_sse41_128_sat_ws, "parasail_sg_stats_rowcol_scan_profile_sse41_128_sat", "sg_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sg_stats_rowcol_striped_profile_sse41_128_64_ws, "parasail_sg_stats_rowcol_striped_profile_sse41_128_64", "sg_stats", "striped_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sg_stats_rowcol_striped_profile_sse41_128_32_ws, "parasail_sg_stats_rowcol_striped_profile_sse41_128_32", "sg_stats", "striped_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sg_stats_rowcol_striped_profile_sse41_128_16_ws, "parasail_sg_stats_rowcol_striped_profile_sse41_128_16", "sg_stats", "striped_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sg_stats_rowcol_striped_profile_sse41_128_8_ws, "parasail_sg_stats_rowcol_striped_profile_sse41_128_8", "sg_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sg_stats_rowcol_striped_profile_sse41_128_sat_ws, "parasail_sg_stats_rowcol_striped_profile_sse41_128_sat", "sg_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sg_stats_rowcol_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sg_stats_rowcol_scan_profile_avx2_256_64", "sg_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sg_stats_rowcol_scan_profile_avx2_256_32", "sg_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sg_stats_rowcol_scan_profile_avx2_256_16", "sg_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_rowcol_scan_profile_avx2_256_8", "sg_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_rowcol_scan_profile_avx2_256_sat", "sg_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sg_stats_rowcol_striped_profile_avx2_256_64", "sg_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sg_stats_rowcol_striped_profile_avx2_256_32", "sg_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sg_stats_rowcol_striped_profile_avx2_256_16", "sg_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_rowcol_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_rowcol_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sg_stats_rowcol_scan_profile_avx2_256_64_ws, "parasail_sg_stats_rowcol_scan_profile_avx2_256_64", "sg_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sg_stats_rowcol_scan_profile_avx2_256_32_ws, "parasail_sg_stats_rowcol_scan_profile_avx2_256_32", "sg_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sg_stats_rowcol_scan_profile_avx2_256_16_ws, "parasail_sg_stats_rowcol_scan_profile_avx2_256_16", "sg_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sg_stats_rowcol_scan_profile_avx2_256_8_ws, "parasail_sg_stats_rowcol_scan_profile_avx2_256_8", "sg_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sg_stats_rowcol_scan_profile_avx2_256_sat_ws, "parasail_sg_stats_rowcol_scan_profile_avx2_256_sat", "sg_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sg_stats_rowcol_striped_profile_avx2_256_64_ws, "parasail_sg_stats_rowcol_striped_profile_avx2_256_64", "sg_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sg_stats_rowcol_striped_profile_avx2_256_32_ws, "parasail_sg_stats_rowcol_striped_profile_avx2_256_32", "sg_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sg_stats_rowcol_striped_profile_avx2_256_16_ws, "parasail_sg_stats_rowcol_striped_profile_avx2_256_16", "sg_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sg_stats_rowcol_striped_profile_avx2_256_8_ws, "parasail_sg_stats_rowcol_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sg_stats_rowcol_striped_profile_avx2_256_sat_ws, "parasail_sg_stats_rowcol_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_sg_stats_rowcol_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sg_stats_rowcol_scan_profile_knc_512_32", "sg_stats", "scan_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sg_stats_rowcol_striped_profile_knc_512_32", "sg_stats", "striped_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
-#endif
-{parasail_sg_stats_rowcol_scan_profile_64, parasail_profile_create_stats_64,    "parasail_sg_stats_rowcol_scan_profile_64", "sg_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_32, parasail_profile_create_stats_32,    "parasail_sg_stats_rowcol_scan_profile_32", "sg_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_16, parasail_profile_create_stats_16,    "parasail_sg_stats_rowcol_scan_profile_16", "sg_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_8, parasail_profile_create_stats_8,     "parasail_sg_stats_rowcol_scan_profile_8", "sg_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_scan_profile_sat, parasail_profile_create_stats_sat,   "parasail_sg_stats_rowcol_scan_profile_sat", "sg_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_64, parasail_profile_create_stats_64,    "parasail_sg_stats_rowcol_striped_profile_64", "sg_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_32, parasail_profile_create_stats_32,    "parasail_sg_stats_rowcol_striped_profile_32", "sg_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_16, parasail_profile_create_stats_16,    "parasail_sg_stats_rowcol_striped_profile_16", "sg_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_8, parasail_profile_create_stats_8,     "parasail_sg_stats_rowcol_striped_profile_8", "sg_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
-{parasail_sg_stats_rowcol_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_sg_stats_rowcol_striped_profile_sat", "sg_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sg_stats_rowcol_scan_profile_knc_512_32_ws, "parasail_sg_stats_rowcol_scan_profile_knc_512_32", "sg_stats", "scan_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sg_stats_rowcol_striped_profile_knc_512_32_ws, "parasail_sg_stats_rowcol_striped_profile_knc_512_32", "sg_stats", "striped_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
+#endif
+{parasail_sg_stats_rowcol_scan_profile_64, parasail_profile_create_stats_64,    parasail_sg_stats_rowcol_scan_profile_64_ws, "parasail_sg_stats_rowcol_scan_profile_64", "sg_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_32, parasail_profile_create_stats_32,    parasail_sg_stats_rowcol_scan_profile_32_ws, "parasail_sg_stats_rowcol_scan_profile_32", "sg_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_16, parasail_profile_create_stats_16,    parasail_sg_stats_rowcol_scan_profile_16_ws, "parasail_sg_stats_rowcol_scan_profile_16", "sg_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_8, parasail_profile_create_stats_8,     parasail_sg_stats_rowcol_scan_profile_8_ws, "parasail_sg_stats_rowcol_scan_profile_8", "sg_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_sat, parasail_profile_create_stats_sat,   parasail_sg_stats_rowcol_scan_profile_sat_ws, "parasail_sg_stats_rowcol_scan_profile_sat", "sg_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_64, parasail_profile_create_stats_64,    parasail_sg_stats_rowcol_striped_profile_64_ws, "parasail_sg_stats_rowcol_striped_profile_64", "sg_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_32, parasail_profile_create_stats_32,    parasail_sg_stats_rowcol_striped_profile_32_ws, "parasail_sg_stats_rowcol_striped_profile_32", "sg_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_16, parasail_profile_create_stats_16,    parasail_sg_stats_rowcol_striped_profile_16_ws, "parasail_sg_stats_rowcol_striped_profile_16", "sg_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_8, parasail_profile_create_stats_8,     parasail_sg_stats_rowcol_striped_profile_8_ws, "parasail_sg_stats_rowcol_striped_profile_8", "sg_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_sg_stats_rowcol_striped_profile_sat_ws, "parasail_sg_stats_rowcol_striped_profile_sat", "sg_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
 #if HAVE_SSE2
-{parasail_sw_stats_rowcol_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_rowcol_scan_profile_sse2_128_64", "sw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_rowcol_scan_profile_sse2_128_32", "sw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_rowcol_scan_profile_sse2_128_16", "sw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_rowcol_scan_profile_sse2_128_8", "sw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_rowcol_scan_profile_sse2_128_sat", "sw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_rowcol_striped_profile_sse2_128_64", "sw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_rowcol_striped_profile_sse2_128_32", "sw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_rowcol_striped_profile_sse2_128_16", "sw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_rowcol_striped_profile_sse2_128_8", "sw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_rowcol_striped_profile_sse2_128_sat", "sw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_rowcol_scan_profile_sse2_128_64_ws, "parasail_sw_stats_rowcol_scan_profile_sse2_128_64", "sw_stats", "scan_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_rowcol_scan_profile_sse2_128_32_ws, "parasail_sw_stats_rowcol_scan_profile_sse2_128_32", "sw_stats", "scan_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_rowcol_scan_profile_sse2_128_16_ws, "parasail_sw_stats_rowcol_scan_profile_sse2_128_16", "sw_stats", "scan_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_rowcol_scan_profile_sse2_128_8_ws, "parasail_sw_stats_rowcol_scan_profile_sse2_128_8", "sw_stats", "scan_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_rowcol_scan_profile_sse2_128_sat_ws, "parasail_sw_stats_rowcol_scan_profile_sse2_128_sat", "sw_stats", "scan_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse2_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_rowcol_striped_profile_sse2_128_64_ws, "parasail_sw_stats_rowcol_striped_profile_sse2_128_64", "sw_stats", "striped_profile", "sse2",  "128", "64",  2, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse2_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_rowcol_striped_profile_sse2_128_32_ws, "parasail_sw_stats_rowcol_striped_profile_sse2_128_32", "sw_stats", "striped_profile", "sse2",  "128", "32",  4, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse2_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_rowcol_striped_profile_sse2_128_16_ws, "parasail_sw_stats_rowcol_striped_profile_sse2_128_16", "sw_stats", "striped_profile", "sse2",  "128", "16",  8, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse2_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_rowcol_striped_profile_sse2_128_8_ws, "parasail_sw_stats_rowcol_striped_profile_sse2_128_8", "sw_stats", "striped_profile", "sse2",  "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse2_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_rowcol_striped_profile_sse2_128_sat_ws, "parasail_sw_stats_rowcol_striped_profile_sse2_128_sat", "sw_stats", "striped_profile", "sse2",  "128", "sat", 16, 0, 1, 1, 0},
 #endif
 #if HAVE_SSE41
-{parasail_sw_stats_rowcol_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_rowcol_scan_profile_sse41_128_64", "sw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_rowcol_scan_profile_sse41_128_32", "sw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_rowcol_scan_profile_sse41_128_16", "sw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_rowcol_scan_profile_sse41_128_8", "sw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_rowcol_scan_profile_sse41_128_sat", "sw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, "parasail_sw_stats_rowcol_striped_profile_sse41_128_64", "sw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, "parasail_sw_stats_rowcol_striped_profile_sse41_128_32", "sw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, "parasail_sw_stats_rowcol_striped_profile_sse41_128_16", "sw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, "parasail_sw_stats_rowcol_striped_profile_sse41_128_8", "sw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, "parasail_sw_stats_rowcol_striped_profile_sse41_128_sat", "sw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_rowcol_scan_profile_sse41_128_64_ws, "parasail_sw_stats_rowcol_scan_profile_sse41_128_64", "sw_stats", "scan_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_rowcol_scan_profile_sse41_128_32_ws, "parasail_sw_stats_rowcol_scan_profile_sse41_128_32", "sw_stats", "scan_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_rowcol_scan_profile_sse41_128_16_ws, "parasail_sw_stats_rowcol_scan_profile_sse41_128_16", "sw_stats", "scan_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_rowcol_scan_profile_sse41_128_8_ws, "parasail_sw_stats_rowcol_scan_profile_sse41_128_8", "sw_stats", "scan_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_rowcol_scan_profile_sse41_128_sat_ws, "parasail_sw_stats_rowcol_scan_profile_sse41_128_sat", "sw_stats", "scan_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse41_128_64, parasail_profile_create_stats_sse_128_64, parasail_sw_stats_rowcol_striped_profile_sse41_128_64_ws, "parasail_sw_stats_rowcol_striped_profile_sse41_128_64", "sw_stats", "striped_profile", "sse41", "128", "64",  2, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse41_128_32, parasail_profile_create_stats_sse_128_32, parasail_sw_stats_rowcol_striped_profile_sse41_128_32_ws, "parasail_sw_stats_rowcol_striped_profile_sse41_128_32", "sw_stats", "striped_profile", "sse41", "128", "32",  4, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse41_128_16, parasail_profile_create_stats_sse_128_16, parasail_sw_stats_rowcol_striped_profile_sse41_128_16_ws, "parasail_sw_stats_rowcol_striped_profile_sse41_128_16", "sw_stats", "striped_profile", "sse41", "128", "16",  8, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse41_128_8, parasail_profile_create_stats_sse_128_8, parasail_sw_stats_rowcol_striped_profile_sse41_128_8_ws, "parasail_sw_stats_rowcol_striped_profile_sse41_128_8", "sw_stats", "striped_profile", "sse41", "128",  "8", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sse41_128_sat, parasail_profile_create_stats_sse_128_sat, parasail_sw_stats_rowcol_striped_profile_sse41_128_sat_ws, "parasail_sw_stats_rowcol_striped_profile_sse41_128_sat", "sw_stats", "striped_profile", "sse41", "128", "sat", 16, 0, 1, 1, 0},
 #endif
 #if HAVE_AVX2
-{parasail_sw_stats_rowcol_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sw_stats_rowcol_scan_profile_avx2_256_64", "sw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sw_stats_rowcol_scan_profile_avx2_256_32", "sw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sw_stats_rowcol_scan_profile_avx2_256_16", "sw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_rowcol_scan_profile_avx2_256_8", "sw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_rowcol_scan_profile_avx2_256_sat", "sw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, "parasail_sw_stats_rowcol_striped_profile_avx2_256_64", "sw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, "parasail_sw_stats_rowcol_striped_profile_avx2_256_32", "sw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, "parasail_sw_stats_rowcol_striped_profile_avx2_256_16", "sw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_rowcol_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_rowcol_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sw_stats_rowcol_scan_profile_avx2_256_64_ws, "parasail_sw_stats_rowcol_scan_profile_avx2_256_64", "sw_stats", "scan_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sw_stats_rowcol_scan_profile_avx2_256_32_ws, "parasail_sw_stats_rowcol_scan_profile_avx2_256_32", "sw_stats", "scan_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sw_stats_rowcol_scan_profile_avx2_256_16_ws, "parasail_sw_stats_rowcol_scan_profile_avx2_256_16", "sw_stats", "scan_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sw_stats_rowcol_scan_profile_avx2_256_8_ws, "parasail_sw_stats_rowcol_scan_profile_avx2_256_8", "sw_stats", "scan_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sw_stats_rowcol_scan_profile_avx2_256_sat_ws, "parasail_sw_stats_rowcol_scan_profile_avx2_256_sat", "sw_stats", "scan_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx2_256_64, parasail_profile_create_stats_avx_256_64, parasail_sw_stats_rowcol_striped_profile_avx2_256_64_ws, "parasail_sw_stats_rowcol_striped_profile_avx2_256_64", "sw_stats", "striped_profile", "avx2",  "256", "64",  4, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx2_256_32, parasail_profile_create_stats_avx_256_32, parasail_sw_stats_rowcol_striped_profile_avx2_256_32_ws, "parasail_sw_stats_rowcol_striped_profile_avx2_256_32", "sw_stats", "striped_profile", "avx2",  "256", "32",  8, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx2_256_16, parasail_profile_create_stats_avx_256_16, parasail_sw_stats_rowcol_striped_profile_avx2_256_16_ws, "parasail_sw_stats_rowcol_striped_profile_avx2_256_16", "sw_stats", "striped_profile", "avx2",  "256", "16", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, parasail_sw_stats_rowcol_striped_profile_avx2_256_8_ws, "parasail_sw_stats_rowcol_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, parasail_sw_stats_rowcol_striped_profile_avx2_256_sat_ws, "parasail_sw_stats_rowcol_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 1, 0},
 #endif
 #if HAVE_KNC
-{parasail_sw_stats_rowcol_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sw_stats_rowcol_scan_profile_knc_512_32", "sw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, "parasail_sw_stats_rowcol_striped_profile_knc_512_32", "sw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
-#endif
-{parasail_sw_stats_rowcol_scan_profile_64, parasail_profile_create_stats_64,    "parasail_sw_stats_rowcol_scan_profile_64", "sw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_32, parasail_profile_create_stats_32,    "parasail_sw_stats_rowcol_scan_profile_32", "sw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_16, parasail_profile_create_stats_16,    "parasail_sw_stats_rowcol_scan_profile_16", "sw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_8, parasail_profile_create_stats_8,     "parasail_sw_stats_rowcol_scan_profile_8", "sw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_scan_profile_sat, parasail_profile_create_stats_sat,   "parasail_sw_stats_rowcol_scan_profile_sat", "sw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_64, parasail_profile_create_stats_64,    "parasail_sw_stats_rowcol_striped_profile_64", "sw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_32, parasail_profile_create_stats_32,    "parasail_sw_stats_rowcol_striped_profile_32", "sw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_16, parasail_profile_create_stats_16,    "parasail_sw_stats_rowcol_striped_profile_16", "sw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_8, parasail_profile_create_stats_8,     "parasail_sw_stats_rowcol_striped_profile_8", "sw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
-{parasail_sw_stats_rowcol_striped_profile_sat, parasail_profile_create_stats_sat,   "parasail_sw_stats_rowcol_striped_profile_sat", "sw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
-{NULL, NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0}
+{parasail_sw_stats_rowcol_scan_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sw_stats_rowcol_scan_profile_knc_512_32_ws, "parasail_sw_stats_rowcol_scan_profile_knc_512_32", "sw_stats", "scan_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_knc_512_32, parasail_profile_create_stats_knc_512_32, parasail_sw_stats_rowcol_striped_profile_knc_512_32_ws, "parasail_sw_stats_rowcol_striped_profile_knc_512_32", "sw_stats", "striped_profile", "knc",   "512", "32", 16, 0, 1, 1, 0},
+#endif
+{parasail_sw_stats_rowcol_scan_profile_64, parasail_profile_create_stats_64,    parasail_sw_stats_rowcol_scan_profile_64_ws, "parasail_sw_stats_rowcol_scan_profile_64", "sw_stats", "scan_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_32, parasail_profile_create_stats_32,    parasail_sw_stats_rowcol_scan_profile_32_ws, "parasail_sw_stats_rowcol_scan_profile_32", "sw_stats", "scan_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_16, parasail_profile_create_stats_16,    parasail_sw_stats_rowcol_scan_profile_16_ws, "parasail_sw_stats_rowcol_scan_profile_16", "sw_stats", "scan_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_8, parasail_profile_create_stats_8,     parasail_sw_stats_rowcol_scan_profile_8_ws, "parasail_sw_stats_rowcol_scan_profile_8", "sw_stats", "scan_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_sat, parasail_profile_create_stats_sat,   parasail_sw_stats_rowcol_scan_profile_sat_ws, "parasail_sw_stats_rowcol_scan_profile_sat", "sw_stats", "scan_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_64, parasail_profile_create_stats_64,    parasail_sw_stats_rowcol_striped_profile_64_ws, "parasail_sw_stats_rowcol_striped_profile_64", "sw_stats", "striped_profile", "disp",   "NA", "64", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_32, parasail_profile_create_stats_32,    parasail_sw_stats_rowcol_striped_profile_32_ws, "parasail_sw_stats_rowcol_striped_profile_32", "sw_stats", "striped_profile", "disp",   "NA", "32", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_16, parasail_profile_create_stats_16,    parasail_sw_stats_rowcol_striped_profile_16_ws, "parasail_sw_stats_rowcol_striped_profile_16", "sw_stats", "striped_profile", "disp",   "NA", "16", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_8, parasail_profile_create_stats_8,     parasail_sw_stats_rowcol_striped_profile_8_ws, "parasail_sw_stats_rowcol_striped_profile_8", "sw_stats", "striped_profile", "disp",   "NA",  "8", -1, 0, 1, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_sat, parasail_profile_create_stats_sat,   parasail_sw_stats_rowcol_striped_profile_sat_ws, "parasail_sw_stats_rowcol_striped_profile_sat", "sw_stats", "striped_profile", "disp",   "NA", "sat", -1, 0, 1, 1, 0},
+{NULL, NULL, NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0}
+};
+
+static const parasail_kfunction_info_t kfunctions[] = {
+{parasail_nw_banded,                    NULL,                                  "parasail_nw_banded",                    "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_nw_banded_sse41_128_32,       NULL,                                  "parasail_nw_banded_sse41_128_32",       "nw",  "banded", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{parasail_nw_banded_sse41_128_16,       NULL,                                  "parasail_nw_banded_sse41_128_16",       "nw",  "banded", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{parasail_nw_banded_sse41_128_8,        NULL,                                  "parasail_nw_banded_sse41_128_8",        "nw",  "banded", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{parasail_nw_banded_sse41_128_sat,      NULL,                                  "parasail_nw_banded_sse41_128_sat",      "nw",  "banded", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_nw_banded_avx2_256_32,        NULL,                                  "parasail_nw_banded_avx2_256_32",        "nw",  "banded", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{parasail_nw_banded_avx2_256_16,        NULL,                                  "parasail_nw_banded_avx2_256_16",        "nw",  "banded", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{parasail_nw_banded_avx2_256_8,         NULL,                                  "parasail_nw_banded_avx2_256_8",         "nw",  "banded", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{parasail_nw_banded_avx2_256_sat,       NULL,                                  "parasail_nw_banded_avx2_256_sat",       "nw",  "banded", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+#endif
+{parasail_nw_banded_32,                 NULL,                                  "parasail_nw_banded_32",                 "nw",  "banded", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{parasail_nw_banded_16,                 NULL,                                  "parasail_nw_banded_16",                 "nw",  "banded", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{parasail_nw_banded_8,                  NULL,                                  "parasail_nw_banded_8",                  "nw",  "banded", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{parasail_nw_banded_sat,                NULL,                                  "parasail_nw_banded_sat",                "nw",  "banded", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded,                    "parasail_sg_banded",                    "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1},
+#if HAVE_SSE41
+{NULL,                                  parasail_sg_banded_sse41_128_32,       "parasail_sg_banded_sse41_128_32",       "sg",  "banded", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_sse41_128_16,       "parasail_sg_banded_sse41_128_16",       "sg",  "banded", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_sse41_128_8,        "parasail_sg_banded_sse41_128_8",        "sg",  "banded", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_sse41_128_sat,      "parasail_sg_banded_sse41_128_sat",      "sg",  "banded", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{NULL,                                  parasail_sg_banded_avx2_256_32,        "parasail_sg_banded_avx2_256_32",        "sg",  "banded", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_avx2_256_16,        "parasail_sg_banded_avx2_256_16",        "sg",  "banded", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_avx2_256_8,         "parasail_sg_banded_avx2_256_8",         "sg",  "banded", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_avx2_256_sat,       "parasail_sg_banded_avx2_256_sat",       "sg",  "banded", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+#endif
+{NULL,                                  parasail_sg_banded_32,                 "parasail_sg_banded_32",                 "sg",  "banded", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_16,                 "parasail_sg_banded_16",                 "sg",  "banded", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_8,                  "parasail_sg_banded_8",                  "sg",  "banded", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_sat,                "parasail_sg_banded_sat",                "sg",  "banded", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded,                    "parasail_sw_banded",                    "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1},
+#if HAVE_SSE41
+{NULL,                                  parasail_sw_banded_sse41_128_32,       "parasail_sw_banded_sse41_128_32",       "sw",  "banded", "sse41", "128", "32",  4, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_sse41_128_16,       "parasail_sw_banded_sse41_128_16",       "sw",  "banded", "sse41", "128", "16",  8, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_sse41_128_8,        "parasail_sw_banded_sse41_128_8",        "sw",  "banded", "sse41", "128",  "8", 16, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_sse41_128_sat,      "parasail_sw_banded_sse41_128_sat",      "sw",  "banded", "sse41", "128", "sat", 16, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{NULL,                                  parasail_sw_banded_avx2_256_32,        "parasail_sw_banded_avx2_256_32",        "sw",  "banded", "avx2",  "256", "32",  8, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_avx2_256_16,        "parasail_sw_banded_avx2_256_16",        "sw",  "banded", "avx2",  "256", "16", 16, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_avx2_256_8,         "parasail_sw_banded_avx2_256_8",         "sw",  "banded", "avx2",  "256",  "8", 32, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_avx2_256_sat,       "parasail_sw_banded_avx2_256_sat",       "sw",  "banded", "avx2",  "256", "sat", 32, 0, 0, 0, 0},
+#endif
+{NULL,                                  parasail_sw_banded_32,                 "parasail_sw_banded_32",                 "sw",  "banded", "disp",   "NA", "32", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_16,                 "parasail_sw_banded_16",                 "sw",  "banded", "disp",   "NA", "16", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_8,                  "parasail_sw_banded_8",                  "sw",  "banded", "disp",   "NA",  "8", -1, 0, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_sat,                "parasail_sw_banded_sat",                "sw",  "banded", "disp",   "NA", "sat", -1, 0, 0, 0, 0},
+{parasail_nw_banded_table,              NULL,                                  "parasail_nw_banded_table",              "nw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_nw_table_banded_sse41_128_32, NULL,                                  "parasail_nw_table_banded_sse41_128_32", "nw",  "banded", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{parasail_nw_table_banded_sse41_128_16, NULL,                                  "parasail_nw_table_banded_sse41_128_16", "nw",  "banded", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{parasail_nw_table_banded_sse41_128_8,  NULL,                                  "parasail_nw_table_banded_sse41_128_8",  "nw",  "banded", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{parasail_nw_table_banded_sse41_128_sat, NULL,                                  "parasail_nw_table_banded_sse41_128_sat", "nw",  "banded", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_nw_table_banded_avx2_256_32,  NULL,                                  "parasail_nw_table_banded_avx2_256_32",  "nw",  "banded", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{parasail_nw_table_banded_avx2_256_16,  NULL,                                  "parasail_nw_table_banded_avx2_256_16",  "nw",  "banded", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{parasail_nw_table_banded_avx2_256_8,   NULL,                                  "parasail_nw_table_banded_avx2_256_8",   "nw",  "banded", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{parasail_nw_table_banded_avx2_256_sat, NULL,                                  "parasail_nw_table_banded_avx2_256_sat", "nw",  "banded", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+#endif
+{parasail_nw_table_banded_32,           NULL,                                  "parasail_nw_table_banded_32",           "nw",  "banded", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{parasail_nw_table_banded_16,           NULL,                                  "parasail_nw_table_banded_16",           "nw",  "banded", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{parasail_nw_table_banded_8,            NULL,                                  "parasail_nw_table_banded_8",            "nw",  "banded", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{parasail_nw_table_banded_sat,          NULL,                                  "parasail_nw_table_banded_sat",          "nw",  "banded", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_banded_table,              "parasail_sg_banded_table",              "sg",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1},
+#if HAVE_SSE41
+{NULL,                                  parasail_sg_table_banded_sse41_128_32, "parasail_sg_table_banded_sse41_128_32", "sg",  "banded", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_sse41_128_16, "parasail_sg_table_banded_sse41_128_16", "sg",  "banded", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_sse41_128_8,  "parasail_sg_table_banded_sse41_128_8",  "sg",  "banded", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_sse41_128_sat, "parasail_sg_table_banded_sse41_128_sat", "sg",  "banded", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{NULL,                                  parasail_sg_table_banded_avx2_256_32,  "parasail_sg_table_banded_avx2_256_32",  "sg",  "banded", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_avx2_256_16,  "parasail_sg_table_banded_avx2_256_16",  "sg",  "banded", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_avx2_256_8,   "parasail_sg_table_banded_avx2_256_8",   "sg",  "banded", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_avx2_256_sat, "parasail_sg_table_banded_avx2_256_sat", "sg",  "banded", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+#endif
+{NULL,                                  parasail_sg_table_banded_32,           "parasail_sg_table_banded_32",           "sg",  "banded", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_16,           "parasail_sg_table_banded_16",           "sg",  "banded", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_8,            "parasail_sg_table_banded_8",            "sg",  "banded", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sg_table_banded_sat,          "parasail_sg_table_banded_sat",          "sg",  "banded", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_banded_table,              "parasail_sw_banded_table",              "sw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1},
+#if HAVE_SSE41
+{NULL,                                  parasail_sw_table_banded_sse41_128_32, "parasail_sw_table_banded_sse41_128_32", "sw",  "banded", "sse41", "128", "32",  4, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_sse41_128_16, "parasail_sw_table_banded_sse41_128_16", "sw",  "banded", "sse41", "128", "16",  8, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_sse41_128_8,  "parasail_sw_table_banded_sse41_128_8",  "sw",  "banded", "sse41", "128",  "8", 16, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_sse41_128_sat, "parasail_sw_table_banded_sse41_128_sat", "sw",  "banded", "sse41", "128", "sat", 16, 1, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{NULL,                                  parasail_sw_table_banded_avx2_256_32,  "parasail_sw_table_banded_avx2_256_32",  "sw",  "banded", "avx2",  "256", "32",  8, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_avx2_256_16,  "parasail_sw_table_banded_avx2_256_16",  "sw",  "banded", "avx2",  "256", "16", 16, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_avx2_256_8,   "parasail_sw_table_banded_avx2_256_8",   "sw",  "banded", "avx2",  "256",  "8", 32, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_avx2_256_sat, "parasail_sw_table_banded_avx2_256_sat", "sw",  "banded", "avx2",  "256", "sat", 32, 1, 0, 0, 0},
+#endif
+{NULL,                                  parasail_sw_table_banded_32,           "parasail_sw_table_banded_32",           "sw",  "banded", "disp",   "NA", "32", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_16,           "parasail_sw_table_banded_16",           "sw",  "banded", "disp",   "NA", "16", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_8,            "parasail_sw_table_banded_8",            "sw",  "banded", "disp",   "NA",  "8", -1, 1, 0, 0, 0},
+{NULL,                                  parasail_sw_table_banded_sat,          "parasail_sw_table_banded_sat",          "sw",  "banded", "disp",   "NA", "sat", -1, 1, 0, 0, 0},
+{parasail_nw_banded_rowcol,             NULL,                                  "parasail_nw_banded_rowcol",             "nw",    "orig", "NA",     "32", "32",  1, 0, 1, 0, 1},
+#if HAVE_SSE41
+{parasail_nw_rowcol_banded_sse41_128_32, NULL,                                  "parasail_nw_rowcol_banded_sse41_128_32", "nw",  "banded", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_sse41_128_16, NULL,                                  "parasail_nw_rowcol_banded_sse41_128_16", "nw",  "banded", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_sse41_128_8, NULL,                                  "parasail_nw_rowcol_banded_sse41_128_8", "nw",  "banded", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_sse41_128_sat, NULL,                                  "parasail_nw_rowcol_banded_sse41_128_sat", "nw",  "banded", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_nw_rowcol_banded_avx2_256_32, NULL,                                  "parasail_nw_rowcol_banded_avx2_256_32", "nw",  "banded", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_avx2_256_16, NULL,                                  "parasail_nw_rowcol_banded_avx2_256_16", "nw",  "banded", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_avx2_256_8,  NULL,                                  "parasail_nw_rowcol_banded_avx2_256_8",  "nw",  "banded", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_avx2_256_sat, NULL,                                  "parasail_nw_rowcol_banded_avx2_256_sat", "nw",  "banded", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+#endif
+{parasail_nw_rowcol_banded_32,          NULL,                                  "parasail_nw_rowcol_banded_32",          "nw",  "banded", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_16,          NULL,                                  "parasail_nw_rowcol_banded_16",          "nw",  "banded", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_8,           NULL,                                  "parasail_nw_rowcol_banded_8",           "nw",  "banded", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{parasail_nw_rowcol_banded_sat,         NULL,                                  "parasail_nw_rowcol_banded_sat",         "nw",  "banded", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_banded_rowcol,             "parasail_sg_banded_rowcol",             "sg",    "orig", "NA",     "32", "32",  1, 0, 1, 0, 1},
+#if HAVE_SSE41
+{NULL,                                  parasail_sg_rowcol_banded_sse41_128_32, "parasail_sg_rowcol_banded_sse41_128_32", "sg",  "banded", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_sse41_128_16, "parasail_sg_rowcol_banded_sse41_128_16", "sg",  "banded", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_sse41_128_8, "parasail_sg_rowcol_banded_sse41_128_8", "sg",  "banded", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_sse41_128_sat, "parasail_sg_rowcol_banded_sse41_128_sat", "sg",  "banded", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+#endif
+#if HAVE_AVX2
+{NULL,                                  parasail_sg_rowcol_banded_avx2_256_32, "parasail_sg_rowcol_banded_avx2_256_32", "sg",  "banded", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_avx2_256_16, "parasail_sg_rowcol_banded_avx2_256_16", "sg",  "banded", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_avx2_256_8,  "parasail_sg_rowcol_banded_avx2_256_8",  "sg",  "banded", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_avx2_256_sat, "parasail_sg_rowcol_banded_avx2_256_sat", "sg",  "banded", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+#endif
+{NULL,                                  parasail_sg_rowcol_banded_32,          "parasail_sg_rowcol_banded_32",          "sg",  "banded", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_16,          "parasail_sg_rowcol_banded_16",          "sg",  "banded", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_8,           "parasail_sg_rowcol_banded_8",           "sg",  "banded", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sg_rowcol_banded_sat,         "parasail_sg_rowcol_banded_sat",         "sg",  "banded", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_banded_rowcol,             "parasail_sw_banded_rowcol",             "sw",    "orig", "NA",     "32", "32",  1, 0, 1, 0, 1},
+#if HAVE_SSE41
+{NULL,                                  parasail_sw_rowcol_banded_sse41_128_32, "parasail_sw_rowcol_banded_sse41_128_32", "sw",  "banded", "sse41", "128", "32",  4, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_sse41_128_16, "parasail_sw_rowcol_banded_sse41_128_16", "sw",  "banded", "sse41", "128", "16",  8, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_sse41_128_8, "parasail_sw_rowcol_banded_sse41_128_8", "sw",  "banded", "sse41", "128",  "8", 16, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_sse41_128_sat, "parasail_sw_rowcol_banded_sse41_128_sat", "sw",  "banded", "sse41", "128", "sat", 16, 0, 1, 0, 0},
+#endif
+#if HAVE_AVX2
+{NULL,                                  parasail_sw_rowcol_banded_avx2_256_32, "parasail_sw_rowcol_banded_avx2_256_32", "sw",  "banded", "avx2",  "256", "32",  8, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_avx2_256_16, "parasail_sw_rowcol_banded_avx2_256_16", "sw",  "banded", "avx2",  "256", "16", 16, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_avx2_256_8,  "parasail_sw_rowcol_banded_avx2_256_8",  "sw",  "banded", "avx2",  "256",  "8", 32, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_avx2_256_sat, "parasail_sw_rowcol_banded_avx2_256_sat", "sw",  "banded", "avx2",  "256", "sat", 32, 0, 1, 0, 0},
+#endif
+{NULL,                                  parasail_sw_rowcol_banded_32,          "parasail_sw_rowcol_banded_32",          "sw",  "banded", "disp",   "NA", "32", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_16,          "parasail_sw_rowcol_banded_16",          "sw",  "banded", "disp",   "NA", "16", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_8,           "parasail_sw_rowcol_banded_8",           "sw",  "banded", "disp",   "NA",  "8", -1, 0, 1, 0, 0},
+{NULL,                                  parasail_sw_rowcol_banded_sat,         "parasail_sw_rowcol_banded_sat",         "sw",  "banded", "disp",   "NA", "sat", -1, 0, 1, 0, 0},
+{NULL, NULL, NULL, "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0}
 };
 
 #ifdef __cplusplus
@@ -41,6 +41,9 @@ typedef union __m256i_64 {
 extern
 __m256i * parasail_memalign___m256i(size_t alignment, size_t size);
 
+extern
+__m256i * parasail_workspace___m256i(parasail_workspace_t *workspace, int slot, size_t size);
+
 extern
 void parasail_memset___m256i(__m256i *b, __m256i c, size_t len);
 
@@ -26,6 +26,9 @@ typedef union __m512i_32 {
 extern
 __m512i * parasail_memalign___m512i(size_t alignment, size_t size);
 
+extern
+__m512i * parasail_workspace___m512i(parasail_workspace_t *workspace, int slot, size_t size);
+
 extern
 void parasail_memset___m512i(__m512i *b, __m512i c, size_t len);
 
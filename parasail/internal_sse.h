@@ -41,6 +41,9 @@ typedef union __m128i_64 {
 extern
 __m128i * parasail_memalign___m128i(size_t alignment, size_t size);
 
+extern
+__m128i * parasail_workspace___m128i(parasail_workspace_t *workspace, int slot, size_t size);
+
 extern
 void parasail_memset___m128i(__m128i *b, __m128i c, size_t len);
 
@@ -25,6 +25,29 @@ extern int64_t * parasail_memalign_int64_t(size_t alignment, size_t size);
 
 extern void parasail_free(void *ptr);
 
+extern void parasail_workspace_init(parasail_workspace_t *workspace);
+extern void parasail_workspace_clear(parasail_workspace_t *workspace);
+extern void * parasail_workspace_reserve(parasail_workspace_t *workspace, int slot, size_t size);
+extern int * parasail_workspace_int(parasail_workspace_t *workspace, int slot, size_t size);
+extern int8_t * parasail_workspace_int8_t(parasail_workspace_t *workspace, int slot, size_t size);
+extern int16_t * parasail_workspace_int16_t(parasail_workspace_t *workspace, int slot, size_t size);
+extern int32_t * parasail_workspace_int32_t(parasail_workspace_t *workspace, int slot, size_t size);
+extern int64_t * parasail_workspace_int64_t(parasail_workspace_t *workspace, int slot, size_t size);
+
+/* The last column a striped kernel computed exactly before it
+ * saturated, so that a wider kernel can pick up where it left off. */
+typedef struct parasail_resume {
+    int column;     /* -1 until a narrower kernel has saturated */
+    int score;      /* running max through column; it ends in column */
+    int length;     /* allocated length of H and E */
+    int *H;         /* H of column, indexed by query position */
+    int *E;         /* E for the next column, indexed by query position */
+} parasail_resume_t;
+
+extern void parasail_resume_init(parasail_resume_t *resume);
+extern void parasail_resume_clear(parasail_resume_t *resume);
+extern void parasail_resume_reserve(parasail_resume_t *resume, int length);
+
 extern void parasail_memset(void *b, int c, size_t len);
 extern void parasail_memset_int(int *b, int c, size_t len);
 extern void parasail_memset_int8_t(int8_t *b, int8_t c, size_t len);
@@ -35,14 +58,32 @@ extern void parasail_memset_int64_t(int64_t *b, int64_t c, size_t len);
 extern parasail_result_t* parasail_result_new();
 extern parasail_result_t* parasail_result_new_table1(const int a, const int b);
 extern parasail_result_t* parasail_result_new_table3(const int a, const int b);
+extern parasail_result_t* parasail_result_new_table1_type(const int a, const int b, const int type);
+extern parasail_result_t* parasail_result_new_table3_type(const int a, const int b, const int type);
+extern parasail_result_t* parasail_result_new_table1_window(const int a, const int b, const int type, const parasail_window_t *window);
+extern parasail_result_t* parasail_result_new_table3_window(const int a, const int b, const int type, const parasail_window_t *window);
 extern parasail_result_t* parasail_result_new_rowcol1(const int a, const int b);
 extern parasail_result_t* parasail_result_new_rowcol3(const int a, const int b);
+extern parasail_result_t* parasail_result_new_trace(
+        const int segLen, const int b, const int lanes, const int type);
 
 extern parasail_profile_t* parasail_profile_new(
         const char * s1, const int s1Len, const parasail_matrix_t *matrix);
 
 extern char* parasail_reverse(const char *s, int end);
 
+extern int32_t* parasail_striped_query(const char *s1, const int s1Len,
+        const parasail_matrix_t *matrix, const int32_t segWidth);
+extern int32_t* parasail_blocked_query(const char *s1, const int s1Len,
+        const parasail_matrix_t *matrix, const int32_t segWidth);
+extern parasail_profile_t* parasail_profile_new_packed(
+        const char * const * s1s, const int * s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix, const int32_t lanes);
+extern int32_t* parasail_packed_query(const parasail_profile_t *profile,
+        const int32_t segWidth);
+extern void parasail_profile_row(int32_t *rows,
+        const parasail_matrix_t *matrix, const int32_t k, const int stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,550 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+
+/* The decision table splits query lengths at 16, 32, ..., 1024 and
+ * keeps one function per range. A range is timed on a query three
+ * quarters as long as its bound, the last on one of 1536, each against
+ * a database sequence of AUTOTUNE_DB_LEN. */
+#define AUTOTUNE_ALGS 3
+#define AUTOTUNE_BINS 8
+#define AUTOTUNE_DB_LEN 256
+#define AUTOTUNE_SECONDS 0.001
+#define AUTOTUNE_TRIALS 3
+#define AUTOTUNE_NAME 64
+#define AUTOTUNE_FIELDS 8
+
+static const char *algs[AUTOTUNE_ALGS] = {"nw", "sg", "sw"};
+
+/* the runtime dispatchers of each family, at the widths whose results
+ * are never saturated */
+static const char *families[] = {
+    "scan_sat", "striped_sat", "diag_sat",
+    "scan_32", "striped_32", "diag_32",
+    "blocked_32", "short_32",
+    NULL
+};
+
+/* what the auto functions run without a tuned table */
+static parasail_function_t *fallbacks[AUTOTUNE_ALGS] = {
+    parasail_nw_striped_sat,
+    parasail_sg_striped_sat,
+    parasail_sw_striped_sat
+};
+
+typedef struct autotune_table {
+    parasail_function_t *pointer[AUTOTUNE_ALGS][AUTOTUNE_BINS];
+    char name[AUTOTUNE_ALGS][AUTOTUNE_BINS][AUTOTUNE_NAME];
+    struct autotune_table *previous;
+} autotune_table_t;
+
+/* The table in use. A table is filled before it is published and never
+ * changes or goes away after, since another thread may still be reading
+ * the one that parasail_autotune replaces. */
+static autotune_table_t *table = NULL;
+
+/* Atomically replace *slot with desired if it holds expected; returns
+ * what *slot held. */
+static autotune_table_t* table_publish(
+        autotune_table_t **slot,
+        autotune_table_t *expected,
+        autotune_table_t *desired)
+{
+#if defined(_MSC_VER)
+    return (autotune_table_t*)InterlockedCompareExchangePointer(
+            (PVOID*)slot, desired, expected);
+#else
+    return __sync_val_compare_and_swap(slot, expected, desired);
+#endif
+}
+
+static autotune_table_t* table_current()
+{
+    return table_publish(&table, NULL, NULL);
+}
+
+static int bound(int bin)
+{
+    return bin < AUTOTUNE_BINS-1 ? 16 << bin : INT32_MAX;
+}
+
+static int find_bin(const int s1Len)
+{
+    int bin = 0;
+
+    while (s1Len > bound(bin)) {
+        ++bin;
+    }
+    return bin;
+}
+
+/* the best instruction set the dispatchers select on this machine */
+static const char* isa()
+{
+#if HAVE_KNC
+    return "knc";
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return "avx2";
+    }
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return "sse41";
+    }
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return "sse2";
+    }
+#endif
+    return "NA";
+#endif
+}
+
+static const char* matrix_name(const parasail_matrix_t *matrix)
+{
+    return NULL == matrix->name || '\0' == matrix->name[0] ?
+        "unnamed" : matrix->name;
+}
+
+/* path, else PARASAIL_AUTOTUNE_CACHE, else .parasail_autotune in the
+ * home directory; NULL when there is none, caller frees */
+static char* cache_path(const char *path)
+{
+    const char *file = "/.parasail_autotune";
+    const char *home = NULL;
+    char *result = NULL;
+
+    if (NULL == path) {
+        path = getenv("PARASAIL_AUTOTUNE_CACHE");
+    }
+    if (NULL != path) {
+        result = (char*)malloc(strlen(path)+1);
+        if (NULL != result) {
+            strcpy(result, path);
+        }
+        return result;
+    }
+    home = getenv("HOME");
+    if (NULL == home) {
+        home = getenv("USERPROFILE");
+    }
+    if (NULL == home) {
+        return NULL;
+    }
+    result = (char*)malloc(strlen(home)+strlen(file)+1);
+    if (NULL != result) {
+        strcpy(result, home);
+        strcat(result, file);
+    }
+    return result;
+}
+
+/* split a cache line of cpu, isa, matrix, open, gap, alg, bound and
+ * name at its tabs */
+static int split(char *line, char *fields[AUTOTUNE_FIELDS])
+{
+    int i = 0;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    if ('#' == line[0]) {
+        return 0;
+    }
+    fields[0] = line;
+    for (i=1; i<AUTOTUNE_FIELDS; ++i) {
+        char *tab = strchr(fields[i-1], '\t');
+        if (NULL == tab) {
+            return 0;
+        }
+        *tab = '\0';
+        fields[i] = tab + 1;
+    }
+    return NULL == strchr(fields[AUTOTUNE_FIELDS-1], '\t');
+}
+
+/* whether the key of a split cache line is this machine with these
+ * gap penalties and matrix */
+static int same_key(char *fields[AUTOTUNE_FIELDS],
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return 0 == strcmp(fields[0], parasail_cpu_model())
+        && 0 == strcmp(fields[1], isa())
+        && 0 == strcmp(fields[2], matrix_name(matrix))
+        && atoi(fields[3]) == open
+        && atoi(fields[4]) == gap;
+}
+
+static int find_alg(const char *alg)
+{
+    int a = 0;
+
+    for (a=0; a<AUTOTUNE_ALGS; ++a) {
+        if (0 == strcmp(alg, algs[a])) {
+            return a;
+        }
+    }
+    return -1;
+}
+
+/* a table from the cache lines for this key, if they name a function
+ * for every range; caller frees */
+static autotune_table_t* load(
+        const char *path,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    autotune_table_t *loaded = NULL;
+    char *file = cache_path(path);
+    FILE *fp = NULL;
+    char line[1024];
+    int count = 0;
+
+    if (NULL == file) {
+        return NULL;
+    }
+    fp = fopen(file, "r");
+    free(file);
+    if (NULL == fp) {
+        return NULL;
+    }
+    loaded = (autotune_table_t*)calloc(1, sizeof(autotune_table_t));
+    if (NULL == loaded) {
+        fclose(fp);
+        return NULL;
+    }
+
+    while (fgets(line, sizeof(line), fp)) {
+        char *fields[AUTOTUNE_FIELDS];
+        int a = 0;
+        int bin = 0;
+        const parasail_function_info_t *info = NULL;
+        if (!split(line, fields) || !same_key(fields, open, gap, matrix)) {
+            continue;
+        }
+        a = find_alg(fields[5]);
+        for (bin=0; bin<AUTOTUNE_BINS; ++bin) {
+            if (atoi(fields[6]) == bound(bin)) {
+                break;
+            }
+        }
+        info = parasail_lookup_function_info(fields[7]);
+        if (a < 0 || bin == AUTOTUNE_BINS || NULL == info
+                || strlen(info->name) >= AUTOTUNE_NAME) {
+            continue;
+        }
+        if (NULL == loaded->pointer[a][bin]) {
+            ++count;
+        }
+        loaded->pointer[a][bin] = info->pointer;
+        strcpy(loaded->name[a][bin], info->name);
+    }
+    fclose(fp);
+
+    if (count != AUTOTUNE_ALGS*AUTOTUNE_BINS) {
+        free(loaded);
+        return NULL;
+    }
+    return loaded;
+}
+
+/* replace the lines for this key in the cache with the tuned table */
+static int save(
+        const char *path,
+        const autotune_table_t *tuned,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    char *file = cache_path(path);
+    char **kept = NULL;
+    int kept_count = 0;
+    int kept_size = 0;
+    FILE *fp = NULL;
+    char line[1024];
+    int a = 0;
+    int bin = 0;
+    int i = 0;
+
+    if (NULL == file) {
+        return path ? -1 : 0;
+    }
+
+    fp = fopen(file, "r");
+    if (NULL != fp) {
+        while (fgets(line, sizeof(line), fp)) {
+            char copy[1024];
+            char *fields[AUTOTUNE_FIELDS];
+            strcpy(copy, line);
+            if (!split(copy, fields) || same_key(fields, open, gap, matrix)) {
+                continue;
+            }
+            if (kept_count == kept_size) {
+                char **grown = NULL;
+                kept_size = kept_size ? 2*kept_size : 64;
+                grown = (char**)realloc(kept, sizeof(char*)*kept_size);
+                if (NULL == grown) {
+                    break;
+                }
+                kept = grown;
+            }
+            kept[kept_count] = (char*)malloc(strlen(line)+1);
+            if (NULL == kept[kept_count]) {
+                break;
+            }
+            strcpy(kept[kept_count++], line);
+        }
+        fclose(fp);
+    }
+
+    fp = fopen(file, "w");
+    free(file);
+    if (NULL != fp) {
+        fprintf(fp, "# parasail autotune: cpu, isa, matrix, open, gap, "
+                "alg, longest query, function\n");
+        for (i=0; i<kept_count; ++i) {
+            fputs(kept[i], fp);
+        }
+        for (a=0; a<AUTOTUNE_ALGS; ++a) {
+            for (bin=0; bin<AUTOTUNE_BINS; ++bin) {
+                fprintf(fp, "%s\t%s\t%s\t%d\t%d\t%s\t%d\t%s\n",
+                        parasail_cpu_model(), isa(), matrix_name(matrix),
+                        open, gap, algs[a], bound(bin), tuned->name[a][bin]);
+            }
+        }
+    }
+    for (i=0; i<kept_count; ++i) {
+        free(kept[i]);
+    }
+    free(kept);
+
+    if (NULL == fp || 0 != fclose(fp)) {
+        return -1;
+    }
+    return 0;
+}
+
+/* seconds per call, the least over the trials; each trial repeats the
+ * call for at least AUTOTUNE_SECONDS and the first also warms up */
+static double measure(
+        parasail_function_t *function,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    double best = 0.0;
+    int trial = 0;
+
+    for (trial=0; trial<AUTOTUNE_TRIALS; ++trial) {
+        double start = parasail_time();
+        double elapsed = 0.0;
+        int calls = 0;
+        do {
+            parasail_result_free(function(s1, s1Len, s2, s2Len, open, gap, matrix));
+            ++calls;
+            elapsed = parasail_time() - start;
+        } while (elapsed < AUTOTUNE_SECONDS);
+        if (0 == trial || elapsed/calls < best) {
+            best = elapsed/calls;
+        }
+    }
+
+    return best;
+}
+
+/* residues drawn from the letters of the matrix, one per row of it */
+static void fill(char *s, const int len, const parasail_matrix_t *matrix,
+        unsigned long *state)
+{
+    char letters[26];
+    int rows = 0;
+    int c = 0;
+    int i = 0;
+
+    for (c='A'; c<='Z'; ++c) {
+        const int row = matrix->mapper[c];
+        for (i=0; i<rows; ++i) {
+            if (matrix->mapper[(unsigned char)letters[i]] == row) {
+                break;
+            }
+        }
+        if (i == rows) {
+            letters[rows++] = (char)c;
+        }
+    }
+    for (i=0; i<len; ++i) {
+        *state = *state * 1103515245UL + 12345UL;
+        s[i] = letters[(*state >> 16) % rows];
+    }
+    s[len] = '\0';
+}
+
+int parasail_autotune(
+        const char *path,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    autotune_table_t *tuned = NULL;
+    autotune_table_t *current = NULL;
+    const int longest = 3*(16 << (AUTOTUNE_BINS-1))/4;
+    char *s1 = (char*)malloc(longest+1);
+    char *s2 = (char*)malloc(AUTOTUNE_DB_LEN+1);
+    unsigned long state = 1;
+    int a = 0;
+    int bin = 0;
+    int f = 0;
+
+    tuned = (autotune_table_t*)calloc(1, sizeof(autotune_table_t));
+    if (NULL == s1 || NULL == s2 || NULL == tuned) {
+        free(s1);
+        free(s2);
+        free(tuned);
+        return -1;
+    }
+    fill(s1, longest, matrix, &state);
+    fill(s2, AUTOTUNE_DB_LEN, matrix, &state);
+
+    for (a=0; a<AUTOTUNE_ALGS; ++a) {
+        for (bin=0; bin<AUTOTUNE_BINS; ++bin) {
+            const int s1Len = 3*(16 << bin)/4;
+            double best = 0.0;
+            for (f=0; NULL!=families[f]; ++f) {
+                char name[AUTOTUNE_NAME];
+                const parasail_function_info_t *info = NULL;
+                double seconds = 0.0;
+                sprintf(name, "parasail_%s_%s", algs[a], families[f]);
+                info = parasail_lookup_function_info(name);
+                if (NULL == info) {
+                    continue;
+                }
+                seconds = measure(info->pointer, s1, s1Len,
+                        s2, AUTOTUNE_DB_LEN, open, gap, matrix);
+                if (NULL == tuned->pointer[a][bin] || seconds < best) {
+                    best = seconds;
+                    tuned->pointer[a][bin] = info->pointer;
+                    strcpy(tuned->name[a][bin], info->name);
+                }
+            }
+        }
+    }
+    free(s1);
+    free(s2);
+
+    /* replace the table in use, keeping the one replaced alive */
+    do {
+        current = table_current();
+        tuned->previous = current;
+    } while (table_publish(&table, current, tuned) != current);
+
+    return save(path, tuned, open, gap, matrix);
+}
+
+const char* parasail_autotune_choice(const char *alg, const int s1Len)
+{
+    const autotune_table_t *current = table_current();
+    const int a = NULL == alg ? -1 : find_alg(alg);
+
+    if (a < 0 || NULL == current) {
+        return NULL;
+    }
+    return current->name[a][find_bin(s1Len)];
+}
+
+/* a table running the fallbacks for every query length */
+static autotune_table_t* untuned()
+{
+    autotune_table_t *fallback = NULL;
+    int a = 0;
+    int bin = 0;
+
+    fallback = (autotune_table_t*)calloc(1, sizeof(autotune_table_t));
+    if (NULL == fallback) {
+        return NULL;
+    }
+    for (a=0; a<AUTOTUNE_ALGS; ++a) {
+        for (bin=0; bin<AUTOTUNE_BINS; ++bin) {
+            fallback->pointer[a][bin] = fallbacks[a];
+            sprintf(fallback->name[a][bin], "parasail_%s_striped_sat", algs[a]);
+        }
+    }
+    return fallback;
+}
+
+/* Without a table, the first call loads the one cached for this machine
+ * and the call's gap penalties and matrix, or else runs the fallbacks;
+ * it never tunes. Threads that race to load keep the first table. */
+static parasail_result_t* dispatch(
+        const int a,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    autotune_table_t *current = table_current();
+
+    if (NULL == current) {
+        autotune_table_t *built = load(NULL, open, gap, matrix);
+        if (NULL == built) {
+            built = untuned();
+        }
+        if (NULL == built) {
+            return fallbacks[a](s1, s1Len, s2, s2Len, open, gap, matrix);
+        }
+        current = table_publish(&table, NULL, built);
+        if (NULL == current) {
+            current = built;
+        }
+        else {
+            free(built);
+        }
+    }
+
+    return current->pointer[a][find_bin(s1Len)](
+            s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return dispatch(0, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sg_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return dispatch(1, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return dispatch(2, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
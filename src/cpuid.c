@@ -14,8 +14,11 @@
 #include "parasail/cpuid.h"
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #if defined(_MSC_VER)
 # include <intrin.h>
+# include <windows.h>
 #endif
 
 static void run_cpuid(uint32_t eax, uint32_t ecx, uint32_t* abcd)
@@ -301,3 +304,69 @@ int parasail_can_use_sse2()
     return can_use_sse2;
 }
 
+
+/* Atomically replace a NULL *slot with model; returns what *slot held. */
+static char* model_publish(char **slot, char *model)
+{
+#if defined(_MSC_VER)
+    return (char*)InterlockedCompareExchangePointer(
+            (PVOID*)slot, model, NULL);
+#else
+    return __sync_val_compare_and_swap(slot, NULL, model);
+#endif
+}
+
+const char* parasail_cpu_model()
+{
+    static char *model = NULL;
+    char *read = NULL;
+    char *built = NULL;
+
+    /* threads that race to read the brand string keep the first copy */
+    read = model_publish(&model, NULL);
+    if (NULL != read) {
+        return read;
+    }
+
+    built = (char*)malloc(49);
+    if (NULL == built) {
+        return "unknown";
+    }
+    built[0] = '\0';
+    {
+        /* the brand string of leaves 0x80000002 to 0x80000004 fills
+         * 48 bytes, padded with spaces and not always terminated */
+        uint32_t info[4];
+        run_cpuid(0x80000000, 0, info);
+        if (info[0] >= 0x80000004) {
+            uint32_t brand[12];
+            const char *begin = (const char*)brand;
+            const char *end = begin + sizeof(brand);
+            size_t len = 0;
+            run_cpuid(0x80000002, 0, brand);
+            run_cpuid(0x80000003, 0, brand+4);
+            run_cpuid(0x80000004, 0, brand+8);
+            while (begin < end && ' ' == *begin) {
+                ++begin;
+            }
+            while (begin + len < end && '\0' != begin[len]) {
+                ++len;
+            }
+            while (len > 0 && ' ' == begin[len-1]) {
+                --len;
+            }
+            memcpy(built, begin, len);
+            built[len] = '\0';
+        }
+    }
+    if ('\0' == built[0]) {
+        strcpy(built, "unknown");
+    }
+
+    read = model_publish(&model, built);
+    if (NULL == read) {
+        return built;
+    }
+    free(built);
+    return read;
+}
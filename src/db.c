@@ -0,0 +1,379 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/io.h"
+
+#define DB_MAGIC "PSLDB001"
+
+/* Start of the blob; the offsets follow directly, 8 byte aligned. */
+typedef struct db_header {
+    char magic[8];
+    uint64_t count;
+    uint64_t residues;
+    uint8_t mapper[256];
+} db_header_t;
+
+#define I4(i) (i), (i)+1, (i)+2, (i)+3
+#define I16(i) I4(i), I4((i)+4), I4((i)+8), I4((i)+12)
+#define I64(i) I16(i), I16((i)+16), I16((i)+32), I16((i)+48)
+
+/* mapper of encoded sequences */
+static const int identity[256] = {
+    I64(0), I64(64), I64(128), I64(192)
+};
+
+/* point the fields of db into its blob */
+static void db_attach(parasail_db_t *db, const void *blob, size_t size)
+{
+    const db_header_t *header = (const db_header_t*)blob;
+
+    db->blob = blob;
+    db->size = size;
+    db->count = header->count;
+    db->mapper = header->mapper;
+    db->offsets = (const uint64_t*)(header + 1);
+    db->residues = (const uint8_t*)(db->offsets + header->count + 1);
+}
+
+parasail_db_t* parasail_db_create(
+        const char * const * const restrict seqs,
+        const int * const restrict lens, const int count,
+        const parasail_matrix_t *matrix)
+{
+    parasail_db_t *db = NULL;
+    db_header_t *header = NULL;
+    uint64_t *offsets = NULL;
+    uint8_t *residues = NULL;
+    uint64_t total = 0;
+    size_t size = 0;
+    int i = 0;
+    int j = 0;
+
+    /* validate inputs */
+    assert(seqs);
+    assert(lens);
+    assert(count >= 0);
+    assert(matrix);
+    assert(matrix->size <= 256);
+
+    for (i=0; i<count; ++i) {
+        assert(lens[i] >= 0);
+        total += lens[i];
+    }
+    size = sizeof(db_header_t) + sizeof(uint64_t)*(count + 1) + total;
+
+    header = (db_header_t*)malloc(size);
+    assert(header);
+    memcpy(header->magic, DB_MAGIC, sizeof(header->magic));
+    header->count = count;
+    header->residues = total;
+    for (i=0; i<256; ++i) {
+        header->mapper[i] = (uint8_t)matrix->mapper[i];
+    }
+
+    offsets = (uint64_t*)(header + 1);
+    residues = (uint8_t*)(offsets + count + 1);
+    offsets[0] = 0;
+    for (i=0; i<count; ++i) {
+        uint8_t *r = residues + offsets[i];
+        for (j=0; j<lens[i]; ++j) {
+            r[j] = header->mapper[(unsigned char)seqs[i][j]];
+        }
+        offsets[i+1] = offsets[i] + lens[i];
+    }
+
+    db = (parasail_db_t*)malloc(sizeof(parasail_db_t));
+    assert(db);
+    db_attach(db, header, size);
+    db->file = NULL;
+
+    return db;
+}
+
+int parasail_db_save(const parasail_db_t *db, const char *fname)
+{
+    FILE *fp = NULL;
+    int status = 0;
+
+    /* validate inputs */
+    assert(db);
+    assert(fname);
+
+    fp = fopen(fname, "wb");
+    if (NULL == fp) {
+        return -1;
+    }
+    if (1 != fwrite(db->blob, db->size, 1, fp)) {
+        status = -1;
+    }
+    if (0 != fclose(fp)) {
+        status = -1;
+    }
+
+    return status;
+}
+
+/* whether size bytes at header hold a whole database: the sizes are
+ * checked without overflow, and the offsets must climb from 0 to the
+ * number of residues */
+static int db_valid(const db_header_t *header, size_t size)
+{
+    const uint64_t *offsets = NULL;
+    uint64_t rest = 0;
+    uint64_t i = 0;
+
+    if (size < sizeof(db_header_t)
+            || 0 != memcmp(header->magic, DB_MAGIC, sizeof(header->magic))) {
+        return 0;
+    }
+    rest = (uint64_t)(size - sizeof(db_header_t));
+    if (header->count >= rest/sizeof(uint64_t)) {
+        return 0;
+    }
+    rest -= sizeof(uint64_t)*(header->count + 1);
+    if (header->residues != rest) {
+        return 0;
+    }
+
+    offsets = (const uint64_t*)(header + 1);
+    if (0 != offsets[0] || header->residues != offsets[header->count]) {
+        return 0;
+    }
+    for (i=0; i<header->count; ++i) {
+        /* sequence lengths are ints */
+        if (offsets[i+1] < offsets[i]
+                || offsets[i+1] - offsets[i] > (uint64_t)INT32_MAX) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+parasail_db_t* parasail_db_map(const char *fname)
+{
+    parasail_file_t *pf = NULL;
+    parasail_db_t *db = NULL;
+    const db_header_t *header = NULL;
+    size_t size = 0;
+
+    /* validate inputs */
+    assert(fname);
+
+    pf = parasail_open(fname);
+    size = (size_t)pf->size;
+    header = (const db_header_t*)pf->buf;
+    if (!db_valid(header, size)) {
+        parasail_close(pf);
+        errno = EINVAL;
+        return NULL;
+    }
+
+    db = (parasail_db_t*)malloc(sizeof(parasail_db_t));
+    assert(db);
+    db_attach(db, pf->buf, size);
+    db->file = pf;
+
+    return db;
+}
+
+void parasail_db_free(parasail_db_t *db)
+{
+    /* validate inputs */
+    assert(db);
+
+    if (NULL != db->file) {
+        parasail_close((parasail_file_t*)db->file);
+    }
+    else {
+        free((void*)db->blob);
+    }
+    free(db);
+}
+
+const uint8_t* parasail_db_sequence(const parasail_db_t *db, uint64_t i)
+{
+    /* validate inputs */
+    assert(db);
+    assert(i < db->count);
+
+    return db->residues + db->offsets[i];
+}
+
+int parasail_db_length(const parasail_db_t *db, uint64_t i)
+{
+    /* validate inputs */
+    assert(db);
+    assert(i < db->count);
+
+    return (int)(db->offsets[i+1] - db->offsets[i]);
+}
+
+int parasail_db_matches(const parasail_db_t *db,
+        const parasail_matrix_t *matrix)
+{
+    uint64_t i = 0;
+
+    /* validate inputs */
+    assert(db);
+    assert(matrix);
+
+    for (i=0; i<256; ++i) {
+        if (db->mapper[i] != matrix->mapper[i]) {
+            return 0;
+        }
+    }
+    /* a mapped file may hold residues its mapper never produces */
+    for (i=0; i<db->offsets[db->count]; ++i) {
+        if (db->residues[i] >= matrix->size) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* What parasail_align_encoded hands the functions in place of the
+ * profile's s1 and matrix: the matrix with an identity mapper, and s1
+ * through the matrix's mapper, since the stats functions build a second
+ * profile from s1 and the _sat functions scan it to pick a width. */
+typedef struct encoded_view {
+    parasail_matrix_t matrix;
+    char *s1;
+} encoded_view_t;
+
+/* Atomically replace a NULL *slot with value; returns what *slot held. */
+static void* encoded_publish(void **slot, void *value)
+{
+#if defined(_MSC_VER)
+    return InterlockedCompareExchangePointer(slot, value, NULL);
+#else
+    return __sync_val_compare_and_swap(slot, NULL, value);
+#endif
+}
+
+/* the view of profile, built once per profile even when threads share
+ * it; a single allocation that parasail_profile_free releases */
+static const encoded_view_t* encoded_view(const parasail_profile_t *profile)
+{
+    void **slot = &((parasail_profile_t*)profile)->encoded;
+    encoded_view_t *view = (encoded_view_t*)encoded_publish(slot, NULL);
+    encoded_view_t *built = NULL;
+    int i = 0;
+
+    if (NULL != view) {
+        return view;
+    }
+
+    built = (encoded_view_t*)malloc(sizeof(encoded_view_t) + profile->s1Len);
+    assert(built);
+    built->matrix = *profile->matrix;
+    built->matrix.mapper = identity;
+    built->s1 = NULL;
+    if (NULL != profile->s1) {
+        built->s1 = (char*)(built + 1);
+        for (i=0; i<profile->s1Len; ++i) {
+            built->s1[i] = (char)profile->matrix->mapper[
+                (unsigned char)profile->s1[i]];
+        }
+    }
+
+    view = (encoded_view_t*)encoded_publish(slot, built);
+    if (NULL == view) {
+        return built;
+    }
+    free(built);
+    return view;
+}
+
+/* A shallow copy of profile that sees the view. The copy keeps the
+ * profile's current settings, so it is made on every call, and costs
+ * no allocation. */
+static void encoded_profile(
+        parasail_profile_t *copy,
+        const parasail_profile_t *profile)
+{
+    const encoded_view_t *view = encoded_view(profile);
+
+    *copy = *profile;
+    copy->matrix = &view->matrix;
+    copy->s1 = view->s1;
+}
+
+/* A width a _sat function built for the copy holds the same vectors as
+ * one built from the profile itself, so the profile keeps it for later
+ * calls, unless another thread gave the profile that width first. */
+static void encoded_profile_adopt(
+        parasail_profile_t *copy,
+        const parasail_profile_t *profile)
+{
+    int i = 0;
+
+    for (i=0; i<4; ++i) {
+        if (copy->lazy[i] != profile->lazy[i]) {
+            void **slot = (void**)&((parasail_profile_t*)profile)->lazy[i];
+            if (NULL != encoded_publish(slot, copy->lazy[i])) {
+                parasail_profile_free(copy->lazy[i]);
+            }
+        }
+    }
+}
+
+parasail_result_t* parasail_align_encoded(
+        parasail_pfunction_t *pfunction,
+        const parasail_profile_t * const restrict profile,
+        const uint8_t * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_profile_t copy;
+    parasail_result_t *result = NULL;
+
+    /* validate inputs */
+    assert(pfunction);
+    assert(profile);
+
+    encoded_profile(&copy, profile);
+    result = pfunction(&copy, (const char*)s2, s2Len, open, gap);
+    encoded_profile_adopt(&copy, profile);
+
+    return result;
+}
+
+parasail_result_t* parasail_align_encoded_ws(
+        parasail_pwfunction_t *pwfunction,
+        const parasail_profile_t * const restrict profile,
+        const uint8_t * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_profile_t copy;
+    parasail_result_t *result = NULL;
+
+    /* validate inputs */
+    assert(pwfunction);
+    assert(profile);
+
+    encoded_profile(&copy, profile);
+    result = pwfunction(&copy, (const char*)s2, s2Len, open, gap, workspace);
+    encoded_profile_adopt(&copy, profile);
+
+    return result;
+}
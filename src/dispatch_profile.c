@@ -24,6 +24,10 @@ parasail_pcreator_t parasail_profile_create_stats_32_dispatcher;
 parasail_pcreator_t parasail_profile_create_stats_16_dispatcher;
 parasail_pcreator_t parasail_profile_create_stats_8_dispatcher;
 parasail_pcreator_t parasail_profile_create_stats_sat_dispatcher;
+parasail_pcreator_t parasail_profile_create_blocked_32_dispatcher;
+parasail_pcreator_t parasail_profile_create_blocked_16_dispatcher;
+parasail_mcreator_t parasail_profile_create_packed_16_dispatcher;
+parasail_mcreator_t parasail_profile_create_packed_8_dispatcher;
 
 /* declare and initialize the pointer to the dispatcher function */
 parasail_pcreator_t * parasail_profile_create_64_pointer = parasail_profile_create_64_dispatcher;
@@ -36,6 +40,10 @@ parasail_pcreator_t * parasail_profile_create_stats_32_pointer = parasail_profil
 parasail_pcreator_t * parasail_profile_create_stats_16_pointer = parasail_profile_create_stats_16_dispatcher;
 parasail_pcreator_t * parasail_profile_create_stats_8_pointer = parasail_profile_create_stats_8_dispatcher;
 parasail_pcreator_t * parasail_profile_create_stats_sat_pointer = parasail_profile_create_stats_sat_dispatcher;
+parasail_pcreator_t * parasail_profile_create_blocked_32_pointer = parasail_profile_create_blocked_32_dispatcher;
+parasail_pcreator_t * parasail_profile_create_blocked_16_pointer = parasail_profile_create_blocked_16_dispatcher;
+parasail_mcreator_t * parasail_profile_create_packed_16_pointer = parasail_profile_create_packed_16_dispatcher;
+parasail_mcreator_t * parasail_profile_create_packed_8_pointer = parasail_profile_create_packed_8_dispatcher;
 
 /* dispatcher function implementations */
 
@@ -389,6 +397,98 @@ parasail_profile_t* parasail_profile_create_stats_sat_dispatcher(
     return parasail_profile_create_stats_sat_pointer(s1, s1Len, matrix);
 }
 
+parasail_profile_t* parasail_profile_create_blocked_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_profile_create_blocked_32_pointer = parasail_profile_create_blocked_avx_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_profile_create_blocked_32_pointer = parasail_profile_create_blocked_sse_128_32;
+    }
+    else
+#endif
+    {
+        /* no fallback */
+        parasail_profile_create_blocked_32_pointer = NULL;
+    }
+    return parasail_profile_create_blocked_32_pointer(s1, s1Len, matrix);
+}
+
+parasail_profile_t* parasail_profile_create_blocked_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_profile_create_blocked_16_pointer = parasail_profile_create_blocked_avx_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_profile_create_blocked_16_pointer = parasail_profile_create_blocked_sse_128_16;
+    }
+    else
+#endif
+    {
+        /* no fallback */
+        parasail_profile_create_blocked_16_pointer = NULL;
+    }
+    return parasail_profile_create_blocked_16_pointer(s1, s1Len, matrix);
+}
+
+parasail_profile_t* parasail_profile_create_packed_16_dispatcher(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_profile_create_packed_16_pointer = parasail_profile_create_packed_avx_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_profile_create_packed_16_pointer = parasail_profile_create_packed_sse_128_16;
+    }
+    else
+#endif
+    {
+        parasail_profile_create_packed_16_pointer = parasail_profile_create_packed;
+    }
+    return parasail_profile_create_packed_16_pointer(s1s, s1Lens, s1Count, matrix);
+}
+
+parasail_profile_t* parasail_profile_create_packed_8_dispatcher(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_profile_create_packed_8_pointer = parasail_profile_create_packed_avx_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_profile_create_packed_8_pointer = parasail_profile_create_packed_sse_128_8;
+    }
+    else
+#endif
+    {
+        parasail_profile_create_packed_8_pointer = parasail_profile_create_packed;
+    }
+    return parasail_profile_create_packed_8_pointer(s1s, s1Lens, s1Count, matrix);
+}
+
 parasail_profile_t* parasail_profile_create_64(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
@@ -459,3 +559,32 @@ parasail_profile_t* parasail_profile_create_stats_sat(
     return parasail_profile_create_stats_sat_pointer(s1, s1Len, matrix);
 }
 
+parasail_profile_t* parasail_profile_create_blocked_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_profile_create_blocked_32_pointer(s1, s1Len, matrix);
+}
+
+parasail_profile_t* parasail_profile_create_blocked_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_profile_create_blocked_16_pointer(s1, s1Len, matrix);
+}
+
+parasail_profile_t* parasail_profile_create_packed_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_profile_create_packed_16_pointer(s1s, s1Lens, s1Count, matrix);
+}
+
+parasail_profile_t* parasail_profile_create_packed_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_profile_create_packed_8_pointer(s1s, s1Lens, s1Count, matrix);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* Local alignment statistics computed lazily. The stats kernels carry
+ * three more DP planes than the score-only kernels, which is wasted on
+ * the many pairs a caller throws away for scoring too low. Here the
+ * score-only kernel runs first; only when the score reaches min_score
+ * does a reverse local alignment over the prefixes ending at end_query
+ * and end_ref find where an optimal alignment begins, and the stats
+ * kernel then runs on that region alone. */
+parasail_result_t* parasail_sw_stats_filtered(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix,
+        const int min_score)
+{
+    parasail_result_t *result = NULL;
+    parasail_result_t *rev = NULL;
+    parasail_result_t *stats = NULL;
+    char *r1 = NULL;
+    char *r2 = NULL;
+    int end_query = 0;
+    int end_ref = 0;
+    int begin_query = 0;
+    int begin_ref = 0;
+
+    /* validate inputs */
+    assert(s1);
+    assert(s1Len > 0);
+    assert(s2);
+    assert(s2Len > 0);
+    assert(open >= 0);
+    assert(gap >= 0);
+    assert(matrix);
+
+    result = parasail_sw_striped_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (result->score < min_score) {
+        return result;
+    }
+    end_query = result->end_query;
+    end_ref = result->end_ref;
+
+    /* an optimal alignment lies within the prefixes ending at the end
+     * location; reversed, the best cell of those is where it begins */
+    r1 = parasail_reverse(s1, end_query + 1);
+    r2 = parasail_reverse(s2, end_ref + 1);
+    rev = parasail_sw_striped_sat(r1, end_query + 1, r2, end_ref + 1,
+            open, gap, matrix);
+    begin_query = end_query - rev->end_query;
+    begin_ref = end_ref - rev->end_ref;
+    parasail_result_free(rev);
+    free(r2);
+    free(r1);
+
+    stats = parasail_sw_stats_striped_sat(
+            s1 + begin_query, end_query - begin_query + 1,
+            s2 + begin_ref, end_ref - begin_ref + 1,
+            open, gap, matrix);
+    assert(stats->score == result->score);
+    result->end_query = begin_query + stats->end_query;
+    result->end_ref = begin_ref + stats->end_ref;
+    result->matches = stats->matches;
+    result->similar = stats->similar;
+    result->length = stats->length;
+    parasail_result_free(stats);
+
+    return result;
+}
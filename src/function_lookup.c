@@ -77,6 +77,19 @@ parasail_pfunction_t * parasail_lookup_pfunction(const char *funcname)
     return NULL;
 }
 
+parasail_pwfunction_t * parasail_lookup_pwfunction(const char *funcname)
+{
+    const parasail_pfunction_info_t * info = NULL;
+
+    info = parasail_lookup_pfunction_info(funcname);
+
+    if (info && info->wpointer) {
+        return info->wpointer;
+    }
+
+    return NULL;
+}
+
 parasail_pcreator_t * parasail_lookup_pcreator(const char *funcname)
 {
     const parasail_pfunction_info_t * info = NULL;
@@ -128,3 +141,67 @@ const parasail_pfunction_info_t * parasail_lookup_pfunction_info(const char *fun
     return f;
 }
 
+
+parasail_kfunction_t * parasail_lookup_kfunction(const char *funcname)
+{
+    const parasail_kfunction_info_t * info = NULL;
+
+    info = parasail_lookup_kfunction_info(funcname);
+
+    if (info && info->kpointer) {
+        return info->kpointer;
+    }
+
+    return NULL;
+}
+
+parasail_dfunction_t * parasail_lookup_dfunction(const char *funcname)
+{
+    const parasail_kfunction_info_t * info = NULL;
+
+    info = parasail_lookup_kfunction_info(funcname);
+
+    if (info && info->dpointer) {
+        return info->dpointer;
+    }
+
+    return NULL;
+}
+
+const parasail_kfunction_info_t * parasail_lookup_kfunction_info(const char *funcname)
+{
+    const parasail_kfunction_info_t * f = NULL;
+
+    if (funcname) {
+        int index = 0;
+        f = &kfunctions[index++];
+        while (f->name) {
+            if (0 == strcmp(funcname, f->name)) {
+                break;
+            }
+            f = &kfunctions[index++];
+        }
+        if (!f->name) {
+            /* perhaps caller forgot "parasail_" prefix? */
+            const char *prefix = "parasail_";
+            char *newname = (char*)malloc(strlen(prefix)+strlen(funcname)+1);
+            strcpy(newname, prefix);
+            strcat(newname, funcname);
+            index = 0;
+            f = &kfunctions[index++];
+            while (f->name) {
+                if (0 == strcmp(newname, f->name)) {
+                    break;
+                }
+                f = &kfunctions[index++];
+            }
+            free(newname);
+        }
+    }
+
+    if (f && !f->name) {
+        f = NULL;
+    }
+
+    return f;
+}
@@ -28537,10 +28537,20041 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_knc_512_32(
 }
 #endif
 
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_KNC
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_knc_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_short_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_packed_sse41_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_packed_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_packed_sse41_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_packed_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_nw_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_packed_avx2_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_packed_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_packed_avx2_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_packed_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_nw_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_packed_sse41_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_packed_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_packed_sse41_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_packed_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sg_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_packed_avx2_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_packed_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_packed_avx2_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_packed_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sg_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_packed_sse41_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_packed_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_packed_sse41_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_packed_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_packed_avx2_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_packed_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_packed_avx2_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_packed_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const int diag, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_blocked_sse41_128_32(
+parasail_result_t* parasail_sg_trace_scan_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -28558,10 +48589,73 @@ parasail_result_t* parasail_sw_blocked_sse41_128_32(
 }
 #endif
 
-#if HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_blocked_sse41_128_16(
+parasail_result_t* parasail_sg_trace_scan_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -28582,7 +48676,7 @@ parasail_result_t* parasail_sw_blocked_sse41_128_16(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -28603,7 +48697,7 @@ parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -28624,7 +48718,7 @@ parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -28645,7 +48739,91 @@ parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
+parasail_result_t* parasail_sw_trace_scan_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -28993,3 +49171,131 @@ parasail_profile_t* parasail_profile_create_stats_knc_512_32(
 }
 #endif
 
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_blocked_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_blocked_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_blocked_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_blocked_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_packed_sse_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_packed_sse_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_packed_avx_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_packed_avx_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
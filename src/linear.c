@@ -0,0 +1,619 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+/* Subproblems with fewer cells than this are cheaper to split serially
+ * than to hand to the vectorized rowcol kernels. */
+#define LINEAR_KERNEL_CELLS (1<<14)
+
+/* Linear space alignment after Myers and Miller, "Optimal alignments in
+ * linear space" (1988). Each level splits the query in half and finds
+ * where the optimal path crosses the middle from a forward pass over
+ * the top half and a reverse pass over the bottom half. A gap of length
+ * k costs G+h*k, so G is open-gap and h is gap. tb and te are what a
+ * deletion touching the top left or bottom right corner pays to open,
+ * either G or 0 when it continues a deletion of the enclosing level.
+ *
+ * The vectorized rowcol kernels only return H, not the deletion scores
+ * needed to see a gap crossing the middle, so they are used when both
+ * corners are ordinary and the expected score of the subproblem is
+ * known. If their best split falls short of that score, the optimal
+ * path crosses with a gap and the level is redone serially. */
+
+typedef struct linear {
+    const char *s1;     /* query */
+    const char *s2;     /* reference */
+    char *r1;           /* reversed query */
+    char *r2;           /* reversed reference */
+    int *m1;            /* query mapped through matrix */
+    int *m2;            /* reference mapped through matrix */
+    int s1Len;
+    int s2Len;
+    int open;
+    int gap;
+    int G;
+    const parasail_matrix_t *matrix;
+    int *CC;
+    int *DD;
+    int *RR;
+    int *SS;
+    char *ops;
+    int length;
+} linear_t;
+
+static inline void push(linear_t *ctx, char op, int count)
+{
+    for (; count>0; --count) {
+        ctx->ops[ctx->length++] = op;
+    }
+}
+
+static inline int gapcost(const linear_t *ctx, int k)
+{
+    return k > 0 ? ctx->G + ctx->gap*k : 0;
+}
+
+/* Whether every score of an M by N subproblem fits the 16-bit kernels.
+ * No step of a path changes the score by more than bound, and the
+ * _sat dispatchers cannot be used instead because not every narrow
+ * kernel notices when it overflows. */
+static inline int narrow(const linear_t *ctx, int M, int N)
+{
+    const parasail_matrix_t *matrix = ctx->matrix;
+    int64_t bound = MAX(matrix->max, -matrix->min);
+    bound = MAX(bound, ctx->open);
+    return bound*((int64_t)M + N + 2) < INT16_MAX;
+}
+
+/* CC[j] is the best score of the M letters of a against the first j
+ * letters of b, DD[j] the best of those ending in a deletion. a and b
+ * are walked with strides ainc and binc so the same pass runs reversed. */
+static void pass(
+        const linear_t *ctx,
+        const int *a, const int ainc, const int M,
+        const int *b, const int binc, const int N,
+        const int tb, int *CC, int *DD)
+{
+    const parasail_matrix_t *matrix = ctx->matrix;
+    const int G = ctx->G;
+    const int h = ctx->gap;
+    int i = 0;
+    int j = 0;
+    int t = -G;
+
+    CC[0] = 0;
+    for (j=1; j<=N; ++j) {
+        t -= h;
+        CC[j] = t;
+        DD[j] = t - G;
+    }
+    t = -tb;
+    for (i=0; i<M; ++i) {
+        const int * const restrict matrow = &matrix->matrix[matrix->size*a[i*ainc]];
+        int s = CC[0];
+        int c = 0;
+        int e = 0;
+        t -= h;
+        c = t;
+        CC[0] = c;
+        e = t - G;
+        for (j=1; j<=N; ++j) {
+            int d = MAX(DD[j], CC[j] - G) - h;
+            e = MAX(e, c - G) - h;
+            c = MAX(d, e);
+            c = MAX(c, s + matrow[b[(j-1)*binc]]);
+            s = CC[j];
+            CC[j] = c;
+            DD[j] = d;
+        }
+    }
+    DD[0] = CC[0];
+}
+
+/* Fill CC and RR from the last rows of a forward and a reverse rowcol
+ * kernel. Returns 0 if either saturated. */
+static int kernel_rows(
+        const linear_t *ctx,
+        const int a, const int imid, const int M,
+        const int b, const int N)
+{
+    parasail_function_t *function = narrow(ctx, M, N) ?
+        parasail_nw_rowcol_scan_16 : parasail_nw_rowcol_scan_32;
+    parasail_result_t *fwd = NULL;
+    parasail_result_t *rev = NULL;
+    int j = 0;
+    int ok = 0;
+
+    fwd = function(
+            ctx->s1 + a, imid,
+            ctx->s2 + b, N,
+            ctx->open, ctx->gap, ctx->matrix);
+    rev = function(
+            ctx->r1 + (ctx->s1Len - a - M), M - imid,
+            ctx->r2 + (ctx->s2Len - b - N), N,
+            ctx->open, ctx->gap, ctx->matrix);
+    if (!fwd->saturated && !rev->saturated) {
+        ctx->CC[0] = -gapcost(ctx, imid);
+        ctx->RR[0] = -gapcost(ctx, M - imid);
+        for (j=0; j<N; ++j) {
+            ctx->CC[j+1] = fwd->score_row[j];
+            ctx->RR[j+1] = rev->score_row[j];
+        }
+        ok = 1;
+    }
+    parasail_result_free(rev);
+    parasail_result_free(fwd);
+
+    return ok;
+}
+
+/* Align a[0..M) of the query with b[0..N) of the reference, appending
+ * the ops. expect is the score of the subproblem if known is set. */
+static void diff(
+        linear_t *ctx,
+        const int a, const int M,
+        const int b, const int N,
+        const int tb, const int te,
+        const int expect, const int known)
+{
+    const int G = ctx->G;
+    const int h = ctx->gap;
+    const int imid = M/2;
+    int j = 0;
+    int best = 0;
+    int best_j = 0;
+    int type = 1;
+
+    if (0 == N) {
+        push(ctx, 'I', M);
+        return;
+    }
+
+    if (0 == M) {
+        push(ctx, 'D', N);
+        return;
+    }
+
+    if (1 == M) {
+        const parasail_matrix_t *matrix = ctx->matrix;
+        const int * const restrict matrow = &matrix->matrix[matrix->size*ctx->m1[a]];
+        /* delete the letter and insert all of b */
+        best = -(MIN(tb, te) + h) - gapcost(ctx, N);
+        best_j = -1;
+        for (j=0; j<N; ++j) {
+            int c = matrow[ctx->m2[b+j]]
+                - gapcost(ctx, j) - gapcost(ctx, N-1-j);
+            if (c > best) {
+                best = c;
+                best_j = j;
+            }
+        }
+        if (best_j < 0) {
+            if (tb < te) {
+                push(ctx, 'I', 1);
+                push(ctx, 'D', N);
+            }
+            else {
+                push(ctx, 'D', N);
+                push(ctx, 'I', 1);
+            }
+        }
+        else {
+            push(ctx, 'D', best_j);
+            push(ctx, 'M', 1);
+            push(ctx, 'D', N-1-best_j);
+        }
+        return;
+    }
+
+    if (known && G == tb && G == te
+            && (int64_t)M*N >= LINEAR_KERNEL_CELLS
+            && kernel_rows(ctx, a, imid, M, b, N)) {
+        best = ctx->CC[0] + ctx->RR[N];
+        best_j = 0;
+        for (j=1; j<=N; ++j) {
+            int c = ctx->CC[j] + ctx->RR[N-j];
+            if (c > best) {
+                best = c;
+                best_j = j;
+            }
+        }
+        if (best == expect) {
+            int top = ctx->CC[best_j];
+            int bottom = ctx->RR[N-best_j];
+            diff(ctx, a, imid, b, best_j, tb, G, top, 1);
+            diff(ctx, a+imid, M-imid, b+best_j, N-best_j, G, te, bottom, 1);
+            return;
+        }
+    }
+
+    pass(ctx, ctx->m1 + a, 1, imid, ctx->m2 + b, 1, N,
+            tb, ctx->CC, ctx->DD);
+    pass(ctx, ctx->m1 + a + M - 1, -1, M - imid, ctx->m2 + b + N - 1, -1, N,
+            te, ctx->RR, ctx->SS);
+    best = ctx->CC[0] + ctx->RR[N];
+    best_j = 0;
+    type = 1;
+    for (j=0; j<=N; ++j) {
+        int c1 = ctx->CC[j] + ctx->RR[N-j];
+        int c2 = ctx->DD[j] + ctx->SS[N-j] + G;
+        if (c1 > best) {
+            best = c1;
+            best_j = j;
+            type = 1;
+        }
+        if (c2 > best) {
+            best = c2;
+            best_j = j;
+            type = 2;
+        }
+    }
+
+    if (1 == type) {
+        int top = ctx->CC[best_j];
+        int bottom = ctx->RR[N-best_j];
+        diff(ctx, a, imid, b, best_j, tb, G, top, 1);
+        diff(ctx, a+imid, M-imid, b+best_j, N-best_j, G, te, bottom, 1);
+    }
+    else {
+        /* the path deletes query letters imid-1 and imid in column best_j */
+        diff(ctx, a, imid-1, b, best_j, tb, 0, 0, 0);
+        push(ctx, 'I', 2);
+        diff(ctx, a+imid+1, M-imid-1, b+best_j, N-best_j, 0, te, 0, 0);
+    }
+}
+
+/* Begin of the local alignment with the given score ending at end_query
+ * and end_ref. A reverse local alignment finds it, but may pick another
+ * alignment of the same score that stops short of the end; in that
+ * case a serial pass anchored at the end is used. */
+static void sw_begin(
+        const linear_t *ctx,
+        const int score, const int end_query, const int end_ref,
+        int *begin_query, int *begin_ref)
+{
+    const parasail_matrix_t *matrix = ctx->matrix;
+    const int G = ctx->G;
+    const int h = ctx->gap;
+    parasail_result_t *rev = NULL;
+    parasail_result_t *region = NULL;
+    int *H = NULL;
+    int *E = NULL;
+    int i = 0;
+    int j = 0;
+
+    rev = (narrow(ctx, end_query + 1, end_ref + 1) ?
+            parasail_sw_scan_16 : parasail_sw_scan_32)(
+            ctx->r1 + (ctx->s1Len - 1 - end_query), end_query + 1,
+            ctx->r2 + (ctx->s2Len - 1 - end_ref), end_ref + 1,
+            ctx->open, ctx->gap, matrix);
+    *begin_query = end_query - rev->end_query;
+    *begin_ref = end_ref - rev->end_ref;
+    parasail_result_free(rev);
+
+    region = (narrow(ctx, end_query + 1, end_ref + 1) ?
+            parasail_nw_scan_16 : parasail_nw_scan_32)(
+            ctx->s1 + *begin_query, end_query - *begin_query + 1,
+            ctx->s2 + *begin_ref, end_ref - *begin_ref + 1,
+            ctx->open, ctx->gap, matrix);
+    if (!region->saturated && score == region->score) {
+        parasail_result_free(region);
+        return;
+    }
+    parasail_result_free(region);
+
+    /* global from the end backwards, local at the begin */
+    H = parasail_memalign_int(16, end_ref + 2);
+    E = parasail_memalign_int(16, end_ref + 2);
+    H[0] = 0;
+    for (j=1; j<=end_ref+1; ++j) {
+        H[j] = -gapcost(ctx, j);
+        E[j] = H[j] - G;
+    }
+    for (i=end_query; i>=0; --i) {
+        const int * const restrict matrow = &matrix->matrix[matrix->size*ctx->m1[i]];
+        int s = H[0];
+        int c = -gapcost(ctx, end_query - i + 1);
+        int f = c - G;
+        H[0] = c;
+        for (j=1; j<=end_ref+1; ++j) {
+            int e = MAX(E[j], H[j] - G) - h;
+            f = MAX(f, c - G) - h;
+            c = MAX(e, f);
+            c = MAX(c, s + matrow[ctx->m2[end_ref+1-j]]);
+            s = H[j];
+            H[j] = c;
+            E[j] = e;
+            if (c == score) {
+                *begin_query = i;
+                *begin_ref = end_ref + 1 - j;
+                parasail_free(E);
+                parasail_free(H);
+                return;
+            }
+        }
+    }
+    parasail_free(E);
+    parasail_free(H);
+    assert(0);
+}
+
+/* Begin of the semi-global alignment with the given score ending at
+ * end_query and end_ref. It starts in the first row or column, which
+ * are the last row and column of a reverse global alignment. */
+static void sg_begin(
+        const linear_t *ctx,
+        const int score, const int end_query, const int end_ref,
+        int *begin_query, int *begin_ref)
+{
+    parasail_result_t *rev = NULL;
+    int k = 0;
+
+    rev = (narrow(ctx, end_query + 1, end_ref + 1) ?
+            parasail_nw_rowcol_scan_16 : parasail_nw_rowcol_scan_32)(
+            ctx->r1 + (ctx->s1Len - 1 - end_query), end_query + 1,
+            ctx->r2 + (ctx->s2Len - 1 - end_ref), end_ref + 1,
+            ctx->open, ctx->gap, ctx->matrix);
+
+    /* all of the query prefix against no reference letters */
+    *begin_query = 0;
+    *begin_ref = end_ref + 1;
+    for (k=0; k<=end_ref; ++k) {
+        if (rev->score_row[k] == score) {
+            *begin_query = 0;
+            *begin_ref = end_ref - k;
+            break;
+        }
+    }
+    if (k > end_ref) {
+        for (k=0; k<=end_query; ++k) {
+            if (rev->score_col[k] == score) {
+                *begin_query = end_query - k;
+                *begin_ref = 0;
+                break;
+            }
+        }
+        if (k > end_query && -gapcost(ctx, end_ref + 1) == score) {
+            *begin_query = end_query + 1;
+            *begin_ref = 0;
+        }
+    }
+
+    parasail_result_free(rev);
+}
+
+static parasail_result_t* linear(
+        const int type,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = NULL;
+    parasail_function_t *function = NULL;
+    linear_t ctx;
+    int i = 0;
+    int j = 0;
+    int begin_query = 0;
+    int begin_ref = 0;
+
+    /* validate inputs */
+    assert(s1);
+    assert(s1Len > 0);
+    assert(s2);
+    assert(s2Len > 0);
+    assert(open >= gap);
+    assert(matrix);
+
+    ctx.s1 = s1;
+    ctx.s2 = s2;
+    ctx.r1 = parasail_reverse(s1, s1Len);
+    ctx.r2 = parasail_reverse(s2, s2Len);
+    ctx.m1 = parasail_memalign_int(16, s1Len);
+    ctx.m2 = parasail_memalign_int(16, s2Len);
+    ctx.s1Len = s1Len;
+    ctx.s2Len = s2Len;
+    ctx.open = open;
+    ctx.gap = gap;
+    ctx.G = open - gap;
+    ctx.matrix = matrix;
+    ctx.CC = parasail_memalign_int(16, s2Len+1);
+    ctx.DD = parasail_memalign_int(16, s2Len+1);
+    ctx.RR = parasail_memalign_int(16, s2Len+1);
+    ctx.SS = parasail_memalign_int(16, s2Len+1);
+    ctx.ops = (char*)malloc(s1Len + s2Len + 1);
+    ctx.length = 0;
+    assert(ctx.ops);
+
+    if (PARASAIL_TRACE_NW == type) {
+        function = narrow(&ctx, s1Len, s2Len) ?
+            parasail_nw_scan_16 : parasail_nw_scan_32;
+    }
+    else if (PARASAIL_TRACE_SG == type) {
+        function = narrow(&ctx, s1Len, s2Len) ?
+            parasail_sg_scan_16 : parasail_sg_scan_32;
+    }
+    else {
+        function = narrow(&ctx, s1Len, s2Len) ?
+            parasail_sw_scan_16 : parasail_sw_scan_32;
+    }
+    result = function(s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    for (i=0; i<s1Len; ++i) {
+        ctx.m1[i] = matrix->mapper[(unsigned char)s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        ctx.m2[j] = matrix->mapper[(unsigned char)s2[j]];
+    }
+
+    if (result->saturated) {
+        /* no alignment, parasail_result_get_traceback returns NULL */
+    }
+    else if (PARASAIL_TRACE_NW == type) {
+        diff(&ctx, 0, s1Len, 0, s2Len, ctx.G, ctx.G, result->score, 1);
+    }
+    else if (PARASAIL_TRACE_SG == type) {
+        sg_begin(&ctx, result->score, result->end_query, result->end_ref,
+                &begin_query, &begin_ref);
+        diff(&ctx, begin_query, result->end_query - begin_query + 1,
+                begin_ref, result->end_ref - begin_ref + 1,
+                ctx.G, ctx.G, result->score, 1);
+    }
+    else if (result->score > 0) {
+        sw_begin(&ctx, result->score, result->end_query, result->end_ref,
+                &begin_query, &begin_ref);
+        diff(&ctx, begin_query, result->end_query - begin_query + 1,
+                begin_ref, result->end_ref - begin_ref + 1,
+                ctx.G, ctx.G, result->score, 1);
+    }
+    ctx.ops[ctx.length] = '\0';
+
+    result->begin_query = begin_query;
+    result->begin_ref = begin_ref;
+    result->length = result->saturated ? 0 : ctx.length;
+    result->trace = (parasail_trace_t*)malloc(sizeof(parasail_trace_t));
+    assert(result->trace);
+    result->trace->bits = NULL;
+    result->trace->lanes = 0;
+    result->trace->segLen = 0;
+    result->trace->words = 0;
+    result->trace->type = type;
+    result->trace->ops = ctx.ops;
+
+    parasail_free(ctx.SS);
+    parasail_free(ctx.RR);
+    parasail_free(ctx.DD);
+    parasail_free(ctx.CC);
+    parasail_free(ctx.m2);
+    parasail_free(ctx.m1);
+    free(ctx.r2);
+    free(ctx.r1);
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return linear(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sg_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return linear(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sw_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return linear(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+/* Begin of an sg or sw result from the prefixes ending at its end
+ * location, which are all that is reversed and mapped. */
+static void find_begin(
+        const int type,
+        parasail_result_t * const restrict result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    linear_t ctx;
+    const int M = result->end_query + 1;
+    const int N = result->end_ref + 1;
+    int i = 0;
+    int j = 0;
+
+    /* validate inputs */
+    assert(result);
+    assert(s1);
+    assert(s2);
+    assert(open >= gap);
+    assert(matrix);
+
+    result->begin_query = 0;
+    result->begin_ref = 0;
+    if (result->saturated
+            || (PARASAIL_TRACE_SW == type && result->score <= 0)) {
+        return;
+    }
+    assert(M > 0 && M <= s1Len);
+    assert(N > 0 && N <= s2Len);
+
+    ctx.s1 = s1;
+    ctx.s2 = s2;
+    ctx.r1 = parasail_reverse(s1, M);
+    ctx.r2 = parasail_reverse(s2, N);
+    ctx.m1 = parasail_memalign_int(16, M);
+    ctx.m2 = parasail_memalign_int(16, N);
+    ctx.s1Len = M;
+    ctx.s2Len = N;
+    ctx.open = open;
+    ctx.gap = gap;
+    ctx.G = open - gap;
+    ctx.matrix = matrix;
+    for (i=0; i<M; ++i) {
+        ctx.m1[i] = matrix->mapper[(unsigned char)s1[i]];
+    }
+    for (j=0; j<N; ++j) {
+        ctx.m2[j] = matrix->mapper[(unsigned char)s2[j]];
+    }
+
+    if (PARASAIL_TRACE_SG == type) {
+        sg_begin(&ctx, result->score, result->end_query, result->end_ref,
+                &result->begin_query, &result->begin_ref);
+    }
+    else {
+        sw_begin(&ctx, result->score, result->end_query, result->end_ref,
+                &result->begin_query, &result->begin_ref);
+    }
+
+    parasail_free(ctx.m2);
+    parasail_free(ctx.m1);
+    free(ctx.r2);
+    free(ctx.r1);
+}
+
+void parasail_sg_find_begin(
+        parasail_result_t * const restrict result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    find_begin(PARASAIL_TRACE_SG, result, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+void parasail_sw_find_begin(
+        parasail_result_t * const restrict result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    find_begin(PARASAIL_TRACE_SW, result, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
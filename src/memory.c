@@ -18,7 +18,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
+
 #include "parasail.h"
+#include "parasail/io.h"
 #include "parasail/memory.h"
 
 void* parasail_memalign(size_t alignment, size_t size)
@@ -74,6 +79,137 @@ int64_t * parasail_memalign_int64_t(size_t alignment, size_t size)
     return (int64_t *) parasail_memalign(alignment, size*sizeof(int64_t));
 }
 
+/* Slots are aligned for the widest vector unit so a single workspace
+ * can be handed to kernels of any ISA. */
+#define WORKSPACE_ALIGNMENT 64
+
+void parasail_workspace_init(parasail_workspace_t *workspace)
+{
+    int i = 0;
+
+    /* validate inputs */
+    assert(NULL != workspace);
+
+    for (i=0; i<PARASAIL_WORKSPACE_SLOTS; ++i) {
+        workspace->slot[i] = NULL;
+        workspace->size[i] = 0;
+    }
+}
+
+void parasail_workspace_clear(parasail_workspace_t *workspace)
+{
+    int i = 0;
+
+    /* validate inputs */
+    assert(NULL != workspace);
+
+    for (i=0; i<PARASAIL_WORKSPACE_SLOTS; ++i) {
+        if (NULL != workspace->slot[i]) parasail_free(workspace->slot[i]);
+        workspace->slot[i] = NULL;
+        workspace->size[i] = 0;
+    }
+}
+
+parasail_workspace_t* parasail_workspace_new(void)
+{
+    parasail_workspace_t *workspace = NULL;
+
+    workspace = (parasail_workspace_t*)malloc(sizeof(parasail_workspace_t));
+    assert(workspace);
+    parasail_workspace_init(workspace);
+
+    return workspace;
+}
+
+void parasail_workspace_free(parasail_workspace_t *workspace)
+{
+    /* validate inputs */
+    assert(NULL != workspace);
+
+    parasail_workspace_clear(workspace);
+    free(workspace);
+}
+
+void * parasail_workspace_reserve(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    /* validate inputs */
+    assert(NULL != workspace);
+    assert(slot >= 0 && slot < PARASAIL_WORKSPACE_SLOTS);
+
+    /* contents are scratch, so grow without copying */
+    if (workspace->size[slot] < size || NULL == workspace->slot[slot]) {
+        if (NULL != workspace->slot[slot]) parasail_free(workspace->slot[slot]);
+        workspace->slot[slot] = parasail_memalign(WORKSPACE_ALIGNMENT, size);
+        workspace->size[slot] = size;
+    }
+
+    return workspace->slot[slot];
+}
+
+int * parasail_workspace_int(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (int *) parasail_workspace_reserve(workspace, slot, size*sizeof(int));
+}
+
+int8_t * parasail_workspace_int8_t(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (int8_t *) parasail_workspace_reserve(workspace, slot, size*sizeof(int8_t));
+}
+
+int16_t * parasail_workspace_int16_t(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (int16_t *) parasail_workspace_reserve(workspace, slot, size*sizeof(int16_t));
+}
+
+int32_t * parasail_workspace_int32_t(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (int32_t *) parasail_workspace_reserve(workspace, slot, size*sizeof(int32_t));
+}
+
+int64_t * parasail_workspace_int64_t(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (int64_t *) parasail_workspace_reserve(workspace, slot, size*sizeof(int64_t));
+}
+
+void parasail_resume_init(parasail_resume_t *resume)
+{
+    /* validate inputs */
+    assert(NULL != resume);
+
+    resume->column = -1;
+    resume->score = 0;
+    resume->length = 0;
+    resume->H = NULL;
+    resume->E = NULL;
+}
+
+void parasail_resume_clear(parasail_resume_t *resume)
+{
+    /* validate inputs */
+    assert(NULL != resume);
+
+    free(resume->H);
+    free(resume->E);
+    parasail_resume_init(resume);
+}
+
+void parasail_resume_reserve(parasail_resume_t *resume, int length)
+{
+    /* validate inputs */
+    assert(NULL != resume);
+    assert(length >= 0);
+
+    if (resume->length < length || NULL == resume->H) {
+        free(resume->H);
+        free(resume->E);
+        resume->H = (int*)malloc(sizeof(int)*(length > 0 ? length : 1));
+        resume->E = (int*)malloc(sizeof(int)*(length > 0 ? length : 1));
+        assert(resume->H);
+        assert(resume->E);
+        resume->length = length;
+    }
+}
+
 void parasail_memset(void *b, int c, size_t len)
 {
     (void)memset(b, c, len);
@@ -134,6 +270,10 @@ parasail_result_t* parasail_result_new()
     result->length = 0;
     result->end_query = 0;
     result->end_ref = 0;
+    result->begin_query = 0;
+    result->begin_ref = 0;
+    result->columns = 0;
+    result->width = 0;
     result->score_table = NULL;
     result->matches_table = NULL;
     result->similar_table = NULL;
@@ -146,14 +286,80 @@ parasail_result_t* parasail_result_new()
     result->matches_col = NULL;
     result->similar_col = NULL;
     result->length_col = NULL;
+    result->trace = NULL;
+    result->table_type = PARASAIL_TABLE_INT;
+    result->window.query_begin = 0;
+    result->window.query_end = 0;
+    result->window.ref_begin = 0;
+    result->window.ref_end = 0;
 
     return result;
 }
 
+static size_t table_entry_size(const int type)
+{
+    switch (type) {
+        case PARASAIL_TABLE_INT16:
+        case PARASAIL_TABLE_UINT16:
+            return sizeof(int16_t);
+        case PARASAIL_TABLE_INT8:
+        case PARASAIL_TABLE_UINT8:
+            return sizeof(int8_t);
+        default:
+            return sizeof(int);
+    }
+}
+
 parasail_result_t* parasail_result_new_table1(const int a, const int b)
+{
+    return parasail_result_new_table1_type(a, b, PARASAIL_TABLE_INT);
+}
+
+parasail_result_t* parasail_result_new_table1_type(
+        const int a, const int b, const int type)
+{
+    return parasail_result_new_table1_window(a, b, type, NULL);
+}
+
+/* clip window to an a by b table and return the number of cells kept */
+static size_t table_window_clip(
+        parasail_window_t *clipped,
+        const parasail_window_t *window,
+        const int a, const int b)
+{
+    clipped->query_begin = 0;
+    clipped->query_end = 0;
+    clipped->ref_begin = 0;
+    clipped->ref_end = 0;
+    if (NULL == window || 0 == window->query_end) {
+        return (size_t)a*b;
+    }
+    clipped->query_begin = window->query_begin < 0 ? 0 : window->query_begin;
+    clipped->query_end = window->query_end > a ? a : window->query_end;
+    clipped->ref_begin = window->ref_begin < 0 ? 0 : window->ref_begin;
+    clipped->ref_end = window->ref_end > b ? b : window->ref_end;
+    if (clipped->query_begin >= clipped->query_end
+            || clipped->ref_begin >= clipped->ref_end) {
+        /* nothing of the window lies in the table; an empty window
+         * past the last row keeps the kernels from writing while still
+         * telling it apart from the whole table */
+        clipped->query_begin = a;
+        clipped->query_end = a;
+        clipped->ref_begin = b;
+        clipped->ref_end = b;
+        return 1;
+    }
+    return (size_t)(clipped->query_end - clipped->query_begin)
+        * (clipped->ref_end - clipped->ref_begin);
+}
+
+parasail_result_t* parasail_result_new_table1_window(
+        const int a, const int b, const int type,
+        const parasail_window_t *window)
 {
     /* declare all variables */
     parasail_result_t *result = NULL;
+    size_t cells = 0;
 
     /* validate inputs */
     assert(a > 0);
@@ -161,9 +367,11 @@ parasail_result_t* parasail_result_new_table1(const int a, const int b)
     
     /* allocate struct to hold memory */
     result = parasail_result_new();
+    result->table_type = type;
+    cells = table_window_clip(&result->window, window, a, b);
 
     /* allocate only score table */
-    result->score_table = (int *)malloc(sizeof(int)*a*b);
+    result->score_table = (int *)malloc(table_entry_size(type)*cells);
     assert(result->score_table);
 
     return result;
@@ -191,22 +399,37 @@ parasail_result_t* parasail_result_new_rowcol1(const int a, const int b)
 }
 
 parasail_result_t* parasail_result_new_table3(const int a, const int b)
+{
+    return parasail_result_new_table3_type(a, b, PARASAIL_TABLE_INT);
+}
+
+parasail_result_t* parasail_result_new_table3_type(
+        const int a, const int b, const int type)
+{
+    return parasail_result_new_table3_window(a, b, type, NULL);
+}
+
+parasail_result_t* parasail_result_new_table3_window(
+        const int a, const int b, const int type,
+        const parasail_window_t *window)
 {
     /* declare all variables */
     parasail_result_t *result = NULL;
+    parasail_window_t clipped;
+    size_t size = table_entry_size(type)*table_window_clip(&clipped, window, a, b);
 
     /* validate inputs */
     assert(a > 0);
     assert(b > 0);
     
     /* allocate struct to hold memory */
-    result = parasail_result_new_table1(a, b);
+    result = parasail_result_new_table1_window(a, b, type, window);
     
-    result->matches_table = (int *)malloc(sizeof(int)*a*b);
+    result->matches_table = (int *)malloc(size);
     assert(result->matches_table);
-    result->similar_table = (int *)malloc(sizeof(int)*a*b);
+    result->similar_table = (int *)malloc(size);
     assert(result->similar_table);
-    result->length_table = (int *)malloc(sizeof(int)*a*b);
+    result->length_table = (int *)malloc(size);
     assert(result->length_table);
 
     return result;
@@ -241,6 +464,68 @@ parasail_result_t* parasail_result_new_rowcol3(const int a, const int b)
     return result;
 }
 
+parasail_result_t* parasail_result_new_trace(
+        const int segLen, const int b, const int lanes, const int type)
+{
+    /* declare all variables */
+    parasail_result_t *result = NULL;
+    parasail_trace_t *trace = NULL;
+
+    /* validate inputs */
+    assert(segLen > 0);
+    assert(b > 0);
+    assert(lanes > 0 && 64 % lanes == 0);
+
+    /* allocate struct to hold memory */
+    result = parasail_result_new();
+
+    trace = (parasail_trace_t*)malloc(sizeof(parasail_trace_t));
+    assert(trace);
+    trace->lanes = lanes;
+    trace->segLen = segLen;
+    trace->words = (4*segLen*lanes + 63) / 64;
+    trace->type = type;
+    trace->bits = (uint64_t *)malloc(sizeof(uint64_t)*trace->words*b);
+    assert(trace->bits);
+    trace->ops = NULL;
+    result->trace = trace;
+
+    return result;
+}
+
+int parasail_result_get_table_value(const parasail_result_t *result,
+        const int *table, int s2Len, int i, int j)
+{
+    size_t index = (size_t)i*s2Len + j;
+
+    /* validate inputs */
+    assert(NULL != result);
+    assert(NULL != table);
+
+    if (result->window.query_end) {
+        const parasail_window_t *w = &result->window;
+        if (i < w->query_begin || i >= w->query_end
+                || j < w->ref_begin || j >= w->ref_end) {
+            return 0;
+        }
+        index = (size_t)(i - w->query_begin)*(w->ref_end - w->ref_begin)
+            + (j - w->ref_begin);
+    }
+
+    switch (result->table_type) {
+        case PARASAIL_TABLE_INT16:
+            return ((const int16_t*)table)[index];
+        case PARASAIL_TABLE_UINT16:
+            return ((const uint16_t*)table)[index];
+        case PARASAIL_TABLE_INT8:
+            return ((const int8_t*)table)[index];
+        case PARASAIL_TABLE_UINT8:
+            return ((const uint8_t*)table)[index];
+        default:
+            return table[index];
+    }
+}
+
 void parasail_result_free(parasail_result_t *result)
 {
     /* validate inputs */
@@ -258,9 +543,28 @@ void parasail_result_free(parasail_result_t *result)
     if (NULL != result->matches_col) free(result->matches_col);
     if (NULL != result->similar_col) free(result->similar_col);
     if (NULL != result->length_col) free(result->length_col);
+    if (NULL != result->trace) {
+        free(result->trace->bits);
+        free(result->trace->ops);
+        free(result->trace);
+    }
     free(result);
 }
 
+void parasail_result_free_batch(parasail_result_t **results, const int count)
+{
+    int i = 0;
+
+    /* validate inputs */
+    assert(NULL != results);
+    assert(count >= 0);
+
+    for (i=0; i<count; ++i) {
+        parasail_result_free(results[i]);
+    }
+    free(results);
+}
+
 void parasail_version(int *major, int *minor, int *patch)
 {
     *major = PARASAIL_VERSION_MAJOR;
@@ -392,6 +696,7 @@ parasail_profile_t* parasail_profile_new(
 {
     /* declare all variables */
     parasail_profile_t *profile = NULL;
+    int i = 0;
 
     profile = (parasail_profile_t*)malloc(sizeof(parasail_profile_t));
     assert(profile);
@@ -413,12 +718,40 @@ parasail_profile_t* parasail_profile_new(
     profile->profile64.similar = NULL;
     profile->free = NULL;
     profile->stop = INT32_MAX;
+    profile->stop_mode = PARASAIL_STOP_REACHED;
+    profile->stop_bound = INT32_MAX;
+    profile->stop_gain = NULL;
+    profile->xdrop = INT32_MAX;
+    profile->narrow_tables = 0;
+    profile->window.query_begin = 0;
+    profile->window.query_end = 0;
+    profile->window.ref_begin = 0;
+    profile->window.ref_end = 0;
+    profile->vector_bytes = 0;
+    profile->layout = PARASAIL_LAYOUT_SERIAL;
+    profile->file = NULL;
+    for (i=0; i<4; ++i) {
+        profile->lazy_create[i] = NULL;
+        profile->lazy[i] = NULL;
+    }
+    profile->packed_count = 0;
+    profile->packed_begin = NULL;
+    profile->packed_s1 = NULL;
+    profile->encoded = NULL;
 
     return profile;
 }
 
 void parasail_profile_free(parasail_profile_t *profile)
 {
+    int i = 0;
+
+    for (i=0; i<4; ++i) {
+        if (NULL != profile->lazy[i]) {
+            parasail_profile_free(profile->lazy[i]);
+        }
+    }
+
     if (NULL != profile->profile8.score) {
         profile->free(profile->profile8.score);
     }
@@ -459,9 +792,181 @@ void parasail_profile_free(parasail_profile_t *profile)
         profile->free(profile->profile64.similar);
     }
 
+    if (NULL != profile->file) {
+        parasail_close((parasail_file_t*)profile->file);
+    }
+    free(profile->stop_gain);
+    free(profile->packed_begin);
+    free(profile->packed_s1);
+    free(profile->encoded);
     free(profile);
 }
 
+/* Atomically replace a NULL *slot with wide; returns what *slot held. */
+static parasail_profile_t* profile_publish(
+        parasail_profile_t **slot, parasail_profile_t *wide)
+{
+#if defined(_MSC_VER)
+    return (parasail_profile_t*)InterlockedCompareExchangePointer(
+            (PVOID*)slot, wide, NULL);
+#else
+    return __sync_val_compare_and_swap(slot, NULL, wide);
+#endif
+}
+
+const parasail_profile_t* parasail_profile_width(
+        const parasail_profile_t *profile, int bits,
+        parasail_profile_t *copy)
+{
+    parasail_profile_t **slot = NULL;
+    parasail_profile_t *wide = NULL;
+    int i = 0;
+
+    /* validate inputs */
+    assert(NULL != profile);
+    assert(8 == bits || 16 == bits || 32 == bits || 64 == bits);
+    assert(NULL != copy);
+
+    i = 8 == bits ? 0 : 16 == bits ? 1 : 32 == bits ? 2 : 3;
+    if (NULL == profile->lazy_create[i]) {
+        return profile;
+    }
+
+    /* threads that race to build the width keep the first one built */
+    slot = &((parasail_profile_t*)profile)->lazy[i];
+    wide = profile_publish(slot, NULL);
+    if (NULL == wide) {
+        parasail_profile_t *built = profile->lazy_create[i](
+                profile->s1, profile->s1Len, profile->matrix);
+        wide = profile_publish(slot, built);
+        if (NULL == wide) {
+            wide = built;
+        }
+        else {
+            parasail_profile_free(built);
+        }
+    }
+
+    *copy = *profile;
+    switch (bits) {
+        case 8: copy->profile8 = wide->profile8; break;
+        case 16: copy->profile16 = wide->profile16; break;
+        case 32: copy->profile32 = wide->profile32; break;
+        default: copy->profile64 = wide->profile64; break;
+    }
+    return copy;
+}
+
+void parasail_profile_set_stop(parasail_profile_t *profile, int stop, int mode)
+{
+    const parasail_matrix_t *matrix = NULL;
+    int n = 0;
+    int i = 0;
+    int k = 0;
+
+    /* validate inputs */
+    assert(NULL != profile);
+    assert(NULL != profile->matrix);
+
+    profile->stop = stop;
+    profile->stop_mode = mode;
+    if (!(mode & PARASAIL_STOP_UNREACHABLE)) {
+        return;
+    }
+
+    /* A local alignment pairs each query and each database letter at
+     * most once, so it can score no more than the best non-negative
+     * substitution of every query letter, and the database letters
+     * still ahead can add no more than their own best substitutions. */
+    matrix = profile->matrix;
+    n = matrix->size;
+    if (NULL == profile->stop_gain) {
+        profile->stop_gain = (int*)malloc(sizeof(int)*n);
+        assert(profile->stop_gain);
+    }
+    for (k=0; k<n; ++k) {
+        profile->stop_gain[k] = 0;
+    }
+    profile->stop_bound = 0;
+    for (i=0; i<profile->s1Len; ++i) {
+        int q = matrix->mapper[(unsigned char)profile->s1[i]];
+        int best = 0;
+        for (k=0; k<n; ++k) {
+            int score = matrix->matrix[n*k+q];
+            if (score > profile->stop_gain[k]) {
+                profile->stop_gain[k] = score;
+            }
+            if (score > best) {
+                best = score;
+            }
+        }
+        profile->stop_bound += best;
+    }
+}
+
+void parasail_profile_set_xdrop(parasail_profile_t *profile, int xdrop)
+{
+    /* validate inputs */
+    assert(NULL != profile);
+    assert(xdrop >= 0);
+
+    profile->xdrop = xdrop;
+}
+
+void parasail_profile_set_narrow_tables(parasail_profile_t *profile, int narrow)
+{
+    /* validate inputs */
+    assert(NULL != profile);
+
+    profile->narrow_tables = narrow;
+}
+
+void parasail_profile_set_window(parasail_profile_t *profile,
+        const parasail_window_t *window)
+{
+    /* validate inputs */
+    assert(NULL != profile);
+
+    if (NULL == window) {
+        profile->window.query_begin = 0;
+        profile->window.query_end = 0;
+        profile->window.ref_begin = 0;
+        profile->window.ref_end = 0;
+        return;
+    }
+
+    assert(window->query_begin < window->query_end);
+    assert(window->ref_begin < window->ref_end);
+
+    profile->window = *window;
+    if (profile->window.query_end > profile->s1Len) {
+        profile->window.query_end = profile->s1Len;
+    }
+}
+
+parasail_window_t parasail_window_around(const parasail_result_t *result,
+        int s1Len, int s2Len, int radius)
+{
+    parasail_window_t window;
+
+    /* validate inputs */
+    assert(NULL != result);
+    assert(s1Len > 0);
+    assert(s2Len > 0);
+    assert(radius >= 0);
+
+    window.query_begin = result->end_query - radius;
+    window.query_end = result->end_query + radius + 1;
+    window.ref_begin = result->end_ref - radius;
+    window.ref_end = result->end_ref + radius + 1;
+    if (window.query_begin < 0) window.query_begin = 0;
+    if (window.query_end > s1Len) window.query_end = s1Len;
+    if (window.ref_begin < 0) window.ref_begin = 0;
+    if (window.ref_end > s2Len) window.ref_end = s2Len;
+
+    return window;
+}
+
 char* parasail_reverse(const char *s, int length)
 {
     char *r = NULL;
@@ -477,3 +982,140 @@ char* parasail_reverse(const char *s, int length)
     return r;
 }
 
+/* Query letters in the striped order of the profiles, lane segNum of
+ * vector i holding position i + segNum*segLen. The positions past
+ * s1Len index the zero that ends each row of parasail_profile_row. */
+int32_t* parasail_striped_query(const char *s1, const int s1Len,
+        const parasail_matrix_t *matrix, const int32_t segWidth)
+{
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    int32_t *query = NULL;
+    int32_t i = 0;
+    int32_t segNum = 0;
+
+    query = (int32_t*)malloc(sizeof(int32_t)*segLen*segWidth);
+    assert(query);
+    for (i=0; i<segLen; ++i) {
+        int32_t j = i;
+        for (segNum=0; segNum<segWidth; ++segNum) {
+            query[i*segWidth+segNum] = j >= s1Len ? matrix->size
+                : matrix->mapper[(unsigned char)s1[j]];
+            j += segLen;
+        }
+    }
+
+    return query;
+}
+
+/* A profile of the leading queries of s1s whose lengths sum to at most
+ * lanes, or NULL if the first alone is longer; the vectors are left to
+ * the caller. */
+parasail_profile_t* parasail_profile_new_packed(
+        const char * const * s1s, const int * s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix, const int32_t lanes)
+{
+    parasail_profile_t *profile = NULL;
+    int count = 0;
+    int total = 0;
+
+    /* validate inputs */
+    assert(s1s);
+    assert(s1Lens);
+    assert(s1Count > 0);
+    assert(s1Lens[0] > 0);
+
+    if (s1Lens[0] > lanes) {
+        return NULL;
+    }
+
+    while (count < s1Count && total + s1Lens[count] <= lanes) {
+        assert(s1Lens[count] > 0);
+        total += s1Lens[count++];
+    }
+
+    profile = parasail_profile_new(NULL, total, matrix);
+    profile->layout = PARASAIL_LAYOUT_PACKED;
+    profile->packed_count = count;
+    profile->packed_begin = (int*)malloc(sizeof(int)*(count+1));
+    profile->packed_s1 = (const char**)malloc(sizeof(const char*)*count);
+    assert(profile->packed_begin);
+    assert(profile->packed_s1);
+    profile->packed_begin[0] = 0;
+    for (count=0; count<profile->packed_count; ++count) {
+        profile->packed_begin[count+1] = profile->packed_begin[count]
+            + s1Lens[count];
+        profile->packed_s1[count] = s1s[count];
+    }
+
+    return profile;
+}
+
+/* Query letters of a packed profile, one lane each, the segWidth
+ * lanes past the last query indexing the zero that ends each row. */
+int32_t* parasail_packed_query(const parasail_profile_t *profile,
+        const int32_t segWidth)
+{
+    const parasail_matrix_t *matrix = profile->matrix;
+    int32_t *query = NULL;
+    int32_t i = 0;
+    int q = 0;
+
+    query = (int32_t*)malloc(sizeof(int32_t)*segWidth);
+    assert(query);
+    for (i=0; i<segWidth; ++i) {
+        query[i] = matrix->size;
+    }
+    for (q=0; q<profile->packed_count; ++q) {
+        const char *s1 = profile->packed_s1[q];
+        for (i=profile->packed_begin[q]; i<profile->packed_begin[q+1]; ++i) {
+            query[i] = matrix->mapper[
+                (unsigned char)s1[i-profile->packed_begin[q]]];
+        }
+    }
+
+    return query;
+}
+
+/* Query letters in the blocked order of the blocked profiles, lane
+ * segNum of vector i holding position i*segWidth + segNum. */
+int32_t* parasail_blocked_query(const char *s1, const int s1Len,
+        const parasail_matrix_t *matrix, const int32_t segWidth)
+{
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    int32_t *query = NULL;
+    int32_t i = 0;
+
+    query = (int32_t*)malloc(sizeof(int32_t)*segLen*segWidth);
+    assert(query);
+    for (i=0; i<segLen*segWidth; ++i) {
+        query[i] = i >= s1Len ? matrix->size
+            : matrix->mapper[(unsigned char)s1[i]];
+    }
+
+    return query;
+}
+
+/* Row k of the score profile by query letter, matrix->size+1 entries
+ * long and ending in a zero, followed by the rows of the matches and
+ * similar profiles when stats is set. */
+void parasail_profile_row(int32_t *rows,
+        const parasail_matrix_t *matrix, const int32_t k, const int stats)
+{
+    const int32_t n = matrix->size;
+    int32_t *score = rows;
+    int32_t *matches = rows + (n+1);
+    int32_t *similar = rows + 2*(n+1);
+    int32_t q = 0;
+
+    for (q=0; q<n; ++q) {
+        score[q] = matrix->matrix[n*k+q];
+    }
+    score[n] = 0;
+    if (!stats) {
+        return;
+    }
+    for (q=0; q<=n; ++q) {
+        matches[q] = k == q;
+        similar[q] = score[q] > 0;
+    }
+}
@@ -17,6 +17,11 @@ __m256i * parasail_memalign___m256i(size_t alignment, size_t size)
     return (__m256i *) parasail_memalign(alignment, size*sizeof(__m256i));
 }
 
+__m256i * parasail_workspace___m256i(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (__m256i *) parasail_workspace_reserve(workspace, slot, size*sizeof(__m256i));
+}
+
 void parasail_memset___m256i(__m256i *b, __m256i c, size_t len)
 {
     size_t i;
@@ -25,35 +30,106 @@ void parasail_memset___m256i(__m256i *b, __m256i c, size_t len)
     }
 }
 
+/* The profile_row functions fill the segLen vectors of one row of a
+ * profile, gathering row, a row of parasail_profile_row, at the letters
+ * of query, from parasail_striped_query. */
+
+static inline __m256i profile_gather(
+        const int32_t * const restrict row,
+        const int32_t * const restrict query)
+{
+    return _mm256_i32gather_epi32(row,
+            _mm256_loadu_si256((const __m256i*)query), 4);
+}
+
+static void profile_row_avx_256_8(
+        __m256i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    /* packing works within 128 bit lanes; put the dwords back in order */
+    const __m256i vOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int32_t i = 0;
+
+    for (i=0; i<segLen; ++i) {
+        const int32_t *q = query + 32*i;
+        __m256i vAB = _mm256_packs_epi32(
+                profile_gather(row, q), profile_gather(row, q+8));
+        __m256i vCD = _mm256_packs_epi32(
+                profile_gather(row, q+16), profile_gather(row, q+24));
+        __m256i v = _mm256_packs_epi16(vAB, vCD);
+        _mm256_store_si256(vProfile+i, _mm256_permutevar8x32_epi32(v, vOrder));
+    }
+}
+
+static void profile_row_avx_256_16(
+        __m256i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    int32_t i = 0;
+
+    for (i=0; i<segLen; ++i) {
+        const int32_t *q = query + 16*i;
+        __m256i v = _mm256_packs_epi32(
+                profile_gather(row, q), profile_gather(row, q+8));
+        _mm256_store_si256(vProfile+i, _mm256_permute4x64_epi64(v, 0xD8));
+    }
+}
+
+static void profile_row_avx_256_32(
+        __m256i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    int32_t i = 0;
+
+    for (i=0; i<segLen; ++i) {
+        _mm256_store_si256(vProfile+i, profile_gather(row, query + 8*i));
+    }
+}
+
+static void profile_row_avx_256_64(
+        __m256i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    int32_t i = 0;
+
+    for (i=0; i<segLen; ++i) {
+        __m128i v = _mm_i32gather_epi32(row,
+                _mm_loadu_si128((const __m128i*)(query + 4*i)), 4);
+        _mm256_store_si256(vProfile+i, _mm256_cvtepi32_epi64(v));
+    }
+}
+
 parasail_profile_t * parasail_profile_create_avx_256_8(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 32; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_8_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_8(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile8.score = vProfile;
     profile->free = &parasail_free___m256i;
     return profile;
@@ -63,31 +139,25 @@ parasail_profile_t * parasail_profile_create_avx_256_16(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 16; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_16_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_16(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile16.score = vProfile;
     profile->free = &parasail_free___m256i;
     return profile;
@@ -97,31 +167,25 @@ parasail_profile_t * parasail_profile_create_avx_256_32(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 8; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_32_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_32(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile32.score = vProfile;
     profile->free = &parasail_free___m256i;
     return profile;
@@ -131,31 +195,25 @@ parasail_profile_t * parasail_profile_create_avx_256_64(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 4; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_64_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_64(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile64.score = vProfile;
     profile->free = &parasail_free___m256i;
     return profile;
@@ -165,54 +223,42 @@ parasail_profile_t* parasail_profile_create_avx_256_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile8 = parasail_profile_create_avx_256_8(s1, s1Len, matrix);
-    parasail_profile_t *profile16 = parasail_profile_create_avx_256_16(s1, s1Len, matrix);
-    parasail_profile_t *profile32 = parasail_profile_create_avx_256_32(s1, s1Len, matrix);
-    profile8->profile16 = profile16->profile16;
-    profile8->profile32 = profile32->profile32;
-    free(profile16);
-    free(profile32);
-
-    return profile8;
+    parasail_profile_t *profile = parasail_profile_create_avx_256_8(s1, s1Len, matrix);
+
+    /* most alignments fit in 8 bits; see parasail_profile_width */
+    profile->lazy_create[1] = parasail_profile_create_avx_256_16;
+    profile->lazy_create[2] = parasail_profile_create_avx_256_32;
+
+    return profile;
 }
 
 parasail_profile_t * parasail_profile_create_stats_avx_256_8(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 32; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileM = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileS = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_8_t p;
-            __m256i_8_t m;
-            __m256i_8_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], p.m);
-            _mm256_store_si256(&vProfileM[index], m.m);
-            _mm256_store_si256(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_avx_256_8(vProfile + k*segLen, rows, query, segLen);
+        profile_row_avx_256_8(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_avx_256_8(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile8.score = vProfile;
     profile->profile8.matches = vProfileM;
     profile->profile8.similar = vProfileS;
@@ -224,39 +270,29 @@ parasail_profile_t * parasail_profile_create_stats_avx_256_16(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 16; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileM = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileS = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_16_t p;
-            __m256i_16_t m;
-            __m256i_16_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], p.m);
-            _mm256_store_si256(&vProfileM[index], m.m);
-            _mm256_store_si256(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_avx_256_16(vProfile + k*segLen, rows, query, segLen);
+        profile_row_avx_256_16(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_avx_256_16(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile16.score = vProfile;
     profile->profile16.matches = vProfileM;
     profile->profile16.similar = vProfileS;
@@ -268,39 +304,29 @@ parasail_profile_t * parasail_profile_create_stats_avx_256_32(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 8; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileM = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileS = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_32_t p;
-            __m256i_32_t m;
-            __m256i_32_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], p.m);
-            _mm256_store_si256(&vProfileM[index], m.m);
-            _mm256_store_si256(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_avx_256_32(vProfile + k*segLen, rows, query, segLen);
+        profile_row_avx_256_32(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_avx_256_32(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile32.score = vProfile;
     profile->profile32.matches = vProfileM;
     profile->profile32.similar = vProfileS;
@@ -312,39 +338,29 @@ parasail_profile_t * parasail_profile_create_stats_avx_256_64(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 4; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileM = parasail_memalign___m256i(32, n * segLen);
     __m256i* const restrict vProfileS = parasail_memalign___m256i(32, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m256i_64_t p;
-            __m256i_64_t m;
-            __m256i_64_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm256_store_si256(&vProfile[index], p.m);
-            _mm256_store_si256(&vProfileM[index], m.m);
-            _mm256_store_si256(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_avx_256_64(vProfile + k*segLen, rows, query, segLen);
+        profile_row_avx_256_64(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_avx_256_64(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile64.score = vProfile;
     profile->profile64.matches = vProfileM;
     profile->profile64.similar = vProfileS;
@@ -356,15 +372,137 @@ parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile8 = parasail_profile_create_stats_avx_256_8(s1, s1Len, matrix);
-    parasail_profile_t *profile16 = parasail_profile_create_stats_avx_256_16(s1, s1Len, matrix);
-    parasail_profile_t *profile32 = parasail_profile_create_stats_avx_256_32(s1, s1Len, matrix);
-    profile8->profile16 = profile16->profile16;
-    profile8->profile32 = profile32->profile32;
-    free(profile16);
-    free(profile32);
-
-    return profile8;
+    parasail_profile_t *profile = parasail_profile_create_stats_avx_256_8(s1, s1Len, matrix);
+
+    /* most alignments fit in 8 bits; see parasail_profile_width */
+    profile->lazy_create[1] = parasail_profile_create_stats_avx_256_16;
+    profile->lazy_create[2] = parasail_profile_create_stats_avx_256_32;
+
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_blocked_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
+    int32_t * const restrict query = parasail_blocked_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_BLOCKED;
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_16(vProfile + k*segLen, rows, query, segLen);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile16.score = vProfile;
+    profile->free = &parasail_free___m256i;
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_blocked_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    __m256i* const restrict vProfile = parasail_memalign___m256i(32, n * segLen);
+    int32_t * const restrict query = parasail_blocked_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m256i);
+    profile->layout = PARASAIL_LAYOUT_BLOCKED;
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_32(vProfile + k*segLen, rows, query, segLen);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile32.score = vProfile;
+    profile->free = &parasail_free___m256i;
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_packed_avx_256_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    __m256i* restrict vProfile = NULL;
+    int32_t * restrict rows = NULL;
+    int32_t * restrict query = NULL;
+    parasail_profile_t *profile = parasail_profile_new_packed(
+            s1s, s1Lens, s1Count, matrix, segWidth);
+
+    if (NULL == profile) {
+        return NULL;
+    }
+    vProfile = parasail_memalign___m256i(32, n);
+    rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+    query = parasail_packed_query(profile, segWidth);
+    profile->vector_bytes = sizeof(__m256i);
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_16(vProfile + k, rows, query, 1);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile16.score = vProfile;
+    profile->free = &parasail_free___m256i;
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_packed_avx_256_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    __m256i* restrict vProfile = NULL;
+    int32_t * restrict rows = NULL;
+    int32_t * restrict query = NULL;
+    parasail_profile_t *profile = parasail_profile_new_packed(
+            s1s, s1Lens, s1Count, matrix, segWidth);
+
+    if (NULL == profile) {
+        return NULL;
+    }
+    vProfile = parasail_memalign___m256i(32, n);
+    rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+    query = parasail_packed_query(profile, segWidth);
+    profile->vector_bytes = sizeof(__m256i);
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_avx_256_8(vProfile + k, rows, query, 1);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile8.score = vProfile;
+    profile->free = &parasail_free___m256i;
+    return profile;
 }
 
 void parasail_free___m256i(void *ptr)
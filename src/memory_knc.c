@@ -17,6 +17,11 @@ __m512i * parasail_memalign___m512i(size_t alignment, size_t size)
     return (__m512i *) parasail_memalign(alignment, size*sizeof(__m512i));
 }
 
+__m512i * parasail_workspace___m512i(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (__m512i *) parasail_workspace_reserve(workspace, slot, size*sizeof(__m512i));
+}
+
 void parasail_memset___m512i(__m512i *b, __m512i c, size_t len)
 {
     size_t i;
@@ -40,6 +45,8 @@ parasail_profile_t * parasail_profile_create_knc_512_32(
     int32_t index = 0;
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m512i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
         for (i=0; i<segLen; ++i) {
@@ -76,6 +83,8 @@ parasail_profile_t * parasail_profile_create_stats_knc_512_32(
     int32_t index = 0;
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m512i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
         for (i=0; i<segLen; ++i) {
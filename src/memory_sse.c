@@ -17,6 +17,11 @@ __m128i * parasail_memalign___m128i(size_t alignment, size_t size)
     return (__m128i *) parasail_memalign(alignment, size*sizeof(__m128i));
 }
 
+__m128i * parasail_workspace___m128i(parasail_workspace_t *workspace, int slot, size_t size)
+{
+    return (__m128i *) parasail_workspace_reserve(workspace, slot, size*sizeof(__m128i));
+}
+
 void parasail_memset___m128i(__m128i *b, __m128i c, size_t len)
 {
     size_t i;
@@ -25,35 +30,90 @@ void parasail_memset___m128i(__m128i *b, __m128i c, size_t len)
     }
 }
 
+/* The profile_row functions fill the segLen vectors of one row of a
+ * profile, looking up row, a row of parasail_profile_row, at the
+ * letters of query, from parasail_striped_query. SSE2 has no gather,
+ * but the lanes are written in place rather than through a union. */
+
+static void profile_row_sse_128_8(
+        __m128i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    int8_t * const restrict t = (int8_t*)vProfile;
+    int32_t i = 0;
+
+    for (i=0; i<segLen*16; ++i) {
+        t[i] = (int8_t)row[query[i]];
+    }
+}
+
+static void profile_row_sse_128_16(
+        __m128i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    int16_t * const restrict t = (int16_t*)vProfile;
+    int32_t i = 0;
+
+    for (i=0; i<segLen*8; ++i) {
+        t[i] = (int16_t)row[query[i]];
+    }
+}
+
+static void profile_row_sse_128_32(
+        __m128i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    int32_t * const restrict t = (int32_t*)vProfile;
+    int32_t i = 0;
+
+    for (i=0; i<segLen*4; ++i) {
+        t[i] = (int32_t)row[query[i]];
+    }
+}
+
+static void profile_row_sse_128_64(
+        __m128i * const restrict vProfile,
+        const int32_t * const restrict row,
+        const int32_t * const restrict query,
+        const int32_t segLen)
+{
+    int64_t * const restrict t = (int64_t*)vProfile;
+    int32_t i = 0;
+
+    for (i=0; i<segLen*2; ++i) {
+        t[i] = (int64_t)row[query[i]];
+    }
+}
+
 parasail_profile_t * parasail_profile_create_sse_128_8(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 16; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_8_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_8(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile8.score = vProfile;
     profile->free = &parasail_free___m128i;
     return profile;
@@ -63,31 +123,25 @@ parasail_profile_t * parasail_profile_create_sse_128_16(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 8; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_16_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_16(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile16.score = vProfile;
     profile->free = &parasail_free___m128i;
     return profile;
@@ -97,31 +151,25 @@ parasail_profile_t * parasail_profile_create_sse_128_32(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 4; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_32_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_32(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile32.score = vProfile;
     profile->free = &parasail_free___m128i;
     return profile;
@@ -131,31 +179,25 @@ parasail_profile_t * parasail_profile_create_sse_128_64(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 2; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_64_t t;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], t.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_64(vProfile + k*segLen, rows, query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile64.score = vProfile;
     profile->free = &parasail_free___m128i;
     return profile;
@@ -165,54 +207,42 @@ parasail_profile_t* parasail_profile_create_sse_128_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile8 = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
-    parasail_profile_t *profile16 = parasail_profile_create_sse_128_16(s1, s1Len, matrix);
-    parasail_profile_t *profile32 = parasail_profile_create_sse_128_32(s1, s1Len, matrix);
-    profile8->profile16 = profile16->profile16;
-    profile8->profile32 = profile32->profile32;
-    free(profile16);
-    free(profile32);
-
-    return profile8;
+    parasail_profile_t *profile = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
+
+    /* most alignments fit in 8 bits; see parasail_profile_width */
+    profile->lazy_create[1] = parasail_profile_create_sse_128_16;
+    profile->lazy_create[2] = parasail_profile_create_sse_128_32;
+
+    return profile;
 }
 
 parasail_profile_t * parasail_profile_create_stats_sse_128_8(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 16; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileM = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileS = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_8_t p;
-            __m128i_8_t m;
-            __m128i_8_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], p.m);
-            _mm_store_si128(&vProfileM[index], m.m);
-            _mm_store_si128(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_sse_128_8(vProfile + k*segLen, rows, query, segLen);
+        profile_row_sse_128_8(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_sse_128_8(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile8.score = vProfile;
     profile->profile8.matches = vProfileM;
     profile->profile8.similar = vProfileS;
@@ -224,39 +254,29 @@ parasail_profile_t * parasail_profile_create_stats_sse_128_16(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 8; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileM = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileS = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_16_t p;
-            __m128i_16_t m;
-            __m128i_16_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], p.m);
-            _mm_store_si128(&vProfileM[index], m.m);
-            _mm_store_si128(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_sse_128_16(vProfile + k*segLen, rows, query, segLen);
+        profile_row_sse_128_16(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_sse_128_16(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile16.score = vProfile;
     profile->profile16.matches = vProfileM;
     profile->profile16.similar = vProfileS;
@@ -268,39 +288,29 @@ parasail_profile_t * parasail_profile_create_stats_sse_128_32(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 4; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileM = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileS = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_32_t p;
-            __m128i_32_t m;
-            __m128i_32_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], p.m);
-            _mm_store_si128(&vProfileM[index], m.m);
-            _mm_store_si128(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_sse_128_32(vProfile + k*segLen, rows, query, segLen);
+        profile_row_sse_128_32(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_sse_128_32(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile32.score = vProfile;
     profile->profile32.matches = vProfileM;
     profile->profile32.similar = vProfileS;
@@ -312,39 +322,29 @@ parasail_profile_t * parasail_profile_create_stats_sse_128_64(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
     const int32_t n = matrix->size; /* number of amino acids in table */
     const int32_t segWidth = 2; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileM = parasail_memalign___m128i(16, n * segLen);
     __m128i* const restrict vProfileS = parasail_memalign___m128i(16, n * segLen);
-    int32_t index = 0;
+    int32_t * const restrict query = parasail_striped_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*3*(n+1));
 
     parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_STRIPED;
 
     for (k=0; k<n; ++k) {
-        for (i=0; i<segLen; ++i) {
-            __m128i_64_t p;
-            __m128i_64_t m;
-            __m128i_64_t s;
-            j = i;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                p.v[segNum] = j >= s1Len ? 0 : matrix->matrix[n*k+matrix->mapper[(unsigned char)s1[j]]];
-                m.v[segNum] = j >= s1Len ? 0 : (k == matrix->mapper[(unsigned char)s1[j]]);
-                s.v[segNum] = p.v[segNum] > 0;
-                j += segLen;
-            }
-            _mm_store_si128(&vProfile[index], p.m);
-            _mm_store_si128(&vProfileM[index], m.m);
-            _mm_store_si128(&vProfileS[index], s.m);
-            ++index;
-        }
+        parasail_profile_row(rows, matrix, k, 1);
+        profile_row_sse_128_64(vProfile + k*segLen, rows, query, segLen);
+        profile_row_sse_128_64(vProfileM + k*segLen, rows + (n+1), query, segLen);
+        profile_row_sse_128_64(vProfileS + k*segLen, rows + 2*(n+1), query, segLen);
     }
 
+    free(rows);
+    free(query);
     profile->profile64.score = vProfile;
     profile->profile64.matches = vProfileM;
     profile->profile64.similar = vProfileS;
@@ -356,15 +356,137 @@ parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile8 = parasail_profile_create_stats_sse_128_8(s1, s1Len, matrix);
-    parasail_profile_t *profile16 = parasail_profile_create_stats_sse_128_16(s1, s1Len, matrix);
-    parasail_profile_t *profile32 = parasail_profile_create_stats_sse_128_32(s1, s1Len, matrix);
-    profile8->profile16 = profile16->profile16;
-    profile8->profile32 = profile32->profile32;
-    free(profile16);
-    free(profile32);
-
-    return profile8;
+    parasail_profile_t *profile = parasail_profile_create_stats_sse_128_8(s1, s1Len, matrix);
+
+    /* most alignments fit in 8 bits; see parasail_profile_width */
+    profile->lazy_create[1] = parasail_profile_create_stats_sse_128_16;
+    profile->lazy_create[2] = parasail_profile_create_stats_sse_128_32;
+
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_blocked_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
+    int32_t * const restrict query = parasail_blocked_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_BLOCKED;
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_16(vProfile + k*segLen, rows, query, segLen);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile16.score = vProfile;
+    profile->free = &parasail_free___m128i;
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_blocked_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 4; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
+    int32_t * const restrict query = parasail_blocked_query(s1, s1Len, matrix, segWidth);
+    int32_t * const restrict rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    profile->vector_bytes = sizeof(__m128i);
+    profile->layout = PARASAIL_LAYOUT_BLOCKED;
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_32(vProfile + k*segLen, rows, query, segLen);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile32.score = vProfile;
+    profile->free = &parasail_free___m128i;
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_packed_sse_128_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    __m128i* restrict vProfile = NULL;
+    int32_t * restrict rows = NULL;
+    int32_t * restrict query = NULL;
+    parasail_profile_t *profile = parasail_profile_new_packed(
+            s1s, s1Lens, s1Count, matrix, segWidth);
+
+    if (NULL == profile) {
+        return NULL;
+    }
+    vProfile = parasail_memalign___m128i(16, n);
+    rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+    query = parasail_packed_query(profile, segWidth);
+    profile->vector_bytes = sizeof(__m128i);
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_16(vProfile + k, rows, query, 1);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile16.score = vProfile;
+    profile->free = &parasail_free___m128i;
+    return profile;
+}
+
+parasail_profile_t * parasail_profile_create_packed_sse_128_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+    int32_t k = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    __m128i* restrict vProfile = NULL;
+    int32_t * restrict rows = NULL;
+    int32_t * restrict query = NULL;
+    parasail_profile_t *profile = parasail_profile_new_packed(
+            s1s, s1Lens, s1Count, matrix, segWidth);
+
+    if (NULL == profile) {
+        return NULL;
+    }
+    vProfile = parasail_memalign___m128i(16, n);
+    rows = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+    query = parasail_packed_query(profile, segWidth);
+    profile->vector_bytes = sizeof(__m128i);
+
+    for (k=0; k<n; ++k) {
+        parasail_profile_row(rows, matrix, k, 0);
+        profile_row_sse_128_8(vProfile + k, rows, query, 1);
+    }
+
+    free(rows);
+    free(query);
+    profile->profile8.score = vProfile;
+    profile->free = &parasail_free___m128i;
+    return profile;
 }
 
 void parasail_free___m128i(void *ptr)
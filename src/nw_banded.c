@@ -83,6 +83,11 @@ parasail_result_t* ENAME(
         }
     }
 #endif
+#ifdef PARASAIL_ROWCOL
+    /* cells outside of the band are reported as 0 */
+    parasail_memset_int(result->score_row, 0, s2Len);
+    parasail_memset_int(result->score_col, 0, s1Len);
+#endif
 
     /* initialize H */
     /* initialize E */
@@ -130,6 +135,14 @@ parasail_result_t* ENAME(
             H[i] = MAX(H[i], H_dag);
 #ifdef PARASAIL_TABLE
             result->score_table[pos*s2Len + j] = H[i];
+#endif
+#ifdef PARASAIL_ROWCOL
+            if (pos == s1Len-1) {
+                result->score_row[j] = H[i];
+            }
+            if (j == s2Len-1) {
+                result->score_col[pos] = H[i];
+            }
 #endif
         }
         colOff += 1;
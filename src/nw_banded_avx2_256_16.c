@@ -0,0 +1,507 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF INT16_MIN
+
+#define _mm256_cmplt_epi16_rpl(a,b) _mm256_cmpgt_epi16(b,a)
+
+#if HAVE_AVX2_MM256_INSERT_EPI16
+#define _mm256_insert_epi16_rpl _mm256_insert_epi16
+#else
+static inline __m256i _mm256_insert_epi16_rpl(__m256i a, int16_t i, int imm) {
+    __m256i_16_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+#endif
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI16
+#define _mm256_extract_epi16_rpl _mm256_extract_epi16
+#else
+static inline int16_t _mm256_extract_epi16_rpl(__m256i a, int imm) {
+    __m256i_16_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#define _mm256_srli_si256_rpl(a,imm) _mm256_or_si256(_mm256_slli_si256(_mm256_permute2x128_si256(a, a, _MM_SHUFFLE(3,0,0,1)), 16-imm), _mm256_srli_si256(a, imm))
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si256(
+        int *array,
+        __m256i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (0 <= i+0 && i+0 < s1Len && 0 <= j-0 && j-0 < s2Len) {
+        array[(i+0)*s2Len + (j-0)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 15);
+    }
+    if (0 <= i+1 && i+1 < s1Len && 0 <= j-1 && j-1 < s2Len) {
+        array[(i+1)*s2Len + (j-1)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 14);
+    }
+    if (0 <= i+2 && i+2 < s1Len && 0 <= j-2 && j-2 < s2Len) {
+        array[(i+2)*s2Len + (j-2)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 13);
+    }
+    if (0 <= i+3 && i+3 < s1Len && 0 <= j-3 && j-3 < s2Len) {
+        array[(i+3)*s2Len + (j-3)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 12);
+    }
+    if (0 <= i+4 && i+4 < s1Len && 0 <= j-4 && j-4 < s2Len) {
+        array[(i+4)*s2Len + (j-4)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 11);
+    }
+    if (0 <= i+5 && i+5 < s1Len && 0 <= j-5 && j-5 < s2Len) {
+        array[(i+5)*s2Len + (j-5)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 10);
+    }
+    if (0 <= i+6 && i+6 < s1Len && 0 <= j-6 && j-6 < s2Len) {
+        array[(i+6)*s2Len + (j-6)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 9);
+    }
+    if (0 <= i+7 && i+7 < s1Len && 0 <= j-7 && j-7 < s2Len) {
+        array[(i+7)*s2Len + (j-7)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 8);
+    }
+    if (0 <= i+8 && i+8 < s1Len && 0 <= j-8 && j-8 < s2Len) {
+        array[(i+8)*s2Len + (j-8)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 7);
+    }
+    if (0 <= i+9 && i+9 < s1Len && 0 <= j-9 && j-9 < s2Len) {
+        array[(i+9)*s2Len + (j-9)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 6);
+    }
+    if (0 <= i+10 && i+10 < s1Len && 0 <= j-10 && j-10 < s2Len) {
+        array[(i+10)*s2Len + (j-10)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 5);
+    }
+    if (0 <= i+11 && i+11 < s1Len && 0 <= j-11 && j-11 < s2Len) {
+        array[(i+11)*s2Len + (j-11)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 4);
+    }
+    if (0 <= i+12 && i+12 < s1Len && 0 <= j-12 && j-12 < s2Len) {
+        array[(i+12)*s2Len + (j-12)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 3);
+    }
+    if (0 <= i+13 && i+13 < s1Len && 0 <= j-13 && j-13 < s2Len) {
+        array[(i+13)*s2Len + (j-13)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 2);
+    }
+    if (0 <= i+14 && i+14 < s1Len && 0 <= j-14 && j-14 < s2Len) {
+        array[(i+14)*s2Len + (j-14)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 1);
+    }
+    if (0 <= i+15 && i+15 < s1Len && 0 <= j-15 && j-15 < s2Len) {
+        array[(i+15)*s2Len + (j-15)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_rowcol(
+        int *row,
+        int *col,
+        __m256i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (i+0 == s1Len-1 && 0 <= j-0 && j-0 < s2Len) {
+        row[j-0] = (int16_t)_mm256_extract_epi16_rpl(vWH, 15);
+    }
+    if (j-0 == s2Len-1 && 0 <= i+0 && i+0 < s1Len) {
+        col[(i+0)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 15);
+    }
+    if (i+1 == s1Len-1 && 0 <= j-1 && j-1 < s2Len) {
+        row[j-1] = (int16_t)_mm256_extract_epi16_rpl(vWH, 14);
+    }
+    if (j-1 == s2Len-1 && 0 <= i+1 && i+1 < s1Len) {
+        col[(i+1)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 14);
+    }
+    if (i+2 == s1Len-1 && 0 <= j-2 && j-2 < s2Len) {
+        row[j-2] = (int16_t)_mm256_extract_epi16_rpl(vWH, 13);
+    }
+    if (j-2 == s2Len-1 && 0 <= i+2 && i+2 < s1Len) {
+        col[(i+2)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 13);
+    }
+    if (i+3 == s1Len-1 && 0 <= j-3 && j-3 < s2Len) {
+        row[j-3] = (int16_t)_mm256_extract_epi16_rpl(vWH, 12);
+    }
+    if (j-3 == s2Len-1 && 0 <= i+3 && i+3 < s1Len) {
+        col[(i+3)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 12);
+    }
+    if (i+4 == s1Len-1 && 0 <= j-4 && j-4 < s2Len) {
+        row[j-4] = (int16_t)_mm256_extract_epi16_rpl(vWH, 11);
+    }
+    if (j-4 == s2Len-1 && 0 <= i+4 && i+4 < s1Len) {
+        col[(i+4)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 11);
+    }
+    if (i+5 == s1Len-1 && 0 <= j-5 && j-5 < s2Len) {
+        row[j-5] = (int16_t)_mm256_extract_epi16_rpl(vWH, 10);
+    }
+    if (j-5 == s2Len-1 && 0 <= i+5 && i+5 < s1Len) {
+        col[(i+5)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 10);
+    }
+    if (i+6 == s1Len-1 && 0 <= j-6 && j-6 < s2Len) {
+        row[j-6] = (int16_t)_mm256_extract_epi16_rpl(vWH, 9);
+    }
+    if (j-6 == s2Len-1 && 0 <= i+6 && i+6 < s1Len) {
+        col[(i+6)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 9);
+    }
+    if (i+7 == s1Len-1 && 0 <= j-7 && j-7 < s2Len) {
+        row[j-7] = (int16_t)_mm256_extract_epi16_rpl(vWH, 8);
+    }
+    if (j-7 == s2Len-1 && 0 <= i+7 && i+7 < s1Len) {
+        col[(i+7)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 8);
+    }
+    if (i+8 == s1Len-1 && 0 <= j-8 && j-8 < s2Len) {
+        row[j-8] = (int16_t)_mm256_extract_epi16_rpl(vWH, 7);
+    }
+    if (j-8 == s2Len-1 && 0 <= i+8 && i+8 < s1Len) {
+        col[(i+8)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 7);
+    }
+    if (i+9 == s1Len-1 && 0 <= j-9 && j-9 < s2Len) {
+        row[j-9] = (int16_t)_mm256_extract_epi16_rpl(vWH, 6);
+    }
+    if (j-9 == s2Len-1 && 0 <= i+9 && i+9 < s1Len) {
+        col[(i+9)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 6);
+    }
+    if (i+10 == s1Len-1 && 0 <= j-10 && j-10 < s2Len) {
+        row[j-10] = (int16_t)_mm256_extract_epi16_rpl(vWH, 5);
+    }
+    if (j-10 == s2Len-1 && 0 <= i+10 && i+10 < s1Len) {
+        col[(i+10)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 5);
+    }
+    if (i+11 == s1Len-1 && 0 <= j-11 && j-11 < s2Len) {
+        row[j-11] = (int16_t)_mm256_extract_epi16_rpl(vWH, 4);
+    }
+    if (j-11 == s2Len-1 && 0 <= i+11 && i+11 < s1Len) {
+        col[(i+11)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 4);
+    }
+    if (i+12 == s1Len-1 && 0 <= j-12 && j-12 < s2Len) {
+        row[j-12] = (int16_t)_mm256_extract_epi16_rpl(vWH, 3);
+    }
+    if (j-12 == s2Len-1 && 0 <= i+12 && i+12 < s1Len) {
+        col[(i+12)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 3);
+    }
+    if (i+13 == s1Len-1 && 0 <= j-13 && j-13 < s2Len) {
+        row[j-13] = (int16_t)_mm256_extract_epi16_rpl(vWH, 2);
+    }
+    if (j-13 == s2Len-1 && 0 <= i+13 && i+13 < s1Len) {
+        col[(i+13)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 2);
+    }
+    if (i+14 == s1Len-1 && 0 <= j-14 && j-14 < s2Len) {
+        row[j-14] = (int16_t)_mm256_extract_epi16_rpl(vWH, 1);
+    }
+    if (j-14 == s2Len-1 && 0 <= i+14 && i+14 < s1Len) {
+        col[(i+14)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 1);
+    }
+    if (i+15 == s1Len-1 && 0 <= j-15 && j-15 < s2Len) {
+        row[j-15] = (int16_t)_mm256_extract_epi16_rpl(vWH, 0);
+    }
+    if (j-15 == s2Len-1 && 0 <= i+15 && i+15 < s1Len) {
+        col[(i+15)] = (int16_t)_mm256_extract_epi16_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_banded_avx2_256_16
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_banded_avx2_256_16
+#else
+#define FNAME parasail_nw_banded_avx2_256_16
+#endif
+#endif
+
+/* floor(x/2), also for negative x */
+static inline int32_t half_floor(int32_t x)
+{
+    return x >= 0 ? x/2 : -((1-x)/2);
+}
+
+static inline int16_t clamp(int64_t x)
+{
+    return x < NEG_INF ? NEG_INF : (int16_t)x;
+}
+
+/* Same anti-diagonal wavefront as the diag kernels, but each stripe of
+ * N query rows only visits the database columns that intersect the
+ * band, and cells outside the band are forced to NEG_INF. */
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    /* diagonals (row minus column) inside the band, same as the band
+     * computed by parasail_nw_banded */
+    const int32_t dlo = s1Len > s2Len ? -k : s1Len - s2Len - k;
+    const int32_t dhi = s1Len > s2Len ? s1Len - s2Len + k : k;
+    int16_t * const restrict s1 = parasail_memalign_int16_t(32, s1Len+PAD);
+    int16_t * const restrict s2B= parasail_memalign_int16_t(32, s2Len+PAD2);
+    int16_t * const restrict _H_pr = parasail_memalign_int16_t(32, s2Len+PAD2);
+    int16_t * const restrict _F_pr = parasail_memalign_int16_t(32, s2Len+PAD2);
+    __m256i * const restrict vLanes = parasail_memalign___m256i(32, N+1);
+    int16_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int16_t * const restrict H_pr = _H_pr+PAD;
+    int16_t * const restrict F_pr = _F_pr+PAD;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t t = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int16_t score = NEG_INF;
+    __m256i vNegInf = _mm256_set1_epi16(NEG_INF);
+    __m256i vZero = _mm256_setzero_si256();
+    __m256i vOpen = _mm256_set1_epi16(open);
+    __m256i vGap  = _mm256_set1_epi16(gap);
+    const int16_t NEG_LIMIT = INT16_MIN
+        + open + matrix->max - matrix->min + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    __m256i vNegLimit = _mm256_set1_epi16(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi16(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+
+    /* vLanes[n] selects the first n rows of a stripe */
+    for (i=0; i<=N; ++i) {
+        __m256i_16_t m;
+        for (t=0; t<N; ++t) {
+            m.v[15-t] = t < i ? -1 : 0;
+        }
+        _mm256_store_si256(&vLanes[i], m.m);
+    }
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, first row is inside the band
+     * up to column -1-dlo */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = -1-j >= dlo ? clamp(-open - (int64_t)j*gap) : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+#ifdef PARASAIL_TABLE
+    /* cells outside of the band are reported as 0 */
+    parasail_memset_int(result->score_table, 0, (size_t)s1Len*s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+    parasail_memset_int(result->score_row, 0, s2Len);
+    parasail_memset_int(result->score_col, 0, s1Len);
+#endif
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* only the columns that intersect the band */
+        const int32_t jstart = i-dhi > 0 ? i-dhi : 0;
+        const int32_t jend = i+2*PAD-dlo+1 < s2Len_PAD ?
+            i+2*PAD-dlo+1 : s2Len_PAD;
+        /* step at which the bottom right cell passes, if in this stripe */
+        const int32_t jlast = s1Len-1-i < N ? s2Len-1 + s1Len-1-i : -1;
+        __m256i vNH = vNegInf;
+        __m256i vWH = vNegInf;
+        __m256i vE = vNegInf;
+        __m256i vF = vNegInf;
+        __m256i vIBoundary;
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
+        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
+        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
+        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
+        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
+        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
+        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
+        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
+        /* left boundary column, inside the band up to row dhi-1 */
+        {
+            __m256i_16_t b;
+            for (t=0; t<N; ++t) {
+                b.v[15-t] = i+t+1 <= dhi ?
+                    clamp(-open - (int64_t)(i+t)*gap) : NEG_INF;
+            }
+            vIBoundary = b.m;
+        }
+        vNH = _mm256_insert_epi16_rpl(vNH, H_pr[jstart-1], 15);
+        if (0 == jstart) {
+            vWH = _mm256_insert_epi16_rpl(vWH, i+1 <= dhi ?
+                    clamp(-open - (int64_t)i*gap) : NEG_INF, 15);
+        }
+        /* iterate over database sequence */
+        for (j=jstart; j<jend; ++j) {
+            __m256i vMat;
+            __m256i vNWH = vNH;
+            /* rows of this stripe inside the band and inside the table */
+            const int32_t tlo = half_floor(j-i+dlo+1);
+            const int32_t thi = half_floor(j-i+dhi);
+            int32_t vlo = j-s2Len+1;
+            int32_t vhi = s1Len-1-i;
+            vNH = _mm256_srli_si256_rpl(vWH, 2);
+            vNH = _mm256_insert_epi16_rpl(vNH, H_pr[j], 15);
+            vF = _mm256_srli_si256_rpl(vF, 2);
+            vF = _mm256_insert_epi16_rpl(vF, F_pr[j], 15);
+            vF = _mm256_max_epi16(
+                    _mm256_subs_epi16(vNH, vOpen),
+                    _mm256_subs_epi16(vF, vGap));
+            vE = _mm256_max_epi16(
+                    _mm256_subs_epi16(vWH, vOpen),
+                    _mm256_subs_epi16(vE, vGap));
+            vMat = _mm256_set_epi16(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]],
+                    matrow8[s2[j-8]],
+                    matrow9[s2[j-9]],
+                    matrow10[s2[j-10]],
+                    matrow11[s2[j-11]],
+                    matrow12[s2[j-12]],
+                    matrow13[s2[j-13]],
+                    matrow14[s2[j-14]],
+                    matrow15[s2[j-15]]
+                    );
+            vNWH = _mm256_adds_epi16(vNWH, vMat);
+            vWH = _mm256_max_epi16(vNWH, vE);
+            vWH = _mm256_max_epi16(vWH, vF);
+            /* as minor diagonal vector passes across the j=-1 boundary,
+             * assign the appropriate boundary conditions */
+            if (j+1 < N) {
+                __m256i cond = _mm256_andnot_si256(vLanes[j+1], vLanes[j+2]);
+                vWH = _mm256_blendv_epi8(vWH, vIBoundary, cond);
+                vF = _mm256_blendv_epi8(vF, vNegInf, cond);
+                vE = _mm256_blendv_epi8(vE, vNegInf, cond);
+            }
+            if (vlo < tlo) vlo = tlo;
+            if (vhi > thi) vhi = thi;
+            if (vhi > j) vhi = j;
+            if (vhi > PAD) vhi = PAD;
+            if (tlo > 0 || thi < PAD) {
+                /* part of the stripe is outside of the band */
+                __m256i cond = _mm256_andnot_si256(
+                        vLanes[tlo < 0 ? 0 : tlo > N ? N : tlo],
+                        vLanes[thi < 0 ? 0 : thi >= N ? N : thi+1]);
+                vWH = _mm256_blendv_epi8(vNegInf, vWH, cond);
+                vF = _mm256_blendv_epi8(vNegInf, vF, cond);
+                vE = _mm256_blendv_epi8(vNegInf, vE, cond);
+            }
+            if (vlo <= 0 && vhi >= PAD) {
+                vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vWH);
+                vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vWH);
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->score_table, vWH, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+                arr_store_rowcol(result->score_row, result->score_col, vWH, i, s1Len, j, s2Len);
+#endif
+            }
+            else if (vlo <= vhi) {
+                /* only check and report cells of the band and table */
+                __m256i cond = _mm256_andnot_si256(
+                        vLanes[vlo < 0 ? 0 : vlo], vLanes[vhi+1]);
+                __m256i vValid = _mm256_blendv_epi8(vZero, vWH, cond);
+                vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vValid);
+                vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vValid);
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->score_table, vValid, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+                arr_store_rowcol(result->score_row, result->score_col, vValid, i, s1Len, j, s2Len);
+#endif
+            }
+            H_pr[j-15] = (int16_t)_mm256_extract_epi16_rpl(vWH,0);
+            F_pr[j-15] = (int16_t)_mm256_extract_epi16_rpl(vF,0);
+            if (j == jlast) {
+                __m256i_16_t h;
+                h.m = vWH;
+                score = h.v[15-(s1Len-1-i)];
+            }
+        }
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmplt_epi16_rpl(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = INT16_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_free(vLanes);
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
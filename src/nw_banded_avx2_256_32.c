@@ -0,0 +1,419 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+
+#if HAVE_AVX2_MM256_INSERT_EPI32
+#define _mm256_insert_epi32_rpl _mm256_insert_epi32
+#else
+static inline __m256i _mm256_insert_epi32_rpl(__m256i a, int32_t i, int imm) {
+    __m256i_32_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+#endif
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI32
+#define _mm256_extract_epi32_rpl _mm256_extract_epi32
+#else
+static inline int32_t _mm256_extract_epi32_rpl(__m256i a, int imm) {
+    __m256i_32_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#define _mm256_cmplt_epi32_rpl(a,b) _mm256_cmpgt_epi32(b,a)
+
+#define _mm256_srli_si256_rpl(a,imm) _mm256_or_si256(_mm256_slli_si256(_mm256_permute2x128_si256(a, a, _MM_SHUFFLE(3,0,0,1)), 16-imm), _mm256_srli_si256(a, imm))
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si256(
+        int *array,
+        __m256i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (0 <= i+0 && i+0 < s1Len && 0 <= j-0 && j-0 < s2Len) {
+        array[(i+0)*s2Len + (j-0)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 7);
+    }
+    if (0 <= i+1 && i+1 < s1Len && 0 <= j-1 && j-1 < s2Len) {
+        array[(i+1)*s2Len + (j-1)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 6);
+    }
+    if (0 <= i+2 && i+2 < s1Len && 0 <= j-2 && j-2 < s2Len) {
+        array[(i+2)*s2Len + (j-2)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 5);
+    }
+    if (0 <= i+3 && i+3 < s1Len && 0 <= j-3 && j-3 < s2Len) {
+        array[(i+3)*s2Len + (j-3)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 4);
+    }
+    if (0 <= i+4 && i+4 < s1Len && 0 <= j-4 && j-4 < s2Len) {
+        array[(i+4)*s2Len + (j-4)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 3);
+    }
+    if (0 <= i+5 && i+5 < s1Len && 0 <= j-5 && j-5 < s2Len) {
+        array[(i+5)*s2Len + (j-5)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 2);
+    }
+    if (0 <= i+6 && i+6 < s1Len && 0 <= j-6 && j-6 < s2Len) {
+        array[(i+6)*s2Len + (j-6)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 1);
+    }
+    if (0 <= i+7 && i+7 < s1Len && 0 <= j-7 && j-7 < s2Len) {
+        array[(i+7)*s2Len + (j-7)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_rowcol(
+        int *row,
+        int *col,
+        __m256i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    if (i+0 == s1Len-1 && 0 <= j-0 && j-0 < s2Len) {
+        row[j-0] = (int32_t)_mm256_extract_epi32_rpl(vWH, 7);
+    }
+    if (j-0 == s2Len-1 && 0 <= i+0 && i+0 < s1Len) {
+        col[(i+0)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 7);
+    }
+    if (i+1 == s1Len-1 && 0 <= j-1 && j-1 < s2Len) {
+        row[j-1] = (int32_t)_mm256_extract_epi32_rpl(vWH, 6);
+    }
+    if (j-1 == s2Len-1 && 0 <= i+1 && i+1 < s1Len) {
+        col[(i+1)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 6);
+    }
+    if (i+2 == s1Len-1 && 0 <= j-2 && j-2 < s2Len) {
+        row[j-2] = (int32_t)_mm256_extract_epi32_rpl(vWH, 5);
+    }
+    if (j-2 == s2Len-1 && 0 <= i+2 && i+2 < s1Len) {
+        col[(i+2)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 5);
+    }
+    if (i+3 == s1Len-1 && 0 <= j-3 && j-3 < s2Len) {
+        row[j-3] = (int32_t)_mm256_extract_epi32_rpl(vWH, 4);
+    }
+    if (j-3 == s2Len-1 && 0 <= i+3 && i+3 < s1Len) {
+        col[(i+3)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 4);
+    }
+    if (i+4 == s1Len-1 && 0 <= j-4 && j-4 < s2Len) {
+        row[j-4] = (int32_t)_mm256_extract_epi32_rpl(vWH, 3);
+    }
+    if (j-4 == s2Len-1 && 0 <= i+4 && i+4 < s1Len) {
+        col[(i+4)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 3);
+    }
+    if (i+5 == s1Len-1 && 0 <= j-5 && j-5 < s2Len) {
+        row[j-5] = (int32_t)_mm256_extract_epi32_rpl(vWH, 2);
+    }
+    if (j-5 == s2Len-1 && 0 <= i+5 && i+5 < s1Len) {
+        col[(i+5)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 2);
+    }
+    if (i+6 == s1Len-1 && 0 <= j-6 && j-6 < s2Len) {
+        row[j-6] = (int32_t)_mm256_extract_epi32_rpl(vWH, 1);
+    }
+    if (j-6 == s2Len-1 && 0 <= i+6 && i+6 < s1Len) {
+        col[(i+6)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 1);
+    }
+    if (i+7 == s1Len-1 && 0 <= j-7 && j-7 < s2Len) {
+        row[j-7] = (int32_t)_mm256_extract_epi32_rpl(vWH, 0);
+    }
+    if (j-7 == s2Len-1 && 0 <= i+7 && i+7 < s1Len) {
+        col[(i+7)] = (int32_t)_mm256_extract_epi32_rpl(vWH, 0);
+    }
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_banded_avx2_256_32
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_banded_avx2_256_32
+#else
+#define FNAME parasail_nw_banded_avx2_256_32
+#endif
+#endif
+
+/* floor(x/2), also for negative x */
+static inline int32_t half_floor(int32_t x)
+{
+    return x >= 0 ? x/2 : -((1-x)/2);
+}
+
+static inline int32_t clamp(int64_t x)
+{
+    return x < NEG_INF ? NEG_INF : (int32_t)x;
+}
+
+/* Same anti-diagonal wavefront as the diag kernels, but each stripe of
+ * N query rows only visits the database columns that intersect the
+ * band, and cells outside the band are forced to NEG_INF. */
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int32_t N = 8; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    /* diagonals (row minus column) inside the band, same as the band
+     * computed by parasail_nw_banded */
+    const int32_t dlo = s1Len > s2Len ? -k : s1Len - s2Len - k;
+    const int32_t dhi = s1Len > s2Len ? s1Len - s2Len + k : k;
+    int32_t * const restrict s1 = parasail_memalign_int32_t(32, s1Len+PAD);
+    int32_t * const restrict s2B= parasail_memalign_int32_t(32, s2Len+PAD2);
+    int32_t * const restrict _H_pr = parasail_memalign_int32_t(32, s2Len+PAD2);
+    int32_t * const restrict _F_pr = parasail_memalign_int32_t(32, s2Len+PAD2);
+    __m256i * const restrict vLanes = parasail_memalign___m256i(32, N+1);
+    int32_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int32_t * const restrict H_pr = _H_pr+PAD;
+    int32_t * const restrict F_pr = _F_pr+PAD;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t t = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int32_t score = NEG_INF;
+    __m256i vNegInf = _mm256_set1_epi32(NEG_INF);
+    __m256i vZero = _mm256_setzero_si256();
+    __m256i vOpen = _mm256_set1_epi32(open);
+    __m256i vGap  = _mm256_set1_epi32(gap);
+    const int32_t NEG_LIMIT = INT32_MIN
+        + open + matrix->max - matrix->min + 1;
+    const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
+    __m256i vNegLimit = _mm256_set1_epi32(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi32(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+
+    /* vLanes[n] selects the first n rows of a stripe */
+    for (i=0; i<=N; ++i) {
+        __m256i_32_t m;
+        for (t=0; t<N; ++t) {
+            m.v[7-t] = t < i ? -1 : 0;
+        }
+        _mm256_store_si256(&vLanes[i], m.m);
+    }
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, first row is inside the band
+     * up to column -1-dlo */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = -1-j >= dlo ? clamp(-open - (int64_t)j*gap) : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+#ifdef PARASAIL_TABLE
+    /* cells outside of the band are reported as 0 */
+    parasail_memset_int(result->score_table, 0, (size_t)s1Len*s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+    parasail_memset_int(result->score_row, 0, s2Len);
+    parasail_memset_int(result->score_col, 0, s1Len);
+#endif
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* only the columns that intersect the band */
+        const int32_t jstart = i-dhi > 0 ? i-dhi : 0;
+        const int32_t jend = i+2*PAD-dlo+1 < s2Len_PAD ?
+            i+2*PAD-dlo+1 : s2Len_PAD;
+        /* step at which the bottom right cell passes, if in this stripe */
+        const int32_t jlast = s1Len-1-i < N ? s2Len-1 + s1Len-1-i : -1;
+        __m256i vNH = vNegInf;
+        __m256i vWH = vNegInf;
+        __m256i vE = vNegInf;
+        __m256i vF = vNegInf;
+        __m256i vIBoundary;
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        /* left boundary column, inside the band up to row dhi-1 */
+        {
+            __m256i_32_t b;
+            for (t=0; t<N; ++t) {
+                b.v[7-t] = i+t+1 <= dhi ?
+                    clamp(-open - (int64_t)(i+t)*gap) : NEG_INF;
+            }
+            vIBoundary = b.m;
+        }
+        vNH = _mm256_insert_epi32_rpl(vNH, H_pr[jstart-1], 7);
+        if (0 == jstart) {
+            vWH = _mm256_insert_epi32_rpl(vWH, i+1 <= dhi ?
+                    clamp(-open - (int64_t)i*gap) : NEG_INF, 7);
+        }
+        /* iterate over database sequence */
+        for (j=jstart; j<jend; ++j) {
+            __m256i vMat;
+            __m256i vNWH = vNH;
+            /* rows of this stripe inside the band and inside the table */
+            const int32_t tlo = half_floor(j-i+dlo+1);
+            const int32_t thi = half_floor(j-i+dhi);
+            int32_t vlo = j-s2Len+1;
+            int32_t vhi = s1Len-1-i;
+            vNH = _mm256_srli_si256_rpl(vWH, 4);
+            vNH = _mm256_insert_epi32_rpl(vNH, H_pr[j], 7);
+            vF = _mm256_srli_si256_rpl(vF, 4);
+            vF = _mm256_insert_epi32_rpl(vF, F_pr[j], 7);
+            vF = _mm256_max_epi32(
+                    _mm256_sub_epi32(vNH, vOpen),
+                    _mm256_sub_epi32(vF, vGap));
+            vE = _mm256_max_epi32(
+                    _mm256_sub_epi32(vWH, vOpen),
+                    _mm256_sub_epi32(vE, vGap));
+            vMat = _mm256_set_epi32(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]]
+                    );
+            vNWH = _mm256_add_epi32(vNWH, vMat);
+            vWH = _mm256_max_epi32(vNWH, vE);
+            vWH = _mm256_max_epi32(vWH, vF);
+            /* as minor diagonal vector passes across the j=-1 boundary,
+             * assign the appropriate boundary conditions */
+            if (j+1 < N) {
+                __m256i cond = _mm256_andnot_si256(vLanes[j+1], vLanes[j+2]);
+                vWH = _mm256_blendv_epi8(vWH, vIBoundary, cond);
+                vF = _mm256_blendv_epi8(vF, vNegInf, cond);
+                vE = _mm256_blendv_epi8(vE, vNegInf, cond);
+            }
+            if (vlo < tlo) vlo = tlo;
+            if (vhi > thi) vhi = thi;
+            if (vhi > j) vhi = j;
+            if (vhi > PAD) vhi = PAD;
+            if (tlo > 0 || thi < PAD) {
+                /* part of the stripe is outside of the band */
+                __m256i cond = _mm256_andnot_si256(
+                        vLanes[tlo < 0 ? 0 : tlo > N ? N : tlo],
+                        vLanes[thi < 0 ? 0 : thi >= N ? N : thi+1]);
+                vWH = _mm256_blendv_epi8(vNegInf, vWH, cond);
+                vF = _mm256_blendv_epi8(vNegInf, vF, cond);
+                vE = _mm256_blendv_epi8(vNegInf, vE, cond);
+            }
+            if (vlo <= 0 && vhi >= PAD) {
+                vSaturationCheckMax = _mm256_max_epi32(vSaturationCheckMax, vWH);
+                vSaturationCheckMin = _mm256_min_epi32(vSaturationCheckMin, vWH);
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->score_table, vWH, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+                arr_store_rowcol(result->score_row, result->score_col, vWH, i, s1Len, j, s2Len);
+#endif
+            }
+            else if (vlo <= vhi) {
+                /* only check and report cells of the band and table */
+                __m256i cond = _mm256_andnot_si256(
+                        vLanes[vlo < 0 ? 0 : vlo], vLanes[vhi+1]);
+                __m256i vValid = _mm256_blendv_epi8(vZero, vWH, cond);
+                vSaturationCheckMax = _mm256_max_epi32(vSaturationCheckMax, vValid);
+                vSaturationCheckMin = _mm256_min_epi32(vSaturationCheckMin, vValid);
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->score_table, vValid, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+                arr_store_rowcol(result->score_row, result->score_col, vValid, i, s1Len, j, s2Len);
+#endif
+            }
+            H_pr[j-7] = (int32_t)_mm256_extract_epi32_rpl(vWH,0);
+            F_pr[j-7] = (int32_t)_mm256_extract_epi32_rpl(vF,0);
+            if (j == jlast) {
+                __m256i_32_t h;
+                h.m = vWH;
+                score = h.v[7-(s1Len-1-i)];
+            }
+        }
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmplt_epi32_rpl(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpgt_epi32(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = INT32_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_free(vLanes);
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
@@ -0,0 +1,205 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+
+#define _mm256_cmplt_epi32_rpl(a,b) _mm256_cmpgt_epi32(b,a)
+
+#define _mm256_alignr_epi8_rpl(a,b,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(b, a, _MM_SHUFFLE(0,2,0,1)), imm)
+
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_blocked_avx2_256_32
+#define PNAME parasail_nw_table_blocked_profile_avx2_256_32
+#define WNAME parasail_nw_table_blocked_profile_avx2_256_32_ws
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_blocked_avx2_256_32
+#define PNAME parasail_nw_rowcol_blocked_profile_avx2_256_32
+#define WNAME parasail_nw_rowcol_blocked_profile_avx2_256_32_ws
+#else
+#define FNAME parasail_nw_blocked_avx2_256_32
+#define PNAME parasail_nw_blocked_profile_avx2_256_32
+#define WNAME parasail_nw_blocked_profile_avx2_256_32_ws
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_blocked_avx_256_32(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    __m256i* const restrict vProfile = (__m256i*)profile->profile32.score;
+    __m256i* const restrict pvH = parasail_workspace___m256i(workspace, 0, segLen);
+    __m256i* const restrict pvE = parasail_workspace___m256i(workspace, 1, segLen);
+    const int32_t * const restrict h = (const int32_t*)pvH;
+    __m256i vGapO = _mm256_set1_epi32(open);
+    __m256i vGapE = _mm256_set1_epi32(gap);
+    __m256i vFront[3];
+    const int32_t NEG_LIMIT = (-open < matrix->min ?
+        INT32_MIN + open : INT32_MIN - matrix->min) + 1;
+    const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
+    int32_t score = NEG_INF;
+    __m256i vNegLimit = _mm256_set1_epi32(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi32(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* initialize H and E */
+    {
+        int32_t * const restrict e = (int32_t*)pvE;
+        for (i=0; i<segLen*segWidth; ++i) {
+            int64_t tmp = -open-gap*(int64_t)i;
+            ((int32_t*)pvH)[i] = tmp < NEG_INF ? NEG_INF : tmp;
+            tmp = tmp - open;
+            e[i] = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+    }
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * leaves empty have nothing above them in the block */
+    for (k=0; k<3; ++k) {
+        __m256i_32_t front;
+        const int32_t lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            int64_t tmp = -(int64_t)lanes*gap;
+            front.v[i] = (i < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = front.m;
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        const __m256i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+        /* the upper boundary: H above row 0 in columns j-1 and j */
+        const int64_t diag = 0 == j ? 0 : -open-gap*(int64_t)(j-1);
+        const int64_t above = -open-gap*(int64_t)j;
+        __m256i vHp = _mm256_set1_epi32(diag < NEG_INF ? NEG_INF : diag);
+        __m256i vFin = _mm256_set1_epi32(above-open < NEG_INF ? NEG_INF : above-open);
+
+        /* each block of query rows sees the row above it through the
+         * last lane of vHp (diagonal) and of vFin (vertical gap) */
+        for (i=0; i<segLen; ++i) {
+            __m256i vHold = _mm256_load_si256(pvH + i);
+            __m256i vE = _mm256_load_si256(pvE + i);
+            __m256i vH = _mm256_alignr_epi8_rpl(vHold, vHp, 12);
+            __m256i vF;
+            vHp = vHold;
+
+            vH = _mm256_add_epi32(vH, _mm256_load_si256(vP + i));
+            vH = _mm256_max_epi32(vH, vE);
+
+            /* resolve F down the block with a log-step prefix max */
+            vF = _mm256_alignr_epi8_rpl(_mm256_sub_epi32(vH, vGapO), vFin, 12);
+            vF = _mm256_max_epi32(vF, _mm256_add_epi32(_mm256_slli_si256_rpl(vF, 4), vFront[0]));
+            vF = _mm256_max_epi32(vF, _mm256_add_epi32(_mm256_slli_si256_rpl(vF, 8), vFront[1]));
+            vF = _mm256_max_epi32(vF, _mm256_add_epi32(_mm256_slli_si256_rpl(vF, 16), vFront[2]));
+            vH = _mm256_max_epi32(vH, vF);
+            _mm256_store_si256(pvH + i, vH);
+            vSaturationCheckMin = _mm256_min_epi32(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm256_max_epi32(vSaturationCheckMax, vH);
+
+            vH = _mm256_sub_epi32(vH, vGapO);
+            vFin = _mm256_max_epi32(_mm256_sub_epi32(vF, vGapE), vH);
+            vE = _mm256_max_epi32(_mm256_sub_epi32(vE, vGapE), vH);
+            _mm256_store_si256(pvE + i, vE);
+        }
+
+#ifdef PARASAIL_TABLE
+        for (i=0; i<segLen*segWidth; ++i) {
+            result->score_table[i*s2Len + j] = h[i];
+        }
+#endif
+
+#ifdef PARASAIL_ROWCOL
+        result->score_row[j] = h[s1Len-1];
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen*segWidth; ++i) {
+        result->score_col[i] = h[i];
+    }
+#endif
+
+    score = h[s1Len-1];
+    end_query = s1Len - 1;
+    end_ref = s2Len - 1;
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmplt_epi32_rpl(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpgt_epi32(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = INT32_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    return result;
+}
+
@@ -333,22 +333,24 @@ parasail_result_t* FNAME(
         __m256i vE = vNegInf;
         __m256i vF = vNegInf;
         __m256i vJ = vJreset;
-        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
-        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
-        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
-        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
-        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
-        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
-        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
-        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
-        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
-        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
-        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
-        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
-        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
-        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
-        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
-        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
+        const __m256i vS1_0 = _mm256_set_epi32(
+                matrix->size*s1[i+8],
+                matrix->size*s1[i+9],
+                matrix->size*s1[i+10],
+                matrix->size*s1[i+11],
+                matrix->size*s1[i+12],
+                matrix->size*s1[i+13],
+                matrix->size*s1[i+14],
+                matrix->size*s1[i+15]);
+        const __m256i vS1_1 = _mm256_set_epi32(
+                matrix->size*s1[i+0],
+                matrix->size*s1[i+1],
+                matrix->size*s1[i+2],
+                matrix->size*s1[i+3],
+                matrix->size*s1[i+4],
+                matrix->size*s1[i+5],
+                matrix->size*s1[i+6],
+                matrix->size*s1[i+7]);
         vNH = _mm256_srli_si256_rpl(vNH, 2);
         vNH = _mm256_insert_epi16_rpl(vNH, H_pr[-1], 15);
         vWH = _mm256_srli_si256_rpl(vWH, 2);
@@ -368,24 +370,14 @@ parasail_result_t* FNAME(
             vE = _mm256_max_epi16(
                     _mm256_sub_epi16(vWH, vOpen),
                     _mm256_sub_epi16(vE, vGap));
-            vMat = _mm256_set_epi16(
-                    matrow0[s2[j-0]],
-                    matrow1[s2[j-1]],
-                    matrow2[s2[j-2]],
-                    matrow3[s2[j-3]],
-                    matrow4[s2[j-4]],
-                    matrow5[s2[j-5]],
-                    matrow6[s2[j-6]],
-                    matrow7[s2[j-7]],
-                    matrow8[s2[j-8]],
-                    matrow9[s2[j-9]],
-                    matrow10[s2[j-10]],
-                    matrow11[s2[j-11]],
-                    matrow12[s2[j-12]],
-                    matrow13[s2[j-13]],
-                    matrow14[s2[j-14]],
-                    matrow15[s2[j-15]]
-                    );
+            {
+                __m256i vMat0 = _mm256_i32gather_epi32(matrix->matrix,
+                    _mm256_add_epi32(vS1_0, _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(s2+j-PAD)))), 4);
+                __m256i vMat1 = _mm256_i32gather_epi32(matrix->matrix,
+                    _mm256_add_epi32(vS1_1, _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(s2+j-PAD+8)))), 4);
+                vMat = _mm256_permute4x64_epi64(
+                    _mm256_packs_epi32(vMat0, vMat1), 0xD8);
+            }
             vNWH = _mm256_add_epi16(vNWH, vMat);
             vWH = _mm256_max_epi16(vNWH, vE);
             vWH = _mm256_max_epi16(vWH, vF);
@@ -134,6 +134,118 @@ parasail_pfunction_t parasail_nw_stats_rowcol_striped_profile_64_dispatcher;
 parasail_pfunction_t parasail_nw_stats_rowcol_striped_profile_32_dispatcher;
 parasail_pfunction_t parasail_nw_stats_rowcol_striped_profile_16_dispatcher;
 parasail_pfunction_t parasail_nw_stats_rowcol_striped_profile_8_dispatcher;
+parasail_pwfunction_t parasail_nw_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_table_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_table_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_nw_stats_rowcol_striped_profile_8_ws_dispatcher;
+parasail_bfunction_t parasail_nw_swipe_32_dispatcher;
+parasail_bfunction_t parasail_nw_swipe_16_dispatcher;
+parasail_bfunction_t parasail_nw_swipe_8_dispatcher;
+parasail_mfunction_t parasail_nw_packed_16_dispatcher;
+parasail_mpfunction_t parasail_nw_packed_profile_16_dispatcher;
+parasail_mfunction_t parasail_nw_packed_8_dispatcher;
+parasail_mpfunction_t parasail_nw_packed_profile_8_dispatcher;
+parasail_function_t parasail_nw_trace_scan_32_dispatcher;
+parasail_function_t parasail_nw_trace_scan_16_dispatcher;
+parasail_function_t parasail_nw_trace_scan_8_dispatcher;
+parasail_kfunction_t parasail_nw_banded_32_dispatcher;
+parasail_kfunction_t parasail_nw_banded_16_dispatcher;
+parasail_kfunction_t parasail_nw_banded_8_dispatcher;
+parasail_kfunction_t parasail_nw_table_banded_32_dispatcher;
+parasail_kfunction_t parasail_nw_table_banded_16_dispatcher;
+parasail_kfunction_t parasail_nw_table_banded_8_dispatcher;
+parasail_kfunction_t parasail_nw_rowcol_banded_32_dispatcher;
+parasail_kfunction_t parasail_nw_rowcol_banded_16_dispatcher;
+parasail_kfunction_t parasail_nw_rowcol_banded_8_dispatcher;
+parasail_function_t parasail_nw_blocked_32_dispatcher;
+parasail_pfunction_t parasail_nw_blocked_profile_32_dispatcher;
+parasail_pwfunction_t parasail_nw_blocked_profile_32_ws_dispatcher;
+parasail_function_t parasail_nw_blocked_16_dispatcher;
+parasail_pfunction_t parasail_nw_blocked_profile_16_dispatcher;
+parasail_pwfunction_t parasail_nw_blocked_profile_16_ws_dispatcher;
+parasail_function_t parasail_nw_table_blocked_32_dispatcher;
+parasail_pfunction_t parasail_nw_table_blocked_profile_32_dispatcher;
+parasail_pwfunction_t parasail_nw_table_blocked_profile_32_ws_dispatcher;
+parasail_function_t parasail_nw_table_blocked_16_dispatcher;
+parasail_pfunction_t parasail_nw_table_blocked_profile_16_dispatcher;
+parasail_pwfunction_t parasail_nw_table_blocked_profile_16_ws_dispatcher;
+parasail_function_t parasail_nw_rowcol_blocked_32_dispatcher;
+parasail_pfunction_t parasail_nw_rowcol_blocked_profile_32_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_blocked_profile_32_ws_dispatcher;
+parasail_function_t parasail_nw_rowcol_blocked_16_dispatcher;
+parasail_pfunction_t parasail_nw_rowcol_blocked_profile_16_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_blocked_profile_16_ws_dispatcher;
+parasail_function_t parasail_nw_short_32_dispatcher;
+parasail_pfunction_t parasail_nw_short_profile_32_dispatcher;
+parasail_pwfunction_t parasail_nw_short_profile_32_ws_dispatcher;
+parasail_function_t parasail_nw_short_16_dispatcher;
+parasail_pfunction_t parasail_nw_short_profile_16_dispatcher;
+parasail_pwfunction_t parasail_nw_short_profile_16_ws_dispatcher;
+parasail_function_t parasail_nw_short_8_dispatcher;
+parasail_pfunction_t parasail_nw_short_profile_8_dispatcher;
+parasail_pwfunction_t parasail_nw_short_profile_8_ws_dispatcher;
+parasail_function_t parasail_nw_table_short_32_dispatcher;
+parasail_pfunction_t parasail_nw_table_short_profile_32_dispatcher;
+parasail_pwfunction_t parasail_nw_table_short_profile_32_ws_dispatcher;
+parasail_function_t parasail_nw_table_short_16_dispatcher;
+parasail_pfunction_t parasail_nw_table_short_profile_16_dispatcher;
+parasail_pwfunction_t parasail_nw_table_short_profile_16_ws_dispatcher;
+parasail_function_t parasail_nw_table_short_8_dispatcher;
+parasail_pfunction_t parasail_nw_table_short_profile_8_dispatcher;
+parasail_pwfunction_t parasail_nw_table_short_profile_8_ws_dispatcher;
+parasail_function_t parasail_nw_rowcol_short_32_dispatcher;
+parasail_pfunction_t parasail_nw_rowcol_short_profile_32_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_short_profile_32_ws_dispatcher;
+parasail_function_t parasail_nw_rowcol_short_16_dispatcher;
+parasail_pfunction_t parasail_nw_rowcol_short_profile_16_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_short_profile_16_ws_dispatcher;
+parasail_function_t parasail_nw_rowcol_short_8_dispatcher;
+parasail_pfunction_t parasail_nw_rowcol_short_profile_8_dispatcher;
+parasail_pwfunction_t parasail_nw_rowcol_short_profile_8_ws_dispatcher;
 
 /* declare and initialize the pointer to the dispatcher function */
 parasail_function_t * parasail_nw_scan_64_pointer = parasail_nw_scan_64_dispatcher;
@@ -256,6 +368,118 @@ parasail_pfunction_t * parasail_nw_stats_rowcol_striped_profile_64_pointer = par
 parasail_pfunction_t * parasail_nw_stats_rowcol_striped_profile_32_pointer = parasail_nw_stats_rowcol_striped_profile_32_dispatcher;
 parasail_pfunction_t * parasail_nw_stats_rowcol_striped_profile_16_pointer = parasail_nw_stats_rowcol_striped_profile_16_dispatcher;
 parasail_pfunction_t * parasail_nw_stats_rowcol_striped_profile_8_pointer = parasail_nw_stats_rowcol_striped_profile_8_dispatcher;
+parasail_pwfunction_t * parasail_nw_scan_profile_64_ws_pointer = parasail_nw_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_scan_profile_32_ws_pointer = parasail_nw_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_scan_profile_16_ws_pointer = parasail_nw_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_scan_profile_8_ws_pointer = parasail_nw_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_striped_profile_64_ws_pointer = parasail_nw_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_striped_profile_32_ws_pointer = parasail_nw_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_striped_profile_16_ws_pointer = parasail_nw_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_striped_profile_8_ws_pointer = parasail_nw_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_scan_profile_64_ws_pointer = parasail_nw_stats_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_scan_profile_32_ws_pointer = parasail_nw_stats_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_scan_profile_16_ws_pointer = parasail_nw_stats_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_scan_profile_8_ws_pointer = parasail_nw_stats_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_striped_profile_64_ws_pointer = parasail_nw_stats_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_striped_profile_32_ws_pointer = parasail_nw_stats_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_striped_profile_16_ws_pointer = parasail_nw_stats_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_striped_profile_8_ws_pointer = parasail_nw_stats_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_scan_profile_64_ws_pointer = parasail_nw_table_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_scan_profile_32_ws_pointer = parasail_nw_table_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_scan_profile_16_ws_pointer = parasail_nw_table_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_scan_profile_8_ws_pointer = parasail_nw_table_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_striped_profile_64_ws_pointer = parasail_nw_table_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_striped_profile_32_ws_pointer = parasail_nw_table_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_striped_profile_16_ws_pointer = parasail_nw_table_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_striped_profile_8_ws_pointer = parasail_nw_table_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_scan_profile_64_ws_pointer = parasail_nw_stats_table_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_scan_profile_32_ws_pointer = parasail_nw_stats_table_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_scan_profile_16_ws_pointer = parasail_nw_stats_table_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_scan_profile_8_ws_pointer = parasail_nw_stats_table_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_striped_profile_64_ws_pointer = parasail_nw_stats_table_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_striped_profile_32_ws_pointer = parasail_nw_stats_table_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_striped_profile_16_ws_pointer = parasail_nw_stats_table_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_table_striped_profile_8_ws_pointer = parasail_nw_stats_table_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_scan_profile_64_ws_pointer = parasail_nw_rowcol_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_scan_profile_32_ws_pointer = parasail_nw_rowcol_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_scan_profile_16_ws_pointer = parasail_nw_rowcol_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_scan_profile_8_ws_pointer = parasail_nw_rowcol_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_striped_profile_64_ws_pointer = parasail_nw_rowcol_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_striped_profile_32_ws_pointer = parasail_nw_rowcol_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_striped_profile_16_ws_pointer = parasail_nw_rowcol_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_striped_profile_8_ws_pointer = parasail_nw_rowcol_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_scan_profile_64_ws_pointer = parasail_nw_stats_rowcol_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_scan_profile_32_ws_pointer = parasail_nw_stats_rowcol_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_scan_profile_16_ws_pointer = parasail_nw_stats_rowcol_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_scan_profile_8_ws_pointer = parasail_nw_stats_rowcol_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_striped_profile_64_ws_pointer = parasail_nw_stats_rowcol_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_striped_profile_32_ws_pointer = parasail_nw_stats_rowcol_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_striped_profile_16_ws_pointer = parasail_nw_stats_rowcol_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_nw_stats_rowcol_striped_profile_8_ws_pointer = parasail_nw_stats_rowcol_striped_profile_8_ws_dispatcher;
+parasail_bfunction_t * parasail_nw_swipe_32_pointer = parasail_nw_swipe_32_dispatcher;
+parasail_bfunction_t * parasail_nw_swipe_16_pointer = parasail_nw_swipe_16_dispatcher;
+parasail_bfunction_t * parasail_nw_swipe_8_pointer = parasail_nw_swipe_8_dispatcher;
+parasail_mfunction_t * parasail_nw_packed_16_pointer = parasail_nw_packed_16_dispatcher;
+parasail_mpfunction_t * parasail_nw_packed_profile_16_pointer = parasail_nw_packed_profile_16_dispatcher;
+parasail_mfunction_t * parasail_nw_packed_8_pointer = parasail_nw_packed_8_dispatcher;
+parasail_mpfunction_t * parasail_nw_packed_profile_8_pointer = parasail_nw_packed_profile_8_dispatcher;
+parasail_function_t * parasail_nw_trace_scan_32_pointer = parasail_nw_trace_scan_32_dispatcher;
+parasail_function_t * parasail_nw_trace_scan_16_pointer = parasail_nw_trace_scan_16_dispatcher;
+parasail_function_t * parasail_nw_trace_scan_8_pointer = parasail_nw_trace_scan_8_dispatcher;
+parasail_kfunction_t * parasail_nw_banded_32_pointer = parasail_nw_banded_32_dispatcher;
+parasail_kfunction_t * parasail_nw_banded_16_pointer = parasail_nw_banded_16_dispatcher;
+parasail_kfunction_t * parasail_nw_banded_8_pointer = parasail_nw_banded_8_dispatcher;
+parasail_kfunction_t * parasail_nw_table_banded_32_pointer = parasail_nw_table_banded_32_dispatcher;
+parasail_kfunction_t * parasail_nw_table_banded_16_pointer = parasail_nw_table_banded_16_dispatcher;
+parasail_kfunction_t * parasail_nw_table_banded_8_pointer = parasail_nw_table_banded_8_dispatcher;
+parasail_kfunction_t * parasail_nw_rowcol_banded_32_pointer = parasail_nw_rowcol_banded_32_dispatcher;
+parasail_kfunction_t * parasail_nw_rowcol_banded_16_pointer = parasail_nw_rowcol_banded_16_dispatcher;
+parasail_kfunction_t * parasail_nw_rowcol_banded_8_pointer = parasail_nw_rowcol_banded_8_dispatcher;
+parasail_function_t * parasail_nw_blocked_32_pointer = parasail_nw_blocked_32_dispatcher;
+parasail_pfunction_t * parasail_nw_blocked_profile_32_pointer = parasail_nw_blocked_profile_32_dispatcher;
+parasail_pwfunction_t * parasail_nw_blocked_profile_32_ws_pointer = parasail_nw_blocked_profile_32_ws_dispatcher;
+parasail_function_t * parasail_nw_blocked_16_pointer = parasail_nw_blocked_16_dispatcher;
+parasail_pfunction_t * parasail_nw_blocked_profile_16_pointer = parasail_nw_blocked_profile_16_dispatcher;
+parasail_pwfunction_t * parasail_nw_blocked_profile_16_ws_pointer = parasail_nw_blocked_profile_16_ws_dispatcher;
+parasail_function_t * parasail_nw_table_blocked_32_pointer = parasail_nw_table_blocked_32_dispatcher;
+parasail_pfunction_t * parasail_nw_table_blocked_profile_32_pointer = parasail_nw_table_blocked_profile_32_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_blocked_profile_32_ws_pointer = parasail_nw_table_blocked_profile_32_ws_dispatcher;
+parasail_function_t * parasail_nw_table_blocked_16_pointer = parasail_nw_table_blocked_16_dispatcher;
+parasail_pfunction_t * parasail_nw_table_blocked_profile_16_pointer = parasail_nw_table_blocked_profile_16_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_blocked_profile_16_ws_pointer = parasail_nw_table_blocked_profile_16_ws_dispatcher;
+parasail_function_t * parasail_nw_rowcol_blocked_32_pointer = parasail_nw_rowcol_blocked_32_dispatcher;
+parasail_pfunction_t * parasail_nw_rowcol_blocked_profile_32_pointer = parasail_nw_rowcol_blocked_profile_32_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_blocked_profile_32_ws_pointer = parasail_nw_rowcol_blocked_profile_32_ws_dispatcher;
+parasail_function_t * parasail_nw_rowcol_blocked_16_pointer = parasail_nw_rowcol_blocked_16_dispatcher;
+parasail_pfunction_t * parasail_nw_rowcol_blocked_profile_16_pointer = parasail_nw_rowcol_blocked_profile_16_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_blocked_profile_16_ws_pointer = parasail_nw_rowcol_blocked_profile_16_ws_dispatcher;
+parasail_function_t * parasail_nw_short_32_pointer = parasail_nw_short_32_dispatcher;
+parasail_pfunction_t * parasail_nw_short_profile_32_pointer = parasail_nw_short_profile_32_dispatcher;
+parasail_pwfunction_t * parasail_nw_short_profile_32_ws_pointer = parasail_nw_short_profile_32_ws_dispatcher;
+parasail_function_t * parasail_nw_short_16_pointer = parasail_nw_short_16_dispatcher;
+parasail_pfunction_t * parasail_nw_short_profile_16_pointer = parasail_nw_short_profile_16_dispatcher;
+parasail_pwfunction_t * parasail_nw_short_profile_16_ws_pointer = parasail_nw_short_profile_16_ws_dispatcher;
+parasail_function_t * parasail_nw_short_8_pointer = parasail_nw_short_8_dispatcher;
+parasail_pfunction_t * parasail_nw_short_profile_8_pointer = parasail_nw_short_profile_8_dispatcher;
+parasail_pwfunction_t * parasail_nw_short_profile_8_ws_pointer = parasail_nw_short_profile_8_ws_dispatcher;
+parasail_function_t * parasail_nw_table_short_32_pointer = parasail_nw_table_short_32_dispatcher;
+parasail_pfunction_t * parasail_nw_table_short_profile_32_pointer = parasail_nw_table_short_profile_32_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_short_profile_32_ws_pointer = parasail_nw_table_short_profile_32_ws_dispatcher;
+parasail_function_t * parasail_nw_table_short_16_pointer = parasail_nw_table_short_16_dispatcher;
+parasail_pfunction_t * parasail_nw_table_short_profile_16_pointer = parasail_nw_table_short_profile_16_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_short_profile_16_ws_pointer = parasail_nw_table_short_profile_16_ws_dispatcher;
+parasail_function_t * parasail_nw_table_short_8_pointer = parasail_nw_table_short_8_dispatcher;
+parasail_pfunction_t * parasail_nw_table_short_profile_8_pointer = parasail_nw_table_short_profile_8_dispatcher;
+parasail_pwfunction_t * parasail_nw_table_short_profile_8_ws_pointer = parasail_nw_table_short_profile_8_ws_dispatcher;
+parasail_function_t * parasail_nw_rowcol_short_32_pointer = parasail_nw_rowcol_short_32_dispatcher;
+parasail_pfunction_t * parasail_nw_rowcol_short_profile_32_pointer = parasail_nw_rowcol_short_profile_32_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_short_profile_32_ws_pointer = parasail_nw_rowcol_short_profile_32_ws_dispatcher;
+parasail_function_t * parasail_nw_rowcol_short_16_pointer = parasail_nw_rowcol_short_16_dispatcher;
+parasail_pfunction_t * parasail_nw_rowcol_short_profile_16_pointer = parasail_nw_rowcol_short_profile_16_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_short_profile_16_ws_pointer = parasail_nw_rowcol_short_profile_16_ws_dispatcher;
+parasail_function_t * parasail_nw_rowcol_short_8_pointer = parasail_nw_rowcol_short_8_dispatcher;
+parasail_pfunction_t * parasail_nw_rowcol_short_profile_8_pointer = parasail_nw_rowcol_short_profile_8_dispatcher;
+parasail_pwfunction_t * parasail_nw_rowcol_short_profile_8_ws_pointer = parasail_nw_rowcol_short_profile_8_ws_dispatcher;
 
 /* dispatcher function implementations */
 
@@ -458,13 +682,13 @@ parasail_result_t* parasail_nw_striped_32_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_nw_striped_32_pointer = parasail_nw_striped_avx2_256_32;
+        parasail_nw_striped_32_pointer = parasail_nw_short_avx2_256_32;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_nw_striped_32_pointer = parasail_nw_striped_sse41_128_32;
+        parasail_nw_striped_32_pointer = parasail_nw_short_sse41_128_32;
     }
     else
 #endif
@@ -495,13 +719,13 @@ parasail_result_t* parasail_nw_striped_16_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_nw_striped_16_pointer = parasail_nw_striped_avx2_256_16;
+        parasail_nw_striped_16_pointer = parasail_nw_short_avx2_256_16;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_nw_striped_16_pointer = parasail_nw_striped_sse41_128_16;
+        parasail_nw_striped_16_pointer = parasail_nw_short_sse41_128_16;
     }
     else
 #endif
@@ -532,13 +756,13 @@ parasail_result_t* parasail_nw_striped_8_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_nw_striped_8_pointer = parasail_nw_striped_avx2_256_8;
+        parasail_nw_striped_8_pointer = parasail_nw_short_avx2_256_8;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_nw_striped_8_pointer = parasail_nw_striped_sse41_128_8;
+        parasail_nw_striped_8_pointer = parasail_nw_short_sse41_128_8;
     }
     else
 #endif
@@ -3116,13 +3340,13 @@ parasail_result_t* parasail_nw_striped_profile_32_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_nw_striped_profile_32_pointer = parasail_nw_striped_profile_avx2_256_32;
+        parasail_nw_striped_profile_32_pointer = parasail_nw_short_profile_avx2_256_32;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_nw_striped_profile_32_pointer = parasail_nw_striped_profile_sse41_128_32;
+        parasail_nw_striped_profile_32_pointer = parasail_nw_short_profile_sse41_128_32;
     }
     else
 #endif
@@ -3152,13 +3376,13 @@ parasail_result_t* parasail_nw_striped_profile_16_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_nw_striped_profile_16_pointer = parasail_nw_striped_profile_avx2_256_16;
+        parasail_nw_striped_profile_16_pointer = parasail_nw_short_profile_avx2_256_16;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_nw_striped_profile_16_pointer = parasail_nw_striped_profile_sse41_128_16;
+        parasail_nw_striped_profile_16_pointer = parasail_nw_short_profile_sse41_128_16;
     }
     else
 #endif
@@ -3188,13 +3412,13 @@ parasail_result_t* parasail_nw_striped_profile_8_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        parasail_nw_striped_profile_8_pointer = parasail_nw_striped_profile_avx2_256_8;
+        parasail_nw_striped_profile_8_pointer = parasail_nw_short_profile_avx2_256_8;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        parasail_nw_striped_profile_8_pointer = parasail_nw_striped_profile_sse41_128_8;
+        parasail_nw_striped_profile_8_pointer = parasail_nw_short_profile_sse41_128_8;
     }
     else
 #endif
@@ -4651,1038 +4875,5334 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8_dispatcher(
     return parasail_nw_stats_rowcol_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
-/* implementation which simply calls the pointer,
- * first time it's the dispatcher, otherwise it's correct impl */
+parasail_result_t* parasail_nw_scan_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_scan_profile_64_ws_pointer = parasail_nw_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_scan_profile_64_ws_pointer = parasail_nw_scan_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_scan_profile_64_ws_pointer = parasail_nw_scan_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_scan_profile_64_ws_pointer = parasail_nw_scan_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_scan_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
 
-parasail_result_t* parasail_nw_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_scan_profile_32_ws_pointer = parasail_nw_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_scan_profile_32_ws_pointer = parasail_nw_scan_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_scan_profile_32_ws_pointer = parasail_nw_scan_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_scan_profile_32_ws_pointer = parasail_nw_scan_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_scan_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_scan_profile_16_ws_pointer = parasail_nw_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_scan_profile_16_ws_pointer = parasail_nw_scan_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_scan_profile_16_ws_pointer = parasail_nw_scan_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_scan_profile_16_ws_pointer = parasail_nw_scan_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_scan_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_scan_profile_8_ws_pointer = parasail_nw_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_scan_profile_8_ws_pointer = parasail_nw_scan_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_scan_profile_8_ws_pointer = parasail_nw_scan_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_scan_profile_8_ws_pointer = parasail_nw_scan_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_scan_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_striped_profile_64_ws_pointer = parasail_nw_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_striped_profile_64_ws_pointer = parasail_nw_striped_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_striped_profile_64_ws_pointer = parasail_nw_striped_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_striped_profile_64_ws_pointer = parasail_nw_striped_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_striped_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_striped_profile_32_ws_pointer = parasail_nw_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_striped_profile_32_ws_pointer = parasail_nw_short_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_striped_profile_32_ws_pointer = parasail_nw_short_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_striped_profile_32_ws_pointer = parasail_nw_striped_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_striped_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_striped_profile_16_ws_pointer = parasail_nw_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_striped_profile_16_ws_pointer = parasail_nw_short_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_striped_profile_16_ws_pointer = parasail_nw_short_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_striped_profile_16_ws_pointer = parasail_nw_striped_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_striped_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_striped_profile_8_ws_pointer = parasail_nw_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_striped_profile_8_ws_pointer = parasail_nw_short_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_striped_profile_8_ws_pointer = parasail_nw_short_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_striped_profile_8_ws_pointer = parasail_nw_striped_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_striped_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_scan_profile_64_ws_pointer = parasail_nw_stats_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_scan_profile_64_ws_pointer = parasail_nw_stats_scan_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_scan_profile_64_ws_pointer = parasail_nw_stats_scan_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_scan_profile_64_ws_pointer = parasail_nw_stats_scan_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_scan_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_scan_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_scan_profile_32_ws_pointer = parasail_nw_stats_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_scan_profile_32_ws_pointer = parasail_nw_stats_scan_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_scan_profile_32_ws_pointer = parasail_nw_stats_scan_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_scan_profile_32_ws_pointer = parasail_nw_stats_scan_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_scan_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_scan_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_scan_profile_16_ws_pointer = parasail_nw_stats_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_scan_profile_16_ws_pointer = parasail_nw_stats_scan_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_scan_profile_16_ws_pointer = parasail_nw_stats_scan_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_scan_profile_16_ws_pointer = parasail_nw_stats_scan_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_scan_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_scan_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_scan_profile_8_ws_pointer = parasail_nw_stats_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_scan_profile_8_ws_pointer = parasail_nw_stats_scan_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_scan_profile_8_ws_pointer = parasail_nw_stats_scan_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_scan_profile_8_ws_pointer = parasail_nw_stats_scan_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_scan_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_striped_profile_64_ws_pointer = parasail_nw_stats_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_striped_profile_64_ws_pointer = parasail_nw_stats_striped_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_striped_profile_64_ws_pointer = parasail_nw_stats_striped_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_striped_profile_64_ws_pointer = parasail_nw_stats_striped_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_striped_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_striped_profile_32_ws_pointer = parasail_nw_stats_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_striped_profile_32_ws_pointer = parasail_nw_stats_striped_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_striped_profile_32_ws_pointer = parasail_nw_stats_striped_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_striped_profile_32_ws_pointer = parasail_nw_stats_striped_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_striped_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_striped_profile_16_ws_pointer = parasail_nw_stats_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_striped_profile_16_ws_pointer = parasail_nw_stats_striped_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_striped_profile_16_ws_pointer = parasail_nw_stats_striped_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_striped_profile_16_ws_pointer = parasail_nw_stats_striped_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_striped_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_striped_profile_8_ws_pointer = parasail_nw_stats_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_striped_profile_8_ws_pointer = parasail_nw_stats_striped_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_striped_profile_8_ws_pointer = parasail_nw_stats_striped_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_striped_profile_8_ws_pointer = parasail_nw_stats_striped_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_striped_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_scan_profile_64_ws_pointer = parasail_nw_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_scan_profile_64_ws_pointer = parasail_nw_table_scan_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_scan_profile_64_ws_pointer = parasail_nw_table_scan_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_scan_profile_64_ws_pointer = parasail_nw_table_scan_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_scan_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_table_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_scan_profile_32_ws_pointer = parasail_nw_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_scan_profile_32_ws_pointer = parasail_nw_table_scan_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_scan_profile_32_ws_pointer = parasail_nw_table_scan_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_scan_profile_32_ws_pointer = parasail_nw_table_scan_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_scan_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_table_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_scan_profile_16_ws_pointer = parasail_nw_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_scan_profile_16_ws_pointer = parasail_nw_table_scan_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_scan_profile_16_ws_pointer = parasail_nw_table_scan_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_scan_profile_16_ws_pointer = parasail_nw_table_scan_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_scan_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_table_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_scan_profile_8_ws_pointer = parasail_nw_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_scan_profile_8_ws_pointer = parasail_nw_table_scan_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_scan_profile_8_ws_pointer = parasail_nw_table_scan_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_scan_profile_8_ws_pointer = parasail_nw_table_scan_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_scan_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_table_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_striped_profile_64_ws_pointer = parasail_nw_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_striped_profile_64_ws_pointer = parasail_nw_table_striped_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_striped_profile_64_ws_pointer = parasail_nw_table_striped_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_striped_profile_64_ws_pointer = parasail_nw_table_striped_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_striped_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_table_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_striped_profile_32_ws_pointer = parasail_nw_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_striped_profile_32_ws_pointer = parasail_nw_table_striped_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_striped_profile_32_ws_pointer = parasail_nw_table_striped_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_striped_profile_32_ws_pointer = parasail_nw_table_striped_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_striped_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_table_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_striped_profile_16_ws_pointer = parasail_nw_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_striped_profile_16_ws_pointer = parasail_nw_table_striped_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_striped_profile_16_ws_pointer = parasail_nw_table_striped_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_striped_profile_16_ws_pointer = parasail_nw_table_striped_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_striped_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_table_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_table_striped_profile_8_ws_pointer = parasail_nw_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_striped_profile_8_ws_pointer = parasail_nw_table_striped_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_striped_profile_8_ws_pointer = parasail_nw_table_striped_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_table_striped_profile_8_ws_pointer = parasail_nw_table_striped_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_table_striped_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_table_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_scan_profile_64_ws_pointer = parasail_nw_stats_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_scan_profile_64_ws_pointer = parasail_nw_stats_table_scan_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_scan_profile_64_ws_pointer = parasail_nw_stats_table_scan_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_scan_profile_64_ws_pointer = parasail_nw_stats_table_scan_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_scan_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_scan_profile_32_ws_pointer = parasail_nw_stats_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_scan_profile_32_ws_pointer = parasail_nw_stats_table_scan_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_scan_profile_32_ws_pointer = parasail_nw_stats_table_scan_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_scan_profile_32_ws_pointer = parasail_nw_stats_table_scan_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_scan_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_scan_profile_16_ws_pointer = parasail_nw_stats_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_scan_profile_16_ws_pointer = parasail_nw_stats_table_scan_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_scan_profile_16_ws_pointer = parasail_nw_stats_table_scan_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_scan_profile_16_ws_pointer = parasail_nw_stats_table_scan_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_scan_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_scan_profile_8_ws_pointer = parasail_nw_stats_table_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_scan_profile_8_ws_pointer = parasail_nw_stats_table_scan_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_scan_profile_8_ws_pointer = parasail_nw_stats_table_scan_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_scan_profile_8_ws_pointer = parasail_nw_stats_table_scan_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_scan_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_striped_profile_64_ws_pointer = parasail_nw_stats_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_striped_profile_64_ws_pointer = parasail_nw_stats_table_striped_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_striped_profile_64_ws_pointer = parasail_nw_stats_table_striped_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_striped_profile_64_ws_pointer = parasail_nw_stats_table_striped_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_striped_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_striped_profile_32_ws_pointer = parasail_nw_stats_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_striped_profile_32_ws_pointer = parasail_nw_stats_table_striped_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_striped_profile_32_ws_pointer = parasail_nw_stats_table_striped_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_striped_profile_32_ws_pointer = parasail_nw_stats_table_striped_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_striped_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_striped_profile_16_ws_pointer = parasail_nw_stats_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_striped_profile_16_ws_pointer = parasail_nw_stats_table_striped_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_striped_profile_16_ws_pointer = parasail_nw_stats_table_striped_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_striped_profile_16_ws_pointer = parasail_nw_stats_table_striped_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_striped_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_table_striped_profile_8_ws_pointer = parasail_nw_stats_table_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_table_striped_profile_8_ws_pointer = parasail_nw_stats_table_striped_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_table_striped_profile_8_ws_pointer = parasail_nw_stats_table_striped_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_table_striped_profile_8_ws_pointer = parasail_nw_stats_table_striped_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_table_striped_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_table_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_scan_profile_64_ws_pointer = parasail_nw_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_scan_profile_64_ws_pointer = parasail_nw_rowcol_scan_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_scan_profile_64_ws_pointer = parasail_nw_rowcol_scan_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_scan_profile_64_ws_pointer = parasail_nw_rowcol_scan_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_scan_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_scan_profile_32_ws_pointer = parasail_nw_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_scan_profile_32_ws_pointer = parasail_nw_rowcol_scan_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_scan_profile_32_ws_pointer = parasail_nw_rowcol_scan_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_scan_profile_32_ws_pointer = parasail_nw_rowcol_scan_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_scan_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_scan_profile_16_ws_pointer = parasail_nw_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_scan_profile_16_ws_pointer = parasail_nw_rowcol_scan_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_scan_profile_16_ws_pointer = parasail_nw_rowcol_scan_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_scan_profile_16_ws_pointer = parasail_nw_rowcol_scan_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_scan_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_scan_profile_8_ws_pointer = parasail_nw_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_scan_profile_8_ws_pointer = parasail_nw_rowcol_scan_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_scan_profile_8_ws_pointer = parasail_nw_rowcol_scan_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_scan_profile_8_ws_pointer = parasail_nw_rowcol_scan_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_scan_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_striped_profile_64_ws_pointer = parasail_nw_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_striped_profile_64_ws_pointer = parasail_nw_rowcol_striped_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_striped_profile_64_ws_pointer = parasail_nw_rowcol_striped_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_striped_profile_64_ws_pointer = parasail_nw_rowcol_striped_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_striped_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_striped_profile_32_ws_pointer = parasail_nw_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_striped_profile_32_ws_pointer = parasail_nw_rowcol_striped_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_striped_profile_32_ws_pointer = parasail_nw_rowcol_striped_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_striped_profile_32_ws_pointer = parasail_nw_rowcol_striped_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_striped_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_striped_profile_16_ws_pointer = parasail_nw_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_striped_profile_16_ws_pointer = parasail_nw_rowcol_striped_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_striped_profile_16_ws_pointer = parasail_nw_rowcol_striped_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_striped_profile_16_ws_pointer = parasail_nw_rowcol_striped_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_striped_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_rowcol_striped_profile_8_ws_pointer = parasail_nw_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_striped_profile_8_ws_pointer = parasail_nw_rowcol_striped_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_striped_profile_8_ws_pointer = parasail_nw_rowcol_striped_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_rowcol_striped_profile_8_ws_pointer = parasail_nw_rowcol_striped_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_rowcol_striped_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_scan_profile_64_ws_pointer = parasail_nw_stats_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_scan_profile_64_ws_pointer = parasail_nw_stats_rowcol_scan_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_scan_profile_64_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_scan_profile_64_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_scan_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_scan_profile_32_ws_pointer = parasail_nw_stats_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_scan_profile_32_ws_pointer = parasail_nw_stats_rowcol_scan_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_scan_profile_32_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_scan_profile_32_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_scan_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_scan_profile_16_ws_pointer = parasail_nw_stats_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_scan_profile_16_ws_pointer = parasail_nw_stats_rowcol_scan_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_scan_profile_16_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_scan_profile_16_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_scan_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_scan_profile_8_ws_pointer = parasail_nw_stats_rowcol_scan_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_scan_profile_8_ws_pointer = parasail_nw_stats_rowcol_scan_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_scan_profile_8_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_scan_profile_8_ws_pointer = parasail_nw_stats_rowcol_scan_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_scan_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_striped_profile_64_ws_pointer = parasail_nw_stats_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_striped_profile_64_ws_pointer = parasail_nw_stats_rowcol_striped_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_striped_profile_64_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_striped_profile_64_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_striped_profile_64_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_striped_profile_32_ws_pointer = parasail_nw_stats_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_striped_profile_32_ws_pointer = parasail_nw_stats_rowcol_striped_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_striped_profile_32_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_striped_profile_32_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_striped_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_striped_profile_16_ws_pointer = parasail_nw_stats_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_striped_profile_16_ws_pointer = parasail_nw_stats_rowcol_striped_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_striped_profile_16_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_striped_profile_16_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_striped_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        parasail_nw_stats_rowcol_striped_profile_8_ws_pointer = parasail_nw_stats_rowcol_striped_profile_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_stats_rowcol_striped_profile_8_ws_pointer = parasail_nw_stats_rowcol_striped_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_stats_rowcol_striped_profile_8_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_nw_stats_rowcol_striped_profile_8_ws_pointer = parasail_nw_stats_rowcol_striped_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#endif
+    {
+        parasail_nw_stats_rowcol_striped_profile_8_ws_pointer = NULL;
+    }
+    return parasail_nw_stats_rowcol_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t** parasail_nw_swipe_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_swipe_32_pointer = parasail_nw_swipe_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_swipe_32_pointer = parasail_nw_swipe_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_swipe_32_pointer = parasail_nw_swipe;
+    }
+    return parasail_nw_swipe_32_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_nw_swipe_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_swipe_16_pointer = parasail_nw_swipe_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_swipe_16_pointer = parasail_nw_swipe_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_swipe_16_pointer = parasail_nw_swipe;
+    }
+    return parasail_nw_swipe_16_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_nw_swipe_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_swipe_8_pointer = parasail_nw_swipe_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_swipe_8_pointer = parasail_nw_swipe_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_swipe_8_pointer = parasail_nw_swipe;
+    }
+    return parasail_nw_swipe_8_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_nw_packed_16_dispatcher(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_packed_16_pointer = parasail_nw_packed_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_packed_16_pointer = parasail_nw_packed_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_packed_16_pointer = parasail_nw_packed;
+    }
+    return parasail_nw_packed_16_pointer(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t** parasail_nw_packed_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_packed_profile_16_pointer = parasail_nw_packed_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_packed_profile_16_pointer = parasail_nw_packed_profile_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_packed_profile_16_pointer = parasail_nw_packed_profile;
+    }
+    return parasail_nw_packed_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t** parasail_nw_packed_8_dispatcher(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_packed_8_pointer = parasail_nw_packed_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_packed_8_pointer = parasail_nw_packed_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_packed_8_pointer = parasail_nw_packed;
+    }
+    return parasail_nw_packed_8_pointer(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t** parasail_nw_packed_profile_8_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_packed_profile_8_pointer = parasail_nw_packed_profile_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_packed_profile_8_pointer = parasail_nw_packed_profile_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_packed_profile_8_pointer = parasail_nw_packed_profile;
+    }
+    return parasail_nw_packed_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_trace_scan_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_trace_scan_32_pointer = parasail_nw_trace_scan_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_trace_scan_32_pointer = parasail_nw_trace_scan_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_trace_scan_32_pointer = parasail_nw_trace;
+    }
+    return parasail_nw_trace_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_trace_scan_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_trace_scan_16_pointer = parasail_nw_trace_scan_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_trace_scan_16_pointer = parasail_nw_trace_scan_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_trace_scan_16_pointer = parasail_nw_trace;
+    }
+    return parasail_nw_trace_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_trace_scan_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_trace_scan_8_pointer = parasail_nw_trace_scan_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_trace_scan_8_pointer = parasail_nw_trace_scan_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_trace_scan_8_pointer = parasail_nw_trace;
+    }
+    return parasail_nw_trace_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_banded_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_banded_32_pointer = parasail_nw_banded_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_banded_32_pointer = parasail_nw_banded_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_banded_32_pointer = parasail_nw_banded;
+    }
+    return parasail_nw_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_banded_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_banded_16_pointer = parasail_nw_banded_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_banded_16_pointer = parasail_nw_banded_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_banded_16_pointer = parasail_nw_banded;
+    }
+    return parasail_nw_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_banded_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_banded_8_pointer = parasail_nw_banded_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_banded_8_pointer = parasail_nw_banded_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_banded_8_pointer = parasail_nw_banded;
+    }
+    return parasail_nw_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_table_banded_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_banded_32_pointer = parasail_nw_table_banded_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_banded_32_pointer = parasail_nw_table_banded_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_banded_32_pointer = parasail_nw_banded_table;
+    }
+    return parasail_nw_table_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_table_banded_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_banded_16_pointer = parasail_nw_table_banded_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_banded_16_pointer = parasail_nw_table_banded_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_banded_16_pointer = parasail_nw_banded_table;
+    }
+    return parasail_nw_table_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_table_banded_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_banded_8_pointer = parasail_nw_table_banded_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_banded_8_pointer = parasail_nw_table_banded_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_banded_8_pointer = parasail_nw_banded_table;
+    }
+    return parasail_nw_table_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_banded_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_banded_32_pointer = parasail_nw_rowcol_banded_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_banded_32_pointer = parasail_nw_rowcol_banded_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_banded_32_pointer = parasail_nw_banded_rowcol;
+    }
+    return parasail_nw_rowcol_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_banded_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_banded_16_pointer = parasail_nw_rowcol_banded_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_banded_16_pointer = parasail_nw_rowcol_banded_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_banded_16_pointer = parasail_nw_banded_rowcol;
+    }
+    return parasail_nw_rowcol_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_banded_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_banded_8_pointer = parasail_nw_rowcol_banded_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_banded_8_pointer = parasail_nw_rowcol_banded_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_banded_8_pointer = parasail_nw_banded_rowcol;
+    }
+    return parasail_nw_rowcol_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_blocked_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_blocked_32_pointer = parasail_nw_blocked_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_blocked_32_pointer = parasail_nw_blocked_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_blocked_32_pointer = parasail_nw;
+    }
+    return parasail_nw_blocked_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_blocked_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_blocked_profile_32_pointer = parasail_nw_blocked_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_blocked_profile_32_pointer = parasail_nw_blocked_profile_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_blocked_profile_32_pointer = NULL;
+    }
+    return parasail_nw_blocked_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_blocked_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_blocked_profile_32_ws_pointer = parasail_nw_blocked_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_blocked_profile_32_ws_pointer = parasail_nw_blocked_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_blocked_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_blocked_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_blocked_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_blocked_16_pointer = parasail_nw_blocked_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_blocked_16_pointer = parasail_nw_blocked_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_blocked_16_pointer = parasail_nw;
+    }
+    return parasail_nw_blocked_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_blocked_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_blocked_profile_16_pointer = parasail_nw_blocked_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_blocked_profile_16_pointer = parasail_nw_blocked_profile_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_blocked_profile_16_pointer = NULL;
+    }
+    return parasail_nw_blocked_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_blocked_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_blocked_profile_16_ws_pointer = parasail_nw_blocked_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_blocked_profile_16_ws_pointer = parasail_nw_blocked_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_blocked_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_blocked_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_blocked_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_blocked_32_pointer = parasail_nw_table_blocked_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_blocked_32_pointer = parasail_nw_table_blocked_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_blocked_32_pointer = parasail_nw_table;
+    }
+    return parasail_nw_table_blocked_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_blocked_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_blocked_profile_32_pointer = parasail_nw_table_blocked_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_blocked_profile_32_pointer = parasail_nw_table_blocked_profile_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_blocked_profile_32_pointer = NULL;
+    }
+    return parasail_nw_table_blocked_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_blocked_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_blocked_profile_32_ws_pointer = parasail_nw_table_blocked_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_blocked_profile_32_ws_pointer = parasail_nw_table_blocked_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_blocked_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_table_blocked_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_blocked_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_blocked_16_pointer = parasail_nw_table_blocked_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_blocked_16_pointer = parasail_nw_table_blocked_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_blocked_16_pointer = parasail_nw_table;
+    }
+    return parasail_nw_table_blocked_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_blocked_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_blocked_profile_16_pointer = parasail_nw_table_blocked_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_blocked_profile_16_pointer = parasail_nw_table_blocked_profile_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_blocked_profile_16_pointer = NULL;
+    }
+    return parasail_nw_table_blocked_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_blocked_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_blocked_profile_16_ws_pointer = parasail_nw_table_blocked_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_blocked_profile_16_ws_pointer = parasail_nw_table_blocked_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_blocked_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_table_blocked_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_blocked_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_blocked_32_pointer = parasail_nw_rowcol_blocked_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_blocked_32_pointer = parasail_nw_rowcol_blocked_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_blocked_32_pointer = parasail_nw_rowcol;
+    }
+    return parasail_nw_rowcol_blocked_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_blocked_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_blocked_profile_32_pointer = parasail_nw_rowcol_blocked_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_blocked_profile_32_pointer = parasail_nw_rowcol_blocked_profile_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_blocked_profile_32_pointer = NULL;
+    }
+    return parasail_nw_rowcol_blocked_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_blocked_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_blocked_profile_32_ws_pointer = parasail_nw_rowcol_blocked_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_blocked_profile_32_ws_pointer = parasail_nw_rowcol_blocked_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_blocked_profile_32_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_blocked_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_blocked_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_blocked_16_pointer = parasail_nw_rowcol_blocked_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_blocked_16_pointer = parasail_nw_rowcol_blocked_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_blocked_16_pointer = parasail_nw_rowcol;
+    }
+    return parasail_nw_rowcol_blocked_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_blocked_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_blocked_profile_16_pointer = parasail_nw_rowcol_blocked_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_blocked_profile_16_pointer = parasail_nw_rowcol_blocked_profile_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_blocked_profile_16_pointer = NULL;
+    }
+    return parasail_nw_rowcol_blocked_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_blocked_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_blocked_profile_16_ws_pointer = parasail_nw_rowcol_blocked_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_blocked_profile_16_ws_pointer = parasail_nw_rowcol_blocked_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_blocked_profile_16_ws_pointer = NULL;
+    }
+    return parasail_nw_rowcol_blocked_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_short_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_32_pointer = parasail_nw_short_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_32_pointer = parasail_nw_short_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_32_pointer = parasail_nw_striped_32;
+    }
+    return parasail_nw_short_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_short_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_profile_32_pointer = parasail_nw_short_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_profile_32_pointer = parasail_nw_short_profile_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_profile_32_pointer = parasail_nw_striped_profile_32;
+    }
+    return parasail_nw_short_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_short_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_profile_32_ws_pointer = parasail_nw_short_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_profile_32_ws_pointer = parasail_nw_short_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_profile_32_ws_pointer = parasail_nw_striped_profile_32_ws;
+    }
+    return parasail_nw_short_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_short_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_16_pointer = parasail_nw_short_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_16_pointer = parasail_nw_short_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_16_pointer = parasail_nw_striped_16;
+    }
+    return parasail_nw_short_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_short_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_profile_16_pointer = parasail_nw_short_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_profile_16_pointer = parasail_nw_short_profile_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_profile_16_pointer = parasail_nw_striped_profile_16;
+    }
+    return parasail_nw_short_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_short_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_profile_16_ws_pointer = parasail_nw_short_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_profile_16_ws_pointer = parasail_nw_short_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_profile_16_ws_pointer = parasail_nw_striped_profile_16_ws;
+    }
+    return parasail_nw_short_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_short_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_8_pointer = parasail_nw_short_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_8_pointer = parasail_nw_short_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_8_pointer = parasail_nw_striped_8;
+    }
+    return parasail_nw_short_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_short_profile_8_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_profile_8_pointer = parasail_nw_short_profile_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_profile_8_pointer = parasail_nw_short_profile_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_profile_8_pointer = parasail_nw_striped_profile_8;
+    }
+    return parasail_nw_short_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_short_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_short_profile_8_ws_pointer = parasail_nw_short_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_short_profile_8_ws_pointer = parasail_nw_short_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_short_profile_8_ws_pointer = parasail_nw_striped_profile_8_ws;
+    }
+    return parasail_nw_short_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_short_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_32_pointer = parasail_nw_table_short_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_32_pointer = parasail_nw_table_short_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_32_pointer = parasail_nw_table_striped_32;
+    }
+    return parasail_nw_table_short_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_short_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_profile_32_pointer = parasail_nw_table_short_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_profile_32_pointer = parasail_nw_table_short_profile_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_profile_32_pointer = parasail_nw_table_striped_profile_32;
+    }
+    return parasail_nw_table_short_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_short_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_profile_32_ws_pointer = parasail_nw_table_short_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_profile_32_ws_pointer = parasail_nw_table_short_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_profile_32_ws_pointer = parasail_nw_table_striped_profile_32_ws;
+    }
+    return parasail_nw_table_short_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_short_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_16_pointer = parasail_nw_table_short_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_16_pointer = parasail_nw_table_short_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_16_pointer = parasail_nw_table_striped_16;
+    }
+    return parasail_nw_table_short_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_short_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_profile_16_pointer = parasail_nw_table_short_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_profile_16_pointer = parasail_nw_table_short_profile_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_profile_16_pointer = parasail_nw_table_striped_profile_16;
+    }
+    return parasail_nw_table_short_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_short_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_profile_16_ws_pointer = parasail_nw_table_short_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_profile_16_ws_pointer = parasail_nw_table_short_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_profile_16_ws_pointer = parasail_nw_table_striped_profile_16_ws;
+    }
+    return parasail_nw_table_short_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_table_short_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_8_pointer = parasail_nw_table_short_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_8_pointer = parasail_nw_table_short_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_8_pointer = parasail_nw_table_striped_8;
+    }
+    return parasail_nw_table_short_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_short_profile_8_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_profile_8_pointer = parasail_nw_table_short_profile_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_profile_8_pointer = parasail_nw_table_short_profile_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_profile_8_pointer = parasail_nw_table_striped_profile_8;
+    }
+    return parasail_nw_table_short_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_short_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_table_short_profile_8_ws_pointer = parasail_nw_table_short_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_table_short_profile_8_ws_pointer = parasail_nw_table_short_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_table_short_profile_8_ws_pointer = parasail_nw_table_striped_profile_8_ws;
+    }
+    return parasail_nw_table_short_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_32_pointer = parasail_nw_rowcol_short_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_32_pointer = parasail_nw_rowcol_short_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_32_pointer = parasail_nw_rowcol_striped_32;
+    }
+    return parasail_nw_rowcol_short_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_profile_32_pointer = parasail_nw_rowcol_short_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_profile_32_pointer = parasail_nw_rowcol_short_profile_sse41_128_32;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_profile_32_pointer = parasail_nw_rowcol_striped_profile_32;
+    }
+    return parasail_nw_rowcol_short_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_profile_32_ws_pointer = parasail_nw_rowcol_short_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_profile_32_ws_pointer = parasail_nw_rowcol_short_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_profile_32_ws_pointer = parasail_nw_rowcol_striped_profile_32_ws;
+    }
+    return parasail_nw_rowcol_short_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_16_pointer = parasail_nw_rowcol_short_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_16_pointer = parasail_nw_rowcol_short_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_16_pointer = parasail_nw_rowcol_striped_16;
+    }
+    return parasail_nw_rowcol_short_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_profile_16_pointer = parasail_nw_rowcol_short_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_profile_16_pointer = parasail_nw_rowcol_short_profile_sse41_128_16;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_profile_16_pointer = parasail_nw_rowcol_striped_profile_16;
+    }
+    return parasail_nw_rowcol_short_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_profile_16_ws_pointer = parasail_nw_rowcol_short_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_profile_16_ws_pointer = parasail_nw_rowcol_short_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_profile_16_ws_pointer = parasail_nw_rowcol_striped_profile_16_ws;
+    }
+    return parasail_nw_rowcol_short_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_8_pointer = parasail_nw_rowcol_short_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_8_pointer = parasail_nw_rowcol_short_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_8_pointer = parasail_nw_rowcol_striped_8;
+    }
+    return parasail_nw_rowcol_short_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_profile_8_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_profile_8_pointer = parasail_nw_rowcol_short_profile_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_profile_8_pointer = parasail_nw_rowcol_short_profile_sse41_128_8;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_profile_8_pointer = parasail_nw_rowcol_striped_profile_8;
+    }
+    return parasail_nw_rowcol_short_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_short_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_nw_rowcol_short_profile_8_ws_pointer = parasail_nw_rowcol_short_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_nw_rowcol_short_profile_8_ws_pointer = parasail_nw_rowcol_short_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+    {
+        parasail_nw_rowcol_short_profile_8_ws_pointer = parasail_nw_rowcol_striped_profile_8_ws;
+    }
+    return parasail_nw_rowcol_short_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+
+/* implementation which simply calls the pointer,
+ * first time it's the dispatcher, otherwise it's correct impl */
+
+parasail_result_t* parasail_nw_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_table_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_table_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_rowcol_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_nw_stats_rowcol_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_nw_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_table_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_table_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_rowcol_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_rowcol_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_rowcol_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_rowcol_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_rowcol_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_rowcol_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_rowcol_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return parasail_nw_stats_rowcol_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
 {
-    return parasail_nw_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_table_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_table_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_rowcol_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_stats_rowcol_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_diag_64(
+parasail_result_t** parasail_nw_swipe_32(
         const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_rowcol_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_swipe_32_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_rowcol_diag_32(
+parasail_result_t** parasail_nw_swipe_16(
         const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_rowcol_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_swipe_16_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_rowcol_diag_16(
+parasail_result_t** parasail_nw_swipe_8(
         const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_rowcol_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_swipe_8_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
 }
-
-parasail_result_t* parasail_nw_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+
+parasail_result_t** parasail_nw_packed_16(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_rowcol_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_packed_16_pointer(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t** parasail_nw_packed_profile_16(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        const int open, const int gap)
 {
-    return parasail_nw_stats_rowcol_scan_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_packed_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t** parasail_nw_packed_8(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_packed_8_pointer(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+parasail_result_t** parasail_nw_packed_profile_8(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
+        const int open, const int gap)
 {
-    return parasail_nw_stats_rowcol_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_packed_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_8(
+parasail_result_t* parasail_nw_trace_scan_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_trace_scan_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_64(
+parasail_result_t* parasail_nw_trace_scan_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_striped_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_trace_scan_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_32(
+parasail_result_t* parasail_nw_trace_scan_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_striped_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_trace_scan_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_16(
+parasail_result_t* parasail_nw_banded_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_striped_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_8(
+parasail_result_t* parasail_nw_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_striped_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_diag_64(
+parasail_result_t* parasail_nw_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_diag_64_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_diag_32(
+parasail_result_t* parasail_nw_table_banded_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_diag_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_diag_16(
+parasail_result_t* parasail_nw_table_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_diag_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_diag_8(
+parasail_result_t* parasail_nw_table_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_diag_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+    return parasail_nw_table_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_banded_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_banded_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_banded_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
 }
 
-parasail_result_t* parasail_nw_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_blocked_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_blocked_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_striped_profile_64(
+parasail_result_t* parasail_nw_blocked_profile_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_blocked_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_striped_profile_32(
+parasail_result_t* parasail_nw_blocked_profile_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_blocked_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_blocked_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_blocked_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_striped_profile_8(
+parasail_result_t* parasail_nw_blocked_profile_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_blocked_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_scan_profile_64(
+parasail_result_t* parasail_nw_blocked_profile_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_blocked_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_table_blocked_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_blocked_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_scan_profile_16(
+parasail_result_t* parasail_nw_table_blocked_profile_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_blocked_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_scan_profile_8(
+parasail_result_t* parasail_nw_table_blocked_profile_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_blocked_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_table_blocked_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_blocked_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_striped_profile_32(
+parasail_result_t* parasail_nw_table_blocked_profile_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_blocked_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_striped_profile_16(
+parasail_result_t* parasail_nw_table_blocked_profile_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_blocked_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_blocked_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_blocked_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_table_scan_profile_64(
+parasail_result_t* parasail_nw_rowcol_blocked_profile_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_table_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_blocked_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_table_scan_profile_32(
+parasail_result_t* parasail_nw_rowcol_blocked_profile_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_blocked_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_blocked_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_table_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_blocked_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_table_scan_profile_8(
+parasail_result_t* parasail_nw_rowcol_blocked_profile_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_table_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_blocked_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_table_striped_profile_64(
+parasail_result_t* parasail_nw_rowcol_blocked_profile_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_blocked_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_table_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_short_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_table_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_table_striped_profile_16(
+parasail_result_t* parasail_nw_short_profile_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_table_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_table_striped_profile_8(
+parasail_result_t* parasail_nw_short_profile_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_table_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_short_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_table_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_profile_32(
+parasail_result_t* parasail_nw_short_profile_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_table_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_profile_16(
+parasail_result_t* parasail_nw_short_profile_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_short_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_table_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_profile_64(
+parasail_result_t* parasail_nw_short_profile_8(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_table_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_profile_32(
+parasail_result_t* parasail_nw_short_profile_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_table_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_short_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_table_short_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_table_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_table_striped_profile_8(
+parasail_result_t* parasail_nw_table_short_profile_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_table_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_profile_64(
+parasail_result_t* parasail_nw_table_short_profile_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_table_short_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_rowcol_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_profile_16(
+parasail_result_t* parasail_nw_table_short_profile_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_rowcol_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_rowcol_scan_profile_8(
+parasail_result_t* parasail_nw_table_short_profile_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_table_short_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_rowcol_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_profile_32(
+parasail_result_t* parasail_nw_table_short_profile_8(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_rowcol_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_profile_16(
+parasail_result_t* parasail_nw_table_short_profile_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_rowcol_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_table_short_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_rowcol_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_short_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_rowcol_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_32_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64(
+parasail_result_t* parasail_nw_rowcol_short_profile_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_rowcol_scan_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_profile_32_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32(
+parasail_result_t* parasail_nw_rowcol_short_profile_32_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_rowcol_scan_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_short_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_scan_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_16_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8(
+parasail_result_t* parasail_nw_rowcol_short_profile_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_rowcol_scan_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_profile_16_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64(
+parasail_result_t* parasail_nw_rowcol_short_profile_16_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_rowcol_striped_profile_64_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_rowcol_short_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
 {
-    return parasail_nw_stats_rowcol_striped_profile_32_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_8_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16(
+parasail_result_t* parasail_nw_rowcol_short_profile_8(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-    return parasail_nw_stats_rowcol_striped_profile_16_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8(
+parasail_result_t* parasail_nw_rowcol_short_profile_8_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
-    return parasail_nw_stats_rowcol_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
+    return parasail_nw_rowcol_short_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace);
 }
 
@@ -0,0 +1,210 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF INT8_MIN
+
+#define _mm256_alignr_epi8_rpl(a,b,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(b, a, _MM_SHUFFLE(0,2,0,1)), imm)
+
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+
+#define FNAME parasail_nw_packed_avx2_256_8
+#define PNAME parasail_nw_packed_profile_avx2_256_8
+#define SNAME parasail_nw_striped_avx2_256_8
+
+parasail_result_t** FNAME(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int segWidth = 32; /* number of values in vector unit */
+    parasail_result_t **results = NULL;
+    int q = 0;
+    int i = 0;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s1Count);
+    while (q < s1Count) {
+        parasail_profile_t *profile = NULL;
+        parasail_result_t **packed = NULL;
+        /* a query too long to share a vector is aligned on its own */
+        if (s1Lens[q] > segWidth) {
+            results[q] = SNAME(s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+            ++q;
+            continue;
+        }
+        profile = parasail_profile_create_packed_avx_256_8(
+                s1s + q, s1Lens + q, s1Count - q, matrix);
+        packed = PNAME(profile, s2, s2Len, open, gap);
+        for (i=0; i<profile->packed_count; ++i) {
+            results[q++] = packed[i];
+        }
+        free(packed);
+        parasail_profile_free(profile);
+    }
+
+    return results;
+}
+
+/* Several queries sit side by side in one vector, each as in the short
+ * kernel. The diagonal and the F carry are cut at the first lane of
+ * every query and vFront never reaches across one, so no cell sees a
+ * row of its neighbour. */
+parasail_result_t** PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int q = 0;
+    const int count = profile->packed_count;
+    const int * const restrict begin = profile->packed_begin;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    const __m256i* const restrict vProfile = (__m256i*)profile->profile8.score;
+    __m256i vGapO = _mm256_set1_epi8(open);
+    __m256i vGapE = _mm256_set1_epi8(gap);
+    __m256i vFront[5];
+    __m256i vFirst;
+    __m256i vH;
+    __m256i vE;
+    __m256i_8_t h;
+    __m256i_8_t lo;
+    __m256i_8_t hi;
+    int lane_row[32];
+    const int8_t NEG_LIMIT = (-open < matrix->min ?
+        INT8_MIN + open : INT8_MIN - matrix->min) + 1;
+    const int8_t POS_LIMIT = INT8_MAX - matrix->max - 1;
+    __m256i vSaturationCheckMin = _mm256_set1_epi8(POS_LIMIT);
+    __m256i vSaturationCheckMax = _mm256_set1_epi8(NEG_LIMIT);
+    parasail_result_t **results = NULL;
+
+    /* the row of each lane within its query, the lanes past the last
+     * query counting on from it */
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+    for (q=0; q<count; ++q) {
+        results[q] = parasail_result_new();
+        for (i=begin[q]; i<begin[q+1]; ++i) {
+            lane_row[i] = i - begin[q];
+        }
+    }
+    for (i=begin[count]; i<segWidth; ++i) {
+        lane_row[i] = i - begin[count];
+    }
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * fills from above the first row of their query get nothing */
+    for (k=0; k<5; ++k) {
+        const int32_t lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            int64_t tmp = -(int64_t)lanes*gap;
+            h.v[i] = (lane_row[i] < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = h.m;
+    }
+
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = 0 == lane_row[i] ? -1 : 0;
+    }
+    vFirst = h.m;
+
+    /* initialize H and E */
+    for (i=0; i<segWidth; ++i) {
+        int64_t tmp = -open-gap*(int64_t)lane_row[i];
+        h.v[i] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+    vH = h.m;
+    for (i=0; i<segWidth; ++i) {
+        int64_t tmp = -open-gap*(int64_t)lane_row[i] - open;
+        h.v[i] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+    vE = h.m;
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        /* the upper boundary: H above row 0 in columns j-1 and j */
+        const int64_t diag = 0 == j ? 0 : -open-gap*(int64_t)(j-1);
+        const int64_t above = -open-gap*(int64_t)j;
+        __m256i vHp = _mm256_set1_epi8(diag < NEG_INF ? NEG_INF : diag);
+        __m256i vFin = _mm256_set1_epi8(above-open < NEG_INF ? NEG_INF : above-open);
+        __m256i vF;
+        __m256i vT;
+
+        vH = _mm256_alignr_epi8_rpl(vH, vHp, 15);
+        vH = _mm256_blendv_epi8(vH, vHp, vFirst);
+        vH = _mm256_adds_epi8(vH, _mm256_load_si256(vProfile + matrix->mapper[(unsigned char)s2[j]]));
+        vH = _mm256_max_epi8(vH, vE);
+
+        /* resolve F down each query with a log-step prefix max */
+        vF = _mm256_alignr_epi8_rpl(_mm256_subs_epi8(vH, vGapO), vFin, 15);
+        vF = _mm256_blendv_epi8(vF, vFin, vFirst);
+        do {
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 1), vFront[0]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 2), vFront[1]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 4), vFront[2]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 8), vFront[3]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 16), vFront[4]));
+            vF = vT;
+        } while (0);
+        vH = _mm256_max_epi8(vH, vF);
+        vE = _mm256_max_epi8(_mm256_subs_epi8(vE, vGapE), _mm256_subs_epi8(vH, vGapO));
+        vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vH);
+        vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vH);
+    }
+
+    h.m = vH;
+    lo.m = vSaturationCheckMin;
+    hi.m = vSaturationCheckMax;
+    for (q=0; q<count; ++q) {
+        parasail_result_t *result = results[q];
+        result->score = h.v[begin[q+1]-1];
+        result->end_query = begin[q+1] - begin[q] - 1;
+        result->end_ref = s2Len - 1;
+        /* only the lanes of this query */
+        for (i=begin[q]; i<begin[q+1]; ++i) {
+            if (lo.v[i] < NEG_LIMIT || hi.v[i] > POS_LIMIT) {
+                result->saturated = 1;
+                result->score = INT8_MAX;
+                result->end_query = 0;
+                result->end_ref = 0;
+                break;
+            }
+        }
+    }
+
+    return results;
+}
+
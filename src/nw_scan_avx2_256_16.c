@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -69,6 +70,197 @@ static inline void arr_store_si256(
     array[(14*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 14);
     array[(15*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 15);
 }
+
+/* transpose vector t of four buffered columns into the table so that each
+ * query position receives the four adjacent entries d..d+3 */
+static inline void arr_store_block(
+        int *array,
+        const __m256i *buf,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    __m128i x[4][4];
+    int32_t c = 0;
+    int32_t k = 0;
+    for (c=0; c<4; ++c) {
+        __m256i vH = _mm256_load_si256(buf + c*seglen + t);
+        __m128i h;
+        h = _mm256_castsi256_si128(vH);
+        x[c][0] = _mm_srai_epi32(_mm_unpacklo_epi16(h, h), 16);
+        x[c][1] = _mm_srai_epi32(_mm_unpackhi_epi16(h, h), 16);
+        h = _mm256_extracti128_si256(vH, 1);
+        x[c][2] = _mm_srai_epi32(_mm_unpacklo_epi16(h, h), 16);
+        x[c][3] = _mm_srai_epi32(_mm_unpackhi_epi16(h, h), 16);
+    }
+    for (k=0; k<4; ++k) {
+        __m128i t0 = _mm_unpacklo_epi32(x[0][k], x[1][k]);
+        __m128i t1 = _mm_unpacklo_epi32(x[2][k], x[3][k]);
+        __m128i t2 = _mm_unpackhi_epi32(x[0][k], x[1][k]);
+        __m128i t3 = _mm_unpackhi_epi32(x[2][k], x[3][k]);
+        int *row = array + (4*k*seglen+t)*dlen + d;
+        _mm_storeu_si128((__m128i*)(row), _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + seglen*dlen), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + 2*seglen*dlen), _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128((__m128i*)(row + 3*seglen*dlen), _mm_unpackhi_epi64(t2, t3));
+    }
+}
+
+static inline void arr_store_si256_narrow(
+        void *array,
+        __m256i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    int16_t *table = (int16_t*)array;
+    table[(0*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 0);
+    table[(1*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 1);
+    table[(2*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 2);
+    table[(3*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 3);
+    table[(4*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 4);
+    table[(5*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 5);
+    table[(6*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 6);
+    table[(7*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 7);
+    table[(8*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 8);
+    table[(9*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 9);
+    table[(10*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 10);
+    table[(11*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 11);
+    table[(12*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 12);
+    table[(13*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 13);
+    table[(14*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 14);
+    table[(15*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 15);
+}
+
+static inline void arr_store_block_narrow(
+        void *array,
+        const __m256i *buf,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    int16_t *table = (int16_t*)array;
+    __m128i x[4][2];
+    int32_t c = 0;
+    int32_t k = 0;
+    for (c=0; c<4; ++c) {
+        __m256i vH = _mm256_load_si256(buf + c*seglen + t);
+        x[c][0] = _mm256_castsi256_si128(vH);
+        x[c][1] = _mm256_extracti128_si256(vH, 1);
+    }
+    for (k=0; k<2; ++k) {
+        __m128i a = _mm_unpacklo_epi16(x[0][k], x[1][k]);
+        __m128i b = _mm_unpacklo_epi16(x[2][k], x[3][k]);
+        __m128i e = _mm_unpackhi_epi16(x[0][k], x[1][k]);
+        __m128i f = _mm_unpackhi_epi16(x[2][k], x[3][k]);
+        __m128i r0 = _mm_unpacklo_epi32(a, b);
+        __m128i r1 = _mm_unpackhi_epi32(a, b);
+        __m128i r2 = _mm_unpacklo_epi32(e, f);
+        __m128i r3 = _mm_unpackhi_epi32(e, f);
+        int16_t *row = table + (8*k*seglen+t)*dlen + d;
+        _mm_storel_epi64((__m128i*)(row), r0);
+        _mm_storel_epi64((__m128i*)(row + seglen*dlen), _mm_srli_si128(r0, 8));
+        _mm_storel_epi64((__m128i*)(row + 2*seglen*dlen), r1);
+        _mm_storel_epi64((__m128i*)(row + 3*seglen*dlen), _mm_srli_si128(r1, 8));
+        _mm_storel_epi64((__m128i*)(row + 4*seglen*dlen), r2);
+        _mm_storel_epi64((__m128i*)(row + 5*seglen*dlen), _mm_srli_si128(r2, 8));
+        _mm_storel_epi64((__m128i*)(row + 6*seglen*dlen), r3);
+        _mm_storel_epi64((__m128i*)(row + 7*seglen*dlen), _mm_srli_si128(r3, 8));
+    }
+}
+
+/* write the rows of column d inside window to a table holding only the
+ * window; the cells are read in place, windows are meant to be small */
+static inline void arr_store_window(
+        int *array,
+        const __m256i *column,
+        int32_t seglen,
+        int32_t d,
+        const parasail_window_t *window,
+        int type)
+{
+    const int16_t *v = (const int16_t*)column;
+    int32_t cols = window->ref_end - window->ref_begin;
+    int32_t i = 0;
+    if (d < window->ref_begin || d >= window->ref_end) {
+        return;
+    }
+    for (i=window->query_begin; i<window->query_end; ++i) {
+        size_t index = (size_t)(i-window->query_begin)*cols + (d-window->ref_begin);
+        int value = (int)v[(i%seglen)*16 + i/seglen];
+        if (PARASAIL_TABLE_INT == type) {
+            array[index] = value;
+        }
+        else {
+            ((int16_t*)array)[index] = (int16_t)value;
+        }
+    }
+}
+
+/* buffer column d; the table, of PARASAIL_TABLE_* type, is written
+ * once four columns are buffered */
+static inline void arr_store_table(
+        int *array,
+        __m256i *buf,
+        const __m256i *column,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result)
+{
+    int32_t c = d % 4;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        arr_store_window(array, column, seglen, d, &result->window,
+                result->table_type);
+        return;
+    }
+    for (t=0; t<seglen; ++t) {
+        _mm256_store_si256(buf + c*seglen + t, _mm256_load_si256(column + t));
+    }
+    if (3 == c) {
+        if (PARASAIL_TABLE_INT == result->table_type) {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block(array, buf, t, seglen, d-3, dlen);
+            }
+        }
+        else {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block_narrow(array, buf, t, seglen, d-3, dlen);
+            }
+        }
+    }
+}
+
+/* write the columns still buffered when the loop ended before column d */
+static inline void arr_store_table_end(
+        int *array,
+        const __m256i *buf,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result)
+{
+    int32_t c = d % 4;
+    int32_t k = 0;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        return;
+    }
+    for (k=0; k<c; ++k) {
+        for (t=0; t<seglen; ++t) {
+            if (PARASAIL_TABLE_INT == result->table_type) {
+                arr_store_si256(array, buf[k*seglen+t], t, seglen, d-c+k, dlen);
+            }
+            else {
+                arr_store_si256_narrow(array, buf[k*seglen+t], t, seglen, d-c+k, dlen);
+            }
+        }
+    }
+}
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -100,13 +292,16 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME parasail_nw_table_scan_avx2_256_16
 #define PNAME parasail_nw_table_scan_profile_avx2_256_16
+#define WNAME parasail_nw_table_scan_profile_avx2_256_16_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME parasail_nw_rowcol_scan_avx2_256_16
 #define PNAME parasail_nw_rowcol_scan_profile_avx2_256_16
+#define WNAME parasail_nw_rowcol_scan_profile_avx2_256_16_ws
 #else
 #define FNAME parasail_nw_scan_avx2_256_16
 #define PNAME parasail_nw_scan_profile_avx2_256_16
+#define WNAME parasail_nw_scan_profile_avx2_256_16_ws
 #endif
 #endif
 
@@ -125,6 +320,21 @@ parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -138,11 +348,11 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     __m256i* const restrict pvP = (__m256i*)profile->profile16.score;
-    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
-    int16_t* const restrict boundary = parasail_memalign_int16_t(32, s2Len+1);
-    __m256i* const restrict pvHt= parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvH = parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvGapper = parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvE = parasail_workspace___m256i(workspace, 0, segLen);
+    int16_t* const restrict boundary = parasail_workspace_int16_t(workspace, 1, s2Len+1);
+    __m256i* const restrict pvHt = parasail_workspace___m256i(workspace, 2, segLen);
+    __m256i* const restrict pvH = parasail_workspace___m256i(workspace, 3, segLen);
+    __m256i* const restrict pvGapper = parasail_workspace___m256i(workspace, 4, segLen);
     __m256i vGapO = _mm256_set1_epi16(open);
     __m256i vGapE = _mm256_set1_epi16(gap);
     const int16_t NEG_LIMIT = (-open < matrix->min ?
@@ -158,7 +368,11 @@ parasail_result_t* PNAME(
     __m256i vSegLenXgap = _mm256_add_epi16(vNegInfFront,
             _mm256_slli_si256_rpl(_mm256_set1_epi16(-segLen*gap), 2));
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table1_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? PARASAIL_TABLE_INT16 : PARASAIL_TABLE_INT,
+            &profile->window);
+    __m256i* const restrict pvHTable = parasail_memalign___m256i(32, 4*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
@@ -260,10 +474,11 @@ parasail_result_t* PNAME(
             _mm256_store_si256(pvH+i, vH);
             vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vH);
             vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vH);
+        } 
+
 #ifdef PARASAIL_TABLE
-            arr_store_si256(result->score_table, vH, i, segLen, j, s2Len);
+        arr_store_table(result->score_table, pvHTable, pvH, segLen, j, s2Len, result);
 #endif
-        } 
 
 
 #ifdef PARASAIL_ROWCOL
@@ -278,6 +493,10 @@ parasail_result_t* PNAME(
 #endif
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
     for (i=0; i<segLen; ++i) {
         __m256i vH = _mm256_load_si256(pvH+i);
@@ -307,11 +526,9 @@ parasail_result_t* PNAME(
     result->end_query = end_query;
     result->end_ref = end_ref;
 
-    parasail_free(pvGapper);
-    parasail_free(pvH);
-    parasail_free(pvHt);
-    parasail_free(boundary);
-    parasail_free(pvE);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
@@ -0,0 +1,241 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF INT8_MIN
+
+#define _mm256_cmplt_epi8_rpl(a,b) _mm256_cmpgt_epi8(b,a)
+
+#define _mm256_alignr_epi8_rpl(a,b,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(b, a, _MM_SHUFFLE(0,2,0,1)), imm)
+
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_short_avx2_256_8
+#define PNAME parasail_nw_table_short_profile_avx2_256_8
+#define WNAME parasail_nw_table_short_profile_avx2_256_8_ws
+#define SNAME parasail_nw_table_striped_profile_avx2_256_8_ws
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_short_avx2_256_8
+#define PNAME parasail_nw_rowcol_short_profile_avx2_256_8
+#define WNAME parasail_nw_rowcol_short_profile_avx2_256_8_ws
+#define SNAME parasail_nw_rowcol_striped_profile_avx2_256_8_ws
+#else
+#define FNAME parasail_nw_short_avx2_256_8
+#define PNAME parasail_nw_short_profile_avx2_256_8
+#define WNAME parasail_nw_short_profile_avx2_256_8_ws
+#define SNAME parasail_nw_striped_profile_avx2_256_8_ws
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx_256_8(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+/* A query of at most one vector sits in the striped profile in order,
+ * one vector per database letter. H and E stay in registers and F is
+ * resolved once per column, where the striped kernel would rerun its
+ * lazy F loop over a single segment. */
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    const __m256i* const restrict vProfile = (__m256i*)profile->profile8.score;
+    __m256i vGapO = _mm256_set1_epi8(open);
+    __m256i vGapE = _mm256_set1_epi8(gap);
+    __m256i vFront[5];
+    __m256i vH;
+    __m256i vE;
+    __m256i_8_t h;
+    const int8_t NEG_LIMIT = (-open < matrix->min ?
+        INT8_MIN + open : INT8_MIN - matrix->min) + 1;
+    const int8_t POS_LIMIT = INT8_MAX - matrix->max - 1;
+    int8_t score = NEG_INF;
+    __m256i vNegLimit = _mm256_set1_epi8(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi8(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+    parasail_result_t *result = NULL;
+
+    /* longer queries, and the stop and X-drop settings, are left to
+     * the striped kernel */
+    if (s1Len > segWidth || INT32_MAX != profile->stop
+            || (profile->stop_mode & PARASAIL_STOP_UNREACHABLE)
+            || INT32_MAX != profile->xdrop) {
+        return SNAME(profile, s2, s2Len, open, gap, workspace);
+    }
+
+#ifdef PARASAIL_TABLE
+    /* as are narrow and windowed tables */
+    if (profile->narrow_tables || profile->window.query_end) {
+        return SNAME(profile, s2, s2Len, open, gap, workspace);
+    }
+    result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    result = parasail_result_new();
+#endif
+#endif
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * leaves empty have nothing above them */
+    for (k=0; k<5; ++k) {
+        const int32_t lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            int64_t tmp = -(int64_t)lanes*gap;
+            h.v[i] = (i < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = h.m;
+    }
+
+    /* initialize H and E */
+    for (i=0; i<segWidth; ++i) {
+        int64_t tmp = -open-gap*(int64_t)i;
+        h.v[i] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+    vH = h.m;
+    for (i=0; i<segWidth; ++i) {
+        int64_t tmp = -open-gap*(int64_t)i - open;
+        h.v[i] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+    vE = h.m;
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        /* the upper boundary: H above row 0 in columns j-1 and j */
+        const int64_t diag = 0 == j ? 0 : -open-gap*(int64_t)(j-1);
+        const int64_t above = -open-gap*(int64_t)j;
+        __m256i vHp = _mm256_set1_epi8(diag < NEG_INF ? NEG_INF : diag);
+        __m256i vFin = _mm256_set1_epi8(above-open < NEG_INF ? NEG_INF : above-open);
+        __m256i vF;
+        __m256i vT;
+
+        vH = _mm256_alignr_epi8_rpl(vH, vHp, 15);
+        vH = _mm256_adds_epi8(vH, _mm256_load_si256(vProfile + matrix->mapper[(unsigned char)s2[j]]));
+        vH = _mm256_max_epi8(vH, vE);
+
+        /* resolve F down the column with a log-step prefix max */
+        vF = _mm256_alignr_epi8_rpl(_mm256_subs_epi8(vH, vGapO), vFin, 15);
+        do {
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 1), vFront[0]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 2), vFront[1]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 4), vFront[2]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 8), vFront[3]));
+            if (!_mm256_movemask_epi8(_mm256_cmpgt_epi8(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm256_max_epi8(vF, _mm256_adds_epi8(_mm256_slli_si256_rpl(vF, 16), vFront[4]));
+            vF = vT;
+        } while (0);
+        vH = _mm256_max_epi8(vH, vF);
+        vE = _mm256_max_epi8(_mm256_subs_epi8(vE, vGapE), _mm256_subs_epi8(vH, vGapO));
+        vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vH);
+        vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vH);
+
+#ifdef PARASAIL_TABLE
+        h.m = vH;
+        for (i=0; i<s1Len; ++i) {
+            result->score_table[i*s2Len + j] = h.v[i];
+        }
+#endif
+
+#ifdef PARASAIL_ROWCOL
+        h.m = vH;
+        result->score_row[j] = h.v[s1Len-1];
+#endif
+    }
+
+    h.m = vH;
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<s1Len; ++i) {
+        result->score_col[i] = h.v[i];
+    }
+#endif
+
+    score = h.v[s1Len-1];
+    end_query = s1Len - 1;
+    end_ref = s2Len - 1;
+
+    /* only the lanes of real rows can saturate */
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = i < s1Len ? -1 : 0;
+    }
+    if (_mm256_movemask_epi8(_mm256_and_si256(h.m, _mm256_or_si256(
+            _mm256_cmplt_epi8_rpl(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpgt_epi8(vSaturationCheckMax, vPosLimit))))) {
+        result->saturated = 1;
+        score = INT8_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    return result;
+}
+
@@ -589,38 +589,42 @@ parasail_result_t* FNAME(
                 s1[i+30],
                 s1[i+31]);
         __m256i vs2 = vNegInf;
-        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
-        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
-        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
-        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
-        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
-        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
-        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
-        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
-        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
-        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
-        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
-        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
-        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
-        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
-        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
-        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
-        const int * const restrict matrow16 = &matrix->matrix[matrix->size*s1[i+16]];
-        const int * const restrict matrow17 = &matrix->matrix[matrix->size*s1[i+17]];
-        const int * const restrict matrow18 = &matrix->matrix[matrix->size*s1[i+18]];
-        const int * const restrict matrow19 = &matrix->matrix[matrix->size*s1[i+19]];
-        const int * const restrict matrow20 = &matrix->matrix[matrix->size*s1[i+20]];
-        const int * const restrict matrow21 = &matrix->matrix[matrix->size*s1[i+21]];
-        const int * const restrict matrow22 = &matrix->matrix[matrix->size*s1[i+22]];
-        const int * const restrict matrow23 = &matrix->matrix[matrix->size*s1[i+23]];
-        const int * const restrict matrow24 = &matrix->matrix[matrix->size*s1[i+24]];
-        const int * const restrict matrow25 = &matrix->matrix[matrix->size*s1[i+25]];
-        const int * const restrict matrow26 = &matrix->matrix[matrix->size*s1[i+26]];
-        const int * const restrict matrow27 = &matrix->matrix[matrix->size*s1[i+27]];
-        const int * const restrict matrow28 = &matrix->matrix[matrix->size*s1[i+28]];
-        const int * const restrict matrow29 = &matrix->matrix[matrix->size*s1[i+29]];
-        const int * const restrict matrow30 = &matrix->matrix[matrix->size*s1[i+30]];
-        const int * const restrict matrow31 = &matrix->matrix[matrix->size*s1[i+31]];
+        const __m256i vS1_0 = _mm256_set_epi32(
+                matrix->size*s1[i+24],
+                matrix->size*s1[i+25],
+                matrix->size*s1[i+26],
+                matrix->size*s1[i+27],
+                matrix->size*s1[i+28],
+                matrix->size*s1[i+29],
+                matrix->size*s1[i+30],
+                matrix->size*s1[i+31]);
+        const __m256i vS1_1 = _mm256_set_epi32(
+                matrix->size*s1[i+16],
+                matrix->size*s1[i+17],
+                matrix->size*s1[i+18],
+                matrix->size*s1[i+19],
+                matrix->size*s1[i+20],
+                matrix->size*s1[i+21],
+                matrix->size*s1[i+22],
+                matrix->size*s1[i+23]);
+        const __m256i vS1_2 = _mm256_set_epi32(
+                matrix->size*s1[i+8],
+                matrix->size*s1[i+9],
+                matrix->size*s1[i+10],
+                matrix->size*s1[i+11],
+                matrix->size*s1[i+12],
+                matrix->size*s1[i+13],
+                matrix->size*s1[i+14],
+                matrix->size*s1[i+15]);
+        const __m256i vS1_3 = _mm256_set_epi32(
+                matrix->size*s1[i+0],
+                matrix->size*s1[i+1],
+                matrix->size*s1[i+2],
+                matrix->size*s1[i+3],
+                matrix->size*s1[i+4],
+                matrix->size*s1[i+5],
+                matrix->size*s1[i+6],
+                matrix->size*s1[i+7]);
         vNH = _mm256_insert_epi8_rpl(vNH, H_pr[-1], 31);
         vWH = _mm256_insert_epi8_rpl(vWH, -open - i*gap, 31);
         H_pr[-1] = -open - (i+N)*gap;
@@ -665,40 +669,21 @@ parasail_result_t* FNAME(
             vEL = _mm256_adds_epi8(vEL, vOne);
             vs2 = _mm256_srli_si256_rpl(vs2, 1);
             vs2 = _mm256_insert_epi8_rpl(vs2, s2[j], 31);
-            vMat = _mm256_set_epi8(
-                    matrow0[s2[j-0]],
-                    matrow1[s2[j-1]],
-                    matrow2[s2[j-2]],
-                    matrow3[s2[j-3]],
-                    matrow4[s2[j-4]],
-                    matrow5[s2[j-5]],
-                    matrow6[s2[j-6]],
-                    matrow7[s2[j-7]],
-                    matrow8[s2[j-8]],
-                    matrow9[s2[j-9]],
-                    matrow10[s2[j-10]],
-                    matrow11[s2[j-11]],
-                    matrow12[s2[j-12]],
-                    matrow13[s2[j-13]],
-                    matrow14[s2[j-14]],
-                    matrow15[s2[j-15]],
-                    matrow16[s2[j-16]],
-                    matrow17[s2[j-17]],
-                    matrow18[s2[j-18]],
-                    matrow19[s2[j-19]],
-                    matrow20[s2[j-20]],
-                    matrow21[s2[j-21]],
-                    matrow22[s2[j-22]],
-                    matrow23[s2[j-23]],
-                    matrow24[s2[j-24]],
-                    matrow25[s2[j-25]],
-                    matrow26[s2[j-26]],
-                    matrow27[s2[j-27]],
-                    matrow28[s2[j-28]],
-                    matrow29[s2[j-29]],
-                    matrow30[s2[j-30]],
-                    matrow31[s2[j-31]]
-                    );
+            {
+                __m256i vMat0 = _mm256_i32gather_epi32(matrix->matrix,
+                    _mm256_add_epi32(vS1_0, _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(s2+j-PAD)))), 4);
+                __m256i vMat1 = _mm256_i32gather_epi32(matrix->matrix,
+                    _mm256_add_epi32(vS1_1, _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(s2+j-PAD+8)))), 4);
+                __m256i vMat2 = _mm256_i32gather_epi32(matrix->matrix,
+                    _mm256_add_epi32(vS1_2, _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(s2+j-PAD+16)))), 4);
+                __m256i vMat3 = _mm256_i32gather_epi32(matrix->matrix,
+                    _mm256_add_epi32(vS1_3, _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(s2+j-PAD+24)))), 4);
+                vMat = _mm256_packs_epi16(
+                    _mm256_packs_epi32(vMat0, vMat1),
+                    _mm256_packs_epi32(vMat2, vMat3));
+                vMat = _mm256_permutevar8x32_epi32(vMat,
+                    _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+            }
             vNWH = _mm256_adds_epi8(vNWH, vMat);
             vWH = _mm256_max_epi8(vNWH, vE);
             vWH = _mm256_max_epi8(vWH, vF);
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -96,6 +97,95 @@ static inline void arr_store_si256(
     array[(2*seglen+t)*dlen + d] = (int64_t)_mm256_extract_epi64_rpl(vH, 2);
     array[(3*seglen+t)*dlen + d] = (int64_t)_mm256_extract_epi64_rpl(vH, 3);
 }
+
+/* transpose vector t of four buffered columns into the table so that each
+ * query position receives the four adjacent entries d..d+3 */
+static inline void arr_store_block(
+        int *array,
+        const __m256i *buf,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    arr_store_si256(array, buf[         t], t, seglen, d,   dlen);
+    arr_store_si256(array, buf[  seglen+t], t, seglen, d+1, dlen);
+    arr_store_si256(array, buf[2*seglen+t], t, seglen, d+2, dlen);
+    arr_store_si256(array, buf[3*seglen+t], t, seglen, d+3, dlen);
+}
+
+/* write the rows of column d inside window to a table holding only the
+ * window; the cells are read in place, windows are meant to be small */
+static inline void arr_store_window(
+        int *array,
+        const __m256i *column,
+        int32_t seglen,
+        int32_t d,
+        const parasail_window_t *window,
+        int type)
+{
+    const int64_t *v = (const int64_t*)column;
+    int32_t cols = window->ref_end - window->ref_begin;
+    int32_t i = 0;
+    if (d < window->ref_begin || d >= window->ref_end) {
+        return;
+    }
+    for (i=window->query_begin; i<window->query_end; ++i) {
+        size_t index = (size_t)(i-window->query_begin)*cols + (d-window->ref_begin);
+        int value = (int)v[(i%seglen)*4 + i/seglen];
+        array[index] = value;
+    }
+}
+
+/* buffer column d; the table, of PARASAIL_TABLE_* type, is written
+ * once four columns are buffered */
+static inline void arr_store_table(
+        int *array,
+        __m256i *buf,
+        const __m256i *column,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result)
+{
+    int32_t c = d % 4;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        arr_store_window(array, column, seglen, d, &result->window,
+                result->table_type);
+        return;
+    }
+    for (t=0; t<seglen; ++t) {
+        _mm256_store_si256(buf + c*seglen + t, _mm256_load_si256(column + t));
+    }
+    if (3 == c) {
+        for (t=0; t<seglen; ++t) {
+            arr_store_block(array, buf, t, seglen, d-3, dlen);
+        }
+    }
+}
+
+/* write the columns still buffered when the loop ended before column d */
+static inline void arr_store_table_end(
+        int *array,
+        const __m256i *buf,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result)
+{
+    int32_t c = d % 4;
+    int32_t k = 0;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        return;
+    }
+    for (k=0; k<c; ++k) {
+        for (t=0; t<seglen; ++t) {
+            arr_store_si256(array, buf[k*seglen+t], t, seglen, d-c+k, dlen);
+        }
+    }
+}
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -115,13 +205,16 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME parasail_nw_stats_table_striped_avx2_256_64
 #define PNAME parasail_nw_stats_table_striped_profile_avx2_256_64
+#define WNAME parasail_nw_stats_table_striped_profile_avx2_256_64_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME parasail_nw_stats_rowcol_striped_avx2_256_64
 #define PNAME parasail_nw_stats_rowcol_striped_profile_avx2_256_64
+#define WNAME parasail_nw_stats_rowcol_striped_profile_avx2_256_64_ws
 #else
 #define FNAME parasail_nw_stats_striped_avx2_256_64
 #define PNAME parasail_nw_stats_striped_profile_avx2_256_64
+#define WNAME parasail_nw_stats_striped_profile_avx2_256_64_ws
 #endif
 #endif
 
@@ -140,6 +233,21 @@ parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -156,19 +264,19 @@ parasail_result_t* PNAME(
     __m256i* const restrict vProfile  = (__m256i*)profile->profile64.score;
     __m256i* const restrict vProfileM = (__m256i*)profile->profile64.matches;
     __m256i* const restrict vProfileS = (__m256i*)profile->profile64.similar;
-    __m256i* restrict pvHStore        = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHLoad         = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHMStore       = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHMLoad        = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHSStore       = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHSLoad        = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHLStore       = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHLLoad        = parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvE             = parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvEM      = parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvES      = parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvEL      = parasail_memalign___m256i(32, segLen);
-    int64_t* const restrict boundary  = parasail_memalign_int64_t(32, s2Len+1);
+    __m256i* restrict pvHStore        = parasail_workspace___m256i(workspace, 0, segLen);
+    __m256i* restrict pvHLoad         = parasail_workspace___m256i(workspace, 1, segLen);
+    __m256i* restrict pvHMStore       = parasail_workspace___m256i(workspace, 2, segLen);
+    __m256i* restrict pvHMLoad        = parasail_workspace___m256i(workspace, 3, segLen);
+    __m256i* restrict pvHSStore       = parasail_workspace___m256i(workspace, 4, segLen);
+    __m256i* restrict pvHSLoad        = parasail_workspace___m256i(workspace, 5, segLen);
+    __m256i* restrict pvHLStore       = parasail_workspace___m256i(workspace, 6, segLen);
+    __m256i* restrict pvHLLoad        = parasail_workspace___m256i(workspace, 7, segLen);
+    __m256i* const restrict pvE             = parasail_workspace___m256i(workspace, 8, segLen);
+    __m256i* const restrict pvEM      = parasail_workspace___m256i(workspace, 9, segLen);
+    __m256i* const restrict pvES      = parasail_workspace___m256i(workspace, 10, segLen);
+    __m256i* const restrict pvEL      = parasail_workspace___m256i(workspace, 11, segLen);
+    int64_t* const restrict boundary  = parasail_workspace_int64_t(workspace, 12, s2Len+1);
     const __m256i vGapO = _mm256_set1_epi64x_rpl(open);
     const __m256i vGapE = _mm256_set1_epi64x_rpl(gap);
     const int64_t NEG_LIMIT = (-open < matrix->min ?
@@ -185,7 +293,11 @@ parasail_result_t* PNAME(
     __m256i vSaturationCheckMin = vPosLimit;
     __m256i vSaturationCheckMax = vNegLimit;
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table3(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table3_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? PARASAIL_TABLE_INT : PARASAIL_TABLE_INT,
+            &profile->window);
+    __m256i* const restrict pvHTable = parasail_memalign___m256i(32, 16*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol3(segLen*segWidth, s2Len);
@@ -327,12 +439,6 @@ parasail_result_t* PNAME(
             vSaturationCheckMax = _mm256_max_epi64_rpl(vSaturationCheckMax, vHM);
             vSaturationCheckMax = _mm256_max_epi64_rpl(vSaturationCheckMax, vHS);
             vSaturationCheckMax = _mm256_max_epi64_rpl(vSaturationCheckMax, vHL);
-#ifdef PARASAIL_TABLE
-            arr_store_si256(result->matches_table, vHM, i, segLen, j, s2Len);
-            arr_store_si256(result->similar_table, vHS, i, segLen, j, s2Len);
-            arr_store_si256(result->length_table, vHL, i, segLen, j, s2Len);
-            arr_store_si256(result->score_table, vH, i, segLen, j, s2Len);
-#endif
             vEF_opn = _mm256_sub_epi64(vH, vGapO);
 
             /* Update vE value. */
@@ -415,12 +521,6 @@ parasail_result_t* PNAME(
                 vSaturationCheckMax = _mm256_max_epi64_rpl(vSaturationCheckMax, vHM);
                 vSaturationCheckMax = _mm256_max_epi64_rpl(vSaturationCheckMax, vHS);
                 vSaturationCheckMax = _mm256_max_epi64_rpl(vSaturationCheckMax, vHL);
-#ifdef PARASAIL_TABLE
-                arr_store_si256(result->matches_table, vHM, i, segLen, j, s2Len);
-                arr_store_si256(result->similar_table, vHS, i, segLen, j, s2Len);
-                arr_store_si256(result->length_table, vHL, i, segLen, j, s2Len);
-                arr_store_si256(result->score_table, vH, i, segLen, j, s2Len);
-#endif
                 /* Update vF value. */
                 vEF_opn = _mm256_sub_epi64(vH, vGapO);
                 vF_ext = _mm256_sub_epi64(vF, vGapE);
@@ -445,6 +545,13 @@ end:
         {
         }
 
+#ifdef PARASAIL_TABLE
+        arr_store_table(result->score_table, pvHTable, pvHStore, segLen, j, s2Len, result);
+        arr_store_table(result->matches_table, pvHTable + 4*segLen, pvHMStore, segLen, j, s2Len, result);
+        arr_store_table(result->similar_table, pvHTable + 8*segLen, pvHSStore, segLen, j, s2Len, result);
+        arr_store_table(result->length_table, pvHTable + 12*segLen, pvHLStore, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
         /* extract last value from the column */
         {
@@ -466,6 +573,13 @@ end:
 #endif
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result);
+    arr_store_table_end(result->matches_table, pvHTable + 4*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->similar_table, pvHTable + 8*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->length_table, pvHTable + 12*segLen, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
     for (i=0; i<segLen; ++i) {
         __m256i vH = _mm256_load_si256(pvHStore+i);
@@ -516,19 +630,9 @@ end:
     result->end_query = end_query;
     result->end_ref = end_ref;
 
-    parasail_free(boundary);
-    parasail_free(pvEL);
-    parasail_free(pvES);
-    parasail_free(pvEM);
-    parasail_free(pvE);
-    parasail_free(pvHLLoad);
-    parasail_free(pvHLStore);
-    parasail_free(pvHSLoad);
-    parasail_free(pvHSStore);
-    parasail_free(pvHMLoad);
-    parasail_free(pvHMStore);
-    parasail_free(pvHLoad);
-    parasail_free(pvHStore);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -48,6 +49,183 @@ static inline void arr_store_si128(
     array[(6*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 6);
     array[(7*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 7);
 }
+
+/* transpose vector t of four buffered columns into the table so that each
+ * query position receives the four adjacent entries d..d+3 */
+static inline void arr_store_block(
+        int *array,
+        const __m128i *buf,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    __m128i x[4][2];
+    int32_t c = 0;
+    int32_t k = 0;
+    for (c=0; c<4; ++c) {
+        __m128i vH = _mm_load_si128(buf + c*seglen + t);
+        x[c][0] = _mm_srai_epi32(_mm_unpacklo_epi16(vH, vH), 16);
+        x[c][1] = _mm_srai_epi32(_mm_unpackhi_epi16(vH, vH), 16);
+    }
+    for (k=0; k<2; ++k) {
+        __m128i t0 = _mm_unpacklo_epi32(x[0][k], x[1][k]);
+        __m128i t1 = _mm_unpacklo_epi32(x[2][k], x[3][k]);
+        __m128i t2 = _mm_unpackhi_epi32(x[0][k], x[1][k]);
+        __m128i t3 = _mm_unpackhi_epi32(x[2][k], x[3][k]);
+        int *row = array + (4*k*seglen+t)*dlen + d;
+        _mm_storeu_si128((__m128i*)(row), _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + seglen*dlen), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + 2*seglen*dlen), _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128((__m128i*)(row + 3*seglen*dlen), _mm_unpackhi_epi64(t2, t3));
+    }
+}
+
+static inline void arr_store_si128_narrow(
+        void *array,
+        __m128i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    int16_t *table = (int16_t*)array;
+    table[(0*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 0);
+    table[(1*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 1);
+    table[(2*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 2);
+    table[(3*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 3);
+    table[(4*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 4);
+    table[(5*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 5);
+    table[(6*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 6);
+    table[(7*seglen+t)*dlen + d] = (int16_t)_mm_extract_epi16(vH, 7);
+}
+
+static inline void arr_store_block_narrow(
+        void *array,
+        const __m128i *buf,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen)
+{
+    int16_t *table = (int16_t*)array;
+    __m128i x[4][1];
+    int32_t c = 0;
+    int32_t k = 0;
+    for (c=0; c<4; ++c) {
+        __m128i vH = _mm_load_si128(buf + c*seglen + t);
+        x[c][0] = vH;
+    }
+    for (k=0; k<1; ++k) {
+        __m128i a = _mm_unpacklo_epi16(x[0][k], x[1][k]);
+        __m128i b = _mm_unpacklo_epi16(x[2][k], x[3][k]);
+        __m128i e = _mm_unpackhi_epi16(x[0][k], x[1][k]);
+        __m128i f = _mm_unpackhi_epi16(x[2][k], x[3][k]);
+        __m128i r0 = _mm_unpacklo_epi32(a, b);
+        __m128i r1 = _mm_unpackhi_epi32(a, b);
+        __m128i r2 = _mm_unpacklo_epi32(e, f);
+        __m128i r3 = _mm_unpackhi_epi32(e, f);
+        int16_t *row = table + (8*k*seglen+t)*dlen + d;
+        _mm_storel_epi64((__m128i*)(row), r0);
+        _mm_storel_epi64((__m128i*)(row + seglen*dlen), _mm_srli_si128(r0, 8));
+        _mm_storel_epi64((__m128i*)(row + 2*seglen*dlen), r1);
+        _mm_storel_epi64((__m128i*)(row + 3*seglen*dlen), _mm_srli_si128(r1, 8));
+        _mm_storel_epi64((__m128i*)(row + 4*seglen*dlen), r2);
+        _mm_storel_epi64((__m128i*)(row + 5*seglen*dlen), _mm_srli_si128(r2, 8));
+        _mm_storel_epi64((__m128i*)(row + 6*seglen*dlen), r3);
+        _mm_storel_epi64((__m128i*)(row + 7*seglen*dlen), _mm_srli_si128(r3, 8));
+    }
+}
+
+/* write the rows of column d inside window to a table holding only the
+ * window; the cells are read in place, windows are meant to be small */
+static inline void arr_store_window(
+        int *array,
+        const __m128i *column,
+        int32_t seglen,
+        int32_t d,
+        const parasail_window_t *window,
+        int type)
+{
+    const int16_t *v = (const int16_t*)column;
+    int32_t cols = window->ref_end - window->ref_begin;
+    int32_t i = 0;
+    if (d < window->ref_begin || d >= window->ref_end) {
+        return;
+    }
+    for (i=window->query_begin; i<window->query_end; ++i) {
+        size_t index = (size_t)(i-window->query_begin)*cols + (d-window->ref_begin);
+        int value = (int)v[(i%seglen)*8 + i/seglen];
+        if (PARASAIL_TABLE_INT == type) {
+            array[index] = value;
+        }
+        else {
+            ((int16_t*)array)[index] = (int16_t)value;
+        }
+    }
+}
+
+/* buffer column d; the table, of PARASAIL_TABLE_* type, is written
+ * once four columns are buffered */
+static inline void arr_store_table(
+        int *array,
+        __m128i *buf,
+        const __m128i *column,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result)
+{
+    int32_t c = d % 4;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        arr_store_window(array, column, seglen, d, &result->window,
+                result->table_type);
+        return;
+    }
+    for (t=0; t<seglen; ++t) {
+        _mm_store_si128(buf + c*seglen + t, _mm_load_si128(column + t));
+    }
+    if (3 == c) {
+        if (PARASAIL_TABLE_INT == result->table_type) {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block(array, buf, t, seglen, d-3, dlen);
+            }
+        }
+        else {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block_narrow(array, buf, t, seglen, d-3, dlen);
+            }
+        }
+    }
+}
+
+/* write the columns still buffered when the loop ended before column d */
+static inline void arr_store_table_end(
+        int *array,
+        const __m128i *buf,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result)
+{
+    int32_t c = d % 4;
+    int32_t k = 0;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        return;
+    }
+    for (k=0; k<c; ++k) {
+        for (t=0; t<seglen; ++t) {
+            if (PARASAIL_TABLE_INT == result->table_type) {
+                arr_store_si128(array, buf[k*seglen+t], t, seglen, d-c+k, dlen);
+            }
+            else {
+                arr_store_si128_narrow(array, buf[k*seglen+t], t, seglen, d-c+k, dlen);
+            }
+        }
+    }
+}
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -71,13 +249,16 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME parasail_nw_stats_table_striped_sse2_128_16
 #define PNAME parasail_nw_stats_table_striped_profile_sse2_128_16
+#define WNAME parasail_nw_stats_table_striped_profile_sse2_128_16_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME parasail_nw_stats_rowcol_striped_sse2_128_16
 #define PNAME parasail_nw_stats_rowcol_striped_profile_sse2_128_16
+#define WNAME parasail_nw_stats_rowcol_striped_profile_sse2_128_16_ws
 #else
 #define FNAME parasail_nw_stats_striped_sse2_128_16
 #define PNAME parasail_nw_stats_striped_profile_sse2_128_16
+#define WNAME parasail_nw_stats_striped_profile_sse2_128_16_ws
 #endif
 #endif
 
@@ -96,6 +277,21 @@ parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -112,19 +308,19 @@ parasail_result_t* PNAME(
     __m128i* const restrict vProfile  = (__m128i*)profile->profile16.score;
     __m128i* const restrict vProfileM = (__m128i*)profile->profile16.matches;
     __m128i* const restrict vProfileS = (__m128i*)profile->profile16.similar;
-    __m128i* restrict pvHStore        = parasail_memalign___m128i(16, segLen);
-    __m128i* restrict pvHLoad         = parasail_memalign___m128i(16, segLen);
-    __m128i* restrict pvHMStore       = parasail_memalign___m128i(16, segLen);
-    __m128i* restrict pvHMLoad        = parasail_memalign___m128i(16, segLen);
-    __m128i* restrict pvHSStore       = parasail_memalign___m128i(16, segLen);
-    __m128i* restrict pvHSLoad        = parasail_memalign___m128i(16, segLen);
-    __m128i* restrict pvHLStore       = parasail_memalign___m128i(16, segLen);
-    __m128i* restrict pvHLLoad        = parasail_memalign___m128i(16, segLen);
-    __m128i* const restrict pvE             = parasail_memalign___m128i(16, segLen);
-    __m128i* const restrict pvEM      = parasail_memalign___m128i(16, segLen);
-    __m128i* const restrict pvES      = parasail_memalign___m128i(16, segLen);
-    __m128i* const restrict pvEL      = parasail_memalign___m128i(16, segLen);
-    int16_t* const restrict boundary  = parasail_memalign_int16_t(16, s2Len+1);
+    __m128i* restrict pvHStore        = parasail_workspace___m128i(workspace, 0, segLen);
+    __m128i* restrict pvHLoad         = parasail_workspace___m128i(workspace, 1, segLen);
+    __m128i* restrict pvHMStore       = parasail_workspace___m128i(workspace, 2, segLen);
+    __m128i* restrict pvHMLoad        = parasail_workspace___m128i(workspace, 3, segLen);
+    __m128i* restrict pvHSStore       = parasail_workspace___m128i(workspace, 4, segLen);
+    __m128i* restrict pvHSLoad        = parasail_workspace___m128i(workspace, 5, segLen);
+    __m128i* restrict pvHLStore       = parasail_workspace___m128i(workspace, 6, segLen);
+    __m128i* restrict pvHLLoad        = parasail_workspace___m128i(workspace, 7, segLen);
+    __m128i* const restrict pvE             = parasail_workspace___m128i(workspace, 8, segLen);
+    __m128i* const restrict pvEM      = parasail_workspace___m128i(workspace, 9, segLen);
+    __m128i* const restrict pvES      = parasail_workspace___m128i(workspace, 10, segLen);
+    __m128i* const restrict pvEL      = parasail_workspace___m128i(workspace, 11, segLen);
+    int16_t* const restrict boundary  = parasail_workspace_int16_t(workspace, 12, s2Len+1);
     const __m128i vGapO = _mm_set1_epi16(open);
     const __m128i vGapE = _mm_set1_epi16(gap);
     const int16_t NEG_LIMIT = (-open < matrix->min ?
@@ -141,7 +337,11 @@ parasail_result_t* PNAME(
     __m128i vSaturationCheckMin = vPosLimit;
     __m128i vSaturationCheckMax = vNegLimit;
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table3(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table3_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? PARASAIL_TABLE_INT16 : PARASAIL_TABLE_INT,
+            &profile->window);
+    __m128i* const restrict pvHTable = parasail_memalign___m128i(16, 16*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol3(segLen*segWidth, s2Len);
@@ -283,12 +483,6 @@ parasail_result_t* PNAME(
             vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vHM);
             vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vHS);
             vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vHL);
-#ifdef PARASAIL_TABLE
-            arr_store_si128(result->matches_table, vHM, i, segLen, j, s2Len);
-            arr_store_si128(result->similar_table, vHS, i, segLen, j, s2Len);
-            arr_store_si128(result->length_table, vHL, i, segLen, j, s2Len);
-            arr_store_si128(result->score_table, vH, i, segLen, j, s2Len);
-#endif
             vEF_opn = _mm_sub_epi16(vH, vGapO);
 
             /* Update vE value. */
@@ -371,12 +565,6 @@ parasail_result_t* PNAME(
                 vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vHM);
                 vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vHS);
                 vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vHL);
-#ifdef PARASAIL_TABLE
-                arr_store_si128(result->matches_table, vHM, i, segLen, j, s2Len);
-                arr_store_si128(result->similar_table, vHS, i, segLen, j, s2Len);
-                arr_store_si128(result->length_table, vHL, i, segLen, j, s2Len);
-                arr_store_si128(result->score_table, vH, i, segLen, j, s2Len);
-#endif
                 /* Update vF value. */
                 vEF_opn = _mm_sub_epi16(vH, vGapO);
                 vF_ext = _mm_sub_epi16(vF, vGapE);
@@ -401,6 +589,13 @@ end:
         {
         }
 
+#ifdef PARASAIL_TABLE
+        arr_store_table(result->score_table, pvHTable, pvHStore, segLen, j, s2Len, result);
+        arr_store_table(result->matches_table, pvHTable + 4*segLen, pvHMStore, segLen, j, s2Len, result);
+        arr_store_table(result->similar_table, pvHTable + 8*segLen, pvHSStore, segLen, j, s2Len, result);
+        arr_store_table(result->length_table, pvHTable + 12*segLen, pvHLStore, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
         /* extract last value from the column */
         {
@@ -422,6 +617,13 @@ end:
 #endif
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result);
+    arr_store_table_end(result->matches_table, pvHTable + 4*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->similar_table, pvHTable + 8*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->length_table, pvHTable + 12*segLen, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
     for (i=0; i<segLen; ++i) {
         __m128i vH = _mm_load_si128(pvHStore+i);
@@ -472,19 +674,9 @@ end:
     result->end_query = end_query;
     result->end_ref = end_ref;
 
-    parasail_free(boundary);
-    parasail_free(pvEL);
-    parasail_free(pvES);
-    parasail_free(pvEM);
-    parasail_free(pvE);
-    parasail_free(pvHLLoad);
-    parasail_free(pvHLStore);
-    parasail_free(pvHSLoad);
-    parasail_free(pvHSStore);
-    parasail_free(pvHMLoad);
-    parasail_free(pvHMStore);
-    parasail_free(pvHLoad);
-    parasail_free(pvHStore);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
@@ -0,0 +1,250 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+
+static inline int _mm256_movemask_epi16_rpl(__m256i a) {
+    int m = _mm256_movemask_epi8(_mm256_packs_epi16(a, _mm256_setzero_si256()));
+    return (m & 0xFF) | ((m >> 8) & 0xFF00);
+}
+
+#define _mm256_cmplt_epi16_rpl(a,b) _mm256_cmpgt_epi16(b,a)
+
+#if HAVE_AVX2_MM256_INSERT_EPI16
+#define _mm256_insert_epi16_rpl _mm256_insert_epi16
+#else
+static inline __m256i _mm256_insert_epi16_rpl(__m256i a, int16_t i, int imm) {
+    __m256i_16_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+#endif
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI16
+#define _mm256_extract_epi16_rpl _mm256_extract_epi16
+#else
+static inline int16_t _mm256_extract_epi16_rpl(__m256i a, int imm) {
+    __m256i_16_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+
+/* pack the four direction masks of vector i of a column */
+static inline void trace_store(
+        uint64_t *bits,
+        int32_t i,
+        uint32_t m0,
+        uint32_t m1,
+        uint32_t m2,
+        uint32_t m3)
+{
+    bits[i] = (uint64_t)m0 | (uint64_t)m1 << 16
+            | (uint64_t)m2 << 32 | (uint64_t)m3 << 48;
+}
+
+#define FNAME parasail_nw_trace_scan_avx2_256_16
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    parasail_profile_t *profile = parasail_profile_create_avx_256_16(s1, s1Len, matrix);
+    parasail_workspace_t workspace;
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m256i* const restrict pvP = (__m256i*)profile->profile16.score;
+    __m256i* restrict pvE = NULL;
+    int16_t* restrict boundary = NULL;
+    __m256i* restrict pvHt = NULL;
+    __m256i* restrict pvH = NULL;
+    __m256i* restrict pvGapper = NULL;
+    __m256i vGapO = _mm256_set1_epi16(open);
+    __m256i vGapE = _mm256_set1_epi16(gap);
+    const int16_t NEG_LIMIT = (-open < matrix->min ?
+        INT16_MIN + open : INT16_MIN - matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    __m256i vZero = _mm256_setzero_si256();
+    int16_t score = NEG_LIMIT;
+    __m256i vNegLimit = _mm256_set1_epi16(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi16(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+    __m256i vNegInfFront = _mm256_set_epi16(0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,NEG_LIMIT);
+    __m256i vSegLenXgap = _mm256_add_epi16(vNegInfFront,
+            _mm256_slli_si256_rpl(_mm256_set1_epi16(-segLen*gap), 2));
+    parasail_result_t *result = parasail_result_new_trace(
+            segLen, s2Len, segWidth, PARASAIL_TRACE_NW);
+    uint64_t * const restrict bits = result->trace->bits;
+    const int32_t words = result->trace->words;
+
+    parasail_workspace_init(&workspace);
+    pvE = parasail_workspace___m256i(&workspace, 0, segLen);
+    boundary = parasail_workspace_int16_t(&workspace, 1, s2Len+1);
+    pvHt = parasail_workspace___m256i(&workspace, 2, segLen);
+    pvH = parasail_workspace___m256i(&workspace, 3, segLen);
+    pvGapper = parasail_workspace___m256i(&workspace, 4, segLen);
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m256i_16_t h;
+            __m256i_16_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+            }
+            _mm256_store_si256(&pvH[index], h.m);
+            _mm256_store_si256(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT16_MIN ? INT16_MIN : tmp;
+        }
+    }
+
+    {
+        __m256i vGapper = _mm256_sub_epi16(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm256_store_si256(pvGapper+i, vGapper);
+            vGapper = _mm256_sub_epi16(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m256i vE;
+        __m256i vHt;
+        __m256i vF;
+        __m256i vH;
+        __m256i vHp;
+        __m256i *pvW;
+        __m256i vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm256_load_si256(pvH+(segLen-1));
+        vHp = _mm256_slli_si256_rpl(vHp, 2);
+        vHp = _mm256_insert_epi16_rpl(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm256_sub_epi16(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm256_load_si256(pvH+i);
+            vE = _mm256_load_si256(pvE+i);
+            vW = _mm256_load_si256(pvW+i);
+            vE = _mm256_max_epi16(
+                    _mm256_sub_epi16(vE, vGapE),
+                    _mm256_sub_epi16(vH, vGapO));
+            vHp = _mm256_add_epi16(vHp, vW);
+            vF = _mm256_max_epi16(vF, _mm256_add_epi16(vHt, pvGapper[i]));
+            vHt = _mm256_max_epi16(vE, vHp);
+            _mm256_store_si256(pvE+i, vE);
+            _mm256_store_si256(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm256_slli_si256_rpl(vHt, 2);
+        vHt = _mm256_insert_epi16_rpl(vHt, boundary[j+1], 0);
+        vF = _mm256_max_epi16(vF, _mm256_add_epi16(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            __m256i vFt = _mm256_slli_si256_rpl(vF, 2);
+            vFt = _mm256_add_epi16(vFt, vSegLenXgap);
+            vF = _mm256_max_epi16(vF, vFt);
+        }
+
+        /* calculate final H and record where each cell came from */
+        vF = _mm256_slli_si256_rpl(vF, 2);
+        vF = _mm256_add_epi16(vF, vNegInfFront);
+        vH = _mm256_max_epi16(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            __m256i vHold = _mm256_load_si256(pvH+i);
+            __m256i vFopen = _mm256_sub_epi16(vH, vGapO);
+            __m256i vCaseE;
+            __m256i vCaseF;
+            vHt = _mm256_load_si256(pvHt+i);
+            vE = _mm256_load_si256(pvE+i);
+            vF = _mm256_max_epi16(_mm256_sub_epi16(vF, vGapE), vFopen);
+            vH = _mm256_max_epi16(vHt, vF);
+            _mm256_store_si256(pvH+i, vH);
+            vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vH);
+            vCaseE = _mm256_cmpeq_epi16(vH, vE);
+            vCaseF = _mm256_andnot_si256(vCaseE, _mm256_cmpeq_epi16(vH, vF));
+            trace_store(bits + j*words, i,
+                    (uint32_t)_mm256_movemask_epi16_rpl(vCaseE),
+                    (uint32_t)_mm256_movemask_epi16_rpl(vCaseF),
+                    (uint32_t)_mm256_movemask_epi16_rpl(_mm256_cmpgt_epi16(vE, _mm256_sub_epi16(vHold, vGapO))),
+                    (uint32_t)_mm256_movemask_epi16_rpl(_mm256_cmpgt_epi16(vF, vFopen)));
+        }
+    }
+
+    /* extract last value from the last column */
+    {
+        __m256i vH = _mm256_load_si256(pvH + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm256_slli_si256_rpl(vH, 2);
+        }
+        score = (int16_t) _mm256_extract_epi16_rpl (vH, 15);
+    }
+
+    /* the scan also overflows when a gap spanning a segment does not
+     * fit in a lane */
+    if ((int64_t)segLen*gap > INT16_MAX
+            || _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmplt_epi16_rpl(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_workspace_clear(&workspace);
+    parasail_profile_free(profile);
+
+    return result;
+}
+
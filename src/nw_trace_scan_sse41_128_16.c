@@ -0,0 +1,236 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#include <smmintrin.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_sse.h"
+
+
+static inline int _mm_movemask_epi16_rpl(__m128i a) {
+    return _mm_movemask_epi8(_mm_packs_epi16(a, _mm_setzero_si128()));
+}
+
+
+/* pack the four direction masks of vector i of a column */
+static inline void trace_store(
+        uint64_t *bits,
+        int32_t i,
+        uint32_t m0,
+        uint32_t m1,
+        uint32_t m2,
+        uint32_t m3)
+{
+    const uint64_t v = (uint64_t)m0 | (uint64_t)m1 << 8
+            | (uint64_t)m2 << 16 | (uint64_t)m3 << 24;
+    const int32_t shift = (i % 2) * 32;
+    if (0 == shift) {
+        bits[i/2] = v;
+    }
+    else {
+        bits[i/2] |= v << shift;
+    }
+}
+
+#define FNAME parasail_nw_trace_scan_sse41_128_16
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    parasail_profile_t *profile = parasail_profile_create_sse_128_16(s1, s1Len, matrix);
+    parasail_workspace_t workspace;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m128i* const restrict pvP = (__m128i*)profile->profile16.score;
+    __m128i* restrict pvE = NULL;
+    int16_t* restrict boundary = NULL;
+    __m128i* restrict pvHt = NULL;
+    __m128i* restrict pvH = NULL;
+    __m128i* restrict pvGapper = NULL;
+    __m128i vGapO = _mm_set1_epi16(open);
+    __m128i vGapE = _mm_set1_epi16(gap);
+    const int16_t NEG_LIMIT = (-open < matrix->min ?
+        INT16_MIN + open : INT16_MIN - matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    __m128i vZero = _mm_setzero_si128();
+    int16_t score = NEG_LIMIT;
+    __m128i vNegLimit = _mm_set1_epi16(NEG_LIMIT);
+    __m128i vPosLimit = _mm_set1_epi16(POS_LIMIT);
+    __m128i vSaturationCheckMin = vPosLimit;
+    __m128i vSaturationCheckMax = vNegLimit;
+    __m128i vNegInfFront = _mm_set_epi16(0,0,0,0,0,0,0,NEG_LIMIT);
+    __m128i vSegLenXgap = _mm_add_epi16(vNegInfFront,
+            _mm_slli_si128(_mm_set1_epi16(-segLen*gap), 2));
+    parasail_result_t *result = parasail_result_new_trace(
+            segLen, s2Len, segWidth, PARASAIL_TRACE_NW);
+    uint64_t * const restrict bits = result->trace->bits;
+    const int32_t words = result->trace->words;
+
+    parasail_workspace_init(&workspace);
+    pvE = parasail_workspace___m128i(&workspace, 0, segLen);
+    boundary = parasail_workspace_int16_t(&workspace, 1, s2Len+1);
+    pvHt = parasail_workspace___m128i(&workspace, 2, segLen);
+    pvH = parasail_workspace___m128i(&workspace, 3, segLen);
+    pvGapper = parasail_workspace___m128i(&workspace, 4, segLen);
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m128i_16_t h;
+            __m128i_16_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+            }
+            _mm_store_si128(&pvH[index], h.m);
+            _mm_store_si128(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT16_MIN ? INT16_MIN : tmp;
+        }
+    }
+
+    {
+        __m128i vGapper = _mm_sub_epi16(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm_store_si128(pvGapper+i, vGapper);
+            vGapper = _mm_sub_epi16(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m128i vE;
+        __m128i vHt;
+        __m128i vF;
+        __m128i vH;
+        __m128i vHp;
+        __m128i *pvW;
+        __m128i vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm_load_si128(pvH+(segLen-1));
+        vHp = _mm_slli_si128(vHp, 2);
+        vHp = _mm_insert_epi16(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm_sub_epi16(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm_load_si128(pvH+i);
+            vE = _mm_load_si128(pvE+i);
+            vW = _mm_load_si128(pvW+i);
+            vE = _mm_max_epi16(
+                    _mm_sub_epi16(vE, vGapE),
+                    _mm_sub_epi16(vH, vGapO));
+            vHp = _mm_add_epi16(vHp, vW);
+            vF = _mm_max_epi16(vF, _mm_add_epi16(vHt, pvGapper[i]));
+            vHt = _mm_max_epi16(vE, vHp);
+            _mm_store_si128(pvE+i, vE);
+            _mm_store_si128(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm_slli_si128(vHt, 2);
+        vHt = _mm_insert_epi16(vHt, boundary[j+1], 0);
+        vF = _mm_max_epi16(vF, _mm_add_epi16(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            __m128i vFt = _mm_slli_si128(vF, 2);
+            vFt = _mm_add_epi16(vFt, vSegLenXgap);
+            vF = _mm_max_epi16(vF, vFt);
+        }
+
+        /* calculate final H and record where each cell came from */
+        vF = _mm_slli_si128(vF, 2);
+        vF = _mm_add_epi16(vF, vNegInfFront);
+        vH = _mm_max_epi16(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            __m128i vHold = _mm_load_si128(pvH+i);
+            __m128i vFopen = _mm_sub_epi16(vH, vGapO);
+            __m128i vCaseE;
+            __m128i vCaseF;
+            vHt = _mm_load_si128(pvHt+i);
+            vE = _mm_load_si128(pvE+i);
+            vF = _mm_max_epi16(_mm_sub_epi16(vF, vGapE), vFopen);
+            vH = _mm_max_epi16(vHt, vF);
+            _mm_store_si128(pvH+i, vH);
+            vSaturationCheckMin = _mm_min_epi16(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vH);
+            vCaseE = _mm_cmpeq_epi16(vH, vE);
+            vCaseF = _mm_andnot_si128(vCaseE, _mm_cmpeq_epi16(vH, vF));
+            trace_store(bits + j*words, i,
+                    (uint32_t)_mm_movemask_epi16_rpl(vCaseE),
+                    (uint32_t)_mm_movemask_epi16_rpl(vCaseF),
+                    (uint32_t)_mm_movemask_epi16_rpl(_mm_cmpgt_epi16(vE, _mm_sub_epi16(vHold, vGapO))),
+                    (uint32_t)_mm_movemask_epi16_rpl(_mm_cmpgt_epi16(vF, vFopen)));
+        }
+    }
+
+    /* extract last value from the last column */
+    {
+        __m128i vH = _mm_load_si128(pvH + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm_slli_si128(vH, 2);
+        }
+        score = (int16_t) _mm_extract_epi16 (vH, 7);
+    }
+
+    /* the scan also overflows when a gap spanning a segment does not
+     * fit in a lane */
+    if ((int64_t)segLen*gap > INT16_MAX
+            || _mm_movemask_epi8(_mm_or_si128(
+            _mm_cmplt_epi16(vSaturationCheckMin, vNegLimit),
+            _mm_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_workspace_clear(&workspace);
+    parasail_profile_free(profile);
+
+    return result;
+}
+
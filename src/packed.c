@@ -0,0 +1,128 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* Serial reference implementations of the packed multi-query
+ * functions. Each query is aligned independently against the database
+ * sequence using the serial reference of the same class. These are
+ * also the fallback when no vector ISA is available at runtime, so the
+ * serial profile records every query and no vectors. */
+
+parasail_profile_t* parasail_profile_create_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_profile_new_packed(s1s, s1Lens, s1Count, matrix, INT32_MAX);
+}
+
+static parasail_result_t** batch(
+        parasail_function_t *function,
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    int i = 0;
+    parasail_result_t **results = NULL;
+
+    /* validate inputs */
+    assert(s1Count >= 0);
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s1Count);
+    assert(NULL != results || 0 == s1Count);
+    for (i=0; i<s1Count; ++i) {
+        results[i] = function(s1s[i], s1Lens[i], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+static parasail_result_t** batch_profile(
+        parasail_function_t *function,
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int i = 0;
+    const int count = profile->packed_count;
+    int *s1Lens = (int*)malloc(sizeof(int)*count);
+    parasail_result_t **results = NULL;
+
+    assert(s1Lens);
+    for (i=0; i<count; ++i) {
+        s1Lens[i] = profile->packed_begin[i+1] - profile->packed_begin[i];
+    }
+    results = batch(function, profile->packed_s1, s1Lens, count,
+            s2, s2Len, open, gap, profile->matrix);
+    free(s1Lens);
+
+    return results;
+}
+
+parasail_result_t** parasail_nw_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return batch(parasail_nw, s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sg_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return batch(parasail_sg, s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_packed(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return batch(parasail_sw, s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t** parasail_nw_packed_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return batch_profile(parasail_nw, profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t** parasail_sg_packed_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return batch_profile(parasail_sg, profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t** parasail_sw_packed_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return batch_profile(parasail_sw, profile, s2, s2Len, open, gap);
+}
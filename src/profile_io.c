@@ -0,0 +1,252 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/io.h"
+#include "parasail/memory.h"
+
+#define PROFILE_MAGIC "PSLPRF02"
+
+/* every section of the file starts on this boundary */
+#define PROFILE_ALIGN 64
+
+typedef struct profile_header {
+    char magic[8];
+    uint32_t vector_bytes;
+    uint32_t layout;        /* PARASAIL_LAYOUT_STRIPED or _BLOCKED */
+    uint32_t s1Len;
+    uint32_t matrix_size;
+    uint32_t present;       /* bit 3*width+kind for each array written */
+    uint32_t reserved;      /* zero */
+    uint64_t matrix_hash;
+    char matrix_name[32];
+} profile_header_t;
+
+static size_t padded(size_t size)
+{
+    return (size + PROFILE_ALIGN - 1) / PROFILE_ALIGN * PROFILE_ALIGN;
+}
+
+/* FNV-1a over the scores and mapper of matrix */
+static uint64_t matrix_hash(const parasail_matrix_t *matrix)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char *p = NULL;
+    size_t i = 0;
+
+    p = (const unsigned char*)matrix->matrix;
+    for (i=0; i<sizeof(int)*matrix->size*matrix->size; ++i) {
+        hash = (hash ^ p[i]) * 1099511628211ULL;
+    }
+    p = (const unsigned char*)matrix->mapper;
+    for (i=0; i<sizeof(int)*256; ++i) {
+        hash = (hash ^ p[i]) * 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/* the score, matches and similar arrays of profile8 through profile64 */
+static void** profile_array(parasail_profile_t *profile, int array)
+{
+    parasail_profile_data_t *data[4];
+    data[0] = &profile->profile8;
+    data[1] = &profile->profile16;
+    data[2] = &profile->profile32;
+    data[3] = &profile->profile64;
+    switch (array % 3) {
+        case 0: return &data[array/3]->score;
+        case 1: return &data[array/3]->matches;
+        default: return &data[array/3]->similar;
+    }
+}
+
+/* bytes of one array of the given width, see parasail_profile_create_*;
+ * the blocked profiles hold as many vectors as the striped ones */
+static size_t array_size(int array, size_t vector_bytes, int s1Len, int n)
+{
+    const size_t bits = (size_t)8 << (array/3);
+    const size_t segWidth = vector_bytes * 8 / bits;
+    const size_t segLen = (s1Len + segWidth - 1) / segWidth;
+    return n * segLen * vector_bytes;
+}
+
+static int can_use(uint32_t vector_bytes)
+{
+    switch (vector_bytes) {
+#if HAVE_SSE2
+        case 16: return parasail_can_use_sse2();
+#endif
+#if HAVE_AVX2
+        case 32: return parasail_can_use_avx2();
+#endif
+#if HAVE_KNC
+        case 64: return 1;
+#endif
+        default: return 0;
+    }
+}
+
+/* the arrays of a mapped profile belong to its file */
+static void mapped_free(void *ptr)
+{
+    (void)ptr;
+}
+
+int parasail_profile_save(const parasail_profile_t *profile, const char *fname)
+{
+    static const char zeros[PROFILE_ALIGN] = {0};
+    parasail_profile_t full;
+    parasail_profile_t copy;
+    parasail_profile_t *p = &full;
+    profile_header_t header;
+    const char *name = NULL;
+    FILE *fp = NULL;
+    int status = 0;
+    int array = 0;
+
+    /* validate inputs */
+    assert(profile);
+    assert(profile->matrix);
+    assert(fname);
+
+    /* a packed profile's queries are not kept with it */
+    if (PARASAIL_LAYOUT_STRIPED != profile->layout
+            && PARASAIL_LAYOUT_BLOCKED != profile->layout) {
+        errno = EINVAL;
+        return -1;
+    }
+    assert(profile->s1);
+    assert(profile->vector_bytes > 0);
+
+    /* a _sat profile is saved with every width built */
+    full = *profile;
+    full.profile16 = parasail_profile_width(profile, 16, &copy)->profile16;
+    full.profile32 = parasail_profile_width(profile, 32, &copy)->profile32;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PROFILE_MAGIC, sizeof(header.magic));
+    header.vector_bytes = profile->vector_bytes;
+    header.layout = profile->layout;
+    header.s1Len = profile->s1Len;
+    header.matrix_size = profile->matrix->size;
+    for (array=0; array<12; ++array) {
+        if (NULL != *profile_array(p, array)) {
+            header.present |= 1U << array;
+        }
+    }
+    header.matrix_hash = matrix_hash(profile->matrix);
+    name = profile->matrix->name ? profile->matrix->name : "";
+    strncpy(header.matrix_name, name, sizeof(header.matrix_name) - 1);
+
+    fp = fopen(fname, "wb");
+    if (NULL == fp) {
+        return -1;
+    }
+    if (1 != fwrite(&header, sizeof(header), 1, fp)
+            || padded(sizeof(header)) - sizeof(header)
+                != fwrite(zeros, 1, padded(sizeof(header)) - sizeof(header), fp)
+            || (profile->s1Len > 0
+                && 1 != fwrite(profile->s1, profile->s1Len, 1, fp))
+            || padded(profile->s1Len) - profile->s1Len
+                != fwrite(zeros, 1, padded(profile->s1Len) - profile->s1Len, fp)) {
+        status = -1;
+    }
+    for (array=0; 0 == status && array<12; ++array) {
+        size_t size = 0;
+        if (!(header.present & (1U << array))) {
+            continue;
+        }
+        size = array_size(array, header.vector_bytes,
+                profile->s1Len, profile->matrix->size);
+        if (1 != fwrite(*profile_array(p, array), size, 1, fp)
+                || padded(size) - size
+                    != fwrite(zeros, 1, padded(size) - size, fp)) {
+            status = -1;
+        }
+    }
+    if (0 != fclose(fp)) {
+        status = -1;
+    }
+
+    return status;
+}
+
+parasail_profile_t* parasail_profile_map(
+        const char *fname, const parasail_matrix_t *matrix, int layout)
+{
+    parasail_file_t *pf = NULL;
+    parasail_profile_t *profile = NULL;
+    const profile_header_t *header = NULL;
+    const char *name = NULL;
+    size_t size = 0;
+    size_t offset = 0;
+    int array = 0;
+
+    /* validate inputs */
+    assert(fname);
+    assert(matrix);
+
+    pf = parasail_open(fname);
+    size = (size_t)pf->size;
+    header = (const profile_header_t*)pf->buf;
+    name = matrix->name ? matrix->name : "";
+    if (size < sizeof(profile_header_t)
+            || 0 != memcmp(header->magic, PROFILE_MAGIC, sizeof(header->magic))
+            || header->layout != (uint32_t)layout
+            || !can_use(header->vector_bytes)
+            || 0 != (uintptr_t)pf->buf % header->vector_bytes
+            || header->matrix_size != (uint32_t)matrix->size
+            || header->matrix_hash != matrix_hash(matrix)
+            || 0 != strncmp(header->matrix_name, name,
+                sizeof(header->matrix_name) - 1)) {
+        parasail_close(pf);
+        errno = EINVAL;
+        return NULL;
+    }
+
+    /* the sections must fill the file exactly */
+    offset = padded(sizeof(profile_header_t)) + padded(header->s1Len);
+    for (array=0; array<12; ++array) {
+        if (header->present & (1U << array)) {
+            offset += padded(array_size(array, header->vector_bytes,
+                        header->s1Len, matrix->size));
+        }
+    }
+    if (offset != size) {
+        parasail_close(pf);
+        errno = EINVAL;
+        return NULL;
+    }
+
+    offset = padded(sizeof(profile_header_t));
+    profile = parasail_profile_new(pf->buf + offset, header->s1Len, matrix);
+    offset += padded(header->s1Len);
+    for (array=0; array<12; ++array) {
+        if (header->present & (1U << array)) {
+            *profile_array(profile, array) = (void*)(pf->buf + offset);
+            offset += padded(array_size(array, header->vector_bytes,
+                        header->s1Len, matrix->size));
+        }
+    }
+    profile->free = &mapped_free;
+    profile->vector_bytes = header->vector_bytes;
+    profile->layout = layout;
+    profile->file = pf;
+
+    return profile;
+}
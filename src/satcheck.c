@@ -7,31 +7,189 @@
  */
 #include "config.h"
 
+#include <assert.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/memory.h"
+
+/* Narrowest width worth starting a _sat function at. A kernel flags
+ * saturation once a cell leaves its limits, so a width is skipped when
+ * a cheap bound puts the score itself outside them. The alignment along
+ * the main diagonal bounds the score from below, its best segment for
+ * sw; for nw, min(s1Len,s2Len)*matrix->max less the gap that unequal
+ * lengths force bounds it from above. A loose bound only costs the
+ * narrow pass that was always tried first. */
+static int sat_bits(
+        const int type,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    const int len = s1Len < s2Len ? s1Len : s2Len;
+    const int diff = s1Len < s2Len ? s2Len - s1Len : s1Len - s2Len;
+    const int64_t gapped = diff ? open + (int64_t)gap*(diff-1) : 0;
+    int64_t lower = 0;
+    int64_t upper = INT64_MAX;
+    int64_t sum = 0;
+    int64_t run = 0;
+    int bits = 8;
+    int i = 0;
+
+    if (NULL == s1 || NULL == s2) {
+        return bits;
+    }
+
+    for (i=0; i<len; ++i) {
+        int score = matrix->matrix[matrix->size*matrix->mapper[(unsigned char)s1[i]]
+            + matrix->mapper[(unsigned char)s2[i]]];
+        sum += score;
+        run = run + score > 0 ? run + score : 0;
+        if (run > lower) {
+            lower = run;
+        }
+    }
+    if (PARASAIL_TRACE_NW == type) {
+        lower = sum - gapped;
+        upper = (int64_t)len*(matrix->max > 0 ? matrix->max : 0) - gapped;
+    }
+    else if (PARASAIL_TRACE_SG == type) {
+        /* the rest of the longer sequence is a free end gap */
+        lower = sum;
+    }
 
+    for (bits=8; bits<32; bits*=2) {
+        const int64_t max = (INT64_C(1) << (bits-1)) - 1;
+        const int64_t min = -max - 1;
+        const int64_t pos_limit = max - matrix->max - 1;
+        const int64_t neg_limit = (-open < matrix->min ?
+                min + open : min - matrix->min) + 1;
+        if (lower <= pos_limit && upper >= neg_limit) {
+            break;
+        }
+    }
 
+    return bits;
+}
 
-parasail_result_t* parasail_nw_scan_sat(
+static int sat_bits_profile(
+        const int type,
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return sat_bits(type, profile->s1, profile->s1Len, s2, s2Len,
+            open, gap, profile->matrix);
+}
+
+/* Re-run only the saturated entries of a batch at a wider width. */
+static void swipe_retry(
+        parasail_bfunction_t *function, parasail_result_t **results,
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    int i = 0;
+    int count = 0;
+    const char **sub_s2s = NULL;
+    int *sub_s2Lens = NULL;
+    int *index = NULL;
+    parasail_result_t **retry = NULL;
+
+    for (i=0; i<s2Count; ++i) {
+        if (results[i]->saturated) {
+            ++count;
+        }
+    }
+    if (0 == count) {
+        return;
+    }
+
+    sub_s2s = (const char**)malloc(sizeof(const char*)*count);
+    sub_s2Lens = (int*)malloc(sizeof(int)*count);
+    index = (int*)malloc(sizeof(int)*count);
+    assert(sub_s2s);
+    assert(sub_s2Lens);
+    assert(index);
+    count = 0;
+    for (i=0; i<s2Count; ++i) {
+        if (results[i]->saturated) {
+            sub_s2s[count] = s2s[i];
+            sub_s2Lens[count] = s2Lens[i];
+            index[count] = i;
+            ++count;
+        }
+    }
+
+    retry = function(s1, s1Len, sub_s2s, sub_s2Lens, count, open, gap, matrix);
+    for (i=0; i<count; ++i) {
+        parasail_result_free(results[index[i]]);
+        results[index[i]] = retry[i];
+    }
+
+    free(retry);
+    free(index);
+    free(sub_s2Lens);
+    free(sub_s2s);
+}
+
+/* Re-run a saturated query of a packed batch on its own, at 16 bits and
+ * then at 32; the queries packed beside it keep their results. */
+static parasail_result_t* packed_retry(
+        parasail_function_t *function16, parasail_function_t *function32,
+        parasail_result_t *result,
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
-    parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (result->saturated) {
         parasail_result_free(result);
-        result = parasail_nw_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = function16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (result->saturated) {
         parasail_result_free(result);
+        result = function32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+
+
+
+parasail_result_t* parasail_nw_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_nw_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
         result = parasail_nw_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -45,16 +203,26 @@ parasail_result_t* parasail_nw_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -68,16 +236,26 @@ parasail_result_t* parasail_nw_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -91,16 +269,26 @@ parasail_result_t* parasail_nw_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -114,16 +302,26 @@ parasail_result_t* parasail_nw_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -137,16 +335,26 @@ parasail_result_t* parasail_nw_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -160,16 +368,26 @@ parasail_result_t* parasail_nw_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -183,16 +401,26 @@ parasail_result_t* parasail_nw_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -206,16 +434,26 @@ parasail_result_t* parasail_nw_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -229,16 +467,26 @@ parasail_result_t* parasail_nw_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -252,16 +500,26 @@ parasail_result_t* parasail_nw_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -275,16 +533,26 @@ parasail_result_t* parasail_nw_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -298,16 +566,26 @@ parasail_result_t* parasail_nw_stats_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -321,16 +599,26 @@ parasail_result_t* parasail_nw_stats_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -344,16 +632,26 @@ parasail_result_t* parasail_nw_stats_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -367,16 +665,26 @@ parasail_result_t* parasail_nw_stats_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -390,16 +698,26 @@ parasail_result_t* parasail_nw_stats_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -413,16 +731,26 @@ parasail_result_t* parasail_nw_stats_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -436,16 +764,26 @@ parasail_result_t* parasail_nw_stats_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -459,16 +797,26 @@ parasail_result_t* parasail_nw_stats_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -482,16 +830,26 @@ parasail_result_t* parasail_nw_stats_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -505,16 +863,26 @@ parasail_result_t* parasail_nw_stats_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -528,16 +896,26 @@ parasail_result_t* parasail_nw_stats_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -551,16 +929,26 @@ parasail_result_t* parasail_nw_stats_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -574,16 +962,26 @@ parasail_result_t* parasail_nw_table_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -597,16 +995,26 @@ parasail_result_t* parasail_nw_table_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -620,16 +1028,26 @@ parasail_result_t* parasail_nw_table_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -643,16 +1061,26 @@ parasail_result_t* parasail_nw_table_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -666,16 +1094,26 @@ parasail_result_t* parasail_nw_table_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -689,16 +1127,26 @@ parasail_result_t* parasail_nw_table_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -712,16 +1160,26 @@ parasail_result_t* parasail_nw_table_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -735,16 +1193,26 @@ parasail_result_t* parasail_nw_table_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -758,16 +1226,26 @@ parasail_result_t* parasail_nw_table_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -781,16 +1259,26 @@ parasail_result_t* parasail_nw_table_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -804,16 +1292,26 @@ parasail_result_t* parasail_nw_table_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -827,16 +1325,26 @@ parasail_result_t* parasail_nw_table_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_table_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_table_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -850,16 +1358,26 @@ parasail_result_t* parasail_nw_stats_table_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -873,16 +1391,26 @@ parasail_result_t* parasail_nw_stats_table_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -896,16 +1424,26 @@ parasail_result_t* parasail_nw_stats_table_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -919,16 +1457,26 @@ parasail_result_t* parasail_nw_stats_table_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -942,16 +1490,26 @@ parasail_result_t* parasail_nw_stats_table_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -965,16 +1523,26 @@ parasail_result_t* parasail_nw_stats_table_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -988,16 +1556,26 @@ parasail_result_t* parasail_nw_stats_table_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1011,16 +1589,26 @@ parasail_result_t* parasail_nw_stats_table_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1034,16 +1622,26 @@ parasail_result_t* parasail_nw_stats_table_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1057,16 +1655,26 @@ parasail_result_t* parasail_nw_stats_table_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1080,16 +1688,26 @@ parasail_result_t* parasail_nw_stats_table_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1103,16 +1721,26 @@ parasail_result_t* parasail_nw_stats_table_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_table_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_table_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1126,16 +1754,26 @@ parasail_result_t* parasail_nw_rowcol_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1149,16 +1787,26 @@ parasail_result_t* parasail_nw_rowcol_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1172,16 +1820,26 @@ parasail_result_t* parasail_nw_rowcol_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1195,16 +1853,26 @@ parasail_result_t* parasail_nw_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1218,16 +1886,26 @@ parasail_result_t* parasail_nw_rowcol_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1241,16 +1919,26 @@ parasail_result_t* parasail_nw_rowcol_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1264,16 +1952,26 @@ parasail_result_t* parasail_nw_rowcol_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1287,16 +1985,26 @@ parasail_result_t* parasail_nw_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1310,16 +2018,26 @@ parasail_result_t* parasail_nw_rowcol_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1333,16 +2051,26 @@ parasail_result_t* parasail_nw_rowcol_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1356,16 +2084,26 @@ parasail_result_t* parasail_nw_rowcol_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1379,16 +2117,26 @@ parasail_result_t* parasail_nw_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_rowcol_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_rowcol_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1402,16 +2150,26 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1425,16 +2183,26 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1448,16 +2216,26 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1471,16 +2249,26 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1494,16 +2282,26 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1517,16 +2315,26 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1540,16 +2348,26 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1563,16 +2381,26 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1586,16 +2414,26 @@ parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1609,16 +2447,26 @@ parasail_result_t* parasail_nw_stats_rowcol_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1632,16 +2480,26 @@ parasail_result_t* parasail_nw_stats_rowcol_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1655,16 +2513,26 @@ parasail_result_t* parasail_nw_stats_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_stats_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_nw_stats_rowcol_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_nw_stats_rowcol_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1678,16 +2546,26 @@ parasail_result_t* parasail_sg_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1701,16 +2579,26 @@ parasail_result_t* parasail_sg_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1724,16 +2612,26 @@ parasail_result_t* parasail_sg_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1747,16 +2645,26 @@ parasail_result_t* parasail_sg_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1770,16 +2678,26 @@ parasail_result_t* parasail_sg_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1793,16 +2711,26 @@ parasail_result_t* parasail_sg_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1816,16 +2744,26 @@ parasail_result_t* parasail_sg_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1839,16 +2777,26 @@ parasail_result_t* parasail_sg_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1862,16 +2810,26 @@ parasail_result_t* parasail_sg_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1885,16 +2843,26 @@ parasail_result_t* parasail_sg_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1908,16 +2876,26 @@ parasail_result_t* parasail_sg_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1931,16 +2909,26 @@ parasail_result_t* parasail_sg_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1954,16 +2942,26 @@ parasail_result_t* parasail_sg_stats_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -1977,16 +2975,26 @@ parasail_result_t* parasail_sg_stats_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2000,16 +3008,26 @@ parasail_result_t* parasail_sg_stats_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2023,16 +3041,26 @@ parasail_result_t* parasail_sg_stats_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2046,16 +3074,26 @@ parasail_result_t* parasail_sg_stats_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2069,16 +3107,26 @@ parasail_result_t* parasail_sg_stats_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2092,16 +3140,26 @@ parasail_result_t* parasail_sg_stats_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2115,16 +3173,26 @@ parasail_result_t* parasail_sg_stats_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2138,16 +3206,26 @@ parasail_result_t* parasail_sg_stats_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2161,16 +3239,26 @@ parasail_result_t* parasail_sg_stats_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2184,16 +3272,26 @@ parasail_result_t* parasail_sg_stats_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2207,16 +3305,26 @@ parasail_result_t* parasail_sg_stats_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2230,16 +3338,26 @@ parasail_result_t* parasail_sg_table_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2253,16 +3371,26 @@ parasail_result_t* parasail_sg_table_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2276,16 +3404,26 @@ parasail_result_t* parasail_sg_table_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2299,16 +3437,26 @@ parasail_result_t* parasail_sg_table_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2322,16 +3470,26 @@ parasail_result_t* parasail_sg_table_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2345,16 +3503,26 @@ parasail_result_t* parasail_sg_table_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2368,16 +3536,26 @@ parasail_result_t* parasail_sg_table_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2391,16 +3569,26 @@ parasail_result_t* parasail_sg_table_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2414,16 +3602,26 @@ parasail_result_t* parasail_sg_table_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2437,16 +3635,26 @@ parasail_result_t* parasail_sg_table_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2460,16 +3668,26 @@ parasail_result_t* parasail_sg_table_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2483,16 +3701,26 @@ parasail_result_t* parasail_sg_table_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_table_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_table_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2506,16 +3734,26 @@ parasail_result_t* parasail_sg_stats_table_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2529,16 +3767,26 @@ parasail_result_t* parasail_sg_stats_table_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2552,16 +3800,26 @@ parasail_result_t* parasail_sg_stats_table_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2575,16 +3833,26 @@ parasail_result_t* parasail_sg_stats_table_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2598,16 +3866,26 @@ parasail_result_t* parasail_sg_stats_table_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2621,16 +3899,26 @@ parasail_result_t* parasail_sg_stats_table_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2644,16 +3932,26 @@ parasail_result_t* parasail_sg_stats_table_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2667,16 +3965,26 @@ parasail_result_t* parasail_sg_stats_table_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2690,16 +3998,26 @@ parasail_result_t* parasail_sg_stats_table_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2713,16 +4031,26 @@ parasail_result_t* parasail_sg_stats_table_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2736,16 +4064,26 @@ parasail_result_t* parasail_sg_stats_table_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2759,16 +4097,26 @@ parasail_result_t* parasail_sg_stats_table_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_table_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_table_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2782,16 +4130,26 @@ parasail_result_t* parasail_sg_rowcol_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2805,16 +4163,26 @@ parasail_result_t* parasail_sg_rowcol_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2828,16 +4196,26 @@ parasail_result_t* parasail_sg_rowcol_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2851,16 +4229,26 @@ parasail_result_t* parasail_sg_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2874,16 +4262,26 @@ parasail_result_t* parasail_sg_rowcol_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2897,16 +4295,26 @@ parasail_result_t* parasail_sg_rowcol_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2920,16 +4328,26 @@ parasail_result_t* parasail_sg_rowcol_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2943,16 +4361,26 @@ parasail_result_t* parasail_sg_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2966,16 +4394,26 @@ parasail_result_t* parasail_sg_rowcol_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -2989,16 +4427,26 @@ parasail_result_t* parasail_sg_rowcol_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3012,16 +4460,26 @@ parasail_result_t* parasail_sg_rowcol_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3035,16 +4493,26 @@ parasail_result_t* parasail_sg_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_rowcol_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_rowcol_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3058,16 +4526,26 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3081,16 +4559,26 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3104,16 +4592,26 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3127,16 +4625,26 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3150,16 +4658,26 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3173,16 +4691,26 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3196,16 +4724,26 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3219,16 +4757,26 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3242,16 +4790,26 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3265,16 +4823,26 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3288,16 +4856,26 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3311,16 +4889,26 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_stats_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sg_stats_rowcol_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sg_stats_rowcol_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3334,16 +4922,26 @@ parasail_result_t* parasail_sw_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3357,16 +4955,26 @@ parasail_result_t* parasail_sw_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3380,16 +4988,26 @@ parasail_result_t* parasail_sw_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3403,131 +5021,59 @@ parasail_result_t* parasail_sw_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sw_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_striped_sse2_128_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-#endif
-
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_striped_sse41_128_sat(
+parasail_result_t* parasail_sw_diag_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-#endif
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_striped_avx2_256_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (8 == bits) {
+        result = parasail_sw_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-
-    return result;
-}
-#endif
-
-
-parasail_result_t* parasail_sw_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-    
-    result = parasail_sw_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (16 == bits) {
         result = parasail_sw_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3541,16 +5087,26 @@ parasail_result_t* parasail_sw_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3564,16 +5120,26 @@ parasail_result_t* parasail_sw_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3587,16 +5153,26 @@ parasail_result_t* parasail_sw_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3610,16 +5186,26 @@ parasail_result_t* parasail_sw_stats_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3633,16 +5219,26 @@ parasail_result_t* parasail_sw_stats_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3656,16 +5252,26 @@ parasail_result_t* parasail_sw_stats_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3679,16 +5285,26 @@ parasail_result_t* parasail_sw_stats_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3702,16 +5318,26 @@ parasail_result_t* parasail_sw_stats_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3725,16 +5351,26 @@ parasail_result_t* parasail_sw_stats_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3748,16 +5384,26 @@ parasail_result_t* parasail_sw_stats_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3771,16 +5417,26 @@ parasail_result_t* parasail_sw_stats_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3794,16 +5450,26 @@ parasail_result_t* parasail_sw_stats_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3817,16 +5483,26 @@ parasail_result_t* parasail_sw_stats_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3840,16 +5516,26 @@ parasail_result_t* parasail_sw_stats_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3863,16 +5549,26 @@ parasail_result_t* parasail_sw_stats_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3886,16 +5582,26 @@ parasail_result_t* parasail_sw_table_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3909,16 +5615,26 @@ parasail_result_t* parasail_sw_table_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3932,16 +5648,26 @@ parasail_result_t* parasail_sw_table_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3955,16 +5681,26 @@ parasail_result_t* parasail_sw_table_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -3978,16 +5714,26 @@ parasail_result_t* parasail_sw_table_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4001,16 +5747,26 @@ parasail_result_t* parasail_sw_table_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4024,16 +5780,26 @@ parasail_result_t* parasail_sw_table_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4047,16 +5813,26 @@ parasail_result_t* parasail_sw_table_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4070,16 +5846,26 @@ parasail_result_t* parasail_sw_table_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4093,16 +5879,26 @@ parasail_result_t* parasail_sw_table_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4116,16 +5912,26 @@ parasail_result_t* parasail_sw_table_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4139,16 +5945,26 @@ parasail_result_t* parasail_sw_table_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_table_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_table_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4162,16 +5978,26 @@ parasail_result_t* parasail_sw_stats_table_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4185,16 +6011,26 @@ parasail_result_t* parasail_sw_stats_table_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4208,16 +6044,26 @@ parasail_result_t* parasail_sw_stats_table_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4231,16 +6077,26 @@ parasail_result_t* parasail_sw_stats_table_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4254,16 +6110,26 @@ parasail_result_t* parasail_sw_stats_table_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4277,16 +6143,26 @@ parasail_result_t* parasail_sw_stats_table_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4300,16 +6176,26 @@ parasail_result_t* parasail_sw_stats_table_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4323,16 +6209,26 @@ parasail_result_t* parasail_sw_stats_table_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4346,16 +6242,26 @@ parasail_result_t* parasail_sw_stats_table_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4369,16 +6275,26 @@ parasail_result_t* parasail_sw_stats_table_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4392,16 +6308,26 @@ parasail_result_t* parasail_sw_stats_table_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4415,16 +6341,26 @@ parasail_result_t* parasail_sw_stats_table_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_table_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_table_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_table_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4438,16 +6374,26 @@ parasail_result_t* parasail_sw_rowcol_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4461,16 +6407,26 @@ parasail_result_t* parasail_sw_rowcol_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4484,16 +6440,26 @@ parasail_result_t* parasail_sw_rowcol_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4507,16 +6473,26 @@ parasail_result_t* parasail_sw_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4530,16 +6506,26 @@ parasail_result_t* parasail_sw_rowcol_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4553,16 +6539,26 @@ parasail_result_t* parasail_sw_rowcol_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4576,16 +6572,26 @@ parasail_result_t* parasail_sw_rowcol_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4599,16 +6605,26 @@ parasail_result_t* parasail_sw_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4622,16 +6638,26 @@ parasail_result_t* parasail_sw_rowcol_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4645,16 +6671,26 @@ parasail_result_t* parasail_sw_rowcol_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4668,16 +6704,26 @@ parasail_result_t* parasail_sw_rowcol_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4691,16 +6737,26 @@ parasail_result_t* parasail_sw_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_rowcol_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_rowcol_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4714,16 +6770,26 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4737,16 +6803,26 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_scan_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_scan_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_scan_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4760,16 +6836,26 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4783,16 +6869,26 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4806,16 +6902,26 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4829,16 +6935,26 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4852,16 +6968,26 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4875,16 +7001,26 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4898,16 +7034,26 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_diag_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_diag_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_diag_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4921,16 +7067,26 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_sse2_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_diag_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_diag_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_diag_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4944,16 +7100,26 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_sse41_128_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_diag_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_diag_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_diag_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4967,16 +7133,26 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_avx2_256_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_stats_rowcol_diag_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
         result = parasail_sw_stats_rowcol_diag_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
+    if (32 == bits) {
         result = parasail_sw_stats_rowcol_diag_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
@@ -4989,3162 +7165,12209 @@ parasail_result_t* parasail_nw_scan_profile_sat(
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_nw_stats_scan_profile_sat(
+parasail_result_t* parasail_nw_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_stats_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_nw_table_scan_profile_sat(
+parasail_result_t* parasail_nw_stats_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_table_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_table_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
+parasail_result_t* parasail_nw_stats_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
+parasail_result_t* parasail_nw_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_table_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
+parasail_result_t* parasail_nw_table_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_table_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_nw_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_table_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_table_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_table_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sg_scan_profile_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sg_stats_scan_profile_sat(
+parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_table_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_stats_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sg_table_scan_profile_sat(
+parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_rowcol_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_table_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_table_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
+parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_rowcol_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sg_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_NW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sw_scan_profile_sat(
+parasail_result_t* parasail_sg_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sw_stats_scan_profile_sat(
+parasail_result_t* parasail_sg_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_stats_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sw_table_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_table_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_table_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
+parasail_result_t* parasail_sg_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_sat(
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_sat(
+
+parasail_result_t* parasail_sg_table_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_table_striped_profile_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
     }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
-#endif
 
 
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
     }
+    result->width = bits;
 
     return result;
 }
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_sat_ws(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_sat(
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_table_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_table_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_table_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
     }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
 
     return result;
 }
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
-    
-    result = parasail_sw_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
     }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SG, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_table_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_table_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_table_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_8(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_16(wide, s2, s2Len, open, gap);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_32(wide, s2, s2Len, open, gap);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_8_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_16_ws(wide, s2, s2Len, open, gap, workspace);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_32_ws(wide, s2, s2Len, open, gap, workspace);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE2
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_8_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_16_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_32_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+
+parasail_result_t* parasail_sw_striped_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t * profile = NULL;
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+    parasail_resume_t resume;
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    parasail_workspace_init(&workspace);
+    parasail_resume_init(&resume);
+    if (8 == bits) {
+        profile = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_sse2_128_8_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            parasail_profile_free(profile);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        profile = parasail_profile_create_sse_128_16(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_sse2_128_16_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            parasail_profile_free(profile);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        profile = parasail_profile_create_sse_128_32(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_sse2_128_32_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+    }
+    result->width = bits;
+    parasail_profile_free(profile);
+    parasail_resume_clear(&resume);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+
+    parasail_workspace_init(&workspace);
+    result = parasail_sw_striped_profile_sse2_128_sat_ws(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    parasail_resume_t resume;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    parasail_resume_init(&resume);
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_striped_profile_sse2_128_8_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_striped_profile_sse2_128_16_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_striped_profile_sse2_128_32_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+    }
+    result->width = bits;
+    parasail_resume_clear(&resume);
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_8_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_16_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_32_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+
+parasail_result_t* parasail_sw_striped_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t * profile = NULL;
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+    parasail_resume_t resume;
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    parasail_workspace_init(&workspace);
+    parasail_resume_init(&resume);
+    if (8 == bits) {
+        profile = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_sse41_128_8_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            parasail_profile_free(profile);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        profile = parasail_profile_create_sse_128_16(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_sse41_128_16_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            parasail_profile_free(profile);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        profile = parasail_profile_create_sse_128_32(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_sse41_128_32_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+    }
+    result->width = bits;
+    parasail_profile_free(profile);
+    parasail_resume_clear(&resume);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+
+    parasail_workspace_init(&workspace);
+    result = parasail_sw_striped_profile_sse41_128_sat_ws(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    parasail_resume_t resume;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    parasail_resume_init(&resume);
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_striped_profile_sse41_128_8_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_striped_profile_sse41_128_16_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_striped_profile_sse41_128_32_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+    }
+    result->width = bits;
+    parasail_resume_clear(&resume);
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_8_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_16_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_32_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+
+parasail_result_t* parasail_sw_striped_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t * profile = NULL;
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+    parasail_resume_t resume;
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    parasail_workspace_init(&workspace);
+    parasail_resume_init(&resume);
+    if (8 == bits) {
+        profile = parasail_profile_create_avx_256_8(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_avx2_256_8_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            parasail_profile_free(profile);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        profile = parasail_profile_create_avx_256_16(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_avx2_256_16_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            parasail_profile_free(profile);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        profile = parasail_profile_create_avx_256_32(s1, s1Len, matrix);
+        result = parasail_sw_striped_profile_avx2_256_32_resume(profile, s2, s2Len, open, gap, &workspace, &resume);
+    }
+    result->width = bits;
+    parasail_profile_free(profile);
+    parasail_resume_clear(&resume);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+
+    parasail_workspace_init(&workspace);
+    result = parasail_sw_striped_profile_avx2_256_sat_ws(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    parasail_resume_t resume;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    parasail_resume_init(&resume);
+    if (8 == bits) {
+        wide = parasail_profile_width(profile, 8, &copy);
+        result = parasail_sw_striped_profile_avx2_256_8_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        wide = parasail_profile_width(profile, 16, &copy);
+        result = parasail_sw_striped_profile_avx2_256_16_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        wide = parasail_profile_width(profile, 32, &copy);
+        result = parasail_sw_striped_profile_avx2_256_32_resume(wide, s2, s2Len, open, gap, workspace, &resume);
+    }
+    result->width = bits;
+    parasail_resume_clear(&resume);
+
+    return result;
+}
+#endif
+
+parasail_result_t* parasail_sw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_KNC
+    if (0) {
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return parasail_sw_striped_avx2_256_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return parasail_sw_striped_sse41_128_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return parasail_sw_striped_sse2_128_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    else
+#endif
+#endif
+    {
+        parasail_result_t * result = NULL;
+        int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+        if (8 == bits) {
+            result = parasail_sw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+            if (result->saturated) {
+                parasail_result_free(result);
+                bits = 16;
+            }
+        }
+        if (16 == bits) {
+            result = parasail_sw_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+            if (result->saturated) {
+                parasail_result_free(result);
+                bits = 32;
+            }
+        }
+        if (32 == bits) {
+            result = parasail_sw_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+        }
+        result->width = bits;
+
+        return result;
+    }
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_KNC
+    if (0) {
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return parasail_sw_striped_profile_avx2_256_sat(profile, s2, s2Len, open, gap);
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return parasail_sw_striped_profile_sse41_128_sat(profile, s2, s2Len, open, gap);
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return parasail_sw_striped_profile_sse2_128_sat(profile, s2, s2Len, open, gap);
+    }
+    else
+#endif
+#endif
+    {
+        parasail_result_t * result = NULL;
+        parasail_profile_t copy;
+        const parasail_profile_t *wide = NULL;
+        int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+        if (8 == bits) {
+            wide = parasail_profile_width(profile, 8, &copy);
+            result = parasail_sw_striped_profile_8(wide, s2, s2Len, open, gap);
+            if (result->saturated) {
+                parasail_result_free(result);
+                bits = 16;
+            }
+        }
+        if (16 == bits) {
+            wide = parasail_profile_width(profile, 16, &copy);
+            result = parasail_sw_striped_profile_16(wide, s2, s2Len, open, gap);
+            if (result->saturated) {
+                parasail_result_free(result);
+                bits = 32;
+            }
+        }
+        if (32 == bits) {
+            wide = parasail_profile_width(profile, 32, &copy);
+            result = parasail_sw_striped_profile_32(wide, s2, s2Len, open, gap);
+        }
+        result->width = bits;
+
+        return result;
+    }
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (0) {
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return parasail_sw_striped_profile_avx2_256_sat_ws(profile, s2, s2Len, open, gap, workspace);
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return parasail_sw_striped_profile_sse41_128_sat_ws(profile, s2, s2Len, open, gap, workspace);
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return parasail_sw_striped_profile_sse2_128_sat_ws(profile, s2, s2Len, open, gap, workspace);
+    }
+    else
+#endif
+#endif
+    {
+        parasail_result_t * result = NULL;
+        parasail_profile_t copy;
+        const parasail_profile_t *wide = NULL;
+        int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+        if (8 == bits) {
+            wide = parasail_profile_width(profile, 8, &copy);
+            result = parasail_sw_striped_profile_8_ws(wide, s2, s2Len, open, gap, workspace);
+            if (result->saturated) {
+                parasail_result_free(result);
+                bits = 16;
+            }
+        }
+        if (16 == bits) {
+            wide = parasail_profile_width(profile, 16, &copy);
+            result = parasail_sw_striped_profile_16_ws(wide, s2, s2Len, open, gap, workspace);
+            if (result->saturated) {
+                parasail_result_free(result);
+                bits = 32;
+            }
+        }
+        if (32 == bits) {
+            wide = parasail_profile_width(profile, 32, &copy);
+            result = parasail_sw_striped_profile_32_ws(wide, s2, s2Len, open, gap, workspace);
+        }
+        result->width = bits;
+
+        return result;
+    }
+}
+
+
+parasail_result_t* parasail_nw_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_nw_table_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_table_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_table_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_table_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_table_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_table_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_table_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_table_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_table_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_table_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_nw_rowcol_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_rowcol_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_rowcol_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_rowcol_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_rowcol_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_nw_rowcol_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_banded_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_banded_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_banded_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_table_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_table_banded_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_table_banded_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_table_banded_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_table_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_table_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_table_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_table_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_table_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_table_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_rowcol_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_rowcol_banded_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_banded_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_banded_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_rowcol_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_rowcol_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_rowcol_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sg_rowcol_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_banded_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_banded_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_banded_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_table_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_table_banded_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_table_banded_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_table_banded_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_table_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_table_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_table_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_table_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_table_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_table_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_table_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_table_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_rowcol_banded_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_rowcol_banded_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_banded_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_banded_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_rowcol_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_rowcol_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_rowcol_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    
+    result = parasail_sw_rowcol_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, diag, k, matrix);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t** parasail_nw_swipe_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_nw_swipe_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_nw_swipe_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_nw_swipe_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t** parasail_nw_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_nw_swipe_sse41_128_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_nw_swipe_sse41_128_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_nw_swipe_sse41_128_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t** parasail_nw_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_nw_swipe_avx2_256_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_nw_swipe_avx2_256_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_nw_swipe_avx2_256_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+#endif
+
+
+parasail_result_t** parasail_sg_swipe_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_sg_swipe_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sg_swipe_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sg_swipe_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t** parasail_sg_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_sg_swipe_sse41_128_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sg_swipe_sse41_128_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sg_swipe_sse41_128_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t** parasail_sg_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_sg_swipe_avx2_256_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sg_swipe_avx2_256_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sg_swipe_avx2_256_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+#endif
+
+
+parasail_result_t** parasail_sw_swipe_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_sw_swipe_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sw_swipe_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sw_swipe_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t** parasail_sw_swipe_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_sw_swipe_sse41_128_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sw_swipe_sse41_128_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sw_swipe_sse41_128_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t** parasail_sw_swipe_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = parasail_sw_swipe_avx2_256_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sw_swipe_avx2_256_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(parasail_sw_swipe_avx2_256_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+#endif
+
+
+parasail_result_t** parasail_nw_packed_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_nw_packed_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_nw_short_16, parasail_nw_short_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_nw_packed_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_nw_packed_profile_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_nw_short_16, parasail_nw_short_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t** parasail_nw_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_nw_packed_sse41_128_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_nw_short_sse41_128_16, parasail_nw_short_sse41_128_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_nw_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_nw_packed_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_nw_short_sse41_128_16, parasail_nw_short_sse41_128_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t** parasail_nw_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_nw_packed_avx2_256_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_nw_short_avx2_256_16, parasail_nw_short_avx2_256_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_nw_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_nw_packed_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_nw_short_avx2_256_16, parasail_nw_short_avx2_256_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+#endif
+
+
+parasail_result_t** parasail_sg_packed_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sg_packed_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_sg_short_16, parasail_sg_short_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_sg_packed_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sg_packed_profile_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_sg_short_16, parasail_sg_short_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t** parasail_sg_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sg_packed_sse41_128_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_sg_short_sse41_128_16, parasail_sg_short_sse41_128_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_sg_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sg_packed_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_sg_short_sse41_128_16, parasail_sg_short_sse41_128_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t** parasail_sg_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sg_packed_avx2_256_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_sg_short_avx2_256_16, parasail_sg_short_avx2_256_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_sg_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sg_packed_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_sg_short_avx2_256_16, parasail_sg_short_avx2_256_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+#endif
+
+
+parasail_result_t** parasail_sw_packed_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sw_packed_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_sw_short_16, parasail_sw_short_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_packed_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sw_packed_profile_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_sw_short_16, parasail_sw_short_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t** parasail_sw_packed_sse41_128_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sw_packed_sse41_128_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_sw_short_sse41_128_16, parasail_sw_short_sse41_128_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_packed_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sw_packed_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_sw_short_sse41_128_16, parasail_sw_short_sse41_128_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t** parasail_sw_packed_avx2_256_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sw_packed_avx2_256_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(parasail_sw_short_avx2_256_16, parasail_sw_short_avx2_256_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_packed_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = parasail_sw_packed_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(parasail_sw_short_avx2_256_16, parasail_sw_short_avx2_256_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
+    }
+
+    return results;
+}
+#endif
+
+
+parasail_result_t* parasail_nw_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_trace_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_nw_trace_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_nw_trace_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_trace_scan_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_trace_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_nw_trace_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_nw_trace_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_trace_scan_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_nw_trace_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_nw_trace_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_nw_trace_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_trace_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_sg_trace_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_sg_trace_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_trace_scan_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_trace_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_sg_trace_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_sg_trace_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_trace_scan_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sg_trace_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_sg_trace_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_sg_trace_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_trace_scan_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_sw_trace_scan_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_sw_trace_scan_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_trace_scan_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_trace_scan_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_sw_trace_scan_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_sw_trace_scan_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    result->width = bits;
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_trace_scan_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    if (8 == bits) {
+        result = parasail_sw_trace_scan_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 16;
+        }
+    }
+    if (16 == bits) {
+        result = parasail_sw_trace_scan_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (result->saturated) {
+            parasail_result_free(result);
+            bits = 32;
+        }
+    }
+    if (32 == bits) {
+        result = parasail_sw_trace_scan_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
+    result->width = bits;
 
     return result;
 }
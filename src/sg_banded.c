@@ -0,0 +1,163 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define NEG_INF_32 (INT32_MIN/2)
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+#ifdef PARASAIL_TABLE
+#define ENAME parasail_sg_banded_table
+#else
+#ifdef PARASAIL_ROWCOL
+#define ENAME parasail_sg_banded_rowcol
+#else
+#define ENAME parasail_sg_banded
+#endif
+#endif
+
+/* keep band limits within one diagonal of the table */
+static inline int band_limit(int64_t d, int s1Len, int s2Len)
+{
+    return d < -s2Len-1 ? -s2Len-1 : d > s1Len+1 ? s1Len+1 : (int)d;
+}
+
+parasail_result_t* ENAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+    int * const restrict s1 = parasail_memalign_int(16, s1Len);
+    int * const restrict s2 = parasail_memalign_int(16, s2Len);
+    int * const restrict H = parasail_memalign_int(16, s2Len+1);
+    int * const restrict F = parasail_memalign_int(16, s2Len+1);
+    /* diagonals (row minus column) inside the band */
+    const int dlo = band_limit(-(int64_t)diag - k, s1Len, s2Len);
+    const int dhi = band_limit(-(int64_t)diag + k, s1Len, s2Len);
+    int i = 0;
+    int j = 0;
+    int score = NEG_INF_32;
+    int end_query = s1Len;
+    int end_ref = s2Len;
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+#ifdef PARASAIL_TABLE
+    /* cells outside of the band are reported as 0 */
+    parasail_memset_int(result->score_table, 0, (size_t)s1Len*s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+    parasail_memset_int(result->score_row, 0, s2Len);
+    parasail_memset_int(result->score_col, 0, s1Len);
+#endif
+
+    /* upper left corner */
+    H[0] = 0;
+    F[0] = NEG_INF_32;
+
+    /* first row, only inside the band */
+    for (j=1; j<=s2Len; ++j) {
+        H[j] = -j >= dlo && -j <= dhi ? 0 : NEG_INF_32;
+        F[j] = NEG_INF_32;
+    }
+
+    /* iter over first sequence */
+    for (i=1; i<=s1Len; ++i) {
+        const int * const restrict matrow = &matrix->matrix[matrix->size*s1[i-1]];
+        /* only the columns that intersect the band */
+        const int jlo = MAX(1, i-dhi);
+        const int jhi = MIN(s2Len, i-dlo);
+        int NH = H[jlo-1];
+        int WH = NEG_INF_32;
+        int E = NEG_INF_32;
+        if (1 == jlo) {
+            /* init first column */
+            WH = i >= dlo && i <= dhi ? 0 : NEG_INF_32;
+            H[0] = WH;
+        }
+        for (j=jlo; j<=jhi; ++j) {
+            int H_dag;
+            int E_opn;
+            int E_ext;
+            int F_opn;
+            int F_ext;
+            int NWH = NH;
+            NH = H[j];
+            F_opn = NH - open;
+            F_ext = F[j] - gap;
+            F[j] = MAX(F_opn, F_ext);
+            E_opn = WH - open;
+            E_ext = E    - gap;
+            E    = MAX(E_opn, E_ext);
+            H_dag = NWH + matrow[s2[j-1]];
+            WH = MAX(H_dag, E);
+            WH = MAX(WH, F[j]);
+            H[j] = WH;
+            /* last column, then last row */
+            if (j == s2Len && WH > score) {
+                score = WH;
+                end_query = i-1;
+                end_ref = j-1;
+            }
+            else if (i == s1Len && (WH > score
+                        || (WH == score && j-1 < end_ref))) {
+                score = WH;
+                end_query = i-1;
+                end_ref = j-1;
+            }
+#ifdef PARASAIL_TABLE
+            result->score_table[(i-1)*s2Len + (j-1)] = WH;
+#endif
+#ifdef PARASAIL_ROWCOL
+            if (i == s1Len) {
+                result->score_row[j-1] = WH;
+            }
+            if (j == s2Len) {
+                result->score_col[i-1] = WH;
+            }
+#endif
+        }
+    }
+
+    if (end_query == s1Len) {
+        /* the band does not intersect the table */
+        score = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_free(F);
+    parasail_free(H);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
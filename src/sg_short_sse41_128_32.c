@@ -0,0 +1,241 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#include <smmintrin.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_sse.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_sg_table_short_sse41_128_32
+#define PNAME parasail_sg_table_short_profile_sse41_128_32
+#define WNAME parasail_sg_table_short_profile_sse41_128_32_ws
+#define SNAME parasail_sg_table_striped_profile_sse41_128_32_ws
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_sg_rowcol_short_sse41_128_32
+#define PNAME parasail_sg_rowcol_short_profile_sse41_128_32
+#define WNAME parasail_sg_rowcol_short_profile_sse41_128_32_ws
+#define SNAME parasail_sg_rowcol_striped_profile_sse41_128_32_ws
+#else
+#define FNAME parasail_sg_short_sse41_128_32
+#define PNAME parasail_sg_short_profile_sse41_128_32
+#define WNAME parasail_sg_short_profile_sse41_128_32_ws
+#define SNAME parasail_sg_striped_profile_sse41_128_32_ws
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_sse_128_32(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+/* A query of at most one vector sits in the striped profile in order,
+ * one vector per database letter. H and E stay in registers and F is
+ * resolved once per column, where the striped kernel would rerun its
+ * lazy F loop over a single segment. */
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 4; /* number of values in vector unit */
+    const __m128i* const restrict vProfile = (__m128i*)profile->profile32.score;
+    __m128i vGapO = _mm_set1_epi32(open);
+    __m128i vGapE = _mm_set1_epi32(gap);
+    __m128i vZero = _mm_setzero_si128();
+    __m128i vFin = _mm_set1_epi32(-open);
+    __m128i vFront[2];
+    __m128i vH = vZero;
+    __m128i vE = _mm_set1_epi32(-open);
+    __m128i vBest = _mm_set1_epi32(NEG_INF);
+    __m128i vLast;
+    __m128i_32_t h;
+    const int32_t NEG_LIMIT = (-open < matrix->min ?
+        INT32_MIN + open : INT32_MIN - matrix->min) + 1;
+    const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
+    int32_t score = NEG_INF;
+    __m128i vNegLimit = _mm_set1_epi32(NEG_LIMIT);
+    __m128i vPosLimit = _mm_set1_epi32(POS_LIMIT);
+    __m128i vSaturationCheckMin = vPosLimit;
+    __m128i vSaturationCheckMax = vNegLimit;
+    parasail_result_t *result = NULL;
+
+    /* longer queries, and the stop and X-drop settings, are left to
+     * the striped kernel */
+    if (s1Len > segWidth || INT32_MAX != profile->stop
+            || (profile->stop_mode & PARASAIL_STOP_UNREACHABLE)
+            || INT32_MAX != profile->xdrop) {
+        return SNAME(profile, s2, s2Len, open, gap, workspace);
+    }
+
+#ifdef PARASAIL_TABLE
+    /* as are narrow and windowed tables */
+    if (profile->narrow_tables || profile->window.query_end) {
+        return SNAME(profile, s2, s2Len, open, gap, workspace);
+    }
+    result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    result = parasail_result_new();
+#endif
+#endif
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * leaves empty have nothing above them */
+    for (k=0; k<2; ++k) {
+        const int32_t lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            int64_t tmp = -(int64_t)lanes*gap;
+            h.v[i] = (i < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = h.m;
+    }
+
+    /* lane s1Len-1 holds the last row */
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = i == s1Len-1 ? -1 : 0;
+    }
+    vLast = h.m;
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m128i vF;
+        __m128i vT;
+
+        /* row -1 is zero, which enters at lane 0 of the diagonal */
+        vH = _mm_alignr_epi8(vH, vZero, 12);
+        vH = _mm_add_epi32(vH, _mm_load_si128(vProfile + matrix->mapper[(unsigned char)s2[j]]));
+        vH = _mm_max_epi32(vH, vE);
+
+        /* resolve F down the column with a log-step prefix max */
+        vF = _mm_alignr_epi8(_mm_sub_epi32(vH, vGapO), vFin, 12);
+        do {
+            vT = _mm_max_epi32(vF, _mm_add_epi32(_mm_slli_si128(vF, 4), vFront[0]));
+            if (!_mm_movemask_epi8(_mm_cmpgt_epi32(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm_max_epi32(vF, _mm_add_epi32(_mm_slli_si128(vF, 8), vFront[1]));
+            vF = vT;
+        } while (0);
+        vH = _mm_max_epi32(vH, vF);
+        vE = _mm_max_epi32(_mm_sub_epi32(vE, vGapE), _mm_sub_epi32(vH, vGapO));
+        vSaturationCheckMin = _mm_min_epi32(vSaturationCheckMin, vH);
+        vSaturationCheckMax = _mm_max_epi32(vSaturationCheckMax, vH);
+
+#ifdef PARASAIL_TABLE
+        h.m = vH;
+        for (i=0; i<s1Len; ++i) {
+            result->score_table[i*s2Len + j] = h.v[i];
+        }
+#endif
+
+#ifdef PARASAIL_ROWCOL
+        h.m = vH;
+        result->score_row[j] = h.v[s1Len-1];
+#endif
+
+        /* max of the last row */
+        if (_mm_movemask_epi8(_mm_and_si128(vLast, _mm_cmpgt_epi32(vH, vBest)))) {
+            h.m = vH;
+            score = h.v[s1Len-1];
+            vBest = _mm_set1_epi32(score);
+            end_ref = j;
+            end_query = s1Len - 1;
+        }
+    }
+
+    h.m = vH;
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<s1Len; ++i) {
+        result->score_col[i] = h.v[i];
+    }
+#endif
+
+    /* max of the last column */
+    {
+        int32_t score_last = h.v[0];
+        for (i=1; i<s1Len; ++i) {
+            if (h.v[i] > score_last) {
+                score_last = h.v[i];
+            }
+        }
+        if (score_last > score || (score_last == score && end_ref == s2Len - 1)) {
+            score = score_last;
+            end_ref = s2Len - 1;
+            for (end_query=0; h.v[end_query]!=score; ++end_query) {
+            }
+        }
+    }
+
+    /* only the lanes of real rows can saturate */
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = i < s1Len ? -1 : 0;
+    }
+    if (_mm_movemask_epi8(_mm_and_si128(h.m, _mm_or_si128(
+            _mm_cmplt_epi32(vSaturationCheckMin, vNegLimit),
+            _mm_cmpgt_epi32(vSaturationCheckMax, vPosLimit))))) {
+        result->saturated = 1;
+        score = INT32_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->columns = j;
+
+    return result;
+}
+
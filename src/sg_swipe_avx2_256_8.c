@@ -0,0 +1,251 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF INT8_MIN
+
+
+#define FNAME parasail_sg_swipe_avx2_256_8
+
+/* Inter-sequence (SWIPE-style) kernel. Each vector lane holds a
+ * different database sequence; the query is walked in the inner loop
+ * one residue at a time. When a lane reaches the end of its sequence
+ * its result is recorded and the next database sequence is loaded into
+ * that lane so all lanes stay busy until the batch is exhausted. */
+parasail_result_t** FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t k = 0;
+    int32_t l = 0;
+    int32_t next = 0;
+    int32_t active = 0;
+    const int32_t n = matrix->size; /* number of amino acids in table */
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    int32_t * const restrict s1 = parasail_memalign_int32_t(16, s1Len);
+    __m256i* const restrict pvP = parasail_memalign___m256i(32, n);
+    __m256i* const restrict pvH = parasail_memalign___m256i(32, s1Len);
+    __m256i* const restrict pvE = parasail_memalign___m256i(32, s1Len);
+    int32_t lane_seq[32];
+    int32_t lane_pos[32];
+    int lane_score[32];
+    int32_t lane_end_ref[32];
+    const int *lane_row[32];
+    __m256i vGapO = _mm256_set1_epi8(open);
+    __m256i vGapE = _mm256_set1_epi8(gap);
+    __m256i vZero = _mm256_setzero_si256();
+    __m256i vNegInf = _mm256_set1_epi8(NEG_INF);
+    __m256i vH = vZero;
+    const int8_t NEG_LIMIT = (-open < matrix->min ?
+        INT8_MIN + open : INT8_MIN - matrix->min) + 1;
+    const int8_t POS_LIMIT = INT8_MAX - matrix->max - 1;
+    __m256i vNegLimit = _mm256_set1_epi8(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi8(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+    parasail_result_t **results = NULL;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s2Count);
+    assert(NULL != results || 0 == s2Count);
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+
+    for (l=0; l<segWidth; ++l) {
+        lane_seq[l] = -1;
+        lane_pos[l] = 0;
+        lane_score[l] = INT32_MIN;
+        lane_end_ref[l] = 0;
+        lane_row[l] = matrix->matrix;
+    }
+
+    /* initialize H and E */
+    for (i=0; i<s1Len; ++i) {
+        _mm256_store_si256(pvH+i, vZero);
+        _mm256_store_si256(pvE+i, vNegInf);
+    }
+
+    while (1) {
+        /* load new database sequences into idle lanes */
+        {
+            __m256i_8_t mask;
+            int refill = 0;
+            mask.m = vZero;
+            for (l=0; l<segWidth; ++l) {
+                if (lane_seq[l] >= 0) {
+                    continue;
+                }
+                /* empty sequences never occupy a lane; an empty
+                 * alignment scores 0 */
+                while (next < s2Count && s2Lens[next] <= 0) {
+                    results[next++] = parasail_result_new();
+                }
+                if (next >= s2Count) {
+                    break;
+                }
+                lane_seq[l] = next++;
+                lane_pos[l] = 0;
+                lane_score[l] = INT32_MIN;
+                lane_end_ref[l] = 0;
+                mask.v[l] = -1;
+                refill = 1;
+                ++active;
+            }
+            if (refill) {
+                for (i=0; i<s1Len; ++i) {
+                    _mm256_store_si256(pvH+i, _mm256_blendv_epi8(_mm256_load_si256(pvH+i),
+                                vZero, mask.m));
+                    _mm256_store_si256(pvE+i, _mm256_blendv_epi8(_mm256_load_si256(pvE+i),
+                                vNegInf, mask.m));
+                }
+                vSaturationCheckMin = _mm256_blendv_epi8(
+                        vSaturationCheckMin, vPosLimit, mask.m);
+                vSaturationCheckMax = _mm256_blendv_epi8(
+                        vSaturationCheckMax, vNegLimit, mask.m);
+            }
+        }
+
+        if (0 == active) {
+            break;
+        }
+
+        /* build the substitution scores for the current column */
+        for (l=0; l<segWidth; ++l) {
+            if (lane_seq[l] >= 0) {
+                const char c = s2s[lane_seq[l]][lane_pos[l]];
+                lane_row[l] = &matrix->matrix[n*matrix->mapper[(unsigned char)c]];
+            }
+        }
+        for (k=0; k<n; ++k) {
+            __m256i_8_t t;
+            for (l=0; l<segWidth; ++l) {
+                t.v[l] = (int8_t)lane_row[l][k];
+            }
+            _mm256_store_si256(pvP+k, t.m);
+        }
+
+        /* inner loop to process the query sequence */
+        {
+            __m256i vHDiag = vZero;
+            __m256i vHUp = vZero;
+            __m256i vF = vNegInf;
+            for (i=0; i<s1Len; ++i) {
+                __m256i vHLeft = _mm256_load_si256(pvH+i);
+                __m256i vE = _mm256_load_si256(pvE+i);
+                vE = _mm256_max_epi8(
+                        _mm256_subs_epi8(vHLeft, vGapO),
+                        _mm256_subs_epi8(vE, vGapE));
+                vF = _mm256_max_epi8(
+                        _mm256_subs_epi8(vHUp, vGapO),
+                        _mm256_subs_epi8(vF, vGapE));
+                vH = _mm256_adds_epi8(vHDiag, _mm256_load_si256(pvP+s1[i]));
+                vH = _mm256_max_epi8(vH, vE);
+                vH = _mm256_max_epi8(vH, vF);
+                _mm256_store_si256(pvE+i, vE);
+                _mm256_store_si256(pvH+i, vH);
+                /* check for saturation */
+                vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vH);
+                vHDiag = vHLeft;
+                vHUp = vH;
+            }
+        }
+
+        /* record finished lanes, advance the others */
+        {
+            __m256i_8_t h;
+            __m256i_8_t satmin;
+            __m256i_8_t satmax;
+            satmin.m = vSaturationCheckMin;
+            satmax.m = vSaturationCheckMax;
+            h.m = vH;
+            for (l=0; l<segWidth; ++l) {
+                int32_t index = lane_seq[l];
+                if (index < 0) {
+                    continue;
+                }
+                if (lane_pos[l] == s2Lens[index] - 1) {
+                    parasail_result_t *result = parasail_result_new();
+                    int saturated = 0;
+                    if (satmin.v[l] < NEG_LIMIT || satmax.v[l] > POS_LIMIT) {
+                        saturated = 1;
+                    }
+                    if (saturated) {
+                        result->saturated = 1;
+                        result->score = INT8_MAX;
+                        result->end_query = 0;
+                        result->end_ref = 0;
+                    }
+                    else {
+                        /* last column, excluding the last row */
+                        int score = INT32_MIN;
+                        int32_t end_query = s1Len-1;
+                        int32_t end_ref = lane_pos[l];
+                        for (i=0; i<s1Len-1; ++i) {
+                            __m256i_8_t t;
+                            t.m = _mm256_load_si256(pvH+i);
+                            if (t.v[l] > score) {
+                                score = t.v[l];
+                                end_query = i;
+                            }
+                        }
+                        /* last row wins ties against the last column */
+                        if (lane_score[l] != INT32_MIN
+                                && lane_score[l] >= score) {
+                            score = lane_score[l];
+                            end_query = s1Len-1;
+                            end_ref = lane_end_ref[l];
+                        }
+                        /* bottom right corner */
+                        if (h.v[l] > score) {
+                            score = h.v[l];
+                            end_query = s1Len-1;
+                            end_ref = lane_pos[l];
+                        }
+                        result->score = score;
+                        result->end_query = end_query;
+                        result->end_ref = end_ref;
+                    }
+                    results[index] = result;
+                    lane_seq[l] = -1;
+                    --active;
+                }
+                else {
+                    /* track the last row */
+                    if (h.v[l] > lane_score[l]) {
+                        lane_score[l] = h.v[l];
+                        lane_end_ref[l] = lane_pos[l];
+                    }
+                    ++lane_pos[l];
+                }
+            }
+        }
+    }
+
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(pvP);
+    parasail_free(s1);
+
+    return results;
+}
+
@@ -0,0 +1,273 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+
+static inline int _mm256_movemask_epi32_rpl(__m256i a) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(a));
+}
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI32
+#define _mm256_extract_epi32_rpl _mm256_extract_epi32
+#else
+static inline int32_t _mm256_extract_epi32_rpl(__m256i a, int imm) {
+    __m256i_32_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#define _mm256_cmplt_epi32_rpl(a,b) _mm256_cmpgt_epi32(b,a)
+
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+static inline int32_t _mm256_hmax_epi32_rpl(__m256i a) {
+    a = _mm256_max_epi32(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,0,0)));
+    a = _mm256_max_epi32(a, _mm256_slli_si256(a, 8));
+    a = _mm256_max_epi32(a, _mm256_slli_si256(a, 4));
+    return _mm256_extract_epi32_rpl(a, 7);
+}
+
+
+/* pack the four direction masks of vector i of a column */
+static inline void trace_store(
+        uint64_t *bits,
+        int32_t i,
+        uint32_t m0,
+        uint32_t m1,
+        uint32_t m2,
+        uint32_t m3)
+{
+    const uint64_t v = (uint64_t)m0 | (uint64_t)m1 << 8
+            | (uint64_t)m2 << 16 | (uint64_t)m3 << 24;
+    const int32_t shift = (i % 2) * 32;
+    if (0 == shift) {
+        bits[i/2] = v;
+    }
+    else {
+        bits[i/2] |= v << shift;
+    }
+}
+
+#define FNAME parasail_sg_trace_scan_avx2_256_32
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    parasail_profile_t *profile = parasail_profile_create_avx_256_32(s1, s1Len, matrix);
+    parasail_workspace_t workspace;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m256i* const restrict pvP = (__m256i*)profile->profile32.score;
+    __m256i* restrict pvE = NULL;
+    __m256i* restrict pvHt = NULL;
+    __m256i* restrict pvH = NULL;
+    __m256i* restrict pvGapper = NULL;
+    __m256i vGapO = _mm256_set1_epi32(open);
+    __m256i vGapE = _mm256_set1_epi32(gap);
+    const int32_t NEG_LIMIT = (-open < matrix->min ?
+        INT32_MIN + open : INT32_MIN - matrix->min) + 1;
+    const int32_t POS_LIMIT = INT32_MAX - matrix->max - 1;
+    __m256i vZero = _mm256_setzero_si256();
+    int32_t score = NEG_LIMIT;
+    __m256i vNegLimit = _mm256_set1_epi32(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi32(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+    __m256i vMaxH = vNegLimit;
+    __m256i vPosMask = _mm256_cmpeq_epi32(_mm256_set1_epi32(position),
+            _mm256_set_epi32(0,1,2,3,4,5,6,7));
+    __m256i vNegInfFront = _mm256_set_epi32(0,0,0,0,0,0,0,NEG_LIMIT);
+    __m256i vSegLenXgap = _mm256_add_epi32(vNegInfFront,
+            _mm256_slli_si256_rpl(_mm256_set1_epi32(-segLen*gap), 4));
+    parasail_result_t *result = parasail_result_new_trace(
+            segLen, s2Len, segWidth, PARASAIL_TRACE_SG);
+    uint64_t * const restrict bits = result->trace->bits;
+    const int32_t words = result->trace->words;
+
+    parasail_workspace_init(&workspace);
+    pvE = parasail_workspace___m256i(&workspace, 0, segLen);
+    pvHt = parasail_workspace___m256i(&workspace, 1, segLen);
+    pvH = parasail_workspace___m256i(&workspace, 2, segLen);
+    pvGapper = parasail_workspace___m256i(&workspace, 3, segLen);
+
+    /* initialize H and E */
+    parasail_memset___m256i(pvH, vZero, segLen);
+    parasail_memset___m256i(pvE, vNegLimit, segLen);
+    {
+        __m256i vGapper = _mm256_sub_epi32(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            _mm256_store_si256(pvGapper+i, vGapper);
+            vGapper = _mm256_sub_epi32(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m256i vE;
+        __m256i vHt;
+        __m256i vF;
+        __m256i vH;
+        __m256i vHp;
+        __m256i *pvW;
+        __m256i vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = _mm256_load_si256(pvH+(segLen-1));
+        vHp = _mm256_slli_si256_rpl(vHp, 4);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = _mm256_sub_epi32(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = _mm256_load_si256(pvH+i);
+            vE = _mm256_load_si256(pvE+i);
+            vW = _mm256_load_si256(pvW+i);
+            vE = _mm256_max_epi32(
+                    _mm256_sub_epi32(vE, vGapE),
+                    _mm256_sub_epi32(vH, vGapO));
+            vHp = _mm256_add_epi32(vHp, vW);
+            vF = _mm256_max_epi32(vF, _mm256_add_epi32(vHt, pvGapper[i]));
+            vHt = _mm256_max_epi32(vE, vHp);
+            _mm256_store_si256(pvE+i, vE);
+            _mm256_store_si256(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = _mm256_slli_si256_rpl(vHt, 4);
+        vF = _mm256_max_epi32(vF, _mm256_add_epi32(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            __m256i vFt = _mm256_slli_si256_rpl(vF, 4);
+            vFt = _mm256_add_epi32(vFt, vSegLenXgap);
+            vF = _mm256_max_epi32(vF, vFt);
+        }
+
+        /* calculate final H and record where each cell came from */
+        vF = _mm256_slli_si256_rpl(vF, 4);
+        vF = _mm256_add_epi32(vF, vNegInfFront);
+        vH = _mm256_max_epi32(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            __m256i vHold = _mm256_load_si256(pvH+i);
+            __m256i vFopen = _mm256_sub_epi32(vH, vGapO);
+            __m256i vCaseE;
+            __m256i vCaseF;
+            vHt = _mm256_load_si256(pvHt+i);
+            vE = _mm256_load_si256(pvE+i);
+            vF = _mm256_max_epi32(_mm256_sub_epi32(vF, vGapE), vFopen);
+            vH = _mm256_max_epi32(vHt, vF);
+            _mm256_store_si256(pvH+i, vH);
+            vSaturationCheckMin = _mm256_min_epi32(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm256_max_epi32(vSaturationCheckMax, vH);
+            vCaseE = _mm256_cmpeq_epi32(vH, vE);
+            vCaseF = _mm256_andnot_si256(vCaseE, _mm256_cmpeq_epi32(vH, vF));
+            trace_store(bits + j*words, i,
+                    (uint32_t)_mm256_movemask_epi32_rpl(vCaseE),
+                    (uint32_t)_mm256_movemask_epi32_rpl(vCaseF),
+                    (uint32_t)_mm256_movemask_epi32_rpl(_mm256_cmpgt_epi32(vE, _mm256_sub_epi32(vHold, vGapO))),
+                    (uint32_t)_mm256_movemask_epi32_rpl(_mm256_cmpgt_epi32(vF, vFopen)));
+        }
+
+        /* extract vector containing last value from column */
+        {
+            __m256i vCompare;
+            vH = _mm256_load_si256(pvH + offset);
+            vCompare = _mm256_and_si256(vPosMask, _mm256_cmpgt_epi32(vH, vMaxH));
+            vMaxH = _mm256_max_epi32(vH, vMaxH);
+            if (_mm256_movemask_epi8(vCompare)) {
+                end_ref = j;
+                end_query = s1Len - 1;
+            }
+        }
+    }
+
+    /* max last value from all columns */
+    {
+        int32_t value;
+        for (k=0; k<position; ++k) {
+            vMaxH = _mm256_slli_si256_rpl(vMaxH, 4);
+        }
+        value = (int32_t) _mm256_extract_epi32_rpl(vMaxH, 7);
+        if (value > score) {
+            score = value;
+        }
+    }
+
+    /* max of last column */
+    {
+        int32_t score_last;
+        vMaxH = vNegLimit;
+
+        for (i=0; i<segLen; ++i) {
+            __m256i vH = _mm256_load_si256(pvH + i);
+            vMaxH = _mm256_max_epi32(vH, vMaxH);
+        }
+
+        /* max in vec */
+        score_last = _mm256_hmax_epi32_rpl(vMaxH);
+        if (score_last > score || (score_last == score && end_ref == s2Len - 1)) {
+            score = score_last;
+            end_ref = s2Len - 1;
+            end_query = s1Len;
+            /* Trace the alignment ending position on read. */
+            {
+                int32_t *t = (int32_t*)pvH;
+                int32_t column_len = segLen * segWidth;
+                for (i = 0; i<column_len; ++i, ++t) {
+                    if (*t == score) {
+                        int32_t temp = i / segWidth + i % segWidth * segLen;
+                        if (temp < end_query) {
+                            end_query = temp;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* the scan also overflows when a gap spanning a segment does not
+     * fit in a lane */
+    if ((int64_t)segLen*gap > INT32_MAX
+            || _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmplt_epi32_rpl(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpgt_epi32(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_workspace_clear(&workspace);
+    parasail_profile_free(profile);
+
+    return result;
+}
+
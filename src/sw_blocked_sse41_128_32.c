@@ -10,52 +10,39 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
 #include <emmintrin.h>
 #include <smmintrin.h>
+#endif
 
 #include "parasail.h"
 #include "parasail/memory.h"
 #include "parasail/internal_sse.h"
 
-#define NEG_INF_32 (INT32_MIN/(int32_t)(2))
+#define NEG_INF (INT32_MIN/(int32_t)(2))
 
-#ifdef PARASAIL_TABLE
-static inline void arr_store_si128(
-        int *array,
-        __m128i vH,
-        int32_t i,
-        int32_t segWidth,
-        int32_t j,
-        int32_t s2Len)
-{
-    array[(i*segWidth+0)*s2Len + j] = (int32_t)_mm_extract_epi32(vH, 0);
-    array[(i*segWidth+1)*s2Len + j] = (int32_t)_mm_extract_epi32(vH, 1);
-    array[(i*segWidth+2)*s2Len + j] = (int32_t)_mm_extract_epi32(vH, 2);
-    array[(i*segWidth+3)*s2Len + j] = (int32_t)_mm_extract_epi32(vH, 3);
+static inline int32_t _mm_hmax_epi32_rpl(__m128i a) {
+    a = _mm_max_epi32(a, _mm_srli_si128(a, 8));
+    a = _mm_max_epi32(a, _mm_srli_si128(a, 4));
+    return _mm_extract_epi32(a, 0);
 }
-#endif
 
-#ifdef PARASAIL_ROWCOL
-static inline void arr_store_col(
-        int *col,
-        __m128i vH,
-        int32_t i,
-        int32_t segWidth)
-{
-    col[i*segWidth+0] = (int16_t)_mm_extract_epi16(vH, 0);
-    col[i*segWidth+1] = (int16_t)_mm_extract_epi16(vH, 1);
-    col[i*segWidth+2] = (int16_t)_mm_extract_epi16(vH, 2);
-    col[i*segWidth+3] = (int16_t)_mm_extract_epi16(vH, 3);
-}
-#endif
 
 #ifdef PARASAIL_TABLE
 #define FNAME parasail_sw_table_blocked_sse41_128_32
+#define PNAME parasail_sw_table_blocked_profile_sse41_128_32
+#define WNAME parasail_sw_table_blocked_profile_sse41_128_32_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME parasail_sw_rowcol_blocked_sse41_128_32
+#define PNAME parasail_sw_rowcol_blocked_profile_sse41_128_32
+#define WNAME parasail_sw_rowcol_blocked_profile_sse41_128_32_ws
 #else
 #define FNAME parasail_sw_blocked_sse41_128_32
+#define PNAME parasail_sw_blocked_profile_sse41_128_32
+#define WNAME parasail_sw_blocked_profile_sse41_128_32_ws
 #endif
 #endif
 
@@ -63,159 +50,154 @@ parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_blocked_sse_128_32(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     int32_t i = 0;
     int32_t j = 0;
     int32_t k = 0;
-    int32_t segNum = 0;
-    const int32_t n = 24; /* number of amino acids in table */
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
     const int32_t segWidth = 4; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
-    __m128i* const restrict vProfile = parasail_memalign___m128i(16, n * segLen);
-    __m128i* restrict pvH = parasail_memalign___m128i(16, segLen);
-    __m128i* const restrict pvE = parasail_memalign___m128i(16, segLen);
-    int score = NEG_INF_32;
+    __m128i* const restrict vProfile = (__m128i*)profile->profile32.score;
+    __m128i* const restrict pvH = parasail_workspace___m128i(workspace, 0, segLen);
+    __m128i* const restrict pvE = parasail_workspace___m128i(workspace, 1, segLen);
+    const int32_t * const restrict h = (const int32_t*)pvH;
     __m128i vGapO = _mm_set1_epi32(open);
     __m128i vGapE = _mm_set1_epi32(gap);
     __m128i vZero = _mm_setzero_si128();
-    __m128i vNegInf = _mm_set1_epi32(NEG_INF_32);
-    __m128i vMaxH = vZero;
+    __m128i vFront[2];
+    int32_t score = NEG_INF;
+    int32_t maxp = INT32_MAX - (int32_t)(matrix->max+1);
 #ifdef PARASAIL_TABLE
     parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-    const int32_t offset = segLen - 1;
-    const int32_t position = s1Len % segWidth;
 #else
     parasail_result_t *result = parasail_result_new();
 #endif
 #endif
 
-    /* Generate query profile.
-     * Rearrange query sequence & calculate the weight of match/mismatch.
-     * Don't alias. */
-    {
-        int32_t index = 0;
-        for (k=0; k<n; ++k) {
-            for (i=0; i<segLen; ++i) {
-                __m128i_32_t t;
-                j = i*segWidth;
-                for (segNum=0; segNum<segWidth; ++segNum) {
-                    t.v[segNum] = j >= s1Len ? 0 : matrix->matrix[matrix->size*matrix->mapper[(unsigned char)s1[j]]];
-                    j += 1;
-                }
-                _mm_store_si128(&vProfile[index], t.m);
-                ++index;
-            }
-        }
-    }
-
     /* initialize H and E */
-    {
-        int32_t index = 0;
-        for (i=0; i<segLen; ++i) {
-            __m128i_32_t h;
-            __m128i_32_t e;
-            for (segNum=0; segNum<segWidth; ++segNum) {
-                h.v[segNum] = 0;
-                e.v[segNum] = -open;
-            }
-            _mm_store_si128(&pvH[index], h.m);
-            _mm_store_si128(&pvE[index], e.m);
-            ++index;
+    parasail_memset___m128i(pvH, vZero, segLen);
+    parasail_memset___m128i(pvE, _mm_set1_epi32(-open), segLen);
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * leaves empty have nothing above them in the block */
+    for (k=0; k<2; ++k) {
+        __m128i_32_t front;
+        const int32_t lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            int64_t tmp = -(int64_t)lanes*gap;
+            front.v[i] = (i < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
         }
+        vFront[k] = front.m;
     }
 
     /* outer loop over database sequence */
     for (j=0; j<s2Len; ++j) {
-        __m128i vX = vZero;
-        __m128i vF = vNegInf;
-        const __m128i* pvP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
-        for (i=0; i<segLen; ++i) {
-            __m128i vP;
-            __m128i vH;
-            __m128i vE;
-            __m128i vT1;
-
-            vH = _mm_load_si128(pvH + i);
-            vE = _mm_load_si128(pvE + i);
+        const __m128i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+        __m128i vHp = vZero;
+        __m128i vFin = _mm_set1_epi32(-open);
+        __m128i vMaxH = vZero;
 
-            vT1 = _mm_srli_si128(vH, 12); /* rshift 3 */
-            vH = _mm_slli_si128(vH, 4); /* lshift 1 */
-            vH = _mm_or_si128(vH, vX);
-            vX = vT1;
+        /* each block of query rows sees the row above it through the
+         * last lane of vHp (diagonal) and of vFin (vertical gap) */
+        for (i=0; i<segLen; ++i) {
+            __m128i vHold = _mm_load_si128(pvH + i);
+            __m128i vE = _mm_load_si128(pvE + i);
+            __m128i vH = _mm_alignr_epi8(vHold, vHp, 12);
+            __m128i vF;
+            vHp = vHold;
 
-            vP = _mm_load_si128(pvP + i);
-            vH = _mm_add_epi32(vH, vP);
+            vH = _mm_add_epi32(vH, _mm_load_si128(vP + i));
             vH = _mm_max_epi32(vH, vE);
             vH = _mm_max_epi32(vH, vZero);
 
-            vF = _mm_srli_si128(vF, 12);
-            vF = _mm_or_si128(vF, _mm_slli_si128(vH, 4));
-            vF = _mm_sub_epi32(vF, vGapO);
-            if (_mm_movemask_epi8(_mm_cmpgt_epi32(vF, vZero))) {
-                __m128i vT2 = vF;
-                while (_mm_movemask_epi8(_mm_cmpgt_epi32(vT2, vZero))) {
-                    vT2 = _mm_slli_si128(vT2, 4);
-                    vT2 = _mm_sub_epi32(vT2, vGapE);
-                    vF = _mm_max_epi32(vF, vT2);
-                }
-                vH = _mm_max_epi32(vH, vF);
-                vF = _mm_add_epi32(vF, vGapO);
-                vF = _mm_sub_epi32(vF, vGapE);
-                vF = _mm_max_epi32(vH, vF);
-            }
-            else {
-                vF = vH;
-            }
-
+            /* resolve F down the block with a log-step prefix max */
+            vF = _mm_alignr_epi8(_mm_sub_epi32(vH, vGapO), vFin, 12);
+            vF = _mm_max_epi32(vF, _mm_add_epi32(_mm_slli_si128(vF, 4), vFront[0]));
+            vF = _mm_max_epi32(vF, _mm_add_epi32(_mm_slli_si128(vF, 8), vFront[1]));
+            vH = _mm_max_epi32(vH, vF);
             _mm_store_si128(pvH + i, vH);
-#ifdef PARASAIL_TABLE
-            arr_store_si128(result->score_table, vH, i, segWidth, j, s2Len);
-#endif
             vMaxH = _mm_max_epi32(vMaxH, vH);
 
             vH = _mm_sub_epi32(vH, vGapO);
-            vE = _mm_sub_epi32(vE, vGapE);
-            vE = _mm_max_epi32(vE, vH);
+            vFin = _mm_max_epi32(_mm_sub_epi32(vF, vGapE), vH);
+            vE = _mm_max_epi32(_mm_sub_epi32(vE, vGapE), vH);
             _mm_store_si128(pvE + i, vE);
+        }
 
+#ifdef PARASAIL_TABLE
+        for (i=0; i<segLen*segWidth; ++i) {
+            result->score_table[i*s2Len + j] = h[i];
         }
+#endif
 
 #ifdef PARASAIL_ROWCOL
-        /* extract last value from the column */
+        result->score_row[j] = h[s1Len-1];
+#endif
+
+        /* the rows past s1Len never exceed the best real cell */
         {
-            __m128i vH = _mm_load_si128(pvH + offset);
-            for (k=0; k<position; ++k) {
-                vH = _mm_slli_si128(vH, 2);
+            int32_t column_max = _mm_hmax_epi32_rpl(vMaxH);
+            if (column_max > score) {
+                score = column_max;
+                end_ref = j;
+                /* if score has potential to overflow, abort early */
+                if (score > maxp) {
+                    result->saturated = 1;
+                    break;
+                }
+                for (end_query=0; h[end_query]!=score; ++end_query) {
+                }
             }
-            result->score_row[j] = (int16_t) _mm_extract_epi16 (vH, 7);
         }
-#endif
     }
 
 #ifdef PARASAIL_ROWCOL
-    for (i=0; i<segLen; ++i) {
-        __m128i vH = _mm_load_si128(pvH + i);
-        arr_store_col(result->score_col, vH, i, segWidth);
+    for (i=0; i<segLen*segWidth; ++i) {
+        result->score_col[i] = h[i];
     }
 #endif
 
-    /* max in vec */
-    for (j=0; j<segWidth; ++j) {
-        int32_t value = (int32_t) _mm_extract_epi32(vMaxH, 3);
-        if (value > score) {
-            score = value;
-        }
-        vMaxH = _mm_slli_si128(vMaxH, 4);
+    if (result->saturated) {
+        score = INT32_MAX;
+        end_query = 0;
+        end_ref = 0;
     }
 
     result->score = score;
-
-    parasail_free(pvE);
-    parasail_free(pvH);
-    parasail_free(vProfile);
+    result->end_query = end_query;
+    result->end_ref = end_ref;
 
     return result;
 }
@@ -0,0 +1,193 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#include <smmintrin.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_sse.h"
+
+#define NEG_INF INT16_MIN
+
+
+#define FNAME parasail_sw_packed_sse41_128_16
+#define PNAME parasail_sw_packed_profile_sse41_128_16
+#define SNAME parasail_sw_striped_sse41_128_16
+
+parasail_result_t** FNAME(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int segWidth = 8; /* number of values in vector unit */
+    parasail_result_t **results = NULL;
+    int q = 0;
+    int i = 0;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s1Count);
+    while (q < s1Count) {
+        parasail_profile_t *profile = NULL;
+        parasail_result_t **packed = NULL;
+        /* a query too long to share a vector is aligned on its own */
+        if (s1Lens[q] > segWidth) {
+            results[q] = SNAME(s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+            ++q;
+            continue;
+        }
+        profile = parasail_profile_create_packed_sse_128_16(
+                s1s + q, s1Lens + q, s1Count - q, matrix);
+        packed = PNAME(profile, s2, s2Len, open, gap);
+        for (i=0; i<profile->packed_count; ++i) {
+            results[q++] = packed[i];
+        }
+        free(packed);
+        parasail_profile_free(profile);
+    }
+
+    return results;
+}
+
+/* Several queries sit side by side in one vector, each as in the short
+ * kernel. The diagonal and the F carry are cut at the first lane of
+ * every query and vFront never reaches across one, so no cell sees a
+ * row of its neighbour. */
+parasail_result_t** PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int q = 0;
+    const int count = profile->packed_count;
+    const int * const restrict begin = profile->packed_begin;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const __m128i* const restrict vProfile = (__m128i*)profile->profile16.score;
+    __m128i vGapO = _mm_set1_epi16(open);
+    __m128i vGapE = _mm_set1_epi16(gap);
+    __m128i vZero = _mm_setzero_si128();
+    __m128i vFront[3];
+    __m128i vFirst;
+    __m128i vReal;
+    __m128i vH = vZero;
+    __m128i vE = _mm_set1_epi16(-open);
+    __m128i vBest = _mm_set1_epi16(NEG_INF);
+    __m128i_16_t h;
+    int lane_query[8];
+    int16_t maxp = INT16_MAX - (int16_t)(matrix->max+1);
+    parasail_result_t **results = NULL;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+    for (q=0; q<count; ++q) {
+        results[q] = parasail_result_new();
+        results[q]->score = NEG_INF;
+        for (i=begin[q]; i<begin[q+1]; ++i) {
+            lane_query[i] = q;
+        }
+    }
+    for (i=begin[count]; i<segWidth; ++i) {
+        lane_query[i] = -1;
+    }
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * fills from above the first row of their query get nothing */
+    for (k=0; k<3; ++k) {
+        const int32_t lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            const int first = lane_query[i] < 0 ? begin[count] : begin[lane_query[i]];
+            int64_t tmp = -(int64_t)lanes*gap;
+            h.v[i] = (i - first < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = h.m;
+    }
+
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = (i < begin[count] && i == begin[lane_query[i]]) ? -1 : 0;
+    }
+    vFirst = h.m;
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = i < begin[count] ? -1 : 0;
+    }
+    vReal = h.m;
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m128i vF;
+        __m128i vT;
+
+        /* row -1 of every query is zero */
+        vH = _mm_alignr_epi8(vH, vZero, 14);
+        vH = _mm_andnot_si128(vFirst, vH);
+        vH = _mm_adds_epi16(vH, _mm_load_si128(vProfile + matrix->mapper[(unsigned char)s2[j]]));
+        vH = _mm_max_epi16(vH, vE);
+        vH = _mm_max_epi16(vH, vZero);
+
+        /* resolve F down each query with a log-step prefix max,
+         * clamped at zero as in the short kernel */
+        vF = _mm_alignr_epi8(_mm_subs_epi16(vH, vGapO), vZero, 14);
+        vF = _mm_andnot_si128(vFirst, _mm_max_epi16(vF, vZero));
+        do {
+            vT = _mm_max_epi16(vF, _mm_adds_epi16(_mm_slli_si128(vF, 2), vFront[0]));
+            if (!_mm_movemask_epi8(_mm_cmpgt_epi16(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm_max_epi16(vF, _mm_adds_epi16(_mm_slli_si128(vF, 4), vFront[1]));
+            if (!_mm_movemask_epi8(_mm_cmpgt_epi16(vT, vF))) {
+                break;
+            }
+            vF = vT;
+            vT = _mm_max_epi16(vF, _mm_adds_epi16(_mm_slli_si128(vF, 8), vFront[2]));
+            vF = vT;
+        } while (0);
+        vH = _mm_max_epi16(vH, vF);
+        vE = _mm_max_epi16(_mm_subs_epi16(vE, vGapE), _mm_subs_epi16(vH, vGapO));
+
+        /* a query can only improve where one of its lanes beats the
+         * best that lane has held */
+        if (_mm_movemask_epi8(_mm_and_si128(vReal, _mm_cmpgt_epi16(vH, vBest)))) {
+            vBest = _mm_max_epi16(vBest, vH);
+            h.m = vH;
+            for (i=0; i<begin[count]; ++i) {
+                parasail_result_t *result = results[lane_query[i]];
+                if (h.v[i] > result->score) {
+                    result->score = h.v[i];
+                    result->end_query = i - begin[lane_query[i]];
+                    result->end_ref = j;
+                    /* if score has potential to overflow, flag it */
+                    if (h.v[i] > maxp) {
+                        result->saturated = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    for (q=0; q<count; ++q) {
+        if (results[q]->saturated) {
+            results[q]->score = INT16_MAX;
+            results[q]->end_query = 0;
+            results[q]->end_ref = 0;
+        }
+    }
+
+    return results;
+}
+
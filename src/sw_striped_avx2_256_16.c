@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -66,6 +67,205 @@ static inline void arr_store_si256(
     array[(14*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 14) - bias;
     array[(15*seglen+t)*dlen + d] = (int16_t)_mm256_extract_epi16_rpl(vH, 15) - bias;
 }
+
+/* transpose vector t of four buffered columns into the table so that each
+ * query position receives the four adjacent entries d..d+3 */
+static inline void arr_store_block(
+        int *array,
+        const __m256i *buf,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        int32_t bias)
+{
+    __m128i x[4][4];
+    const __m128i vBias = _mm_set1_epi32(bias);
+    int32_t c = 0;
+    int32_t k = 0;
+    for (c=0; c<4; ++c) {
+        __m256i vH = _mm256_load_si256(buf + c*seglen + t);
+        __m128i h;
+        h = _mm256_castsi256_si128(vH);
+        x[c][0] = _mm_sub_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(h, h), 16), vBias);
+        x[c][1] = _mm_sub_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(h, h), 16), vBias);
+        h = _mm256_extracti128_si256(vH, 1);
+        x[c][2] = _mm_sub_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(h, h), 16), vBias);
+        x[c][3] = _mm_sub_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(h, h), 16), vBias);
+    }
+    for (k=0; k<4; ++k) {
+        __m128i t0 = _mm_unpacklo_epi32(x[0][k], x[1][k]);
+        __m128i t1 = _mm_unpacklo_epi32(x[2][k], x[3][k]);
+        __m128i t2 = _mm_unpackhi_epi32(x[0][k], x[1][k]);
+        __m128i t3 = _mm_unpackhi_epi32(x[2][k], x[3][k]);
+        int *row = array + (4*k*seglen+t)*dlen + d;
+        _mm_storeu_si128((__m128i*)(row), _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + seglen*dlen), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + 2*seglen*dlen), _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128((__m128i*)(row + 3*seglen*dlen), _mm_unpackhi_epi64(t2, t3));
+    }
+}
+
+static inline void arr_store_si256_narrow(
+        void *array,
+        __m256i vH,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        int32_t bias)
+{
+    uint16_t *table = (uint16_t*)array;
+    table[(0*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 0) - bias);
+    table[(1*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 1) - bias);
+    table[(2*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 2) - bias);
+    table[(3*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 3) - bias);
+    table[(4*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 4) - bias);
+    table[(5*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 5) - bias);
+    table[(6*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 6) - bias);
+    table[(7*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 7) - bias);
+    table[(8*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 8) - bias);
+    table[(9*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 9) - bias);
+    table[(10*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 10) - bias);
+    table[(11*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 11) - bias);
+    table[(12*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 12) - bias);
+    table[(13*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 13) - bias);
+    table[(14*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 14) - bias);
+    table[(15*seglen+t)*dlen + d] = (uint16_t)(_mm256_extract_epi16_rpl(vH, 15) - bias);
+}
+
+static inline void arr_store_block_narrow(
+        void *array,
+        const __m256i *buf,
+        int32_t t,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        int32_t bias)
+{
+    uint16_t *table = (uint16_t*)array;
+    __m128i x[4][2];
+    const __m128i vBias = _mm_set1_epi16((int16_t)bias);
+    int32_t c = 0;
+    int32_t k = 0;
+    for (c=0; c<4; ++c) {
+        __m256i vH = _mm256_load_si256(buf + c*seglen + t);
+        x[c][0] = _mm_sub_epi16(_mm256_castsi256_si128(vH), vBias);
+        x[c][1] = _mm_sub_epi16(_mm256_extracti128_si256(vH, 1), vBias);
+    }
+    for (k=0; k<2; ++k) {
+        __m128i a = _mm_unpacklo_epi16(x[0][k], x[1][k]);
+        __m128i b = _mm_unpacklo_epi16(x[2][k], x[3][k]);
+        __m128i e = _mm_unpackhi_epi16(x[0][k], x[1][k]);
+        __m128i f = _mm_unpackhi_epi16(x[2][k], x[3][k]);
+        __m128i r0 = _mm_unpacklo_epi32(a, b);
+        __m128i r1 = _mm_unpackhi_epi32(a, b);
+        __m128i r2 = _mm_unpacklo_epi32(e, f);
+        __m128i r3 = _mm_unpackhi_epi32(e, f);
+        uint16_t *row = table + (8*k*seglen+t)*dlen + d;
+        _mm_storel_epi64((__m128i*)(row), r0);
+        _mm_storel_epi64((__m128i*)(row + seglen*dlen), _mm_srli_si128(r0, 8));
+        _mm_storel_epi64((__m128i*)(row + 2*seglen*dlen), r1);
+        _mm_storel_epi64((__m128i*)(row + 3*seglen*dlen), _mm_srli_si128(r1, 8));
+        _mm_storel_epi64((__m128i*)(row + 4*seglen*dlen), r2);
+        _mm_storel_epi64((__m128i*)(row + 5*seglen*dlen), _mm_srli_si128(r2, 8));
+        _mm_storel_epi64((__m128i*)(row + 6*seglen*dlen), r3);
+        _mm_storel_epi64((__m128i*)(row + 7*seglen*dlen), _mm_srli_si128(r3, 8));
+    }
+}
+
+/* write the rows of column d inside window to a table holding only the
+ * window; the cells are read in place, windows are meant to be small */
+static inline void arr_store_window(
+        int *array,
+        const __m256i *column,
+        int32_t seglen,
+        int32_t d,
+        const parasail_window_t *window,
+        int type,
+        int32_t bias)
+{
+    const int16_t *v = (const int16_t*)column;
+    int32_t cols = window->ref_end - window->ref_begin;
+    int32_t i = 0;
+    if (d < window->ref_begin || d >= window->ref_end) {
+        return;
+    }
+    for (i=window->query_begin; i<window->query_end; ++i) {
+        size_t index = (size_t)(i-window->query_begin)*cols + (d-window->ref_begin);
+        int value = (int)v[(i%seglen)*16 + i/seglen] - bias;
+        if (PARASAIL_TABLE_INT == type) {
+            array[index] = value;
+        }
+        else {
+            ((uint16_t*)array)[index] = (uint16_t)value;
+        }
+    }
+}
+
+/* buffer column d; the table, of PARASAIL_TABLE_* type, is written
+ * once four columns are buffered */
+static inline void arr_store_table(
+        int *array,
+        __m256i *buf,
+        const __m256i *column,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result,
+        int32_t bias)
+{
+    int32_t c = d % 4;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        arr_store_window(array, column, seglen, d, &result->window,
+                result->table_type, bias);
+        return;
+    }
+    for (t=0; t<seglen; ++t) {
+        _mm256_store_si256(buf + c*seglen + t, _mm256_load_si256(column + t));
+    }
+    if (3 == c) {
+        if (PARASAIL_TABLE_INT == result->table_type) {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block(array, buf, t, seglen, d-3, dlen, bias);
+            }
+        }
+        else {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block_narrow(array, buf, t, seglen, d-3, dlen, bias);
+            }
+        }
+    }
+}
+
+/* write the columns still buffered when the loop ended before column d */
+static inline void arr_store_table_end(
+        int *array,
+        const __m256i *buf,
+        int32_t seglen,
+        int32_t d,
+        int32_t dlen,
+        const parasail_result_t *result,
+        int32_t bias)
+{
+    int32_t c = d % 4;
+    int32_t k = 0;
+    int32_t t = 0;
+    if (result->window.query_end) {
+        return;
+    }
+    for (k=0; k<c; ++k) {
+        for (t=0; t<seglen; ++t) {
+            if (PARASAIL_TABLE_INT == result->table_type) {
+                arr_store_si256(array, buf[k*seglen+t], t, seglen, d-c+k, dlen, bias);
+            }
+            else {
+                arr_store_si256_narrow(array, buf[k*seglen+t], t, seglen, d-c+k, dlen, bias);
+            }
+        }
+    }
+}
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -98,13 +298,17 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME parasail_sw_table_striped_avx2_256_16
 #define PNAME parasail_sw_table_striped_profile_avx2_256_16
+#define WNAME parasail_sw_table_striped_profile_avx2_256_16_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME parasail_sw_rowcol_striped_avx2_256_16
 #define PNAME parasail_sw_rowcol_striped_profile_avx2_256_16
+#define WNAME parasail_sw_rowcol_striped_profile_avx2_256_16_ws
 #else
 #define FNAME parasail_sw_striped_avx2_256_16
 #define PNAME parasail_sw_striped_profile_avx2_256_16
+#define WNAME parasail_sw_striped_profile_avx2_256_16_ws
+#define RNAME parasail_sw_striped_profile_avx2_256_16_resume
 #endif
 #endif
 
@@ -123,10 +327,54 @@ parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+#ifdef RNAME
+/* Same as WNAME, but if resume holds a column from a narrower kernel
+ * the alignment continues after it, and if this kernel saturates its
+ * last exact column is left in resume for the next wider kernel. */
+extern parasail_result_t* RNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    return RNAME(profile, s2, s2Len, open, gap, workspace, NULL);
+}
+
+parasail_result_t* RNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume)
+#else
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
     int32_t k = 0;
+    int32_t start = 0;
     int32_t end_query = 0;
     int32_t end_ref = 0;
     const int s1Len = profile->s1Len;
@@ -134,10 +382,10 @@ parasail_result_t* PNAME(
     const int32_t segWidth = 16; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile = (__m256i*)profile->profile16.score;
-    __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHLoad = parasail_memalign___m256i(32, segLen);
-    __m256i* restrict pvHMax = parasail_memalign___m256i(32, segLen);
-    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvHStore = parasail_workspace___m256i(workspace, 0, segLen);
+    __m256i* restrict pvHLoad = parasail_workspace___m256i(workspace, 1, segLen);
+    __m256i* restrict pvHMax = parasail_workspace___m256i(workspace, 2, segLen);
+    __m256i* const restrict pvE = parasail_workspace___m256i(workspace, 3, segLen);
     __m256i vGapO = _mm256_set1_epi16(open);
     __m256i vGapE = _mm256_set1_epi16(gap);
     __m256i vZero = _mm256_set1_epi16(0);
@@ -150,9 +398,19 @@ parasail_result_t* PNAME(
     __m256i insert_mask = _mm256_cmpgt_epi16(
             _mm256_set_epi16(0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1),
             vZero);
-    /*int16_t stop = profile->stop == INT32_MAX ?  INT16_MAX : (int16_t)profile->stop-bias;*/
+    const int stop = profile->stop_mode & PARASAIL_STOP_REACHED ?
+        profile->stop : INT32_MAX;
+    const int * const restrict gain =
+        profile->stop_mode & PARASAIL_STOP_UNREACHABLE ?
+        profile->stop_gain : NULL;
+    int potential = 0;
+    const int xdrop = profile->xdrop;
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table1_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? PARASAIL_TABLE_UINT16 : PARASAIL_TABLE_INT,
+            &profile->window);
+    __m256i* const restrict pvHTable = parasail_memalign___m256i(32, 4*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
@@ -167,8 +425,39 @@ parasail_result_t* PNAME(
     parasail_memset___m256i(pvHStore, vBias, segLen);
     parasail_memset___m256i(pvE, vBias, segLen);
 
+#ifdef RNAME
+    /* continue from the last column a narrower kernel computed exactly */
+    if (resume && resume->column >= 0) {
+        int16_t *h = (int16_t*)pvHStore;
+        int16_t *e = (int16_t*)pvE;
+        for (i=0; i<segLen*segWidth; ++i) {
+            int32_t q = i / segWidth + i % segWidth * segLen;
+            if (q < s1Len) {
+                h[i] = (int16_t)(resume->H[q] + bias);
+                e[i] = (int16_t)(resume->E[q] + bias);
+            }
+        }
+        score = (int16_t)(resume->score + bias);
+        vMaxH = _mm256_set1_epi16(score);
+        vMaxHUnit = vMaxH;
+        end_ref = resume->column;
+        start = resume->column + 1;
+    }
+#endif
+
+    if (gain) {
+        /* most that the rest of s2 could add to any alignment */
+        for (j=start; j<s2Len; ++j) {
+            potential += gain[matrix->mapper[(unsigned char)s2[j]]];
+        }
+        if (profile->stop_bound < profile->stop) {
+            /* nothing reaches stop, give up after the first column */
+            potential = 0;
+        }
+    }
+
     /* outer loop over database sequence */
-    for (j=0; j<s2Len; ++j) {
+    for (j=start; j<s2Len; ++j) {
         __m256i vE;
         __m256i vF;
         __m256i vH;
@@ -210,9 +499,6 @@ parasail_result_t* PNAME(
             vH = _mm256_max_epi16(vH, vF);
             /* Save vH values. */
             _mm256_store_si256(pvHStore + i, vH);
-#ifdef PARASAIL_TABLE
-            arr_store_si256(result->score_table, vH, i, segLen, j, s2Len, bias);
-#endif
             vMaxH = _mm256_max_epi16(vH, vMaxH);
 
             /* Update vE value. */
@@ -238,9 +524,6 @@ parasail_result_t* PNAME(
                 vH = _mm256_load_si256(pvHStore + i);
                 vH = _mm256_max_epi16(vH,vF);
                 _mm256_store_si256(pvHStore + i, vH);
-#ifdef PARASAIL_TABLE
-                arr_store_si256(result->score_table, vH, i, segLen, j, s2Len, bias);
-#endif
                 vMaxH = _mm256_max_epi16(vH, vMaxH);
                 vH = _mm256_subs_epi16(vH, vGapO);
                 vF = _mm256_subs_epi16(vF, vGapE);
@@ -252,6 +535,10 @@ end:
         {
         }
 
+#ifdef PARASAIL_TABLE
+        arr_store_table(result->score_table, pvHTable, pvHStore, segLen, j, s2Len, result, bias);
+#endif
+
 #ifdef PARASAIL_ROWCOL
         /* extract last value from the column */
         {
@@ -270,6 +557,23 @@ end:
                 /* if score has potential to overflow, abort early */
                 if (score > maxp) {
                     result->saturated = 1;
+#ifdef RNAME
+                    /* column j is still exact; hand it to a wider kernel */
+                    if (resume) {
+                        int16_t *h = (int16_t*)pvHStore;
+                        int16_t *e = (int16_t*)pvE;
+                        parasail_resume_reserve(resume, s1Len);
+                        for (i=0; i<segLen*segWidth; ++i) {
+                            int32_t q = i / segWidth + i % segWidth * segLen;
+                            if (q < s1Len) {
+                                resume->H[q] = h[i] - bias;
+                                resume->E[q] = e[i] - bias;
+                            }
+                        }
+                        resume->column = j;
+                        resume->score = score - bias;
+                    }
+#endif
                     break;
                 }
                 vMaxHUnit = _mm256_set1_epi16(score);
@@ -277,9 +581,37 @@ end:
             }
         }
 
-        /*if (score == stop) break;*/
+        /* stop once the score reaches stop or can no longer reach it */
+        if (score - bias >= stop) {
+            /* leave j one past the last column, as after a full pass */
+            ++j;
+            break;
+        }
+        if (gain) {
+            potential -= gain[matrix->mapper[(unsigned char)s2[j]]];
+            if (score - bias + potential < profile->stop) {
+                ++j;
+                break;
+            }
+        }
+
+        /* stop once the whole column fell more than xdrop below score */
+        if (xdrop < INT32_MAX) {
+            __m256i vColMax = _mm256_load_si256(pvHStore);
+            for (i=1; i<segLen; ++i) {
+                vColMax = _mm256_max_epi16(vColMax, _mm256_load_si256(pvHStore + i));
+            }
+            if (score - _mm256_hmax_epi16_rpl(vColMax) > xdrop) {
+                ++j;
+                break;
+            }
+        }
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result, bias);
+#endif
+
 #ifdef PARASAIL_ROWCOL
     for (i=0; i<segLen; ++i) {
         __m256i vH = _mm256_load_si256(pvHStore+i);
@@ -328,11 +660,11 @@ end:
     result->score = score - bias;
     result->end_query = end_query;
     result->end_ref = end_ref;
+    result->columns = j;
 
-    parasail_free(pvE);
-    parasail_free(pvHMax);
-    parasail_free(pvHLoad);
-    parasail_free(pvHStore);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
@@ -0,0 +1,85 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+/* Serial reference implementations of the inter-sequence (swipe) batch
+ * functions. Each database sequence is aligned independently against
+ * the query using the serial reference of the same class. These are
+ * also the fallback when no vector ISA is available at runtime. */
+
+static parasail_result_t** batch(
+        parasail_function_t *function,
+        const int empty_score, const int empty_end_query,
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    int i = 0;
+    parasail_result_t **results = NULL;
+
+    /* validate inputs */
+    assert(s2Count >= 0);
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s2Count);
+    assert(NULL != results || 0 == s2Count);
+    for (i=0; i<s2Count; ++i) {
+        if (s2Lens[i] <= 0) {
+            /* the serial functions take no empty sequence; s1 aligns
+             * to one as a single gap, or not at all */
+            results[i] = parasail_result_new();
+            results[i]->score = empty_score;
+            results[i]->end_query = empty_end_query;
+        }
+        else {
+            results[i] = function(s1, s1Len, s2s[i], s2Lens[i], open, gap, matrix);
+        }
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_nw_swipe(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return batch(parasail_nw, -open - (s1Len-1)*gap, s1Len-1,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sg_swipe(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return batch(parasail_sg, 0, 0,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_swipe(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return batch(parasail_sw, 0, 0,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
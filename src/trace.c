@@ -0,0 +1,509 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define NEG_INF_32 (INT32_MIN/2)
+#define MAX(a,b) ((a)>(b)?(a):(b))
+
+/* Serial reference implementations of the traceback functions. They
+ * keep one query position per vector, so that the vectorized kernels
+ * and this file share a single layout of the direction bits. The codes
+ * and the order in which ties are broken match the kernels exactly. */
+
+static parasail_result_t* align(
+        const int type,
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t *result = parasail_result_new_trace(s1Len, s2Len, 1, type);
+    uint64_t * const restrict bits = result->trace->bits;
+    const int words = result->trace->words;
+    int * const restrict s1 = parasail_memalign_int(16, s1Len);
+    int * const restrict s2 = parasail_memalign_int(16, s2Len);
+    int * const restrict H = parasail_memalign_int(16, s2Len+1);
+    int * const restrict F = parasail_memalign_int(16, s2Len+1);
+    int i = 0;
+    int j = 0;
+    int score = NEG_INF_32;
+    int end_query = s1Len;
+    int end_ref = s2Len;
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* bits are only ever set below */
+    parasail_memset(bits, 0, sizeof(uint64_t)*words*s2Len);
+
+    /* upper left corner */
+    H[0] = 0;
+    F[0] = NEG_INF_32;
+
+    /* first row */
+    for (j=1; j<=s2Len; ++j) {
+        H[j] = PARASAIL_TRACE_NW == type ? -open -(j-1)*gap : 0;
+        F[j] = NEG_INF_32;
+    }
+
+    /* iter over first sequence */
+    for (i=1; i<=s1Len; ++i) {
+        const int * const restrict matrow = &matrix->matrix[matrix->size*s1[i-1]];
+        /* init first column */
+        int NH = H[0];
+        int WH = PARASAIL_TRACE_NW == type ? -open - (i-1)*gap : 0;
+        int E = NEG_INF_32;
+        H[0] = WH;
+        for (j=1; j<=s2Len; ++j) {
+            int H_dag;
+            int E_opn;
+            int E_ext;
+            int F_opn;
+            int F_ext;
+            int code;
+            int NWH = NH;
+            NH = H[j];
+            F_opn = NH - open;
+            F_ext = F[j] - gap;
+            F[j] = MAX(F_opn, F_ext);
+            E_opn = WH - open;
+            E_ext = E    - gap;
+            E    = MAX(E_opn, E_ext);
+            H_dag = NWH + matrow[s2[j-1]];
+            WH = MAX(H_dag, E);
+            WH = MAX(WH, F[j]);
+            if (PARASAIL_TRACE_SW == type) {
+                WH = MAX(WH, 0);
+            }
+            H[j] = WH;
+
+            if (PARASAIL_TRACE_SW == type && 0 == WH) {
+                code = 3;
+            }
+            else if (WH == E) {
+                code = 1;
+            }
+            else if (WH == F[j]) {
+                code = 2;
+            }
+            else {
+                code = 0;
+            }
+            code |= (E_ext > E_opn) << 2;
+            code |= (F_ext > F_opn) << 3;
+            bits[(size_t)(j-1)*words + (i-1)/16] |=
+                (uint64_t)code << (4*((i-1)%16));
+
+            if (PARASAIL_TRACE_SW == type
+                    || (PARASAIL_TRACE_SG == type && i == s1Len)) {
+                if (WH > score) {
+                    score = WH;
+                    end_query = i-1;
+                    end_ref = j-1;
+                }
+                else if (score == WH && j-1 < end_ref) {
+                    end_query = i-1;
+                    end_ref = j-1;
+                }
+            }
+            else if (PARASAIL_TRACE_SG == type && j == s2Len) {
+                if (WH > score) {
+                    score = WH;
+                    end_query = i-1;
+                    end_ref = s2Len-1;
+                }
+            }
+        }
+    }
+
+    if (PARASAIL_TRACE_NW == type) {
+        score = H[s2Len];
+        end_query = s1Len-1;
+        end_ref = s2Len-1;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_free(F);
+    parasail_free(H);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_trace(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return align(PARASAIL_TRACE_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sg_trace(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return align(PARASAIL_TRACE_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sw_trace(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return align(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+/* plane p of the cell of query position q in column j */
+static inline int trace_bit(
+        const parasail_trace_t *trace, const int q, const int j, const int p)
+{
+    const int vector = q % trace->segLen;
+    const int lane = q / trace->segLen;
+    const size_t bit = (size_t)(4*vector+p)*trace->lanes + lane;
+    return (int)(trace->bits[(size_t)j*trace->words + bit/64] >> (bit%64)) & 1;
+}
+
+/* BAM op codes, the index of each op in this string */
+static const char cigar_ops[] = "MIDNSHP=X";
+#define CIGAR_INS 1
+#define CIGAR_DEL 2
+#define CIGAR_EQ 7
+#define CIGAR_X 8
+
+static inline void cigar_push(parasail_cigar_t *cigar, uint32_t op)
+{
+    if (cigar->len > 0 && (cigar->seq[cigar->len-1] & 0xf) == op) {
+        cigar->seq[cigar->len-1] += 1U << 4;
+    }
+    else {
+        cigar->seq[cigar->len++] = 1U << 4 | op;
+    }
+}
+
+static inline void cigar_push_n(parasail_cigar_t *cigar, uint32_t op, int n)
+{
+    for (; n>0; --n) {
+        cigar_push(cigar, op);
+    }
+}
+
+/* walk the packed directions back from the end of the alignment */
+static void cigar_from_bits(
+        parasail_cigar_t *cigar,
+        const parasail_result_t * const restrict result,
+        const char * const restrict seqA,
+        const char * const restrict seqB)
+{
+    const parasail_trace_t *trace = result->trace;
+    int i = result->end_query;
+    int j = result->end_ref;
+    int k = 0;
+    int state = 0; /* 0 is H, 1 is E, 2 is F */
+
+    while (i >= 0 && j >= 0) {
+        if (0 == state) {
+            int code = trace_bit(trace, i, j, 0) | trace_bit(trace, i, j, 1) << 1;
+            if (3 == code) {
+                break;
+            }
+            else if (1 == code) {
+                state = 1;
+            }
+            else if (2 == code) {
+                state = 2;
+            }
+            else {
+                cigar_push(cigar, seqA[i] == seqB[j] ? CIGAR_EQ : CIGAR_X);
+                --i;
+                --j;
+            }
+        }
+        else if (1 == state) {
+            cigar_push(cigar, CIGAR_DEL);
+            state = trace_bit(trace, i, j, 2) ? 1 : 0;
+            --j;
+        }
+        else {
+            cigar_push(cigar, CIGAR_INS);
+            state = trace_bit(trace, i, j, 3) ? 2 : 0;
+            --i;
+        }
+    }
+
+    /* a global alignment pays for what is left, the others begin here */
+    if (PARASAIL_TRACE_NW == trace->type) {
+        cigar_push_n(cigar, CIGAR_INS, i+1);
+        cigar_push_n(cigar, CIGAR_DEL, j+1);
+        i = -1;
+        j = -1;
+    }
+    cigar->beg_query = i+1;
+    cigar->beg_ref = j+1;
+
+    for (k=0; k<cigar->len/2; ++k) {
+        uint32_t tmp = cigar->seq[k];
+        cigar->seq[k] = cigar->seq[cigar->len-1-k];
+        cigar->seq[cigar->len-1-k] = tmp;
+    }
+}
+
+/* the *_linear functions kept the ops of the alignment itself */
+static void cigar_from_ops(
+        parasail_cigar_t *cigar,
+        const parasail_result_t * const restrict result,
+        const char * const restrict seqA,
+        const char * const restrict seqB)
+{
+    const char *ops = result->trace->ops;
+    int i = result->end_query + 1;
+    int j = result->end_ref + 1;
+    int k = 0;
+
+    for (k=0; k<result->length; ++k) {
+        i -= 'D' != ops[k];
+        j -= 'I' != ops[k];
+    }
+    cigar->beg_query = i;
+    cigar->beg_ref = j;
+
+    for (k=0; k<result->length; ++k) {
+        if ('M' == ops[k]) {
+            cigar_push(cigar, seqA[i++] == seqB[j++] ? CIGAR_EQ : CIGAR_X);
+        }
+        else if ('I' == ops[k]) {
+            cigar_push(cigar, CIGAR_INS);
+            ++i;
+        }
+        else {
+            cigar_push(cigar, CIGAR_DEL);
+            ++j;
+        }
+    }
+}
+
+parasail_cigar_t* parasail_result_get_cigar(
+        const parasail_result_t * const restrict result,
+        const char * const restrict seqA, const int lena,
+        const char * const restrict seqB, const int lenb)
+{
+    const parasail_trace_t *trace = NULL;
+    parasail_cigar_t *cigar = NULL;
+
+    /* validate inputs */
+    assert(NULL != result);
+    assert(NULL != seqA);
+    assert(NULL != seqB);
+
+    trace = result->trace;
+    if (NULL == trace || result->saturated) {
+        return NULL;
+    }
+    assert(NULL != trace->ops || lena <= trace->segLen*trace->lanes);
+
+    cigar = (parasail_cigar_t*)malloc(sizeof(parasail_cigar_t));
+    assert(cigar);
+    cigar->seq = (uint32_t*)malloc(sizeof(uint32_t)*(lena+lenb+1));
+    assert(cigar->seq);
+    cigar->len = 0;
+    cigar->end_query = result->end_query;
+    cigar->end_ref = result->end_ref;
+
+    if (NULL != trace->ops) {
+        cigar_from_ops(cigar, result, seqA, seqB);
+    }
+    else {
+        cigar_from_bits(cigar, result, seqA, seqB);
+    }
+
+    return cigar;
+}
+
+void parasail_cigar_free(parasail_cigar_t *cigar)
+{
+    /* validate inputs */
+    assert(NULL != cigar);
+
+    free(cigar->seq);
+    free(cigar);
+}
+
+char parasail_cigar_decode_op(uint32_t cigar_int)
+{
+    return (cigar_int & 0xf) > 8 ? 'M' : cigar_ops[cigar_int & 0xf];
+}
+
+uint32_t parasail_cigar_decode_len(uint32_t cigar_int)
+{
+    return cigar_int >> 4;
+}
+
+char* parasail_cigar_decode(const parasail_cigar_t *cigar)
+{
+    char *s = NULL;
+    size_t len = 0;
+    int i = 0;
+
+    /* validate inputs */
+    assert(NULL != cigar);
+
+    /* at most 10 digits and an op each */
+    s = (char*)malloc(11*cigar->len + 1);
+    assert(s);
+    for (i=0; i<cigar->len; ++i) {
+        len += sprintf(s+len, "%u%c",
+                parasail_cigar_decode_len(cigar->seq[i]),
+                parasail_cigar_decode_op(cigar->seq[i]));
+    }
+    s[len] = '\0';
+
+    return s;
+}
+
+static inline char compare(
+        const parasail_matrix_t *matrix, const char a, const char b,
+        char match, char pos, char neg)
+{
+    if (a == b) {
+        return match;
+    }
+    else if (matrix->matrix[
+            matrix->size*matrix->mapper[(unsigned char)a]
+            + matrix->mapper[(unsigned char)b]] > 0) {
+        return pos;
+    }
+    return neg;
+}
+
+parasail_traceback_t* parasail_result_get_traceback(
+        const parasail_result_t * const restrict result,
+        const char * const restrict seqA, const int lena,
+        const char * const restrict seqB, const int lenb,
+        const parasail_matrix_t *matrix,
+        char match, char pos, char neg)
+{
+    parasail_traceback_t *traceback = NULL;
+    parasail_cigar_t *cigar = NULL;
+    char *q = NULL;
+    char *c = NULL;
+    char *r = NULL;
+    int len = 0;
+    int i = 0;
+    int j = 0;
+    int k = 0;
+    int sg = 0;
+
+    /* validate inputs */
+    assert(NULL != result);
+    assert(NULL != seqA);
+    assert(NULL != seqB);
+    assert(NULL != matrix);
+
+    cigar = parasail_result_get_cigar(result, seqA, lena, seqB, lenb);
+    if (NULL == cigar) {
+        return NULL;
+    }
+    sg = PARASAIL_TRACE_SG == result->trace->type;
+
+    q = (char*)malloc(lena+lenb+1);
+    c = (char*)malloc(lena+lenb+1);
+    r = (char*)malloc(lena+lenb+1);
+    assert(q && c && r);
+
+    /* a semi-global alignment also shows the free overhangs */
+    i = sg ? 0 : cigar->beg_query;
+    j = sg ? 0 : cigar->beg_ref;
+    for (; j<cigar->beg_ref; ++j, ++len) {
+        q[len] = '-';
+        c[len] = ' ';
+        r[len] = seqB[j];
+    }
+    for (; i<cigar->beg_query; ++i, ++len) {
+        q[len] = seqA[i];
+        c[len] = ' ';
+        r[len] = '-';
+    }
+
+    for (k=0; k<cigar->len; ++k) {
+        char op = parasail_cigar_decode_op(cigar->seq[k]);
+        uint32_t n = parasail_cigar_decode_len(cigar->seq[k]);
+        for (; n>0; --n, ++len) {
+            if ('I' == op) {
+                q[len] = seqA[i++];
+                c[len] = ' ';
+                r[len] = '-';
+            }
+            else if ('D' == op) {
+                q[len] = '-';
+                c[len] = ' ';
+                r[len] = seqB[j++];
+            }
+            else {
+                q[len] = seqA[i];
+                r[len] = seqB[j];
+                c[len] = compare(matrix, seqA[i++], seqB[j++], match, pos, neg);
+            }
+        }
+    }
+
+    if (sg) {
+        for (; j<lenb; ++j, ++len) {
+            q[len] = '-';
+            c[len] = ' ';
+            r[len] = seqB[j];
+        }
+        for (; i<lena; ++i, ++len) {
+            q[len] = seqA[i];
+            c[len] = ' ';
+            r[len] = '-';
+        }
+    }
+
+    q[len] = '\0';
+    c[len] = '\0';
+    r[len] = '\0';
+
+    parasail_cigar_free(cigar);
+
+    traceback = (parasail_traceback_t*)malloc(sizeof(parasail_traceback_t));
+    assert(traceback);
+    traceback->query = q;
+    traceback->comp = c;
+    traceback->ref = r;
+
+    return traceback;
+}
+
+void parasail_traceback_free(parasail_traceback_t *traceback)
+{
+    /* validate inputs */
+    assert(NULL != traceback);
+
+    free(traceback->query);
+    free(traceback->comp);
+    free(traceback->ref);
+    free(traceback);
+}
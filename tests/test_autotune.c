@@ -0,0 +1,278 @@
+#include "config.h"
+
+/* strdup needs _POSIX_C_SOURCE 200809L */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "kseq.h"
+KSEQ_INIT(int, read)
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+typedef struct gap_score {
+    int open;
+    int extend;
+} gap_score_t;
+
+gap_score_t gap_scores[] = {
+    {10,1},
+    {14,2},
+    {INT_MIN,INT_MIN}
+};
+
+typedef struct auto_info {
+    parasail_function_t *pointer;
+    parasail_function_t *reference;
+    const char *alg;
+    const char *name;
+} auto_info_t;
+
+static auto_info_t functions[] = {
+    {parasail_nw_auto, parasail_nw, "nw", "parasail_nw_auto"},
+    {parasail_sg_auto, parasail_sg, "sg", "parasail_sg_auto"},
+    {parasail_sw_auto, parasail_sw, "sw", "parasail_sw_auto"},
+    {NULL, NULL, NULL, NULL}
+};
+
+static void parse_sequences(
+        const char *filename,
+        char ***strings_,
+        int **sizes_,
+        int *count_)
+{
+    FILE* fp;
+    kseq_t *seq = NULL;
+    int l = 0;
+    char **strings = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int memory = 1000;
+
+    fp = fopen(filename, "r");
+    if(fp == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+    strings = malloc(sizeof(char*) * memory);
+    sizes = malloc(sizeof(int) * memory);
+    seq = kseq_init(fileno(fp));
+    while ((l = kseq_read(seq)) >= 0) {
+        strings[count] = strdup(seq->seq.s);
+        if (NULL == strings[count]) {
+            perror("strdup");
+            exit(1);
+        }
+        sizes[count] = seq->seq.l;
+        ++count;
+        if (count >= memory) {
+            memory *= 2;
+            strings = realloc(strings, sizeof(char*) * memory);
+            sizes = realloc(sizes, sizeof(int) * memory);
+            if (NULL == strings || NULL == sizes) {
+                perror("realloc");
+                exit(1);
+            }
+        }
+    }
+    kseq_destroy(seq);
+    fclose(fp);
+
+    *strings_ = strings;
+    *sizes_ = sizes;
+    *count_ = count;
+}
+
+/* lines of the cache file naming one of the auto functions' choices */
+static int count_lines(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char line[1024];
+    int lines = 0;
+
+    if (NULL == fp) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), fp)) {
+        if ('#' != line[0] && strstr(line, "\tparasail_")) {
+            ++lines;
+        }
+    }
+    fclose(fp);
+    return lines;
+}
+
+/* compare f with its reference on every pair, returning the errors;
+ * results are never saturated at the widths the table picks from */
+static unsigned long compare(
+        const auto_info_t *f,
+        char **sequences, const int *sizes, const int count,
+        const int open, const int extend,
+        const parasail_matrix_t *matrix)
+{
+    unsigned long errors = 0;
+    int pair = 0;
+
+#pragma omp parallel for schedule(dynamic)
+    for (pair=0; pair<count*count; ++pair) {
+        const int query = pair / count;
+        const int i = pair % count;
+        parasail_result_t *reference = f->reference(
+                sequences[query], sizes[query],
+                sequences[i], sizes[i],
+                open, extend, matrix);
+        parasail_result_t *result = f->pointer(
+                sequences[query], sizes[query],
+                sequences[i], sizes[i],
+                open, extend, matrix);
+        if (result->saturated || reference->score != result->score) {
+#pragma omp critical(printer)
+            printf("%s(%d,%d,%d,%d) wrong score (%d != %d%s)\n",
+                    f->name, query, i, open, extend,
+                    reference->score, result->score,
+                    result->saturated ? ", saturated" : "");
+#pragma omp atomic
+            errors += 1;
+        }
+        parasail_result_free(result);
+        parasail_result_free(reference);
+    }
+
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    char **sequences = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int query = 0;
+    int function_index = 0;
+    int gap_index = 0;
+    int length = 0;
+    int lines = 0;
+    unsigned long errors = 0;
+    const char *path = "test_autotune.cache";
+    const parasail_matrix_t *matrix = &parasail_blosum62;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s sequences.fasta\n", argv[0]);
+        return 1;
+    }
+
+    parse_sequences(argv[1], &sequences, &sizes, &count);
+    printf("%d sequences read\n", count);
+
+    /* a cache of this test's own, empty to begin with */
+    remove(path);
+    setenv("PARASAIL_AUTOTUNE_CACHE", path, 1);
+
+    if (NULL != parasail_autotune_choice("sw", 1)) {
+        printf("choice before tuning\n");
+        ++errors;
+    }
+
+    /* without a cached table the auto functions never tune; they run
+     * the striped _sat dispatchers */
+    errors += compare(&functions[2], sequences, sizes, count, 10, 1, matrix);
+    if (NULL == parasail_autotune_choice("sw", 1)
+            || 0 != strcmp("parasail_sw_striped_sat",
+                parasail_autotune_choice("sw", 1))) {
+        printf("untuned choice %s\n", parasail_autotune_choice("sw", 1));
+        ++errors;
+    }
+    if (0 <= count_lines(path)) {
+        printf("%s written without tuning\n", path);
+        ++errors;
+    }
+
+    /* tuning while other threads align replaces the table under them */
+#pragma omp parallel sections
+    {
+#pragma omp section
+        {
+            if (0 != parasail_autotune(NULL, 10, 1, matrix)) {
+#pragma omp critical(printer)
+                printf("could not write %s\n", path);
+#pragma omp atomic
+                errors += 1;
+            }
+        }
+#pragma omp section
+        {
+            unsigned long section_errors = compare(&functions[0],
+                    sequences, sizes, count, 10, 1, matrix);
+#pragma omp atomic
+            errors += section_errors;
+        }
+    }
+
+    /* 3 algs, 8 ranges of query lengths */
+    lines = count_lines(path);
+    if (24 != lines) {
+        printf("%s has %d lines, not 24\n", path, lines);
+        ++errors;
+    }
+    /* tuning again replaces the lines for this machine and penalties,
+     * other penalties get lines of their own */
+    if (0 != parasail_autotune(NULL, 10, 1, matrix)
+            || 24 != (lines = count_lines(path))) {
+        printf("%s has %d lines after tuning again\n", path, lines);
+        ++errors;
+    }
+    if (0 != parasail_autotune(NULL, 14, 2, matrix)
+            || 48 != (lines = count_lines(path))) {
+        printf("%s has %d lines after tuning other penalties\n", path, lines);
+        ++errors;
+    }
+    remove(path);
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const auto_info_t *f = &functions[function_index];
+        if (f->pointer != parasail_lookup_function(f->name)) {
+            printf("%s not found by name\n", f->name);
+            ++errors;
+        }
+        for (length=1; length<=4096; length*=2) {
+            const char *choice = parasail_autotune_choice(f->alg, length);
+            if (NULL == choice || NULL == parasail_lookup_function(choice)) {
+                printf("%s no function for length %d\n", f->name, length);
+                ++errors;
+            }
+            else if (1 == length || 4096 == length) {
+                printf("%s length %d: %s\n", f->name, length, choice);
+            }
+        }
+    }
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const auto_info_t *f = &functions[function_index];
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            errors += compare(f, sequences, sizes, count,
+                    gap_scores[gap_index].open,
+                    gap_scores[gap_index].extend, matrix);
+        }
+    }
+
+    printf("%lu errors\n", errors);
+
+    for (query=0; query<count; ++query) {
+        free(sequences[query]);
+    }
+    free(sequences);
+    free(sizes);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,375 @@
+#include "config.h"
+
+/* strdup needs _POSIX_C_SOURCE 200809L */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "kseq.h"
+KSEQ_INIT(int, read)
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/matrices/blosum62.h"
+
+typedef struct gap_score {
+    int open;
+    int extend;
+} gap_score_t;
+
+gap_score_t gap_scores[] = {
+    {10,1},
+    {14,2},
+    {40,2},
+    {INT_MIN,INT_MIN}
+};
+
+static int bands[] = {0, 1, 5, 16, 64, -1};
+
+/* band centers for the sg and sw functions, relative to the main diagonal */
+static int diags[] = {0, 3, -7, 40, INT_MIN};
+
+typedef struct banded_info {
+    parasail_kfunction_t *pointer;
+    parasail_kfunction_t *reference;
+    const char *name;
+    const char *isa;
+    int is_table;
+    int is_rowcol;
+} banded_info_t;
+
+static banded_info_t functions[] = {
+#if HAVE_SSE41
+    {parasail_nw_banded_sse41_128_32,        parasail_nw_banded,        "parasail_nw_banded_sse41_128_32",        "sse41", 0, 0},
+    {parasail_nw_banded_sse41_128_16,        parasail_nw_banded,        "parasail_nw_banded_sse41_128_16",        "sse41", 0, 0},
+    {parasail_nw_banded_sse41_128_8,         parasail_nw_banded,        "parasail_nw_banded_sse41_128_8",         "sse41", 0, 0},
+    {parasail_nw_banded_sse41_128_sat,       parasail_nw_banded,        "parasail_nw_banded_sse41_128_sat",       "sse41", 0, 0},
+    {parasail_nw_table_banded_sse41_128_16,  parasail_nw_banded_table,  "parasail_nw_table_banded_sse41_128_16",  "sse41", 1, 0},
+    {parasail_nw_rowcol_banded_sse41_128_16, parasail_nw_banded_rowcol, "parasail_nw_rowcol_banded_sse41_128_16", "sse41", 0, 1},
+#endif
+#if HAVE_AVX2
+    {parasail_nw_banded_avx2_256_32,         parasail_nw_banded,        "parasail_nw_banded_avx2_256_32",         "avx2", 0, 0},
+    {parasail_nw_banded_avx2_256_16,         parasail_nw_banded,        "parasail_nw_banded_avx2_256_16",         "avx2", 0, 0},
+    {parasail_nw_banded_avx2_256_8,          parasail_nw_banded,        "parasail_nw_banded_avx2_256_8",          "avx2", 0, 0},
+    {parasail_nw_banded_avx2_256_sat,        parasail_nw_banded,        "parasail_nw_banded_avx2_256_sat",        "avx2", 0, 0},
+    {parasail_nw_table_banded_avx2_256_16,   parasail_nw_banded_table,  "parasail_nw_table_banded_avx2_256_16",   "avx2", 1, 0},
+    {parasail_nw_rowcol_banded_avx2_256_16,  parasail_nw_banded_rowcol, "parasail_nw_rowcol_banded_avx2_256_16",  "avx2", 0, 1},
+#endif
+    {parasail_nw_banded_sat,                 parasail_nw_banded,        "parasail_nw_banded_sat",                 "disp", 0, 0},
+    {parasail_nw_table_banded_sat,           parasail_nw_banded_table,  "parasail_nw_table_banded_sat",           "disp", 1, 0},
+    {parasail_nw_rowcol_banded_sat,          parasail_nw_banded_rowcol, "parasail_nw_rowcol_banded_sat",          "disp", 0, 1},
+    {NULL, NULL, NULL, NULL, 0, 0}
+};
+
+typedef struct diag_banded_info {
+    parasail_dfunction_t *pointer;
+    parasail_dfunction_t *reference;
+    const char *name;
+    const char *isa;
+    int is_table;
+    int is_rowcol;
+} diag_banded_info_t;
+
+static diag_banded_info_t dfunctions[] = {
+#if HAVE_SSE41
+    {parasail_sg_banded_sse41_128_32,         parasail_sg_banded,         "parasail_sg_banded_sse41_128_32",         "sse41", 0, 0},
+    {parasail_sg_banded_sse41_128_16,         parasail_sg_banded,         "parasail_sg_banded_sse41_128_16",         "sse41", 0, 0},
+    {parasail_sg_banded_sse41_128_8,          parasail_sg_banded,         "parasail_sg_banded_sse41_128_8",          "sse41", 0, 0},
+    {parasail_sg_banded_sse41_128_sat,        parasail_sg_banded,         "parasail_sg_banded_sse41_128_sat",        "sse41", 0, 0},
+    {parasail_sg_table_banded_sse41_128_16,   parasail_sg_banded_table,   "parasail_sg_table_banded_sse41_128_16",   "sse41", 1, 0},
+    {parasail_sg_rowcol_banded_sse41_128_16,  parasail_sg_banded_rowcol,  "parasail_sg_rowcol_banded_sse41_128_16",  "sse41", 0, 1},
+    {parasail_sw_banded_sse41_128_32,         parasail_sw_banded,         "parasail_sw_banded_sse41_128_32",         "sse41", 0, 0},
+    {parasail_sw_banded_sse41_128_16,         parasail_sw_banded,         "parasail_sw_banded_sse41_128_16",         "sse41", 0, 0},
+    {parasail_sw_banded_sse41_128_8,          parasail_sw_banded,         "parasail_sw_banded_sse41_128_8",          "sse41", 0, 0},
+    {parasail_sw_banded_sse41_128_sat,        parasail_sw_banded,         "parasail_sw_banded_sse41_128_sat",        "sse41", 0, 0},
+    {parasail_sw_table_banded_sse41_128_16,   parasail_sw_banded_table,   "parasail_sw_table_banded_sse41_128_16",   "sse41", 1, 0},
+    {parasail_sw_rowcol_banded_sse41_128_16,  parasail_sw_banded_rowcol,  "parasail_sw_rowcol_banded_sse41_128_16",  "sse41", 0, 1},
+#endif
+#if HAVE_AVX2
+    {parasail_sg_banded_avx2_256_32,          parasail_sg_banded,         "parasail_sg_banded_avx2_256_32",          "avx2",  0, 0},
+    {parasail_sg_banded_avx2_256_16,          parasail_sg_banded,         "parasail_sg_banded_avx2_256_16",          "avx2",  0, 0},
+    {parasail_sg_banded_avx2_256_8,           parasail_sg_banded,         "parasail_sg_banded_avx2_256_8",           "avx2",  0, 0},
+    {parasail_sg_banded_avx2_256_sat,         parasail_sg_banded,         "parasail_sg_banded_avx2_256_sat",         "avx2",  0, 0},
+    {parasail_sg_table_banded_avx2_256_16,    parasail_sg_banded_table,   "parasail_sg_table_banded_avx2_256_16",    "avx2",  1, 0},
+    {parasail_sg_rowcol_banded_avx2_256_16,   parasail_sg_banded_rowcol,  "parasail_sg_rowcol_banded_avx2_256_16",   "avx2",  0, 1},
+    {parasail_sw_banded_avx2_256_32,          parasail_sw_banded,         "parasail_sw_banded_avx2_256_32",          "avx2",  0, 0},
+    {parasail_sw_banded_avx2_256_16,          parasail_sw_banded,         "parasail_sw_banded_avx2_256_16",          "avx2",  0, 0},
+    {parasail_sw_banded_avx2_256_8,           parasail_sw_banded,         "parasail_sw_banded_avx2_256_8",           "avx2",  0, 0},
+    {parasail_sw_banded_avx2_256_sat,         parasail_sw_banded,         "parasail_sw_banded_avx2_256_sat",         "avx2",  0, 0},
+    {parasail_sw_table_banded_avx2_256_16,    parasail_sw_banded_table,   "parasail_sw_table_banded_avx2_256_16",    "avx2",  1, 0},
+    {parasail_sw_rowcol_banded_avx2_256_16,   parasail_sw_banded_rowcol,  "parasail_sw_rowcol_banded_avx2_256_16",   "avx2",  0, 1},
+#endif
+    {parasail_sg_banded_sat,                  parasail_sg_banded,         "parasail_sg_banded_sat",                  "disp",  0, 0},
+    {parasail_sg_table_banded_sat,            parasail_sg_banded_table,   "parasail_sg_table_banded_sat",            "disp",  1, 0},
+    {parasail_sg_rowcol_banded_sat,           parasail_sg_banded_rowcol,  "parasail_sg_rowcol_banded_sat",           "disp",  0, 1},
+    {parasail_sw_banded_sat,                  parasail_sw_banded,         "parasail_sw_banded_sat",                  "disp",  0, 0},
+    {parasail_sw_table_banded_sat,            parasail_sw_banded_table,   "parasail_sw_table_banded_sat",            "disp",  1, 0},
+    {parasail_sw_rowcol_banded_sat,           parasail_sw_banded_rowcol,  "parasail_sw_rowcol_banded_sat",           "disp",  0, 1},
+    {NULL, NULL, NULL, NULL, 0, 0}
+};
+
+static void parse_sequences(
+        const char *filename,
+        char ***strings_,
+        int **sizes_,
+        int *count_)
+{
+    FILE* fp;
+    kseq_t *seq = NULL;
+    int l = 0;
+    char **strings = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int memory = 1000;
+
+    fp = fopen(filename, "r");
+    if(fp == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+    strings = malloc(sizeof(char*) * memory);
+    sizes = malloc(sizeof(int) * memory);
+    seq = kseq_init(fileno(fp));
+    while ((l = kseq_read(seq)) >= 0) {
+        strings[count] = strdup(seq->seq.s);
+        if (NULL == strings[count]) {
+            perror("strdup");
+            exit(1);
+        }
+        sizes[count] = seq->seq.l;
+        ++count;
+        if (count >= memory) {
+            memory *= 2;
+            strings = realloc(strings, sizeof(char*) * memory);
+            sizes = realloc(sizes, sizeof(int) * memory);
+            if (NULL == strings || NULL == sizes) {
+                perror("realloc");
+                exit(1);
+            }
+        }
+    }
+    kseq_destroy(seq);
+    fclose(fp);
+
+    *strings_ = strings;
+    *sizes_ = sizes;
+    *count_ = count;
+}
+
+static int isa_supported(const char *isa)
+{
+    if (0 == strcmp(isa, "sse41")) {
+        return parasail_can_use_sse41();
+    }
+    if (0 == strcmp(isa, "avx2")) {
+        return parasail_can_use_avx2();
+    }
+    return 1;
+}
+
+static int same_ints(const int *a, const int *b, size_t size)
+{
+    return 0 == memcmp(a, b, sizeof(int)*size);
+}
+
+/* returns 1 if result disagrees with reference, ignoring saturation */
+static int compare(
+        const parasail_result_t *reference,
+        const parasail_result_t *result,
+        int is_table, int is_rowcol, int s1Len, int s2Len,
+        unsigned long *saturated)
+{
+    int wrong = 0;
+    if (result->saturated) {
+        /* no point in comparing a result that saturated */
+        ++*saturated;
+        return 0;
+    }
+    wrong = reference->score != result->score
+        || reference->end_query != result->end_query
+        || reference->end_ref != result->end_ref;
+    if (is_table) {
+        wrong = wrong || !same_ints(
+                reference->score_table,
+                result->score_table,
+                (size_t)s1Len*s2Len);
+    }
+    if (is_rowcol) {
+        wrong = wrong
+            || !same_ints(reference->score_row, result->score_row, s2Len)
+            || !same_ints(reference->score_col, result->score_col, s1Len);
+    }
+    return wrong;
+}
+
+int main(int argc, char **argv)
+{
+    char **sequences = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int i = 0;
+    int function_index = 0;
+    int gap_index = 0;
+    int band_index = 0;
+    int diag_index = 0;
+    unsigned long errors = 0;
+    unsigned long saturated = 0;
+    const parasail_matrix_t *matrix = &parasail_blosum62;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s sequences.fasta\n", argv[0]);
+        return 1;
+    }
+
+    parse_sequences(argv[1], &sequences, &sizes, &count);
+    printf("%d sequences read\n", count);
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const banded_info_t *f = &functions[function_index];
+        if (!isa_supported(f->isa)) {
+            continue;
+        }
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            int open = gap_scores[gap_index].open;
+            int extend = gap_scores[gap_index].extend;
+            for (band_index=0; bands[band_index]>=0; ++band_index) {
+                int k = bands[band_index];
+                int a = 0;
+                int b = 0;
+                for (a=0; a<count; ++a) {
+                    for (b=a; b<count; ++b) {
+                        parasail_result_t *reference = f->reference(
+                                sequences[a], sizes[a],
+                                sequences[b], sizes[b],
+                                open, extend, k, matrix);
+                        parasail_result_t *result = f->pointer(
+                                sequences[a], sizes[a],
+                                sequences[b], sizes[b],
+                                open, extend, k, matrix);
+                        if (compare(reference, result,
+                                    f->is_table, f->is_rowcol,
+                                    sizes[a], sizes[b], &saturated)) {
+                            printf("%s(%d,%d,%d,%d,%d) wrong result "
+                                    "(%d,%d,%d != %d,%d,%d)\n",
+                                    f->name, a, b, open, extend, k,
+                                    reference->score,
+                                    reference->end_query,
+                                    reference->end_ref,
+                                    result->score,
+                                    result->end_query,
+                                    result->end_ref);
+                            ++errors;
+                        }
+                        parasail_result_free(result);
+                        parasail_result_free(reference);
+                    }
+                }
+            }
+        }
+    }
+
+    for (function_index=0;
+            NULL!=dfunctions[function_index].pointer;
+            ++function_index) {
+        const diag_banded_info_t *f = &dfunctions[function_index];
+        if (!isa_supported(f->isa)) {
+            continue;
+        }
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            int open = gap_scores[gap_index].open;
+            int extend = gap_scores[gap_index].extend;
+            for (diag_index=0; INT_MIN!=diags[diag_index]; ++diag_index) {
+                int diag = diags[diag_index];
+                for (band_index=0; bands[band_index]>=0; ++band_index) {
+                    int k = bands[band_index];
+                    int a = 0;
+                    int b = 0;
+                    for (a=0; a<count; ++a) {
+                        for (b=a; b<count; ++b) {
+                            parasail_result_t *reference = f->reference(
+                                    sequences[a], sizes[a],
+                                    sequences[b], sizes[b],
+                                    open, extend, diag, k, matrix);
+                            parasail_result_t *result = f->pointer(
+                                    sequences[a], sizes[a],
+                                    sequences[b], sizes[b],
+                                    open, extend, diag, k, matrix);
+                            if (compare(reference, result,
+                                        f->is_table, f->is_rowcol,
+                                        sizes[a], sizes[b], &saturated)) {
+                                printf("%s(%d,%d,%d,%d,%d,%d) wrong result "
+                                        "(%d,%d,%d != %d,%d,%d)\n",
+                                        f->name, a, b, open, extend, diag, k,
+                                        reference->score,
+                                        reference->end_query,
+                                        reference->end_ref,
+                                        result->score,
+                                        result->end_query,
+                                        result->end_ref);
+                                ++errors;
+                            }
+                            parasail_result_free(result);
+                            parasail_result_free(reference);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* a band wide enough to cover the table is the unbanded alignment */
+    {
+        int a = 0;
+        int b = 0;
+        printf("checking wide bands\n");
+        for (a=0; a<count; ++a) {
+            for (b=a; b<count; ++b) {
+                int k = sizes[a] + sizes[b];
+                parasail_result_t *sg = parasail_sg(
+                        sequences[a], sizes[a], sequences[b], sizes[b],
+                        10, 1, matrix);
+                parasail_result_t *sg_banded = parasail_sg_banded_sat(
+                        sequences[a], sizes[a], sequences[b], sizes[b],
+                        10, 1, 0, k, matrix);
+                parasail_result_t *sw = parasail_sw(
+                        sequences[a], sizes[a], sequences[b], sizes[b],
+                        10, 1, matrix);
+                parasail_result_t *sw_banded = parasail_sw_banded_sat(
+                        sequences[a], sizes[a], sequences[b], sizes[b],
+                        10, 1, 0, k, matrix);
+                if (sg->score != sg_banded->score
+                        || sw->score != sw_banded->score) {
+                    printf("wide band (%d,%d) wrong result "
+                            "(%d,%d != %d,%d)\n", a, b,
+                            sg->score, sw->score,
+                            sg_banded->score, sw_banded->score);
+                    ++errors;
+                }
+                parasail_result_free(sw_banded);
+                parasail_result_free(sw);
+                parasail_result_free(sg_banded);
+                parasail_result_free(sg);
+            }
+        }
+    }
+
+    printf("%lu errors, %lu saturated\n", errors, saturated);
+
+    for (i=0; i<count; ++i) {
+        free(sequences[i]);
+    }
+    free(sequences);
+    free(sizes);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,295 @@
+#include "config.h"
+
+/* strdup needs _POSIX_C_SOURCE 200809L */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "kseq.h"
+KSEQ_INIT(int, read)
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+#include "parasail/matrices/nuc44.h"
+
+typedef struct gap_score {
+    int open;
+    int extend;
+} gap_score_t;
+
+gap_score_t gap_scores[] = {
+    {10,1},
+    {40,2},
+    {INT_MIN,INT_MIN}
+};
+
+static void parse_sequences(
+        const char *filename,
+        char ***strings_,
+        int **sizes_,
+        int *count_)
+{
+    FILE* fp;
+    kseq_t *seq = NULL;
+    int l = 0;
+    char **strings = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int memory = 1000;
+
+    fp = fopen(filename, "r");
+    if(fp == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+    strings = malloc(sizeof(char*) * memory);
+    sizes = malloc(sizeof(int) * memory);
+    seq = kseq_init(fileno(fp));
+    while ((l = kseq_read(seq)) >= 0) {
+        strings[count] = strdup(seq->seq.s);
+        if (NULL == strings[count]) {
+            perror("strdup");
+            exit(1);
+        }
+        sizes[count] = seq->seq.l;
+        ++count;
+        if (count >= memory) {
+            memory *= 2;
+            strings = realloc(strings, sizeof(char*) * memory);
+            sizes = realloc(sizes, sizeof(int) * memory);
+            if (NULL == strings || NULL == sizes) {
+                perror("realloc");
+                exit(1);
+            }
+        }
+    }
+    kseq_destroy(seq);
+    fclose(fp);
+
+    *strings_ = strings;
+    *sizes_ = sizes;
+    *count_ = count;
+}
+
+typedef struct encoded_info {
+    const char *name;
+    parasail_function_t *reference;
+} encoded_info_t;
+
+/* profile functions run on the encoded sequences, each compared with
+ * the serial function of the same class */
+static encoded_info_t functions[] = {
+    {"parasail_sw_striped_profile_sat", parasail_sw},
+    {"parasail_sw_scan_profile_16", parasail_sw},
+    {"parasail_sg_striped_profile_sat", parasail_sg},
+    {"parasail_nw_scan_profile_sat", parasail_nw},
+    {"parasail_sw_stats_striped_profile_sat", parasail_sw_stats},
+    {NULL, NULL}
+};
+
+/* write size bytes of blob to path and try to map it back */
+static int maps(const char *path, const void *blob, size_t size)
+{
+    FILE *fp = fopen(path, "wb");
+    parasail_db_t *db = NULL;
+
+    if (NULL == fp || 1 != fwrite(blob, size, 1, fp) || 0 != fclose(fp)) {
+        perror(path);
+        exit(1);
+    }
+    errno = 0;
+    db = parasail_db_map(path);
+    if (NULL == db) {
+        return EINVAL == errno ? 0 : -1;
+    }
+    parasail_db_free(db);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    char **sequences = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int query = 0;
+    int function_index = 0;
+    int gap_index = 0;
+    unsigned long errors = 0;
+    unsigned long saturated = 0;
+    const char *path = "test_db.db";
+    const parasail_matrix_t *matrix = &parasail_blosum62;
+    parasail_db_t *created = NULL;
+    parasail_db_t *db = NULL;
+    char *blob = NULL;
+    uint64_t *offsets = NULL;
+    uint64_t i = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s sequences.fasta\n", argv[0]);
+        return 1;
+    }
+
+    parse_sequences(argv[1], &sequences, &sizes, &count);
+    printf("%d sequences read\n", count);
+
+    created = parasail_db_create((const char * const *)sequences,
+            sizes, count, matrix);
+    if (0 != parasail_db_save(created, path)) {
+        perror(path);
+        return 1;
+    }
+    db = parasail_db_map(path);
+    if (NULL == db || db->size != created->size
+            || 0 != memcmp(db->blob, created->blob, db->size)) {
+        printf("%s does not map back to what was saved\n", path);
+        return 1;
+    }
+    if ((int)db->count != count) {
+        printf("%s holds %lu sequences, not %d\n",
+                path, (unsigned long)db->count, count);
+        ++errors;
+    }
+    for (query=0; query<count; ++query) {
+        int j = 0;
+        if (parasail_db_length(db, query) != sizes[query]) {
+            printf("sequence %d has length %d, not %d\n",
+                    query, parasail_db_length(db, query), sizes[query]);
+            ++errors;
+            continue;
+        }
+        for (j=0; j<sizes[query]; ++j) {
+            if (parasail_db_sequence(db, query)[j]
+                    != matrix->mapper[(unsigned char)sequences[query][j]]) {
+                printf("sequence %d residue %d not encoded\n", query, j);
+                ++errors;
+                break;
+            }
+        }
+    }
+    if (!parasail_db_matches(db, matrix)) {
+        printf("%s does not match its own matrix\n", path);
+        ++errors;
+    }
+    if (parasail_db_matches(db, &parasail_nuc44)) {
+        printf("%s matches a matrix it was not encoded with\n", path);
+        ++errors;
+    }
+
+    /* corrupt copies of the blob must not map */
+    blob = (char*)malloc(created->size);
+    memcpy(blob, created->blob, created->size);
+    offsets = (uint64_t*)((char*)blob + ((const char*)created->offsets
+                - (const char*)created->blob));
+    if (0 != maps(path, blob, created->size - 1)) {
+        printf("truncated database mapped\n");
+        ++errors;
+    }
+    /* a count whose offsets would overflow the size */
+    ((uint64_t*)blob)[1] = UINT64_MAX / sizeof(uint64_t);
+    if (0 != maps(path, blob, created->size)) {
+        printf("database with overflowing count mapped\n");
+        ++errors;
+    }
+    ((uint64_t*)blob)[1] = created->count;
+    if (count > 1) {
+        uint64_t saved = offsets[1];
+        offsets[1] = offsets[2] + 1;
+        if (0 != maps(path, blob, created->size)) {
+            printf("database with offsets out of order mapped\n");
+            ++errors;
+        }
+        offsets[1] = saved;
+    }
+    offsets[count] += 1;
+    if (0 != maps(path, blob, created->size)) {
+        printf("database with offsets past its residues mapped\n");
+        ++errors;
+    }
+    offsets[count] -= 1;
+    if (1 != maps(path, blob, created->size)) {
+        printf("restored database did not map\n");
+        ++errors;
+    }
+    free(blob);
+
+    for (function_index=0;
+            NULL!=functions[function_index].name;
+            ++function_index) {
+        const encoded_info_t *f = &functions[function_index];
+        parasail_pfunction_t *pfunction = parasail_lookup_pfunction(f->name);
+        parasail_pwfunction_t *pwfunction = parasail_lookup_pwfunction(f->name);
+        parasail_pcreator_t *creator = parasail_lookup_pcreator(f->name);
+        parasail_workspace_t *workspace = parasail_workspace_new();
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            int open = gap_scores[gap_index].open;
+            int extend = gap_scores[gap_index].extend;
+            for (query=0; query<count; ++query) {
+                parasail_profile_t *profile = creator(
+                        sequences[query], sizes[query], matrix);
+                for (i=0; i<db->count; ++i) {
+                    parasail_result_t *reference = f->reference(
+                            sequences[query], sizes[query],
+                            sequences[i], sizes[i],
+                            open, extend, matrix);
+                    parasail_result_t *results[2];
+                    int k = 0;
+                    results[0] = parasail_align_encoded(pfunction, profile,
+                            parasail_db_sequence(db, i),
+                            parasail_db_length(db, i), open, extend);
+                    results[1] = parasail_align_encoded_ws(pwfunction, profile,
+                            parasail_db_sequence(db, i),
+                            parasail_db_length(db, i), open, extend,
+                            workspace);
+                    for (k=0; k<2; ++k) {
+                        parasail_result_t *result = results[k];
+                        if (result->saturated) {
+                            ++saturated;
+                        }
+                        else if (reference->score != result->score
+                                || reference->end_query != result->end_query
+                                || reference->end_ref != result->end_ref
+                                || reference->matches != result->matches) {
+                            printf("%s%s(%d,%lu,%d,%d) wrong result "
+                                    "(%d,%d,%d,%d != %d,%d,%d,%d)\n",
+                                    f->name, k ? "_ws" : "",
+                                    query, (unsigned long)i, open, extend,
+                                    reference->score,
+                                    reference->end_query,
+                                    reference->end_ref,
+                                    reference->matches,
+                                    result->score,
+                                    result->end_query,
+                                    result->end_ref,
+                                    result->matches);
+                            ++errors;
+                        }
+                        parasail_result_free(result);
+                    }
+                    parasail_result_free(reference);
+                }
+                parasail_profile_free(profile);
+            }
+        }
+        parasail_workspace_free(workspace);
+    }
+
+    printf("%lu errors, %lu saturated\n", errors, saturated);
+
+    remove(path);
+    parasail_db_free(db);
+    parasail_db_free(created);
+    for (query=0; query<count; ++query) {
+        free(sequences[query]);
+    }
+    free(sequences);
+    free(sizes);
+
+    return errors ? 1 : 0;
+}
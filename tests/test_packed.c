@@ -0,0 +1,323 @@
+#include "config.h"
+
+/* strdup needs _POSIX_C_SOURCE 200809L */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "kseq.h"
+KSEQ_INIT(int, read)
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/matrices/blosum62.h"
+
+typedef struct gap_score {
+    int open;
+    int extend;
+} gap_score_t;
+
+gap_score_t gap_scores[] = {
+    {10,1},
+    {10,2},
+    {14,2},
+    {40,2},
+    {INT_MIN,INT_MIN}
+};
+
+typedef struct packed_info {
+    parasail_mfunction_t *pointer;
+    parasail_function_t *reference;
+    const char *name;
+    const char *isa;
+} packed_info_t;
+
+static packed_info_t functions[] = {
+    {parasail_nw_packed,               parasail_nw, "parasail_nw_packed",               "novec"},
+    {parasail_sg_packed,               parasail_sg, "parasail_sg_packed",               "novec"},
+    {parasail_sw_packed,               parasail_sw, "parasail_sw_packed",               "novec"},
+#if HAVE_SSE41
+    {parasail_nw_packed_sse41_128_16,  parasail_nw, "parasail_nw_packed_sse41_128_16",  "sse41"},
+    {parasail_nw_packed_sse41_128_8,   parasail_nw, "parasail_nw_packed_sse41_128_8",   "sse41"},
+    {parasail_nw_packed_sse41_128_sat, parasail_nw, "parasail_nw_packed_sse41_128_sat", "sse41"},
+    {parasail_sg_packed_sse41_128_16,  parasail_sg, "parasail_sg_packed_sse41_128_16",  "sse41"},
+    {parasail_sg_packed_sse41_128_8,   parasail_sg, "parasail_sg_packed_sse41_128_8",   "sse41"},
+    {parasail_sg_packed_sse41_128_sat, parasail_sg, "parasail_sg_packed_sse41_128_sat", "sse41"},
+    {parasail_sw_packed_sse41_128_16,  parasail_sw, "parasail_sw_packed_sse41_128_16",  "sse41"},
+    {parasail_sw_packed_sse41_128_8,   parasail_sw, "parasail_sw_packed_sse41_128_8",   "sse41"},
+    {parasail_sw_packed_sse41_128_sat, parasail_sw, "parasail_sw_packed_sse41_128_sat", "sse41"},
+#endif
+#if HAVE_AVX2
+    {parasail_nw_packed_avx2_256_16,   parasail_nw, "parasail_nw_packed_avx2_256_16",   "avx2"},
+    {parasail_nw_packed_avx2_256_8,    parasail_nw, "parasail_nw_packed_avx2_256_8",    "avx2"},
+    {parasail_nw_packed_avx2_256_sat,  parasail_nw, "parasail_nw_packed_avx2_256_sat",  "avx2"},
+    {parasail_sg_packed_avx2_256_16,   parasail_sg, "parasail_sg_packed_avx2_256_16",   "avx2"},
+    {parasail_sg_packed_avx2_256_8,    parasail_sg, "parasail_sg_packed_avx2_256_8",    "avx2"},
+    {parasail_sg_packed_avx2_256_sat,  parasail_sg, "parasail_sg_packed_avx2_256_sat",  "avx2"},
+    {parasail_sw_packed_avx2_256_16,   parasail_sw, "parasail_sw_packed_avx2_256_16",   "avx2"},
+    {parasail_sw_packed_avx2_256_8,    parasail_sw, "parasail_sw_packed_avx2_256_8",    "avx2"},
+    {parasail_sw_packed_avx2_256_sat,  parasail_sw, "parasail_sw_packed_avx2_256_sat",  "avx2"},
+#endif
+    {parasail_nw_packed_sat,           parasail_nw, "parasail_nw_packed_sat",           "disp"},
+    {parasail_sg_packed_sat,           parasail_sg, "parasail_sg_packed_sat",           "disp"},
+    {parasail_sw_packed_sat,           parasail_sw, "parasail_sw_packed_sat",           "disp"},
+    {NULL, NULL, NULL, NULL}
+};
+
+typedef struct packed_profile_info {
+    parasail_mpfunction_t *pointer;
+    parasail_mcreator_t *creator;
+    parasail_function_t *reference;
+    const char *name;
+    const char *isa;
+} packed_profile_info_t;
+
+static packed_profile_info_t pfunctions[] = {
+    {parasail_nw_packed_profile,               parasail_profile_create_packed,            parasail_nw, "parasail_nw_packed_profile",               "novec"},
+    {parasail_sg_packed_profile,               parasail_profile_create_packed,            parasail_sg, "parasail_sg_packed_profile",               "novec"},
+    {parasail_sw_packed_profile,               parasail_profile_create_packed,            parasail_sw, "parasail_sw_packed_profile",               "novec"},
+#if HAVE_SSE41
+    {parasail_nw_packed_profile_sse41_128_16,  parasail_profile_create_packed_sse_128_16, parasail_nw, "parasail_nw_packed_profile_sse41_128_16",  "sse41"},
+    {parasail_nw_packed_profile_sse41_128_8,   parasail_profile_create_packed_sse_128_8,  parasail_nw, "parasail_nw_packed_profile_sse41_128_8",   "sse41"},
+    {parasail_nw_packed_profile_sse41_128_sat, parasail_profile_create_packed_sse_128_8,  parasail_nw, "parasail_nw_packed_profile_sse41_128_sat", "sse41"},
+    {parasail_sg_packed_profile_sse41_128_16,  parasail_profile_create_packed_sse_128_16, parasail_sg, "parasail_sg_packed_profile_sse41_128_16",  "sse41"},
+    {parasail_sg_packed_profile_sse41_128_8,   parasail_profile_create_packed_sse_128_8,  parasail_sg, "parasail_sg_packed_profile_sse41_128_8",   "sse41"},
+    {parasail_sg_packed_profile_sse41_128_sat, parasail_profile_create_packed_sse_128_8,  parasail_sg, "parasail_sg_packed_profile_sse41_128_sat", "sse41"},
+    {parasail_sw_packed_profile_sse41_128_16,  parasail_profile_create_packed_sse_128_16, parasail_sw, "parasail_sw_packed_profile_sse41_128_16",  "sse41"},
+    {parasail_sw_packed_profile_sse41_128_8,   parasail_profile_create_packed_sse_128_8,  parasail_sw, "parasail_sw_packed_profile_sse41_128_8",   "sse41"},
+    {parasail_sw_packed_profile_sse41_128_sat, parasail_profile_create_packed_sse_128_8,  parasail_sw, "parasail_sw_packed_profile_sse41_128_sat", "sse41"},
+#endif
+#if HAVE_AVX2
+    {parasail_nw_packed_profile_avx2_256_16,   parasail_profile_create_packed_avx_256_16, parasail_nw, "parasail_nw_packed_profile_avx2_256_16",   "avx2"},
+    {parasail_nw_packed_profile_avx2_256_8,    parasail_profile_create_packed_avx_256_8,  parasail_nw, "parasail_nw_packed_profile_avx2_256_8",    "avx2"},
+    {parasail_nw_packed_profile_avx2_256_sat,  parasail_profile_create_packed_avx_256_8,  parasail_nw, "parasail_nw_packed_profile_avx2_256_sat",  "avx2"},
+    {parasail_sg_packed_profile_avx2_256_16,   parasail_profile_create_packed_avx_256_16, parasail_sg, "parasail_sg_packed_profile_avx2_256_16",   "avx2"},
+    {parasail_sg_packed_profile_avx2_256_8,    parasail_profile_create_packed_avx_256_8,  parasail_sg, "parasail_sg_packed_profile_avx2_256_8",    "avx2"},
+    {parasail_sg_packed_profile_avx2_256_sat,  parasail_profile_create_packed_avx_256_8,  parasail_sg, "parasail_sg_packed_profile_avx2_256_sat",  "avx2"},
+    {parasail_sw_packed_profile_avx2_256_16,   parasail_profile_create_packed_avx_256_16, parasail_sw, "parasail_sw_packed_profile_avx2_256_16",   "avx2"},
+    {parasail_sw_packed_profile_avx2_256_8,    parasail_profile_create_packed_avx_256_8,  parasail_sw, "parasail_sw_packed_profile_avx2_256_8",    "avx2"},
+    {parasail_sw_packed_profile_avx2_256_sat,  parasail_profile_create_packed_avx_256_8,  parasail_sw, "parasail_sw_packed_profile_avx2_256_sat",  "avx2"},
+#endif
+    {parasail_nw_packed_profile_sat,           parasail_profile_create_packed_8,          parasail_nw, "parasail_nw_packed_profile_sat",           "disp"},
+    {parasail_sg_packed_profile_sat,           parasail_profile_create_packed_8,          parasail_sg, "parasail_sg_packed_profile_sat",           "disp"},
+    {parasail_sw_packed_profile_sat,           parasail_profile_create_packed_8,          parasail_sw, "parasail_sw_packed_profile_sat",           "disp"},
+    {NULL, NULL, NULL, NULL, NULL}
+};
+
+static void parse_sequences(
+        const char *filename,
+        char ***strings_,
+        int **sizes_,
+        int *count_)
+{
+    FILE* fp;
+    kseq_t *seq = NULL;
+    int l = 0;
+    char **strings = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int memory = 1000;
+
+    fp = fopen(filename, "r");
+    if(fp == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+    strings = malloc(sizeof(char*) * memory);
+    sizes = malloc(sizeof(int) * memory);
+    seq = kseq_init(fileno(fp));
+    while ((l = kseq_read(seq)) >= 0) {
+        strings[count] = strdup(seq->seq.s);
+        if (NULL == strings[count]) {
+            perror("strdup");
+            exit(1);
+        }
+        sizes[count] = seq->seq.l;
+        ++count;
+        if (count >= memory) {
+            memory *= 2;
+            strings = realloc(strings, sizeof(char*) * memory);
+            sizes = realloc(sizes, sizeof(int) * memory);
+            if (NULL == strings || NULL == sizes) {
+                perror("realloc");
+                exit(1);
+            }
+        }
+    }
+    kseq_destroy(seq);
+    fclose(fp);
+
+    *strings_ = strings;
+    *sizes_ = sizes;
+    *count_ = count;
+}
+
+static int isa_supported(const char *isa)
+{
+    if (0 == strcmp(isa, "sse41")) {
+        return parasail_can_use_sse41();
+    }
+    if (0 == strcmp(isa, "avx2")) {
+        return parasail_can_use_avx2();
+    }
+    return 1;
+}
+
+static unsigned long check(
+        const char *name, parasail_function_t *reference,
+        parasail_result_t **results,
+        const char * const * peptides, const int *lengths, int count,
+        const char *s2, int s2Len, int open, int extend,
+        const parasail_matrix_t *matrix, unsigned long *saturated)
+{
+    unsigned long errors = 0;
+    int i = 0;
+
+    for (i=0; i<count; ++i) {
+        parasail_result_t *expected = reference(
+                peptides[i], lengths[i], s2, s2Len, open, extend, matrix);
+        if (results[i]->saturated) {
+            /* no point in comparing a result that saturated */
+            ++*saturated;
+        }
+        else if (expected->score != results[i]->score
+                || expected->end_query != results[i]->end_query
+                || expected->end_ref != results[i]->end_ref) {
+            printf("%s(%d,%d,%d) wrong result "
+                    "(%d,%d,%d != %d,%d,%d)\n",
+                    name, i, open, extend,
+                    expected->score,
+                    expected->end_query,
+                    expected->end_ref,
+                    results[i]->score,
+                    results[i]->end_query,
+                    results[i]->end_ref);
+            ++errors;
+        }
+        parasail_result_free(expected);
+    }
+
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    char **sequences = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    const char **peptides = NULL;
+    int *lengths = NULL;
+    int npeptides = 0;
+    int i = 0;
+    int function_index = 0;
+    int gap_index = 0;
+    unsigned long errors = 0;
+    unsigned long saturated = 0;
+    const parasail_matrix_t *matrix = &parasail_blosum62;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s sequences.fasta\n", argv[0]);
+        return 1;
+    }
+
+    parse_sequences(argv[1], &sequences, &sizes, &count);
+    printf("%d sequences read\n", count);
+
+    /* peptides of 8 to 30 residues from the start of each sequence,
+     * plus one too long to share a vector */
+    peptides = malloc(sizeof(const char*) * count);
+    lengths = malloc(sizeof(int) * count);
+    for (i=0; i<count; ++i) {
+        int length = 8 + i%23;
+        if (i == count/2) {
+            length = 40;
+        }
+        if (length > sizes[i]) {
+            continue;
+        }
+        peptides[npeptides] = sequences[i];
+        lengths[npeptides] = length;
+        ++npeptides;
+    }
+    printf("%d peptides\n", npeptides);
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const packed_info_t *f = &functions[function_index];
+        if (!isa_supported(f->isa)) {
+            continue;
+        }
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            int open = gap_scores[gap_index].open;
+            int extend = gap_scores[gap_index].extend;
+            for (i=0; i<count; ++i) {
+                parasail_result_t **results = f->pointer(
+                        peptides, lengths, npeptides,
+                        sequences[i], sizes[i],
+                        open, extend, matrix);
+                errors += check(f->name, f->reference, results,
+                        peptides, lengths, npeptides,
+                        sequences[i], sizes[i], open, extend,
+                        matrix, &saturated);
+                parasail_result_free_batch(results, npeptides);
+            }
+        }
+    }
+
+    for (function_index=0;
+            NULL!=pfunctions[function_index].pointer;
+            ++function_index) {
+        const packed_profile_info_t *f = &pfunctions[function_index];
+        if (!isa_supported(f->isa)) {
+            continue;
+        }
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            int open = gap_scores[gap_index].open;
+            int extend = gap_scores[gap_index].extend;
+            int first = 0;
+            while (first < npeptides) {
+                parasail_profile_t *profile = NULL;
+                profile = f->creator(peptides + first, lengths + first,
+                        npeptides - first, matrix);
+                if (NULL == profile) {
+                    /* too long to share a vector */
+                    ++first;
+                    continue;
+                }
+                for (i=0; i<count; ++i) {
+                    parasail_result_t **results = f->pointer(
+                            profile, sequences[i], sizes[i], open, extend);
+                    errors += check(f->name, f->reference, results,
+                            peptides + first, lengths + first,
+                            profile->packed_count,
+                            sequences[i], sizes[i], open, extend,
+                            matrix, &saturated);
+                    parasail_result_free_batch(results, profile->packed_count);
+                }
+                first += profile->packed_count;
+                parasail_profile_free(profile);
+            }
+        }
+    }
+
+    printf("%lu errors, %lu saturated\n", errors, saturated);
+
+    for (i=0; i<count; ++i) {
+        free(sequences[i]);
+    }
+    free(sequences);
+    free(sizes);
+    free(peptides);
+    free(lengths);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,232 @@
+#include "config.h"
+
+/* strdup needs _POSIX_C_SOURCE 200809L */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "kseq.h"
+KSEQ_INIT(int, read)
+
+#include "parasail.h"
+#include "parasail/matrices/blosum62.h"
+
+typedef struct gap_score {
+    int open;
+    int extend;
+} gap_score_t;
+
+gap_score_t gap_scores[] = {
+    {10,1},
+    {INT_MIN,INT_MIN}
+};
+
+static void parse_sequences(
+        const char *filename,
+        char ***strings_,
+        int **sizes_,
+        int *count_)
+{
+    FILE* fp;
+    kseq_t *seq = NULL;
+    int l = 0;
+    char **strings = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int memory = 1000;
+
+    fp = fopen(filename, "r");
+    if(fp == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+    strings = malloc(sizeof(char*) * memory);
+    sizes = malloc(sizeof(int) * memory);
+    seq = kseq_init(fileno(fp));
+    while ((l = kseq_read(seq)) >= 0) {
+        strings[count] = strdup(seq->seq.s);
+        if (NULL == strings[count]) {
+            perror("strdup");
+            exit(1);
+        }
+        sizes[count] = seq->seq.l;
+        ++count;
+        if (count >= memory) {
+            memory *= 2;
+            strings = realloc(strings, sizeof(char*) * memory);
+            sizes = realloc(sizes, sizeof(int) * memory);
+            if (NULL == strings || NULL == sizes) {
+                perror("realloc");
+                exit(1);
+            }
+        }
+    }
+    kseq_destroy(seq);
+    fclose(fp);
+
+    *strings_ = strings;
+    *sizes_ = sizes;
+    *count_ = count;
+}
+
+typedef struct profile_info {
+    const char *name;
+    int layout;
+    parasail_function_t *reference;
+} profile_info_t;
+
+/* profile functions run on profiles saved and mapped back, each compared
+ * with the serial function of the same class */
+static profile_info_t functions[] = {
+    {"parasail_sw_striped_profile_sat", PARASAIL_LAYOUT_STRIPED, parasail_sw},
+    {"parasail_sg_scan_profile_16", PARASAIL_LAYOUT_STRIPED, parasail_sg},
+    {"parasail_sw_stats_striped_profile_sat", PARASAIL_LAYOUT_STRIPED, parasail_sw_stats},
+    {"parasail_sw_blocked_profile_16", PARASAIL_LAYOUT_BLOCKED, parasail_sw},
+    {"parasail_nw_blocked_profile_32", PARASAIL_LAYOUT_BLOCKED, parasail_nw},
+    {NULL, 0, NULL}
+};
+
+/* map path for layout, 1 if it mapped, 0 if refused with EINVAL */
+static int maps(const char *path, const parasail_matrix_t *matrix, int layout)
+{
+    parasail_profile_t *profile = NULL;
+
+    errno = 0;
+    profile = parasail_profile_map(path, matrix, layout);
+    if (NULL == profile) {
+        return EINVAL == errno ? 0 : -1;
+    }
+    parasail_profile_free(profile);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    char **sequences = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int query = 0;
+    int function_index = 0;
+    int gap_index = 0;
+    int layout = 0;
+    int i = 0;
+    unsigned long errors = 0;
+    unsigned long saturated = 0;
+    const char *path = "test_profile_io.profile";
+    const parasail_matrix_t *matrix = &parasail_blosum62;
+    parasail_profile_t *packed = NULL;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s sequences.fasta\n", argv[0]);
+        return 1;
+    }
+
+    parse_sequences(argv[1], &sequences, &sizes, &count);
+    printf("%d sequences read\n", count);
+
+    /* a packed profile does not keep its queries, so it is never saved */
+    packed = parasail_profile_create_packed_16(
+            (const char * const *)sequences, sizes, count, matrix);
+    if (NULL != packed) {
+        errno = 0;
+        if (-1 != parasail_profile_save(packed, path) || EINVAL != errno) {
+            printf("packed profile saved\n");
+            ++errors;
+        }
+        parasail_profile_free(packed);
+    }
+
+    for (function_index=0;
+            NULL!=functions[function_index].name;
+            ++function_index) {
+        const profile_info_t *f = &functions[function_index];
+        parasail_pfunction_t *pfunction = parasail_lookup_pfunction(f->name);
+        parasail_pcreator_t *creator = parasail_lookup_pcreator(f->name);
+        printf("checking %s\n", f->name);
+        for (query=0; query<count; ++query) {
+            parasail_profile_t *created = creator(
+                    sequences[query], sizes[query], matrix);
+            parasail_profile_t *profile = NULL;
+            if (f->layout != created->layout) {
+                printf("%s(%d) created with layout %d\n",
+                        f->name, query, created->layout);
+                ++errors;
+            }
+            if (0 != parasail_profile_save(created, path)) {
+                perror(path);
+                return 1;
+            }
+            parasail_profile_free(created);
+            /* only the layout it was saved with maps */
+            for (layout=PARASAIL_LAYOUT_SERIAL;
+                    layout<=PARASAIL_LAYOUT_PACKED;
+                    ++layout) {
+                if ((layout == f->layout) != maps(path, matrix, layout)) {
+                    printf("%s(%d) saved as layout %d %s layout %d\n",
+                            f->name, query, f->layout,
+                            layout == f->layout ? "does not map as" : "maps as",
+                            layout);
+                    ++errors;
+                }
+            }
+            profile = parasail_profile_map(path, matrix, f->layout);
+            if (NULL == profile) {
+                printf("%s(%d) does not map back\n", f->name, query);
+                ++errors;
+                continue;
+            }
+            for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+                int open = gap_scores[gap_index].open;
+                int extend = gap_scores[gap_index].extend;
+                for (i=0; i<count; ++i) {
+                    parasail_result_t *reference = f->reference(
+                            sequences[query], sizes[query],
+                            sequences[i], sizes[i],
+                            open, extend, matrix);
+                    parasail_result_t *result = pfunction(profile,
+                            sequences[i], sizes[i], open, extend);
+                    if (result->saturated) {
+                        ++saturated;
+                    }
+                    else if (reference->score != result->score
+                            || reference->end_query != result->end_query
+                            || reference->end_ref != result->end_ref
+                            || reference->matches != result->matches) {
+                        printf("%s(%d,%d,%d,%d) wrong result "
+                                "(%d,%d,%d,%d != %d,%d,%d,%d)\n",
+                                f->name, query, i, open, extend,
+                                reference->score,
+                                reference->end_query,
+                                reference->end_ref,
+                                reference->matches,
+                                result->score,
+                                result->end_query,
+                                result->end_ref,
+                                result->matches);
+                        ++errors;
+                    }
+                    parasail_result_free(result);
+                    parasail_result_free(reference);
+                }
+            }
+            parasail_profile_free(profile);
+        }
+    }
+
+    printf("%lu errors, %lu saturated\n", errors, saturated);
+
+    remove(path);
+    for (query=0; query<count; ++query) {
+        free(sequences[query]);
+    }
+    free(sequences);
+    free(sizes);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,255 @@
+#include "config.h"
+
+/* strdup needs _POSIX_C_SOURCE 200809L */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "kseq.h"
+KSEQ_INIT(int, read)
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/matrices/blosum62.h"
+
+typedef struct gap_score {
+    int open;
+    int extend;
+} gap_score_t;
+
+gap_score_t gap_scores[] = {
+    {10,1},
+    {10,2},
+    {14,2},
+    {40,2},
+    {INT_MIN,INT_MIN}
+};
+
+typedef struct batch_info {
+    parasail_bfunction_t *pointer;
+    parasail_function_t *reference;
+    const char *name;
+    const char *isa;
+} batch_info_t;
+
+static batch_info_t functions[] = {
+    {parasail_nw_swipe,            parasail_nw, "parasail_nw_swipe",            "novec"},
+    {parasail_sg_swipe,            parasail_sg, "parasail_sg_swipe",            "novec"},
+    {parasail_sw_swipe,            parasail_sw, "parasail_sw_swipe",            "novec"},
+#if HAVE_SSE41
+    {parasail_nw_swipe_sse41_128_32, parasail_nw, "parasail_nw_swipe_sse41_128_32", "sse41"},
+    {parasail_nw_swipe_sse41_128_16, parasail_nw, "parasail_nw_swipe_sse41_128_16", "sse41"},
+    {parasail_nw_swipe_sse41_128_8,  parasail_nw, "parasail_nw_swipe_sse41_128_8",  "sse41"},
+    {parasail_nw_swipe_sse41_128_sat,parasail_nw, "parasail_nw_swipe_sse41_128_sat","sse41"},
+    {parasail_sg_swipe_sse41_128_32, parasail_sg, "parasail_sg_swipe_sse41_128_32", "sse41"},
+    {parasail_sg_swipe_sse41_128_16, parasail_sg, "parasail_sg_swipe_sse41_128_16", "sse41"},
+    {parasail_sg_swipe_sse41_128_8,  parasail_sg, "parasail_sg_swipe_sse41_128_8",  "sse41"},
+    {parasail_sg_swipe_sse41_128_sat,parasail_sg, "parasail_sg_swipe_sse41_128_sat","sse41"},
+    {parasail_sw_swipe_sse41_128_32, parasail_sw, "parasail_sw_swipe_sse41_128_32", "sse41"},
+    {parasail_sw_swipe_sse41_128_16, parasail_sw, "parasail_sw_swipe_sse41_128_16", "sse41"},
+    {parasail_sw_swipe_sse41_128_8,  parasail_sw, "parasail_sw_swipe_sse41_128_8",  "sse41"},
+    {parasail_sw_swipe_sse41_128_sat,parasail_sw, "parasail_sw_swipe_sse41_128_sat","sse41"},
+#endif
+#if HAVE_AVX2
+    {parasail_nw_swipe_avx2_256_32,  parasail_nw, "parasail_nw_swipe_avx2_256_32",  "avx2"},
+    {parasail_nw_swipe_avx2_256_16,  parasail_nw, "parasail_nw_swipe_avx2_256_16",  "avx2"},
+    {parasail_nw_swipe_avx2_256_8,   parasail_nw, "parasail_nw_swipe_avx2_256_8",   "avx2"},
+    {parasail_nw_swipe_avx2_256_sat, parasail_nw, "parasail_nw_swipe_avx2_256_sat", "avx2"},
+    {parasail_sg_swipe_avx2_256_32,  parasail_sg, "parasail_sg_swipe_avx2_256_32",  "avx2"},
+    {parasail_sg_swipe_avx2_256_16,  parasail_sg, "parasail_sg_swipe_avx2_256_16",  "avx2"},
+    {parasail_sg_swipe_avx2_256_8,   parasail_sg, "parasail_sg_swipe_avx2_256_8",   "avx2"},
+    {parasail_sg_swipe_avx2_256_sat, parasail_sg, "parasail_sg_swipe_avx2_256_sat", "avx2"},
+    {parasail_sw_swipe_avx2_256_32,  parasail_sw, "parasail_sw_swipe_avx2_256_32",  "avx2"},
+    {parasail_sw_swipe_avx2_256_16,  parasail_sw, "parasail_sw_swipe_avx2_256_16",  "avx2"},
+    {parasail_sw_swipe_avx2_256_8,   parasail_sw, "parasail_sw_swipe_avx2_256_8",   "avx2"},
+    {parasail_sw_swipe_avx2_256_sat, parasail_sw, "parasail_sw_swipe_avx2_256_sat", "avx2"},
+#endif
+    {parasail_nw_swipe_sat,        parasail_nw, "parasail_nw_swipe_sat",        "disp"},
+    {parasail_sg_swipe_sat,        parasail_sg, "parasail_sg_swipe_sat",        "disp"},
+    {parasail_sw_swipe_sat,        parasail_sw, "parasail_sw_swipe_sat",        "disp"},
+    {NULL, NULL, NULL, NULL}
+};
+
+static void parse_sequences(
+        const char *filename,
+        char ***strings_,
+        int **sizes_,
+        int *count_)
+{
+    FILE* fp;
+    kseq_t *seq = NULL;
+    int l = 0;
+    char **strings = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int memory = 1000;
+
+    fp = fopen(filename, "r");
+    if(fp == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+    strings = malloc(sizeof(char*) * memory);
+    sizes = malloc(sizeof(int) * memory);
+    seq = kseq_init(fileno(fp));
+    while ((l = kseq_read(seq)) >= 0) {
+        strings[count] = strdup(seq->seq.s);
+        if (NULL == strings[count]) {
+            perror("strdup");
+            exit(1);
+        }
+        sizes[count] = seq->seq.l;
+        ++count;
+        if (count >= memory) {
+            memory *= 2;
+            strings = realloc(strings, sizeof(char*) * memory);
+            sizes = realloc(sizes, sizeof(int) * memory);
+            if (NULL == strings || NULL == sizes) {
+                perror("realloc");
+                exit(1);
+            }
+        }
+    }
+    kseq_destroy(seq);
+    fclose(fp);
+
+    *strings_ = strings;
+    *sizes_ = sizes;
+    *count_ = count;
+}
+
+static int isa_supported(const char *isa)
+{
+    if (0 == strcmp(isa, "sse41")) {
+        return parasail_can_use_sse41();
+    }
+    if (0 == strcmp(isa, "avx2")) {
+        return parasail_can_use_avx2();
+    }
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    char **sequences = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int query = 0;
+    int function_index = 0;
+    int gap_index = 0;
+    unsigned long errors = 0;
+    unsigned long saturated = 0;
+    const parasail_matrix_t *matrix = &parasail_blosum62;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s sequences.fasta\n", argv[0]);
+        return 1;
+    }
+
+    parse_sequences(argv[1], &sequences, &sizes, &count);
+    printf("%d sequences read\n", count);
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const batch_info_t *f = &functions[function_index];
+        if (!isa_supported(f->isa)) {
+            continue;
+        }
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            int open = gap_scores[gap_index].open;
+            int extend = gap_scores[gap_index].extend;
+            for (query=0; query<count; ++query) {
+                int i = 0;
+                parasail_result_t **results = f->pointer(
+                        sequences[query], sizes[query],
+                        (const char * const *)sequences, sizes, count,
+                        open, extend, matrix);
+                for (i=0; i<count; ++i) {
+                    parasail_result_t *reference = f->reference(
+                            sequences[query], sizes[query],
+                            sequences[i], sizes[i],
+                            open, extend, matrix);
+                    if (results[i]->saturated) {
+                        /* no point in comparing a result that saturated */
+                        ++saturated;
+                    }
+                    else if (reference->score != results[i]->score
+                            || reference->end_query != results[i]->end_query
+                            || reference->end_ref != results[i]->end_ref) {
+                        printf("%s(%d,%d,%d,%d) wrong result "
+                                "(%d,%d,%d != %d,%d,%d)\n",
+                                f->name, query, i, open, extend,
+                                reference->score,
+                                reference->end_query,
+                                reference->end_ref,
+                                results[i]->score,
+                                results[i]->end_query,
+                                results[i]->end_ref);
+                        ++errors;
+                    }
+                    parasail_result_free(reference);
+                }
+                parasail_result_free_batch(results, count);
+            }
+        }
+    }
+
+    /* an empty database sequence between two others costs nw a gap the
+     * length of the query and scores 0 for sg and sw */
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const batch_info_t *f = &functions[function_index];
+        const char *s2s[3];
+        int s2Lens[3];
+        int open = gap_scores[0].open;
+        int extend = gap_scores[0].extend;
+        int expected = 0;
+        int end_query = 0;
+        parasail_result_t **results = NULL;
+        if (!isa_supported(f->isa)) {
+            continue;
+        }
+        s2s[0] = sequences[0];
+        s2Lens[0] = sizes[0];
+        s2s[1] = "";
+        s2Lens[1] = 0;
+        s2s[2] = sequences[count-1];
+        s2Lens[2] = sizes[count-1];
+        if (parasail_nw == f->reference) {
+            expected = -open - (sizes[0]-1)*extend;
+            end_query = sizes[0]-1;
+        }
+        results = f->pointer(sequences[0], sizes[0],
+                s2s, s2Lens, 3, open, extend, matrix);
+        if (results[1]->saturated) {
+            ++saturated;
+        }
+        else if (expected != results[1]->score
+                || end_query != results[1]->end_query) {
+            printf("%s empty sequence wrong result (%d,%d != %d,%d)\n",
+                    f->name, expected, end_query,
+                    results[1]->score, results[1]->end_query);
+            ++errors;
+        }
+        parasail_result_free_batch(results, 3);
+    }
+
+    printf("%lu errors, %lu saturated\n", errors, saturated);
+
+    for (query=0; query<count; ++query) {
+        free(sequences[query]);
+    }
+    free(sequences);
+    free(sizes);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,320 @@
+#include "config.h"
+
+/* strdup needs _POSIX_C_SOURCE 200809L */
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "kseq.h"
+KSEQ_INIT(int, read)
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/matrices/blosum62.h"
+
+typedef struct gap_score {
+    int open;
+    int extend;
+} gap_score_t;
+
+gap_score_t gap_scores[] = {
+    {10,1},
+    {10,2},
+    {14,2},
+    {40,2},
+    {INT_MIN,INT_MIN}
+};
+
+typedef struct trace_info {
+    parasail_function_t *pointer;
+    parasail_function_t *reference;
+    const char *name;
+    const char *isa;
+} trace_info_t;
+
+static trace_info_t functions[] = {
+    {parasail_nw_trace,                     parasail_nw_trace, "parasail_nw_trace",                     "novec"},
+    {parasail_sg_trace,                     parasail_sg_trace, "parasail_sg_trace",                     "novec"},
+    {parasail_sw_trace,                     parasail_sw_trace, "parasail_sw_trace",                     "novec"},
+#if HAVE_SSE41
+    {parasail_nw_trace_scan_sse41_128_32,   parasail_nw_trace, "parasail_nw_trace_scan_sse41_128_32",   "sse41"},
+    {parasail_nw_trace_scan_sse41_128_16,   parasail_nw_trace, "parasail_nw_trace_scan_sse41_128_16",   "sse41"},
+    {parasail_nw_trace_scan_sse41_128_8,    parasail_nw_trace, "parasail_nw_trace_scan_sse41_128_8",    "sse41"},
+    {parasail_nw_trace_scan_sse41_128_sat,  parasail_nw_trace, "parasail_nw_trace_scan_sse41_128_sat",  "sse41"},
+    {parasail_sg_trace_scan_sse41_128_32,   parasail_sg_trace, "parasail_sg_trace_scan_sse41_128_32",   "sse41"},
+    {parasail_sg_trace_scan_sse41_128_16,   parasail_sg_trace, "parasail_sg_trace_scan_sse41_128_16",   "sse41"},
+    {parasail_sg_trace_scan_sse41_128_8,    parasail_sg_trace, "parasail_sg_trace_scan_sse41_128_8",    "sse41"},
+    {parasail_sg_trace_scan_sse41_128_sat,  parasail_sg_trace, "parasail_sg_trace_scan_sse41_128_sat",  "sse41"},
+    {parasail_sw_trace_scan_sse41_128_32,   parasail_sw_trace, "parasail_sw_trace_scan_sse41_128_32",   "sse41"},
+    {parasail_sw_trace_scan_sse41_128_16,   parasail_sw_trace, "parasail_sw_trace_scan_sse41_128_16",   "sse41"},
+    {parasail_sw_trace_scan_sse41_128_8,    parasail_sw_trace, "parasail_sw_trace_scan_sse41_128_8",    "sse41"},
+    {parasail_sw_trace_scan_sse41_128_sat,  parasail_sw_trace, "parasail_sw_trace_scan_sse41_128_sat",  "sse41"},
+#endif
+#if HAVE_AVX2
+    {parasail_nw_trace_scan_avx2_256_32,    parasail_nw_trace, "parasail_nw_trace_scan_avx2_256_32",    "avx2"},
+    {parasail_nw_trace_scan_avx2_256_16,    parasail_nw_trace, "parasail_nw_trace_scan_avx2_256_16",    "avx2"},
+    {parasail_nw_trace_scan_avx2_256_8,     parasail_nw_trace, "parasail_nw_trace_scan_avx2_256_8",     "avx2"},
+    {parasail_nw_trace_scan_avx2_256_sat,   parasail_nw_trace, "parasail_nw_trace_scan_avx2_256_sat",   "avx2"},
+    {parasail_sg_trace_scan_avx2_256_32,    parasail_sg_trace, "parasail_sg_trace_scan_avx2_256_32",    "avx2"},
+    {parasail_sg_trace_scan_avx2_256_16,    parasail_sg_trace, "parasail_sg_trace_scan_avx2_256_16",    "avx2"},
+    {parasail_sg_trace_scan_avx2_256_8,     parasail_sg_trace, "parasail_sg_trace_scan_avx2_256_8",     "avx2"},
+    {parasail_sg_trace_scan_avx2_256_sat,   parasail_sg_trace, "parasail_sg_trace_scan_avx2_256_sat",   "avx2"},
+    {parasail_sw_trace_scan_avx2_256_32,    parasail_sw_trace, "parasail_sw_trace_scan_avx2_256_32",    "avx2"},
+    {parasail_sw_trace_scan_avx2_256_16,    parasail_sw_trace, "parasail_sw_trace_scan_avx2_256_16",    "avx2"},
+    {parasail_sw_trace_scan_avx2_256_8,     parasail_sw_trace, "parasail_sw_trace_scan_avx2_256_8",     "avx2"},
+    {parasail_sw_trace_scan_avx2_256_sat,   parasail_sw_trace, "parasail_sw_trace_scan_avx2_256_sat",   "avx2"},
+#endif
+    {parasail_nw_trace_scan_sat,            parasail_nw_trace, "parasail_nw_trace_scan_sat",            "disp"},
+    {parasail_sg_trace_scan_sat,            parasail_sg_trace, "parasail_sg_trace_scan_sat",            "disp"},
+    {parasail_sw_trace_scan_sat,            parasail_sw_trace, "parasail_sw_trace_scan_sat",            "disp"},
+    {NULL, NULL, NULL, NULL}
+};
+
+static void parse_sequences(
+        const char *filename,
+        char ***strings_,
+        int **sizes_,
+        int *count_)
+{
+    FILE* fp;
+    kseq_t *seq = NULL;
+    int l = 0;
+    char **strings = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int memory = 1000;
+
+    fp = fopen(filename, "r");
+    if(fp == NULL) {
+        perror("fopen");
+        exit(1);
+    }
+    strings = malloc(sizeof(char*) * memory);
+    sizes = malloc(sizeof(int) * memory);
+    seq = kseq_init(fileno(fp));
+    while ((l = kseq_read(seq)) >= 0) {
+        strings[count] = strdup(seq->seq.s);
+        if (NULL == strings[count]) {
+            perror("strdup");
+            exit(1);
+        }
+        sizes[count] = seq->seq.l;
+        ++count;
+        if (count >= memory) {
+            memory *= 2;
+            strings = realloc(strings, sizeof(char*) * memory);
+            sizes = realloc(sizes, sizeof(int) * memory);
+            if (NULL == strings || NULL == sizes) {
+                perror("realloc");
+                exit(1);
+            }
+        }
+    }
+    kseq_destroy(seq);
+    fclose(fp);
+
+    *strings_ = strings;
+    *sizes_ = sizes;
+    *count_ = count;
+}
+
+static int isa_supported(const char *isa)
+{
+    if (0 == strcmp(isa, "sse41")) {
+        return parasail_can_use_sse41();
+    }
+    if (0 == strcmp(isa, "avx2")) {
+        return parasail_can_use_avx2();
+    }
+    return 1;
+}
+
+/* score of an alignment as printed by the traceback; with free_ends,
+ * the leading and trailing gap of a semi-global alignment cost nothing */
+static int rescore(
+        const parasail_traceback_t *traceback,
+        int open, int extend, int free_ends,
+        const parasail_matrix_t *matrix)
+{
+    const char *q = traceback->query;
+    const char *r = traceback->ref;
+    int len = (int)strlen(q);
+    int first = 0;
+    int last = len-1;
+    int score = 0;
+    int i = 0;
+
+    if (free_ends && first < len) {
+        const char *s = '-' == q[first] ? q : r;
+        while (first < len && '-' == s[first]) {
+            ++first;
+        }
+    }
+    if (free_ends && last >= first) {
+        const char *s = '-' == q[last] ? q : r;
+        while (last >= first && '-' == s[last]) {
+            --last;
+        }
+    }
+    for (i=first; i<=last; ++i) {
+        if ('-' == q[i]) {
+            score -= (i > first && '-' == q[i-1]) ? extend : open;
+        }
+        else if ('-' == r[i]) {
+            score -= (i > first && '-' == r[i-1]) ? extend : open;
+        }
+        else {
+            score += matrix->matrix[
+                matrix->size*matrix->mapper[(unsigned char)q[i]]
+                + matrix->mapper[(unsigned char)r[i]]];
+        }
+    }
+    return score;
+}
+
+/* whether the ops of cigar consume exactly the letters between its
+ * begin and end coordinates */
+static int cigar_spans(const parasail_cigar_t *cigar)
+{
+    int query = 0;
+    int ref = 0;
+    int i = 0;
+    for (i=0; i<cigar->len; ++i) {
+        char op = parasail_cigar_decode_op(cigar->seq[i]);
+        int len = (int)parasail_cigar_decode_len(cigar->seq[i]);
+        if ('D' != op) {
+            query += len;
+        }
+        if ('I' != op) {
+            ref += len;
+        }
+    }
+    return query == cigar->end_query - cigar->beg_query + 1
+        && ref == cigar->end_ref - cigar->beg_ref + 1;
+}
+
+int main(int argc, char **argv)
+{
+    char **sequences = NULL;
+    int *sizes = NULL;
+    int count = 0;
+    int query = 0;
+    int function_index = 0;
+    int gap_index = 0;
+    unsigned long errors = 0;
+    unsigned long saturated = 0;
+    const parasail_matrix_t *matrix = &parasail_blosum62;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s sequences.fasta\n", argv[0]);
+        return 1;
+    }
+
+    parse_sequences(argv[1], &sequences, &sizes, &count);
+    printf("%d sequences read\n", count);
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const trace_info_t *f = &functions[function_index];
+        const int free_ends = NULL != strstr(f->name, "sg");
+        if (!isa_supported(f->isa)) {
+            continue;
+        }
+        printf("checking %s\n", f->name);
+        for (gap_index=0; INT_MIN!=gap_scores[gap_index].open; ++gap_index) {
+            int open = gap_scores[gap_index].open;
+            int extend = gap_scores[gap_index].extend;
+            for (query=0; query<count; ++query) {
+                int i = 0;
+                for (i=0; i<count; ++i) {
+                    parasail_result_t *reference = f->reference(
+                            sequences[query], sizes[query],
+                            sequences[i], sizes[i],
+                            open, extend, matrix);
+                    parasail_result_t *result = f->pointer(
+                            sequences[query], sizes[query],
+                            sequences[i], sizes[i],
+                            open, extend, matrix);
+                    parasail_traceback_t *expected = parasail_result_get_traceback(
+                            reference, sequences[query], sizes[query],
+                            sequences[i], sizes[i], matrix, '|', ':', '.');
+                    parasail_traceback_t *traceback = parasail_result_get_traceback(
+                            result, sequences[query], sizes[query],
+                            sequences[i], sizes[i], matrix, '|', ':', '.');
+                    parasail_cigar_t *cigar = parasail_result_get_cigar(
+                            result, sequences[query], sizes[query],
+                            sequences[i], sizes[i]);
+                    if (result->saturated) {
+                        /* no point in comparing a result that saturated */
+                        if (NULL != traceback) {
+                            printf("%s(%d,%d,%d,%d) traceback of saturated result\n",
+                                    f->name, query, i, open, extend);
+                            ++errors;
+                        }
+                        ++saturated;
+                    }
+                    else if (reference->score != result->score
+                            || reference->end_query != result->end_query
+                            || reference->end_ref != result->end_ref) {
+                        printf("%s(%d,%d,%d,%d) wrong result "
+                                "(%d,%d,%d != %d,%d,%d)\n",
+                                f->name, query, i, open, extend,
+                                reference->score,
+                                reference->end_query,
+                                reference->end_ref,
+                                result->score,
+                                result->end_query,
+                                result->end_ref);
+                        ++errors;
+                    }
+                    else if (rescore(traceback, open, extend, free_ends, matrix)
+                                != result->score) {
+                        printf("%s(%d,%d,%d,%d) traceback scores %d, not %d\n",
+                                f->name, query, i, open, extend,
+                                rescore(traceback, open, extend, free_ends, matrix),
+                                result->score);
+                        ++errors;
+                    }
+                    else if (!cigar_spans(cigar)) {
+                        printf("%s(%d,%d,%d,%d) cigar does not span the alignment\n",
+                                f->name, query, i, open, extend);
+                        ++errors;
+                    }
+                    else if (0 != strcmp(expected->query, traceback->query)
+                            || 0 != strcmp(expected->comp, traceback->comp)
+                            || 0 != strcmp(expected->ref, traceback->ref)) {
+                        printf("%s(%d,%d,%d,%d) wrong traceback\n",
+                                f->name, query, i, open, extend);
+                        ++errors;
+                    }
+                    if (NULL != traceback) {
+                        parasail_traceback_free(traceback);
+                    }
+                    if (NULL != cigar) {
+                        parasail_cigar_free(cigar);
+                    }
+                    parasail_traceback_free(expected);
+                    parasail_result_free(result);
+                    parasail_result_free(reference);
+                }
+            }
+        }
+    }
+
+    printf("%lu errors, %lu saturated\n", errors, saturated);
+
+    for (query=0; query<count; ++query) {
+        free(sequences[query]);
+    }
+    free(sequences);
+    free(sizes);
+
+    return errors ? 1 : 0;
+}
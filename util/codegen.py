@@ -57,6 +57,42 @@ bias_templates = [
 "sw_stats_striped_bias.c",
 ]
 
+swipe_templates = [
+"nw_swipe.c",
+"sg_swipe.c",
+"sw_swipe.c",
+]
+
+banded_templates = [
+"nw_banded.c",
+"sg_banded.c",
+"sw_banded.c",
+]
+
+trace_templates = [
+"nw_trace_scan.c",
+"sg_trace_scan.c",
+"sw_trace_scan.c",
+]
+
+blocked_templates = [
+"nw_blocked.c",
+"sg_blocked.c",
+"sw_blocked.c",
+]
+
+short_templates = [
+"nw_short.c",
+"sg_short.c",
+"sw_short.c",
+]
+
+packed_templates = [
+"nw_packed.c",
+"sg_packed.c",
+"sw_packed.c",
+]
+
 
 output_dir = "generated/"
 if not os.path.exists(output_dir):
@@ -93,7 +129,10 @@ def generate_printer(params):
                 bias_rowcol += "    col[%(LANE)2d*seglen+t] = (%(INT)s)%(VEXTRACT)s(vH, %(LANE)2d) - bias;\n" % params
             else:
                 bias_rowcol += "    col[%(LANE)s*seglen+t] = (%(INT)s)%(VEXTRACT)s(vH, %(LANE)s) - bias;\n" % params
-    elif "diag" in params["NAME"]:
+    elif ("swipe" in params["NAME"] or "blocked" in params["NAME"]
+            or "short" in params["NAME"] or "packed" in params["NAME"]):
+        pass
+    elif "diag" in params["NAME"] or "banded" in params["NAME"]:
         for lane in range(params["LANES"]):
             params["LANE"] = lane
             params["LANE_END"] = params["LANES"]-lane-1
@@ -119,9 +158,355 @@ def generate_printer(params):
     params["PRINTER_BIAS"] = bias[:-1] # remove last newline
     params["PRINTER_ROWCOL"] = rowcol[:-1] # remove last newline
     params["PRINTER_BIAS_ROWCOL"] = bias_rowcol[:-1] # remove last newline
+    params = generate_printer_table(params)
+    return params
+
+
+def generate_printer_table(params):
+    # Striped and scan tables are written a block of four columns at a
+    # time.  Each column vector is split into 128-bit halves, widened to
+    # 32-bit lanes and the four columns are transposed 4x4 with unpacks so
+    # that every query position receives four adjacent table entries.
+    # Narrow tables keep the kernel's 16 or 8 bits and skip the widening.
+    width = params["WIDTH"]
+    if width in [16,8]:
+        params["TABLE_TYPE"] = "PARASAIL_TABLE_INT%d" % width
+        params["TABLE_TYPE_BIAS"] = "PARASAIL_TABLE_UINT%d" % width
+    else:
+        params["TABLE_TYPE"] = "PARASAIL_TABLE_INT"
+        params["TABLE_TYPE_BIAS"] = "PARASAIL_TABLE_INT"
+    if "striped" not in params["NAME"] and "scan" not in params["NAME"]:
+        params["PRINTER_TABLE"] = ""
+        params["PRINTER_TABLE_BIAS"] = ""
+        return params
+    params["PRINTER_TABLE"] = generate_printer_table_text(params, False)
+    params["PRINTER_TABLE_BIAS"] = generate_printer_table_text(params, True)
     return params
 
 
+def generate_table_halves(params):
+    if params["BITS"] == 256:
+        return ["_mm256_castsi256_si128(vH)",
+                "_mm256_extracti128_si256(vH, 1)"]
+    return ["vH"]
+
+
+def generate_printer_block(params, args, biased):
+    width = params["WIDTH"]
+    if width == 64:
+        return """
+    arr_store_si%(BITS)s(array, buf[         t], t, seglen, d,   dlen%(BIAS_ARG)s);
+    arr_store_si%(BITS)s(array, buf[  seglen+t], t, seglen, d+1, dlen%(BIAS_ARG)s);
+    arr_store_si%(BITS)s(array, buf[2*seglen+t], t, seglen, d+2, dlen%(BIAS_ARG)s);
+    arr_store_si%(BITS)s(array, buf[3*seglen+t], t, seglen, d+3, dlen%(BIAS_ARG)s);""" % args
+    halves = generate_table_halves(params)
+    widen = ""
+    chunk = 0
+    for half in halves:
+        if len(halves) > 1:
+            widen += "        h = %s;\n" % half
+            half = "h"
+        if width == 32:
+            parts = [half]
+        elif width == 16:
+            parts = ["_mm_srai_epi32(_mm_unpacklo_epi16(%s, %s), 16)" % (half,half),
+                     "_mm_srai_epi32(_mm_unpackhi_epi16(%s, %s), 16)" % (half,half)]
+        else:
+            # widen each half of the bytes through w before the next
+            parts = []
+            for unpack in ["_mm_unpacklo_epi8", "_mm_unpackhi_epi8"]:
+                widen += "        w = %s(%s, %s);\n" % (unpack, half, half)
+                for part in ["_mm_srai_epi32(_mm_unpacklo_epi16(w, w), 24)",
+                             "_mm_srai_epi32(_mm_unpackhi_epi16(w, w), 24)"]:
+                    if biased:
+                        part = "_mm_sub_epi32(%s, vBias)" % part
+                    widen += "        x[c][%d] = %s;\n" % (chunk, part)
+                    chunk += 1
+        for part in parts:
+            if biased:
+                part = "_mm_sub_epi32(%s, vBias)" % part
+            widen += "        x[c][%d] = %s;\n" % (chunk, part)
+            chunk += 1
+    decl = ""
+    if len(halves) > 1:
+        decl += "        __m128i h;\n"
+    if width == 8:
+        decl += "        __m128i w;\n"
+    args = dict(args)
+    args["CHUNKS"] = chunk
+    args["DECL"] = decl
+    args["WIDEN"] = widen
+    args["BIAS_DECL"] = ""
+    if biased:
+        args["BIAS_DECL"] = "    const __m128i vBias = _mm_set1_epi32(bias);\n"
+    return """
+    __m128i x[4][%(CHUNKS)d];
+%(BIAS_DECL)s    %(INDEX)s c = 0;
+    %(INDEX)s k = 0;
+    for (c=0; c<4; ++c) {
+        %(VTYPE)s vH = %(VLOAD)s(buf + c*seglen + t);
+%(DECL)s%(WIDEN)s    }
+    for (k=0; k<%(CHUNKS)d; ++k) {
+        __m128i t0 = _mm_unpacklo_epi32(x[0][k], x[1][k]);
+        __m128i t1 = _mm_unpacklo_epi32(x[2][k], x[3][k]);
+        __m128i t2 = _mm_unpackhi_epi32(x[0][k], x[1][k]);
+        __m128i t3 = _mm_unpackhi_epi32(x[2][k], x[3][k]);
+        int *row = array + (4*k*seglen+t)*dlen + d;
+        _mm_storeu_si128((__m128i*)(row), _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + seglen*dlen), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(row + 2*seglen*dlen), _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128((__m128i*)(row + 3*seglen*dlen), _mm_unpackhi_epi64(t2, t3));
+    }""" % args
+
+
+def generate_printer_narrow(params, args, biased):
+    # per-lane and block writers for tables kept in the kernel's width
+    width = params["WIDTH"]
+    lanes = params["LANES"]
+    halves = generate_table_halves(params)
+    args = dict(args)
+    lane_text = ""
+    for lane in range(lanes):
+        value = "%s(vH, %d)" % (params["VEXTRACT"], lane)
+        if biased:
+            value = "(%s - bias)" % value
+        lane_text += "    table[(%d*seglen+t)*dlen + d] = (%s)%s;\n" % (
+                lane, args["STYPE"], value)
+    args["LANE_TEXT"] = lane_text.rstrip("\n")
+    load = ""
+    for n,half in enumerate(halves):
+        if biased:
+            half = "_mm_sub_epi%d(%s, vBias)" % (width, half)
+        load += "        x[c][%d] = %s;\n" % (n, half)
+    args["LOAD"] = load
+    args["HALVES"] = len(halves)
+    args["BIAS_DECL"] = ""
+    if biased:
+        args["BIAS_DECL"] = "    const __m128i vBias = _mm_set1_epi%d((int%d_t)bias);\n" % (width, width)
+    if width == 16:
+        # four adjacent 16-bit entries per lane, two lanes per register
+        store = ""
+        for lane in range(8):
+            src = "r%d" % (lane/2)
+            if lane % 2:
+                src = "_mm_srli_si128(%s, 8)" % src
+            offset = "row" if lane == 0 else "row + %d*seglen*dlen" % lane
+            if lane == 1:
+                offset = "row + seglen*dlen"
+            store += "        _mm_storel_epi64((__m128i*)(%s), %s);\n" % (offset, src)
+        args["TRANSPOSE"] = """
+        __m128i a = _mm_unpacklo_epi16(x[0][k], x[1][k]);
+        __m128i b = _mm_unpacklo_epi16(x[2][k], x[3][k]);
+        __m128i e = _mm_unpackhi_epi16(x[0][k], x[1][k]);
+        __m128i f = _mm_unpackhi_epi16(x[2][k], x[3][k]);
+        __m128i r0 = _mm_unpacklo_epi32(a, b);
+        __m128i r1 = _mm_unpackhi_epi32(a, b);
+        __m128i r2 = _mm_unpacklo_epi32(e, f);
+        __m128i r3 = _mm_unpackhi_epi32(e, f);
+        %(STYPE)s *row = table + (8*k*seglen+t)*dlen + d;
+""".lstrip("\n") % args + store
+    else:
+        # four adjacent 8-bit entries per lane, four lanes per register
+        store = ""
+        for lane in range(16):
+            src = "r%d" % (lane/4)
+            if lane % 4:
+                src = "_mm_srli_si128(%s, %d)" % (src, 4*(lane%4))
+            offset = "row" if lane == 0 else "row + %d*seglen*dlen" % lane
+            if lane == 1:
+                offset = "row + seglen*dlen"
+            store += "        v = _mm_cvtsi128_si32(%s);\n" % src
+            store += "        memcpy(%s, &v, sizeof(v));\n" % offset
+        args["TRANSPOSE"] = """
+        __m128i a = _mm_unpacklo_epi8(x[0][k], x[1][k]);
+        __m128i b = _mm_unpacklo_epi8(x[2][k], x[3][k]);
+        __m128i e = _mm_unpackhi_epi8(x[0][k], x[1][k]);
+        __m128i f = _mm_unpackhi_epi8(x[2][k], x[3][k]);
+        __m128i r0 = _mm_unpacklo_epi16(a, b);
+        __m128i r1 = _mm_unpackhi_epi16(a, b);
+        __m128i r2 = _mm_unpacklo_epi16(e, f);
+        __m128i r3 = _mm_unpackhi_epi16(e, f);
+        %(STYPE)s *row = table + (16*k*seglen+t)*dlen + d;
+        int32_t v = 0;
+""".lstrip("\n") % args + store
+    args["TRANSPOSE"] = args["TRANSPOSE"].rstrip("\n")
+    args["LANES_PER_HALF"] = lanes / len(halves)
+    return """
+static inline void arr_store_si%(BITS)s_narrow(
+        void *array,
+        %(VTYPE)s vH,
+        %(INDEX)s t,
+        %(INDEX)s seglen,
+        %(INDEX)s d,
+        %(INDEX)s dlen%(BIAS_PARAM)s
+{
+    %(STYPE)s *table = (%(STYPE)s*)array;
+%(LANE_TEXT)s
+}
+
+static inline void arr_store_block_narrow(
+        void *array,
+        const %(VTYPE)s *buf,
+        %(INDEX)s t,
+        %(INDEX)s seglen,
+        %(INDEX)s d,
+        %(INDEX)s dlen%(BIAS_PARAM)s
+{
+    %(STYPE)s *table = (%(STYPE)s*)array;
+    __m128i x[4][%(HALVES)d];
+%(BIAS_DECL)s    %(INDEX)s c = 0;
+    %(INDEX)s k = 0;
+    for (c=0; c<4; ++c) {
+        %(VTYPE)s vH = %(VLOAD)s(buf + c*seglen + t);
+%(LOAD)s    }
+    for (k=0; k<%(HALVES)d; ++k) {
+%(TRANSPOSE)s
+    }
+}
+""".strip("\n") % args
+
+
+def generate_printer_table_text(params, biased):
+    width = params["WIDTH"]
+    args = {"BITS":params["BITS"], "INDEX":params["INDEX"],
+            "VTYPE":params["VTYPE"], "VLOAD":params["VLOAD"],
+            "VSTORE":params["VSTORE"], "INT":params["INT"],
+            "LANES":params["LANES"]}
+    if biased:
+        args["BIAS_PARAM"] = ",\n        %(INDEX)s bias)" % args
+        args["BIAS_ARG"] = ", bias"
+        args["BIAS_SUB"] = " - bias"
+        args["STYPE"] = "uint%d_t" % width
+    else:
+        args["BIAS_PARAM"] = ")"
+        args["BIAS_ARG"] = ""
+        args["BIAS_SUB"] = ""
+        args["STYPE"] = "int%d_t" % width
+    args["BLOCK"] = generate_printer_block(params, args, biased).strip("\n")
+    if width in [16,8]:
+        args["NARROW"] = generate_printer_narrow(params, args, biased) + "\n\n"
+        args["STORE_BLOCK"] = """
+        if (PARASAIL_TABLE_INT == result->table_type) {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block(array, buf, t, seglen, d-3, dlen%(BIAS_ARG)s);
+            }
+        }
+        else {
+            for (t=0; t<seglen; ++t) {
+                arr_store_block_narrow(array, buf, t, seglen, d-3, dlen%(BIAS_ARG)s);
+            }
+        }""".strip("\n") % args
+        args["STORE_LANES"] = """
+            if (PARASAIL_TABLE_INT == result->table_type) {
+                arr_store_si%(BITS)s(array, buf[k*seglen+t], t, seglen, d-c+k, dlen%(BIAS_ARG)s);
+            }
+            else {
+                arr_store_si%(BITS)s_narrow(array, buf[k*seglen+t], t, seglen, d-c+k, dlen%(BIAS_ARG)s);
+            }""".strip("\n") % args
+        args["STORE_CELL"] = """
+        if (PARASAIL_TABLE_INT == type) {
+            array[index] = value;
+        }
+        else {
+            ((%(STYPE)s*)array)[index] = (%(STYPE)s)value;
+        }""".strip("\n") % args
+    else:
+        # the table is never narrower than the kernel
+        args["NARROW"] = ""
+        args["STORE_BLOCK"] = """
+        for (t=0; t<seglen; ++t) {
+            arr_store_block(array, buf, t, seglen, d-3, dlen%(BIAS_ARG)s);
+        }""".strip("\n") % args
+        args["STORE_LANES"] = """
+            arr_store_si%(BITS)s(array, buf[k*seglen+t], t, seglen, d-c+k, dlen%(BIAS_ARG)s);""".strip("\n") % args
+        args["STORE_CELL"] = """
+        array[index] = value;""".strip("\n")
+    return """
+/* transpose vector t of four buffered columns into the table so that each
+ * query position receives the four adjacent entries d..d+3 */
+static inline void arr_store_block(
+        int *array,
+        const %(VTYPE)s *buf,
+        %(INDEX)s t,
+        %(INDEX)s seglen,
+        %(INDEX)s d,
+        %(INDEX)s dlen%(BIAS_PARAM)s
+{
+%(BLOCK)s
+}
+
+%(NARROW)s/* write the rows of column d inside window to a table holding only the
+ * window; the cells are read in place, windows are meant to be small */
+static inline void arr_store_window(
+        int *array,
+        const %(VTYPE)s *column,
+        %(INDEX)s seglen,
+        %(INDEX)s d,
+        const parasail_window_t *window,
+        int type%(BIAS_PARAM)s
+{
+    const %(INT)s *v = (const %(INT)s*)column;
+    %(INDEX)s cols = window->ref_end - window->ref_begin;
+    %(INDEX)s i = 0;
+    if (d < window->ref_begin || d >= window->ref_end) {
+        return;
+    }
+    for (i=window->query_begin; i<window->query_end; ++i) {
+        size_t index = (size_t)(i-window->query_begin)*cols + (d-window->ref_begin);
+        int value = (int)v[(i%%seglen)*%(LANES)s + i/seglen]%(BIAS_SUB)s;
+%(STORE_CELL)s
+    }
+}
+
+/* buffer column d; the table, of PARASAIL_TABLE_* type, is written
+ * once four columns are buffered */
+static inline void arr_store_table(
+        int *array,
+        %(VTYPE)s *buf,
+        const %(VTYPE)s *column,
+        %(INDEX)s seglen,
+        %(INDEX)s d,
+        %(INDEX)s dlen,
+        const parasail_result_t *result%(BIAS_PARAM)s
+{
+    %(INDEX)s c = d %% 4;
+    %(INDEX)s t = 0;
+    if (result->window.query_end) {
+        arr_store_window(array, column, seglen, d, &result->window,
+                result->table_type%(BIAS_ARG)s);
+        return;
+    }
+    for (t=0; t<seglen; ++t) {
+        %(VSTORE)s(buf + c*seglen + t, %(VLOAD)s(column + t));
+    }
+    if (3 == c) {
+%(STORE_BLOCK)s
+    }
+}
+
+/* write the columns still buffered when the loop ended before column d */
+static inline void arr_store_table_end(
+        int *array,
+        const %(VTYPE)s *buf,
+        %(INDEX)s seglen,
+        %(INDEX)s d,
+        %(INDEX)s dlen,
+        const parasail_result_t *result%(BIAS_PARAM)s
+{
+    %(INDEX)s c = d %% 4;
+    %(INDEX)s k = 0;
+    %(INDEX)s t = 0;
+    if (result->window.query_end) {
+        return;
+    }
+    for (k=0; k<c; ++k) {
+        for (t=0; t<seglen; ++t) {
+%(STORE_LANES)s
+        }
+    }
+}""".strip("\n") % args
+
+
 def generate_saturation_check_old(params):
     width = params["WIDTH"]
     if width == 8:
@@ -176,6 +561,11 @@ def generate_saturation_check_old(params):
         params["STATS_SATURATION_CHECK_INIT"] = ""
         params["STATS_SATURATION_CHECK_MID"] = ""
         params["STATS_SATURATION_CHECK_FINAL"] = ""
+        params["SWIPE_SATURATION_CHECK_INIT"] = ""
+        params["SWIPE_SATURATION_CHECK_RESET"] = ""
+        params["SWIPE_SATURATION_CHECK_MID"] = ""
+        params["SWIPE_SATURATION_CHECK_LANES"] = ""
+        params["SWIPE_SATURATION_CHECK_FINAL"] = ""
     return params
 
 
@@ -272,6 +662,37 @@ def generate_saturation_check(params):
         end_ref = 0;
     }""".strip() % params
 
+        params["SWIPE_SATURATION_CHECK_INIT"] = """
+    const int8_t NEG_LIMIT = (-open < matrix->min ?
+        INT8_MIN + open : INT8_MIN - matrix->min) + 1;
+    const int8_t POS_LIMIT = INT8_MAX - matrix->max - 1;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;""".strip() % params
+
+        params["SWIPE_SATURATION_CHECK_RESET"] = """
+                vSaturationCheckMin = %(VBLEND)s(
+                        vSaturationCheckMin, vPosLimit, mask.m);
+                vSaturationCheckMax = %(VBLEND)s(
+                        vSaturationCheckMax, vNegLimit, mask.m);""".strip() % params
+
+        params["SWIPE_SATURATION_CHECK_MID"] = """
+                /* check for saturation */
+                vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+                vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);""".strip() % params
+
+        params["SWIPE_SATURATION_CHECK_LANES"] = """
+            %(VTYPE)s_8_t satmin;
+            %(VTYPE)s_8_t satmax;
+            satmin.m = vSaturationCheckMin;
+            satmax.m = vSaturationCheckMax;""".strip() % params
+
+        params["SWIPE_SATURATION_CHECK_FINAL"] = """
+                    if (satmin.v[l] < NEG_LIMIT || satmax.v[l] > POS_LIMIT) {
+                        saturated = 1;
+                    }""".strip() % params
+
         params["NEG_INF"] = "INT8_MIN"
         params["VADD"] = params["VADDSx8"]
         params["VSUB"] = params["VSUBSx8"]
@@ -291,6 +712,11 @@ def generate_saturation_check(params):
         params["STATS_SATURATION_CHECK_MID1"] = ""
         params["STATS_SATURATION_CHECK_MID2"] = ""
         params["STATS_SATURATION_CHECK_FINAL"] = ""
+        params["SWIPE_SATURATION_CHECK_INIT"] = ""
+        params["SWIPE_SATURATION_CHECK_RESET"] = ""
+        params["SWIPE_SATURATION_CHECK_MID"] = ""
+        params["SWIPE_SATURATION_CHECK_LANES"] = ""
+        params["SWIPE_SATURATION_CHECK_FINAL"] = ""
     return params
 
 
@@ -308,12 +734,57 @@ def generated_params_diag(params):
     params["DIAG_VS1"] = "                ".join(
             ["s1[i+%d],\n"%i
                 for i in range(lanes)])[:-2]
+    if ("avx" == params["ISA"] and "diag" in params["NAME"]
+            and params["WIDTH"] <= 16):
+        return generated_params_diag_gather(params)
     params["DIAG_MATROW_DECL"] = "        ".join(
             ["const int * const restrict matrow%d = &matrix->matrix[matrix->size*s1[i+%d]];\n"%(i,i)
                 for i in range(lanes)])[:-1]
     params["DIAG_MATROW_USE"] = "                    ".join(
             ["matrow%d[s2[j-%d]],\n"%(i,i)
                 for i in range(lanes)])[:-2]
+    params["DIAG_MAT"] = "vMat = %s(\n%s%s\n%s);" % (
+            params["VSETx%d" % params["WIDTH"]], " "*20,
+            params["DIAG_MATROW_USE"], " "*20)
+    return params
+
+
+def generated_params_diag_gather(params):
+    # Lane m of a diagonal vector pairs s1[i+N-1-m] with s2[j-N+1+m], so
+    # the matrix offsets are s1 row offsets, fixed for a block of rows,
+    # plus s2 letters loaded straight from memory. AVX2 gathers the
+    # entries eight lanes at a time and packs them, instead of assembling
+    # the 16 or 32 lanes one at a time. At 32 and 64 bits there are too
+    # few lanes for the gather to pay off.
+    lanes = params["LANES"]
+    width = params["WIDTH"]
+    decl = []
+    load = {
+        8: "_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(s2+j-PAD%s)))",
+        16: "_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(s2+j-PAD%s)))",
+    }[width]
+    chunks = lanes / 8
+    for c in range(chunks):
+        decl.append("const __m256i vS1_%d = _mm256_set_epi32(\n%s);" % (c,
+            ",\n".join([" "*16 + "matrix->size*s1[i+%d]" % (lanes-8-8*c+k)
+                for k in range(8)])))
+    params["DIAG_MATROW_DECL"] = "\n        ".join(decl)
+    mat = []
+    for c in range(chunks):
+        mat.append("__m256i vMat%d = _mm256_i32gather_epi32(matrix->matrix,\n"
+                "                    _mm256_add_epi32(vS1_%d, %s), 4);" % (
+                    c, c, load % ("+%d" % (8*c) if c else "")))
+    if 16 == width:
+        mat.append("vMat = _mm256_permute4x64_epi64(\n"
+                "                    _mm256_packs_epi32(vMat0, vMat1), 0xD8);")
+    else:
+        mat.append("vMat = _mm256_packs_epi16(\n"
+                "                    _mm256_packs_epi32(vMat0, vMat1),\n"
+                "                    _mm256_packs_epi32(vMat2, vMat3));")
+        mat.append("vMat = _mm256_permutevar8x32_epi32(vMat,\n"
+                "                    _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));")
+    params["DIAG_MAT"] = "{\n" + "\n".join(
+            " "*16 + line for line in mat) + "\n            }"
     return params
 
 
@@ -387,7 +858,7 @@ def generated_params(template, params):
     params["LAST_POS"] = params["LANES"]-1
     params["INT"] = "int%(WIDTH)s_t" % params
     params["NEG_INF"] = "(INT%(WIDTH)s_MIN/(%(INT)s)(2))" % params
-    if "diag" in params["NAME"]:
+    if "diag" in params["NAME"] or "banded" in params["NAME"]:
         params = generated_params_diag(params)
     elif "striped" in params["NAME"]:
         params = generated_params_striped(params)
@@ -400,12 +871,19 @@ def generated_params(template, params):
             new_key = key.split('x')[0]
             params[new_key] = params[key]
     fixes = ""
+    included = []
     template_params = re.findall(r'%\([A-Za-z0-9]+\)s', template)
     for param in params:
         wrapped_param = r'%%(%s)s'%param
         if (wrapped_param in template_params
                 and str(params[param]).endswith("_rpl")):
             fixes += params[params[param]]
+            included.append(params[param])
+    # some fixes are written in terms of other fixes, define those first
+    for name in re.findall(r'_mm[0-9]*_[a-z0-9_]+_rpl', fixes):
+        if name in params and name not in included:
+            fixes = params[name] + fixes
+            included.append(name)
     params["FIXES"] = fixes
     params = generate_printer(params)
     params = generate_saturation_check(params)
@@ -548,3 +1026,276 @@ for template_filename in bias_templates:
             writer.write("\n")
             writer.close()
 
+
+# inter-sequence (swipe) templates only exist for score-only, sse41 and avx2
+for template_filename in swipe_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    for width in [32,16,8]:
+        for isa in [sse41,avx2]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params = generated_params(template, params)
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            writer = open(output_filename, "w")
+            writer.write(template % params)
+            writer.write("\n")
+            writer.close()
+
+
+# banded templates only exist for sse41 and avx2; out-of-band cells are
+# pinned at the most negative value, so both narrow widths saturate
+for template_filename in banded_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    parts = prefix.split('_')
+    table_prefix = "%s_table_%s" % (parts[0], parts[1])
+    rowcol_prefix = "%s_rowcol_%s" % (parts[0], parts[1])
+    for width in [32,16,8]:
+        for isa in [sse41,avx2]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_table_name = "%s_%s%s_%s_%s" % (table_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_rowcol_name = "%s_%s%s_%s_%s" % (rowcol_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params["NAME_TABLE"] = "parasail_"+function_table_name
+            params["NAME_ROWCOL"] = "parasail_"+function_rowcol_name
+            params = generated_params(template, params)
+            if width == 16:
+                params["NEG_INF"] = "INT16_MIN"
+                params["VADD"] = params["VADDSx16"]
+                params["VSUB"] = params["VSUBSx16"]
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            writer = open(output_filename, "w")
+            writer.write(template % params)
+            writer.write("\n")
+            writer.close()
+
+
+def generate_trace_store(params):
+    # one vector of four direction masks fills 4*LANES bits, so it is
+    # either two whole words, one whole word, or a part of one word
+    lanes = params["LANES"]
+    if lanes == 32:
+        text = """
+    bits[2*i]   = (uint64_t)m0 | (uint64_t)m1 << 32;
+    bits[2*i+1] = (uint64_t)m2 | (uint64_t)m3 << 32;"""
+    elif lanes == 16:
+        text = """
+    bits[i] = (uint64_t)m0 | (uint64_t)m1 << 16
+            | (uint64_t)m2 << 32 | (uint64_t)m3 << 48;"""
+    else:
+        per = 64/(4*lanes)
+        text = """
+    const uint64_t v = (uint64_t)m0 | (uint64_t)m1 << %(L1)d
+            | (uint64_t)m2 << %(L2)d | (uint64_t)m3 << %(L3)d;
+    const int32_t shift = (i %% %(PER)d) * %(L4)d;
+    if (0 == shift) {
+        bits[i/%(PER)d] = v;
+    }
+    else {
+        bits[i/%(PER)d] |= v << shift;
+    }""" % {"L1":lanes, "L2":2*lanes, "L3":3*lanes, "L4":4*lanes, "PER":per}
+    params["TRACE_STORE"] = text.strip("\n")
+    return params
+
+
+# traceback templates only exist for score-only, sse41 and avx2
+for template_filename in trace_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    for width in [32,16,8]:
+        for isa in [sse41,avx2]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params = generated_params(template, params)
+            params = generate_trace_store(params)
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            writer = open(output_filename, "w")
+            writer.write(template % params)
+            writer.write("\n")
+            writer.close()
+
+
+def generate_blocked_scan(template, lanes, nbytes):
+    # F within a block is a prefix max over the lanes, log2(lanes) steps
+    # of shifting by a doubling number of lanes; the steps are written
+    # into the template so that the fixes they need are found
+    steps = 0
+    text = ""
+    while (1 << steps) < lanes:
+        text += """
+            vF = %%(VMAX)s(vF, %%(VADD)s(%%(VSHIFT)s(vF, %d), vFront[%d]));""" % (
+                (1 << steps)*nbytes, steps)
+        steps += 1
+    template = template.replace("%(BLOCKED_SCAN)s", text.strip("\n"))
+    template = template.replace("%(BLOCKED_STEPS)s", str(steps))
+    # the last lane of the block above enters at lane 0
+    template = template.replace("%(CARRY_BYTES)s", str(16 - nbytes))
+    return template
+
+
+# blocked templates only exist for sse41 and avx2; the 16 bit kernels
+# saturate so that -inf stays put while gaps are subtracted from it
+for template_filename in blocked_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    parts = prefix.split('_')
+    prefix_prof = prefix + "_profile"
+    table_prefix = "%s_table_%s" % (parts[0], parts[1])
+    rowcol_prefix = "%s_rowcol_%s" % (parts[0], parts[1])
+    table_prefix_prof = table_prefix + "_profile"
+    rowcol_prefix_prof = rowcol_prefix + "_profile"
+    for width in [32,16]:
+        for isa in [sse41,avx2]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_table_name = "%s_%s%s_%s_%s" % (table_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_rowcol_name = "%s_%s%s_%s_%s" % (rowcol_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_pname = "%s_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_table_pname = "%s_%s%s_%s_%s" % (table_prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_rowcol_pname = "%s_%s%s_%s_%s" % (rowcol_prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params["NAME_TABLE"] = "parasail_"+function_table_name
+            params["NAME_ROWCOL"] = "parasail_"+function_rowcol_name
+            params["PNAME"] = "parasail_"+function_pname
+            params["PNAME_TABLE"] = "parasail_"+function_table_pname
+            params["PNAME_ROWCOL"] = "parasail_"+function_rowcol_pname
+            blocked = generate_blocked_scan(template,
+                    isa["BITS"]/width, width/8)
+            params = generated_params(blocked, params)
+            if width == 16:
+                params["NEG_INF"] = "INT16_MIN"
+                params["VADD"] = params["VADDSx16"]
+                params["VSUB"] = params["VSUBSx16"]
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            writer = open(output_filename, "w")
+            writer.write(blocked % params)
+            writer.write("\n")
+            writer.close()
+
+
+def generate_short_scan(template, lanes, nbytes):
+    # as in the blocked scan, but a step that changes no lane ends it:
+    # every longer step would only bring in cells already outweighed
+    steps = 0
+    text = "        do {"
+    while (1 << steps) < lanes:
+        text += """
+            vT = %%(VMAX)s(vF, %%(VADD)s(%%(VSHIFT)s(vF, %d), vFront[%d]));""" % (
+                (1 << steps)*nbytes, steps)
+        if (1 << (steps+1)) < lanes:
+            text += """
+            if (!%(VMOVEMASK)s(%(VCMPGT)s(vT, vF))) {
+                break;
+            }"""
+        text += """
+            vF = vT;"""
+        steps += 1
+    text += """
+        } while (0);"""
+    template = template.replace("%(SHORT_SCAN)s", text)
+    template = template.replace("%(BLOCKED_STEPS)s", str(steps))
+    template = template.replace("%(CARRY_BYTES)s", str(16 - nbytes))
+    return template
+
+
+# short templates keep a query of at most one vector in registers; they
+# reuse the striped profile and, with an early exit, the blocked F scan;
+# as with blocked the narrow kernels saturate
+for template_filename in short_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    parts = prefix.split('_')
+    prefix_prof = prefix + "_profile"
+    table_prefix = "%s_table_%s" % (parts[0], parts[1])
+    rowcol_prefix = "%s_rowcol_%s" % (parts[0], parts[1])
+    table_prefix_prof = table_prefix + "_profile"
+    rowcol_prefix_prof = rowcol_prefix + "_profile"
+    for width in [32,16,8]:
+        for isa in [sse41,avx2]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_table_name = "%s_%s%s_%s_%s" % (table_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_rowcol_name = "%s_%s%s_%s_%s" % (rowcol_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_pname = "%s_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_table_pname = "%s_%s%s_%s_%s" % (table_prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_rowcol_pname = "%s_%s%s_%s_%s" % (rowcol_prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params["NAME_TABLE"] = "parasail_"+function_table_name
+            params["NAME_ROWCOL"] = "parasail_"+function_rowcol_name
+            params["PNAME"] = "parasail_"+function_pname
+            params["PNAME_TABLE"] = "parasail_"+function_table_pname
+            params["PNAME_ROWCOL"] = "parasail_"+function_rowcol_pname
+            # longer queries fall back to the striped kernel
+            for suffix in ["", "_TABLE", "_ROWCOL"]:
+                params["SNAME"+suffix] = params["PNAME"+suffix].replace(
+                        "_short_", "_striped_")
+            short = generate_short_scan(template,
+                    isa["BITS"]/width, width/8)
+            params = generated_params(short, params)
+            if width < 32:
+                params["NEG_INF"] = "INT%d_MIN" % width
+                params["VADD"] = params["VADDSx%d" % width]
+                params["VSUB"] = params["VSUBSx%d" % width]
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            writer = open(output_filename, "w")
+            writer.write(short % params)
+            writer.write("\n")
+            writer.close()
+
+
+# packed templates run several short queries side by side in the lanes
+# of one vector; they are score only, like swipe, and only the narrow
+# widths leave room for more than one query
+for template_filename in packed_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    prefix_prof = prefix + "_profile"
+    for width in [16,8]:
+        for isa in [sse41,avx2]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_pname = "%s_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params["PNAME"] = "parasail_"+function_pname
+            # a query longer than a vector runs alone on the striped kernel
+            params["SNAME"] = params["NAME"].replace("_packed_", "_striped_")
+            packed = generate_short_scan(template,
+                    isa["BITS"]/width, width/8)
+            params = generated_params(packed, params)
+            params["NEG_INF"] = "INT%d_MIN" % width
+            params["VADD"] = params["VADDSx%d" % width]
+            params["VSUB"] = params["VSUBSx%d" % width]
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            writer = open(output_filename, "w")
+            writer.write(packed % params)
+            writer.write("\n")
+            writer.close()
@@ -4,6 +4,22 @@
 
 import os
 
+# algorithms with vectorized banded implementations; the global band
+# follows from the sequence lengths, the others are centered on diag
+banded_algs = {
+    "nw": ("parasail_kfunction_t", "const int k", "k"),
+    "sg": ("parasail_dfunction_t", "const int diag, const int k", "diag, k"),
+    "sw": ("parasail_dfunction_t", "const int diag, const int k", "diag, k"),
+}
+
+# the score-only striped dispatchers pick the short kernels on sse41 and
+# avx2; those take queries that fit in one vector and leave the rest to
+# the striped kernel of the same isa
+def short_prefix(alg, stats, table, par, width, prefix2):
+    if par.startswith("striped") and not stats and not table and width in [32, 16, 8]:
+        return prefix2.replace("_striped", "_short")
+    return prefix2
+
 def codegen(alg):
     txt = """/**
  * @file
@@ -38,6 +54,51 @@ def codegen(alg):
                         alg, stats, table, par, width)
                     txt += "parasail_pfunction_t %s_dispatcher;\n" % prefix
 
+    for table in ["", "_table", "_rowcol"]:
+        for stats in ["", "_stats"]:
+            for par in ["scan_profile", "striped_profile"]:
+                for width in [64, 32, 16, 8]:
+                    prefix = "parasail_%s%s%s_%s_%d_ws"%(
+                        alg, stats, table, par, width)
+                    txt += "parasail_pwfunction_t %s_dispatcher;\n" % prefix
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_swipe_%d"%(alg, width)
+        txt += "parasail_bfunction_t %s_dispatcher;\n" % prefix
+
+    for width in [16, 8]:
+        prefix = "parasail_%s_packed_%d"%(alg, width)
+        txt += "parasail_mfunction_t %s_dispatcher;\n" % prefix
+        prefix = "parasail_%s_packed_profile_%d"%(alg, width)
+        txt += "parasail_mpfunction_t %s_dispatcher;\n" % prefix
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_trace_scan_%d"%(alg, width)
+        txt += "parasail_function_t %s_dispatcher;\n" % prefix
+
+    if alg in banded_algs:
+        for table in ["", "_table", "_rowcol"]:
+            for width in [32, 16, 8]:
+                prefix = "parasail_%s%s_banded_%d"%(alg, table, width)
+                txt += "%s %s_dispatcher;\n" % (
+                        banded_algs[alg][0], prefix)
+
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16]:
+            prefix = "parasail_%s%s_blocked_%d"%(alg, table, width)
+            txt += "parasail_function_t %s_dispatcher;\n" % prefix
+            prefix = "parasail_%s%s_blocked_profile_%d"%(alg, table, width)
+            txt += "parasail_pfunction_t %s_dispatcher;\n" % prefix
+            txt += "parasail_pwfunction_t %s_ws_dispatcher;\n" % prefix
+
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16, 8]:
+            prefix = "parasail_%s%s_short_%d"%(alg, table, width)
+            txt += "parasail_function_t %s_dispatcher;\n" % prefix
+            prefix = "parasail_%s%s_short_profile_%d"%(alg, table, width)
+            txt += "parasail_pfunction_t %s_dispatcher;\n" % prefix
+            txt += "parasail_pwfunction_t %s_ws_dispatcher;\n" % prefix
+
     txt += """
 /* declare and initialize the pointer to the dispatcher function */
 """
@@ -59,6 +120,62 @@ def codegen(alg):
                     txt += "parasail_pfunction_t * %s_pointer = %s_dispatcher;\n"%(
                             prefix, prefix)
 
+    for table in ["", "_table", "_rowcol"]:
+        for stats in ["", "_stats"]:
+            for par in ["scan_profile", "striped_profile"]:
+                for width in [64, 32, 16, 8]:
+                    prefix = "parasail_%s%s%s_%s_%d_ws"%(
+                        alg, stats, table, par, width)
+                    txt += "parasail_pwfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                            prefix, prefix)
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_swipe_%d"%(alg, width)
+        txt += "parasail_bfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                prefix, prefix)
+
+    for width in [16, 8]:
+        prefix = "parasail_%s_packed_%d"%(alg, width)
+        txt += "parasail_mfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                prefix, prefix)
+        prefix = "parasail_%s_packed_profile_%d"%(alg, width)
+        txt += "parasail_mpfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                prefix, prefix)
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_trace_scan_%d"%(alg, width)
+        txt += "parasail_function_t * %s_pointer = %s_dispatcher;\n"%(
+                prefix, prefix)
+
+    if alg in banded_algs:
+        for table in ["", "_table", "_rowcol"]:
+            for width in [32, 16, 8]:
+                prefix = "parasail_%s%s_banded_%d"%(alg, table, width)
+                txt += "%s * %s_pointer = %s_dispatcher;\n"%(
+                        banded_algs[alg][0], prefix, prefix)
+
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16]:
+            prefix = "parasail_%s%s_blocked_%d"%(alg, table, width)
+            txt += "parasail_function_t * %s_pointer = %s_dispatcher;\n"%(
+                    prefix, prefix)
+            prefix = "parasail_%s%s_blocked_profile_%d"%(alg, table, width)
+            txt += "parasail_pfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                    prefix, prefix)
+            txt += "parasail_pwfunction_t * %s_ws_pointer = %s_ws_dispatcher;\n"%(
+                    prefix, prefix)
+
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16, 8]:
+            prefix = "parasail_%s%s_short_%d"%(alg, table, width)
+            txt += "parasail_function_t * %s_pointer = %s_dispatcher;\n"%(
+                    prefix, prefix)
+            prefix = "parasail_%s%s_short_profile_%d"%(alg, table, width)
+            txt += "parasail_pfunction_t * %s_pointer = %s_dispatcher;\n"%(
+                    prefix, prefix)
+            txt += "parasail_pwfunction_t * %s_ws_pointer = %s_ws_dispatcher;\n"%(
+                    prefix, prefix)
+
     txt += """
 /* dispatcher function implementations */
 """
@@ -78,6 +195,7 @@ def codegen(alg):
                             "BASE": base,
                             "PREFIX": prefix,
                             "PREFIX2": prefix2,
+                            "PREFIX3": short_prefix(alg, stats, table, par, width, prefix2),
                             "TABLE": table,
                             "STATS": stats,
                             "PAR": par,
@@ -98,13 +216,13 @@ parasail_result_t* %(PREFIX)s_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+        %(PREFIX)s_pointer = %(PREFIX3)s_avx2_256_%(WIDTH)s;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+        %(PREFIX)s_pointer = %(PREFIX3)s_sse41_128_%(WIDTH)s;
     }
     else
 #endif
@@ -134,6 +252,7 @@ parasail_result_t* %(PREFIX)s_dispatcher(
                             "ALG": alg,
                             "PREFIX": prefix,
                             "PREFIX2": prefix2,
+                            "PREFIX3": short_prefix(alg, stats, table, par, width, prefix2),
                             "TABLE": table,
                             "STATS": stats,
                             "PAR": par,
@@ -153,13 +272,13 @@ parasail_result_t* %(PREFIX)s_dispatcher(
 #else
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
-        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+        %(PREFIX)s_pointer = %(PREFIX3)s_avx2_256_%(WIDTH)s;
     }
     else
 #endif
 #if HAVE_SSE41
     if (parasail_can_use_sse41()) {
-        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+        %(PREFIX)s_pointer = %(PREFIX3)s_sse41_128_%(WIDTH)s;
     }
     else
 #endif
@@ -175,6 +294,428 @@ parasail_result_t* %(PREFIX)s_dispatcher(
     }
     return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
 }
+""" % params
+
+    for table in ["", "_table", "_rowcol"]:
+        for stats in ["", "_stats"]:
+            for par in ["scan_profile", "striped_profile"]:
+                for width in [64, 32, 16, 8]:
+                    prefix = "parasail_%s%s%s_%s_%d_ws"%(
+                        alg, stats, table, par, width)
+                    prefix2 = "parasail_%s%s%s_%s"%(
+                        alg, stats, table, par)
+                    params = {
+                            "ALG": alg,
+                            "PREFIX": prefix,
+                            "PREFIX2": prefix2,
+                            "PREFIX3": short_prefix(alg, stats, table, par, width, prefix2),
+                            "TABLE": table,
+                            "STATS": stats,
+                            "PAR": par,
+                            "WIDTH": width
+                    }
+                    txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_KNC
+    if (1) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_knc_512_32_ws;
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX3)s_avx2_256_%(WIDTH)s_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX3)s_sse41_128_%(WIDTH)s_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse2_128_%(WIDTH)s_ws;
+    }
+    else
+#endif
+#endif
+    {
+        %(PREFIX)s_pointer = NULL;
+    }
+    return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+""" % params
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_swipe_%d"%(alg, width)
+        prefix2 = "parasail_%s_swipe"%(alg)
+        params = {
+                "ALG": alg,
+                "PREFIX": prefix,
+                "PREFIX2": prefix2,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t** %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(PREFIX2)s;
+    }
+    return %(PREFIX)s_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
+""" % params
+
+    for width in [16, 8]:
+        prefix = "parasail_%s_packed_%d"%(alg, width)
+        prefix2 = "parasail_%s_packed"%(alg)
+        params = {
+                "ALG": alg,
+                "PREFIX": prefix,
+                "PREFIX2": prefix2,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t** %(PREFIX)s_dispatcher(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(PREFIX2)s;
+    }
+    return %(PREFIX)s_pointer(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+}
+""" % params
+
+        prefix = "parasail_%s_packed_profile_%d"%(alg, width)
+        prefix2 = "parasail_%s_packed_profile"%(alg)
+        params = {
+                "ALG": alg,
+                "PREFIX": prefix,
+                "PREFIX2": prefix2,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t** %(PREFIX)s_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(PREFIX2)s;
+    }
+    return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
+}
+""" % params
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_trace_scan_%d"%(alg, width)
+        prefix2 = "parasail_%s_trace_scan"%(alg)
+        base = "parasail_%s_trace"%(alg)
+        params = {
+                "ALG": alg,
+                "BASE": base,
+                "PREFIX": prefix,
+                "PREFIX2": prefix2,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(BASE)s;
+    }
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+""" % params
+
+    if alg in banded_algs:
+        for table in ["", "_table", "_rowcol"]:
+            for width in [32, 16, 8]:
+                prefix = "parasail_%s%s_banded_%d"%(alg, table, width)
+                prefix2 = "parasail_%s%s_banded"%(alg, table)
+                base = "parasail_%s_banded%s"%(alg, table)
+                params = {
+                        "ALG": alg,
+                        "BASE": base,
+                        "PREFIX": prefix,
+                        "PREFIX2": prefix2,
+                        "BAND": banded_algs[alg][1],
+                        "BAND_ARGS": banded_algs[alg][2],
+                        "WIDTH": width
+                }
+                txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, %(BAND)s,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(BASE)s;
+    }
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, %(BAND_ARGS)s, matrix);
+}
+""" % params
+
+    # blocked kernels only exist for sse41 and avx2; their profiles are
+    # laid out for them, so the profile variants have no fallback
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16]:
+            prefix = "parasail_%s%s_blocked_%d"%(alg, table, width)
+            prefix2 = "parasail_%s%s_blocked"%(alg, table)
+            base = "parasail_%s%s"%(alg, table)
+            params = {
+                    "ALG": alg,
+                    "BASE": base,
+                    "PREFIX": prefix,
+                    "PREFIX2": prefix2,
+                    "WIDTH": width
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(BASE)s;
+    }
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+""" % params
+            params["PREFIX"] = "parasail_%s%s_blocked_profile_%d"%(alg, table, width)
+            params["PREFIX2"] = "parasail_%s%s_blocked_profile"%(alg, table)
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = NULL;
+    }
+    return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* %(PREFIX)s_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_ws_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_ws_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s_ws;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_ws_pointer = NULL;
+    }
+    return %(PREFIX)s_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+""" % params
+
+    # short kernels only exist for sse41 and avx2; without them the
+    # striped dispatchers take over, profile variants included since the
+    # short kernels use the striped profiles
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16, 8]:
+            prefix = "parasail_%s%s_short_%d"%(alg, table, width)
+            prefix2 = "parasail_%s%s_short"%(alg, table)
+            base = "parasail_%s%s_striped_%d"%(alg, table, width)
+            params = {
+                    "ALG": alg,
+                    "BASE": base,
+                    "PREFIX": prefix,
+                    "PREFIX2": prefix2,
+                    "WIDTH": width
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(BASE)s;
+    }
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+""" % params
+            params["PREFIX"] = "parasail_%s%s_short_profile_%d"%(alg, table, width)
+            params["PREFIX2"] = "parasail_%s%s_short_profile"%(alg, table)
+            params["BASE"] = "parasail_%s%s_striped_profile_%d"%(alg, table, width)
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(BASE)s;
+    }
+    return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* %(PREFIX)s_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_ws_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_ws_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s_ws;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_ws_pointer = %(BASE)s_ws;
+    }
+    return %(PREFIX)s_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
 """ % params
 
     txt += """
@@ -228,6 +769,193 @@ parasail_result_t* %(PREFIX)s(
 {
     return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
 }
+""" % params
+
+    for table in ["", "_table", "_rowcol"]:
+        for stats in ["", "_stats"]:
+            for par in ["scan_profile", "striped_profile"]:
+                for width in [64, 32, 16, 8]:
+                    prefix = "parasail_%s%s%s_%s_%d_ws"%(
+                        alg, stats, table, par, width)
+                    params = {
+                            "ALG": alg,
+                            "PREFIX": prefix,
+                            "TABLE": table,
+                            "STATS": stats,
+                            "PAR": par,
+                            "WIDTH": width
+                    }
+                    txt += """
+parasail_result_t* %(PREFIX)s(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+""" % params
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_swipe_%d"%(alg, width)
+        params = {
+                "ALG": alg,
+                "PREFIX": prefix,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t** %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+}
+""" % params
+
+    for width in [16, 8]:
+        prefix = "parasail_%s_packed_%d"%(alg, width)
+        params = {
+                "ALG": alg,
+                "PREFIX": prefix,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t** %(PREFIX)s(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+}
+""" % params
+
+        prefix = "parasail_%s_packed_profile_%d"%(alg, width)
+        params = {
+                "ALG": alg,
+                "PREFIX": prefix,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t** %(PREFIX)s(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
+}
+""" % params
+
+    for width in [32, 16, 8]:
+        prefix = "parasail_%s_trace_scan_%d"%(alg, width)
+        params = {
+                "ALG": alg,
+                "PREFIX": prefix,
+                "WIDTH": width
+        }
+        txt += """
+parasail_result_t* %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+""" % params
+
+    if alg in banded_algs:
+        for table in ["", "_table", "_rowcol"]:
+            for width in [32, 16, 8]:
+                prefix = "parasail_%s%s_banded_%d"%(alg, table, width)
+                params = {
+                        "ALG": alg,
+                        "PREFIX": prefix,
+                        "BAND": banded_algs[alg][1],
+                        "BAND_ARGS": banded_algs[alg][2],
+                        "WIDTH": width
+                }
+                txt += """
+parasail_result_t* %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, %(BAND)s,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, %(BAND_ARGS)s, matrix);
+}
+""" % params
+
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16]:
+            params = {
+                    "PREFIX": "parasail_%s%s_blocked_%d"%(alg, table, width),
+                    "PPREFIX": "parasail_%s%s_blocked_profile_%d"%(alg, table, width),
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* %(PPREFIX)s(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return %(PPREFIX)s_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* %(PPREFIX)s_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    return %(PPREFIX)s_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
+""" % params
+
+    for table in ["", "_table", "_rowcol"]:
+        for width in [32, 16, 8]:
+            params = {
+                    "PREFIX": "parasail_%s%s_short_%d"%(alg, table, width),
+                    "PPREFIX": "parasail_%s%s_short_profile_%d"%(alg, table, width),
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* %(PPREFIX)s(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return %(PPREFIX)s_pointer(profile, s2, s2Len, open, gap);
+}
+
+parasail_result_t* %(PPREFIX)s_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    return %(PPREFIX)s_ws_pointer(profile, s2, s2Len, open, gap, workspace);
+}
 """ % params
 
     return txt
@@ -65,6 +65,16 @@ for table in [""]:
                     for width in widths:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_stats, 0)
+                # blocked kernels are score only, sse41 and avx2 only
+                if not stats and isa in ["sse41", "avx2"]:
+                    for width in [32, 16]:
+                        name = "%s_blocked_%s_%s_%s" % (pre, isa, bits, width)
+                        print_fmt(name, name, alg+stats, "blocked", isa, bits, width, bits/width, is_table, is_stats, 0)
+                # so are the trace kernels, which have no table variants
+                if not stats and isa in ["sse41", "avx2"]:
+                    for width in [32, 16, 8]:
+                        name = "%s_trace_scan_%s_%s_%s" % (pre, isa, bits, width)
+                        print_fmt(name, name, alg+stats, "trace_scan", isa, bits, width, bits/width, is_table, is_stats, 0)
                 print_null()
                 print "};"
                 print 'static parasail_function_group_t %s_%s = {"%s_%s", %s_%s_functions};' % ((pre, isa)*3)
@@ -94,10 +104,21 @@ for table in [""]:
                     name = "%s_%s_%s" % (pre, par, width)
                     print_fmt(name, name, alg+stats, par, "disp", "NA", width, -
 1, is_table, is_stats, 0)
+            if not stats:
+                for width in [32, 16]:
+                    name = "%s_blocked_%s" % (pre, width)
+                    print_fmt(name, name, alg+stats, "blocked", "disp", "NA", width, -1, is_table, is_stats, 0)
+            if not stats:
+                for width in [32, 16, 8]:
+                    name = "%s_trace_scan_%s" % (pre, width)
+                    print_fmt(name, name, alg+stats, "trace_scan", "disp", "NA", width, -1, is_table, is_stats, 0)
             # also print the saturation check function
             for par in ["scan", "striped", "diag"]:
                 name = "%s_%s_sat" % (pre, par)
                 print_fmt(name, name, alg+stats, par, "sat", "NA", 8, -1, is_table, is_stats, 0)
+            if not stats:
+                name = "%s_trace_scan_sat" % pre
+                print_fmt(name, name, alg+stats, "trace_scan", "sat", "NA", 8, -1, is_table, is_stats, 0)
             print_null()
             print "};"
             print 'static parasail_function_group_t %s_%s = {"%s_%s", %s_%s_functions};' % ((pre, isa)*3)
@@ -36,10 +36,39 @@ def print_fmt(*args):
     print fmt % tuple(new_args)
 
 def print_pfmt(*args):
-    fmt = '{%-36s %-36s %-38s %5s %10s %-8s %6s %5s %3s %1s %1s %1s %1s},'
+    fmt = '{%-36s %-36s %-39s %-38s %5s %10s %-8s %6s %5s %3s %1s %1s %1s %1s},'
     new_args = [arg for arg in args]
+    # the workspace variant follows the creator
+    new_args.insert(2, '%s_ws,' % new_args[0])
     new_args[0] = '%s,'   % new_args[0]
     new_args[1] = '%s,'   % new_args[1]
+    new_args[3] = '"%s",' % new_args[3]
+    new_args[4] = '"%s",' % new_args[4]
+    new_args[5] = '"%s",' % new_args[5]
+    new_args[6] = '"%s",' % new_args[6]
+    new_args[7] = '"%s",' % new_args[7]
+    new_args[8] = '"%s",' % new_args[8]
+    new_args[9] = '%d,'   % new_args[9]
+    new_args[10]= '%d,'   % new_args[10]
+    new_args[11]= '%d,'   % new_args[11]
+    new_args[12]= '%d,'   % new_args[12]
+    new_args[13]= '%d'    % new_args[13]
+    print fmt % tuple(new_args)
+
+def print_knull():
+    fmt = '{%s, %s, %s, "%s", "%s", "%s", "%s", "%s", %d, %d, %d, %d, %d},'
+    print fmt[:-1] % ("NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0)
+
+def print_kfmt(*args):
+    fmt = '{%-38s %-38s %-40s %5s %10s %-8s %6s %5s %3s %1s %1s %1s %1s},'
+    new_args = [arg for arg in args]
+    # global bands only need k, the others are centered on a diagonal
+    if new_args[2] == "nw":
+        new_args.insert(1, 'NULL,')
+        new_args[0] = '%s,'   % new_args[0]
+    else:
+        new_args.insert(0, 'NULL,')
+        new_args[1] = '%s,'   % new_args[1]
     new_args[2] = '"%s",' % new_args[2]
     new_args[3] = '"%s",' % new_args[3]
     new_args[4] = '"%s",' % new_args[4]
@@ -58,8 +87,8 @@ def print_null():
     print fmt[:-1] % ("NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0)
 
 def print_pnull():
-    fmt = '{%s, %s, "%s", "%s", "%s", "%s", "%s", "%s", %d, %d, %d, %d, %d},'
-    print fmt[:-1] % ("NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0)
+    fmt = '{%s, %s, %s, "%s", "%s", "%s", "%s", "%s", "%s", %d, %d, %d, %d, %d},'
+    print fmt[:-1] % ("NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0)
 
 isa_to_bits = {
     "sse2"  : 128,
@@ -98,12 +127,17 @@ for table in ["", "_table", "_rowcol"]:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         print_fmt(name, name, alg+stats, par, isa, bits,
                                 width, elem, is_table, is_rowcol, is_stats, 0)
-                # blocked implementations only exist for sw sse41 32 and 16 bit
-                if isa == "sse41" and alg == "sw" and not stats:
+                # blocked implementations only exist for sse41 and avx2, 32 and 16 bit
+                if isa != "sse2" and not stats:
                     par = "blocked"
                     for width in [32, 16]:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_rowcol, is_stats, 0)
+                    # short implementations take the striped profiles
+                    par = "short"
+                    for width in [32, 16, 8]:
+                        name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
+                        print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_rowcol, is_stats, 0)
                 print "#endif"
             for isa in ["knc"]:
                 print "#if HAVE_%s" % isa.upper()
@@ -118,6 +152,44 @@ for table in ["", "_table", "_rowcol"]:
                 for width in [64, 32, 16, 8, "sat"]:
                     name = "%s_%s_%s" % (pre, par, width)
                     print_fmt(name, name, alg+stats, par, "disp", "NA", width, -1, is_table, is_rowcol, is_stats, 0)
+            if not stats:
+                for width in [32, 16]:
+                    name = "%s_blocked_%s" % (pre, width)
+                    print_fmt(name, name, alg, "blocked", "disp", "NA", width, -1, is_table, is_rowcol, 0, 0)
+                for width in [32, 16, 8]:
+                    name = "%s_short_%s" % (pre, width)
+                    print_fmt(name, name, alg, "short", "disp", "NA", width, -1, is_table, is_rowcol, 0, 0)
+
+# traceback implementations only exist for score-only, sse41 and avx2
+for alg in ["nw", "sg", "sw"]:
+    pre = "parasail_"+alg
+    print_fmt(pre+"_trace", pre+"_trace", alg, "trace", "NA", "32", "32", 1, 0, 0, 0, 1)
+    for isa in ["sse41", "avx2"]:
+        print "#if HAVE_%s" % isa.upper()
+        bits = isa_to_bits[isa]
+        par = "trace_scan"
+        for width in [32, 16, 8, "sat"]:
+            elem = 0
+            if "sat" == width:
+                elem = bits/8
+            else:
+                elem = bits/width
+            name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
+            print_fmt(name, name, alg, par, isa, bits, width, elem, 0, 0, 0, 0)
+        print "#endif"
+    for width in [32, 16, 8, "sat"]:
+        name = "%s_trace_scan_%s" % (pre, width)
+        print_fmt(name, name, alg, "trace_scan", "disp", "NA", width, -1, 0, 0, 0, 0)
+
+# linear space alignments sit on top of the dispatched rowcol kernels
+for alg in ["nw", "sg", "sw"]:
+    pre = "parasail_"+alg
+    print_fmt(pre+"_linear", pre+"_linear", alg, "linear", "disp", "NA", "sat", -1, 0, 0, 0, 0)
+
+# autotuned alignments run the dispatcher timed fastest for the query length
+for alg in ["nw", "sg", "sw"]:
+    pre = "parasail_"+alg
+    print_fmt(pre+"_auto", pre+"_auto", alg, "auto", "disp", "NA", "sat", -1, 0, 0, 0, 0)
 
 print_null()
 print "};"
@@ -151,6 +223,17 @@ for table in ["", "_table", "_rowcol"]:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         creator = "parasail_profile_create%s_%s_%s_%s" % (stats, isa[:3], bits, width)
                         print_pfmt(name, creator, name, alg+stats, par, isa, bits, width, elem, is_table, is_rowcol, is_stats, 0)
+                if isa != "sse2" and not stats:
+                    par = "blocked_profile"
+                    for width in [32, 16]:
+                        name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
+                        creator = "parasail_profile_create_blocked_%s_%s_%s" % (isa[:3], bits, width)
+                        print_pfmt(name, creator, name, alg, par, isa, bits, width, bits/width, is_table, is_rowcol, 0, 0)
+                    par = "short_profile"
+                    for width in [32, 16, 8]:
+                        name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
+                        creator = "parasail_profile_create_%s_%s_%s" % (isa[:3], bits, width)
+                        print_pfmt(name, creator, name, alg, par, isa, bits, width, bits/width, is_table, is_rowcol, 0, 0)
                 print "#endif"
             for isa in ["knc"]:
                 print "#if HAVE_%s" % isa.upper()
@@ -167,10 +250,53 @@ for table in ["", "_table", "_rowcol"]:
                     name = "%s_%s_%s" % (pre, par, width)
                     creator = "parasail_profile_create%s_%s" % (stats, width)
                     print_pfmt(name, creator, name, alg+stats, par, "disp", "NA", width, -1, is_table, is_rowcol, is_stats, 0)
+            if not stats:
+                for width in [32, 16]:
+                    name = "%s_blocked_profile_%s" % (pre, width)
+                    creator = "parasail_profile_create_blocked_%s" % width
+                    print_pfmt(name, creator, name, alg, "blocked_profile", "disp", "NA", width, -1, is_table, is_rowcol, 0, 0)
+                for width in [32, 16, 8]:
+                    name = "%s_short_profile_%s" % (pre, width)
+                    creator = "parasail_profile_create_%s" % width
+                    print_pfmt(name, creator, name, alg, "short_profile", "disp", "NA", width, -1, is_table, is_rowcol, 0, 0)
 
 print_pnull()
 print "};"
 
+print
+print "static const parasail_kfunction_info_t kfunctions[] = {"
+
+for table in ["", "_table", "_rowcol"]:
+    for alg in ["nw", "sg", "sw"]:
+        is_table = 0
+        is_rowcol = 0
+        if table == "_table":
+            is_table = 1
+        elif table == "_rowcol":
+            is_rowcol = 1
+        pre = "parasail_"+alg+table
+        ref = "parasail_"+alg+"_banded"+table
+        print_kfmt(ref, ref, alg, "orig", "NA", "32", "32", 1, is_table, is_rowcol, 0, 1)
+        for isa in ["sse41", "avx2"]:
+            print "#if HAVE_%s" % isa.upper()
+            bits = isa_to_bits[isa]
+            for width in [32, 16, 8, "sat"]:
+                elem = 0
+                if "sat" == width:
+                    elem = bits/8
+                else:
+                    elem = bits/width
+                name = "%s_banded_%s_%s_%s" % (pre, isa, bits, width)
+                print_kfmt(name, name, alg, "banded", isa, bits, width, elem, is_table, is_rowcol, 0, 0)
+            print "#endif"
+        # also print the dispatcher function
+        for width in [32, 16, 8, "sat"]:
+            name = "%s_banded_%s" % (pre, width)
+            print_kfmt(name, name, alg, "banded", "disp", "NA", width, -1, is_table, is_rowcol, 0, 0)
+
+print_knull()
+print "};"
+
 print """
 #ifdef __cplusplus
 }
@@ -60,6 +60,10 @@ sse2 = {
     "VMINx32"     : "_mm_min_epi32_rpl",
     "VMINx64"     : "_mm_min_epi64_rpl",
     "VMOVEMASK"   : "_mm_movemask_epi8",
+    "VMASKBITSx8" : "_mm_movemask_epi8",
+    "VMASKBITSx16": "_mm_movemask_epi16_rpl",
+    "VMASKBITSx32": "_mm_movemask_epi32_rpl",
+    "VMASKBITSx64": "_mm_movemask_epi64_rpl",
     "VPACKS"      : "_mm_packs_epi16",
     "VUNPACKLO"   : "_mm_unpacklo_epi8",
     "VUNPACKHI"   : "_mm_unpackhi_epi8",
@@ -269,6 +273,21 @@ static inline __m128i _mm_set1_epi64x_rpl(int64_t i) {
     return A.m;
 }
 #endif
+""",
+    "_mm_movemask_epi16_rpl" : """
+static inline int _mm_movemask_epi16_rpl(__m128i a) {
+    return _mm_movemask_epi8(_mm_packs_epi16(a, _mm_setzero_si128()));
+}
+""",
+    "_mm_movemask_epi32_rpl" : """
+static inline int _mm_movemask_epi32_rpl(__m128i a) {
+    return _mm_movemask_ps(_mm_castsi128_ps(a));
+}
+""",
+    "_mm_movemask_epi64_rpl" : """
+static inline int _mm_movemask_epi64_rpl(__m128i a) {
+    return _mm_movemask_pd(_mm_castsi128_pd(a));
+}
 """,
     "_mm_set_epi64x_rpl" : """
 #if HAVE_SSE2_MM_SET_EPI64X
@@ -297,6 +316,7 @@ sse41 = {
     "VADDx64"     : "_mm_add_epi64",
     "VADDSx8"     : "_mm_adds_epi8",
     "VADDSx16"    : "_mm_adds_epi16",
+    "VALIGNR"     : "_mm_alignr_epi8",
     "VBLEND"      : "_mm_blendv_epi8",
     "VCMPEQx8"    : "_mm_cmpeq_epi8",
     "VCMPEQx16"   : "_mm_cmpeq_epi16",
@@ -332,6 +352,10 @@ sse41 = {
     "VMINx32"     : "_mm_min_epi32",
     "VMINx64"     : "_mm_min_epi64_rpl",
     "VMOVEMASK"   : "_mm_movemask_epi8",
+    "VMASKBITSx8" : "_mm_movemask_epi8",
+    "VMASKBITSx16": "_mm_movemask_epi16_rpl",
+    "VMASKBITSx32": "_mm_movemask_epi32_rpl",
+    "VMASKBITSx64": "_mm_movemask_epi64_rpl",
     "VPACKS"      : "_mm_packs_epi16",
     "VUNPACKLO"   : "_mm_unpacklo_epi8",
     "VUNPACKHI"   : "_mm_unpackhi_epi8",
@@ -469,6 +493,21 @@ static inline __m128i _mm_set1_epi64x_rpl(int64_t i) {
     return A.m;
 }
 #endif
+""",
+    "_mm_movemask_epi16_rpl" : """
+static inline int _mm_movemask_epi16_rpl(__m128i a) {
+    return _mm_movemask_epi8(_mm_packs_epi16(a, _mm_setzero_si128()));
+}
+""",
+    "_mm_movemask_epi32_rpl" : """
+static inline int _mm_movemask_epi32_rpl(__m128i a) {
+    return _mm_movemask_ps(_mm_castsi128_ps(a));
+}
+""",
+    "_mm_movemask_epi64_rpl" : """
+static inline int _mm_movemask_epi64_rpl(__m128i a) {
+    return _mm_movemask_pd(_mm_castsi128_pd(a));
+}
 """,
     "_mm_set_epi64x_rpl" : """
 #if HAVE_SSE2_MM_SET_EPI64X
@@ -497,6 +536,7 @@ avx2 = {
     "VADDx64"     : "_mm256_add_epi64",
     "VADDSx8"     : "_mm256_adds_epi8",
     "VADDSx16"    : "_mm256_adds_epi16",
+    "VALIGNR"     : "_mm256_alignr_epi8_rpl",
     "VBLEND"      : "_mm256_blendv_epi8",
     "VCMPEQx8"    : "_mm256_cmpeq_epi8",
     "VCMPEQx16"   : "_mm256_cmpeq_epi16",
@@ -532,6 +572,10 @@ avx2 = {
     "VMINx32"     : "_mm256_min_epi32",
     "VMINx64"     : "_mm256_min_epi64_rpl",
     "VMOVEMASK"   : "_mm256_movemask_epi8",
+    "VMASKBITSx8" : "_mm256_movemask_epi8",
+    "VMASKBITSx16": "_mm256_movemask_epi16_rpl",
+    "VMASKBITSx32": "_mm256_movemask_epi32_rpl",
+    "VMASKBITSx64": "_mm256_movemask_epi64_rpl",
     "VPACKS"      : "_mm256_packs_epi16_rpl",
     "VUNPACKLO"   : "_mm256_unpacklo_epi8_rpl",
     "VUNPACKHI"   : "_mm256_unpackhi_epi8_rpl",
@@ -656,6 +700,9 @@ static inline __m256i _mm256_unpackhi_epi8_rpl(__m256i a, __m256i b) {
 """,
     "_mm256_slli_si256_rpl" : """
 #define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+""",
+    "_mm256_alignr_epi8_rpl" : """
+#define _mm256_alignr_epi8_rpl(a,b,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(b, a, _MM_SHUFFLE(0,2,0,1)), imm)
 """,
     "_mm256_rlli_si256_rpl" : """
 #define _mm256_rlli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,0,1)), 16-imm)
@@ -751,6 +798,22 @@ static inline int8_t _mm256_extract_epi8_rpl(__m256i a, int imm) {
     return A.v[imm];
 }
 #endif
+""",
+    "_mm256_movemask_epi16_rpl" : """
+static inline int _mm256_movemask_epi16_rpl(__m256i a) {
+    int m = _mm256_movemask_epi8(_mm256_packs_epi16(a, _mm256_setzero_si256()));
+    return (m & 0xFF) | ((m >> 8) & 0xFF00);
+}
+""",
+    "_mm256_movemask_epi32_rpl" : """
+static inline int _mm256_movemask_epi32_rpl(__m256i a) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(a));
+}
+""",
+    "_mm256_movemask_epi64_rpl" : """
+static inline int _mm256_movemask_epi64_rpl(__m256i a) {
+    return _mm256_movemask_pd(_mm256_castsi256_pd(a));
+}
 """,
     "_mm256_set1_epi64x_rpl" : """
 #if HAVE_AVX2_MM256_SET1_EPI64X
@@ -79,6 +79,91 @@ def body2():
 }
 #endif"""
 
+def body4():
+    print """{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(s2Count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body5():
+    print """{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body6():
+    print """{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body7():
+    print """{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(diag);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body8():
+    print """{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body9():
+    print """{
+    UNUSED(s1s);
+    UNUSED(s1Lens);
+    UNUSED(s1Count);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
 def body3():
     print """{
     UNUSED(s1);
@@ -140,12 +225,17 @@ for a in alg:
                     print " "*8+"const int open, const int gap)"
                     body2()
 
-# vectorized implementations of blocked (1x1x3x1x2 = 6 impl)
-alg = ["sw"]
-stats = [""]
+# vectorized profile implementations with workspace (3x2x3x2x13 = 468 impl)
+alg = ["nw", "sg", "sw"]
+stats = ["", "_stats"]
 table = ["", "_table", "_rowcol"]
-par = ["_blocked"]
-isa = ["_sse41_128_32", "_sse41_128_16"]
+par = ["_scan_profile", "_striped_profile"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_knc_512_32"
+    ]
 for a in alg:
     for s in stats:
         for t in table:
@@ -154,12 +244,187 @@ for a in alg:
                     print ""
                     isa_to_guard(i)
                     print "extern"
-                    print "parasail_result_t* parasail_"+a+s+t+p+i+'('
-                    print " "*8+"const char * const restrict s1, const int s1Len,"
+                    print "parasail_result_t* parasail_"+a+s+t+p+i+'_ws('
+                    print " "*8+"const parasail_profile_t * const restrict profile,"
                     print " "*8+"const char * const restrict s2, const int s2Len,"
                     print " "*8+"const int open, const int gap,"
-                    print " "*8+"const parasail_matrix_t* matrix)"
-                    body1()
+                    print " "*8+"parasail_workspace_t * const restrict workspace)"
+                    body5()
+
+# vectorized implementations of blocked (3x3x4 = 36 impl)
+alg = ["nw", "sg", "sw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_blocked"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"const parasail_matrix_t* matrix)"
+            body1()
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_blocked_profile"+i+'('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap)"
+            body2()
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_blocked_profile"+i+'_ws('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace)"
+            body5()
+
+# vectorized implementations of short (3x3x6 = 54 impl)
+alg = ["nw", "sg", "sw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8",
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_short"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"const parasail_matrix_t* matrix)"
+            body1()
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_short_profile"+i+'('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap)"
+            body2()
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_short_profile"+i+'_ws('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace)"
+            body5()
+
+# inter-sequence (swipe) batch implementations (3x8 = 24 impl)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t** parasail_"+a+"_swipe"+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const * const restrict s2s,"
+        print " "*8+"const int * const restrict s2Lens, const int s2Count,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix)"
+        body4()
+
+# packed multi-query implementations (3x6 = 18 impl, each with a
+# profile variant)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t** parasail_"+a+"_packed"+i+'('
+        print " "*8+"const char * const * const restrict s1s,"
+        print " "*8+"const int * const restrict s1Lens, const int s1Count,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix)"
+        body8()
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t** parasail_"+a+"_packed_profile"+i+'('
+        print " "*8+"const parasail_profile_t * const restrict profile,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap)"
+        body2()
+
+# vectorized banded implementations (1x3x8 = 24 impl)
+alg = ["nw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_banded"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap, const int k,"
+            print " "*8+"const parasail_matrix_t* matrix)"
+            body6()
+
+# vectorized banded implementations centered on a diagonal (2x3x8 = 48 impl)
+alg = ["sg", "sw"]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_banded"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"const int diag, const int k,"
+            print " "*8+"const parasail_matrix_t* matrix)"
+            body7()
+
+# vectorized traceback implementations (3x8 = 24 impl)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        isa_to_guard(i)
+        print "extern"
+        print "parasail_result_t* parasail_"+a+"_trace_scan"+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix)"
+        body1()
 
 # profile creation functions (2x13 = 26 impl)
 stats = ["", "_stats"]
@@ -178,4 +443,33 @@ for s in stats:
         print " "*8+"const parasail_matrix_t* matrix)"
         body3()
 
+# blocked profile creation functions (4 impl)
+isa = [
+    "_sse_128_32", "_sse_128_16",
+    "_avx_256_32", "_avx_256_16",
+    ]
+for i in isa:
+    print ""
+    isa_to_guard(i)
+    print "extern"
+    print "parasail_profile_t* parasail_profile_create_blocked"+i+'('
+    print " "*8+"const char * const restrict s1, const int s1Len,"
+    print " "*8+"const parasail_matrix_t* matrix)"
+    body3()
+
+# packed profile creation functions (4 impl)
+isa = [
+    "_sse_128_16", "_sse_128_8",
+    "_avx_256_16", "_avx_256_8",
+    ]
+for i in isa:
+    print ""
+    isa_to_guard(i)
+    print "extern"
+    print "parasail_profile_t* parasail_profile_create_packed"+i+'('
+    print " "*8+"const char * const * const restrict s1s,"
+    print " "*8+"const int * const restrict s1Lens, const int s1Count,"
+    print " "*8+"const parasail_matrix_t* matrix)"
+    body9()
+
 print # for newline at end of file
@@ -4,10 +4,14 @@ print """LIBRARY parasail
 EXPORTS
 ; from parasail.h
     parasail_profile_free
+    parasail_workspace_new
+    parasail_workspace_free
     parasail_version
     parasail_result_free
+    parasail_result_free_batch
     parasail_lookup_function
     parasail_lookup_pfunction
+    parasail_lookup_pwfunction
     parasail_lookup_pcreator
     parasail_lookup_function_info
     parasail_lookup_pfunction_info
@@ -94,18 +98,53 @@ for a in alg:
                 for i in isa:
                     print "    parasail_"+a+s+t+p+i
 
-# vectorized implementations of blocked (1x1x3x1x2 = 6 impl)
-alg = ["sw"]
-stats = [""]
+# vectorized profile implementations with workspace (3x2x3x2x13 = 468 impl)
+alg = ["nw", "sg", "sw"]
+stats = ["", "_stats"]
 table = ["", "_table", "_rowcol"]
-par = ["_blocked"]
-isa = ["_sse41_128_32", "_sse41_128_16"]
+par = ["_scan_profile", "_striped_profile"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_knc_512_32"
+    ]
 for a in alg:
     for s in stats:
         for t in table:
             for p in par:
                 for i in isa:
-                    print "    parasail_"+a+s+t+p+i
+                    print "    parasail_"+a+s+t+p+i+"_ws"
+
+# vectorized implementations of blocked, and their dispatchers (3x3x6 = 54 impl)
+alg = ["nw", "sg", "sw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_32", "_16"
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print "    parasail_"+a+t+"_blocked"+i
+            print "    parasail_"+a+t+"_blocked_profile"+i
+            print "    parasail_"+a+t+"_blocked_profile"+i+"_ws"
+
+# vectorized implementations of short, and their dispatchers (3x3x9 = 81 impl)
+alg = ["nw", "sg", "sw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8",
+    "_32", "_16", "_8"
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print "    parasail_"+a+t+"_short"+i
+            print "    parasail_"+a+t+"_short_profile"+i
+            print "    parasail_"+a+t+"_short_profile"+i+"_ws"
 
 # dispatching implementations (3x2x3x3x4 = 216 impl)
 alg = ["nw", "sg", "sw"]
@@ -133,6 +172,19 @@ for a in alg:
                 for w in width:
                     print "    parasail_"+a+s+t+p+w
 
+# dispatching profile implementations with workspace (3x2x3x2x4 = 144 impl)
+alg = ["nw", "sg", "sw"]
+stats = ["", "_stats"]
+table = ["", "_table", "_rowcol"]
+par = ["_scan_profile", "_striped_profile"]
+width = ["_64", "_32", "_16", "_8", "_sat"]
+for a in alg:
+    for s in stats:
+        for t in table:
+            for p in par:
+                for w in width:
+                    print "    parasail_"+a+s+t+p+w+"_ws"
+
 # profile creation functions (2x13 = 26 impl)
 stats = ["", "_stats"]
 isa = [
@@ -145,6 +197,25 @@ for s in stats:
     for i in isa:
         print "    parasail_profile_create"+s+i
 
+# blocked profile creation functions (6 impl)
+isa = [
+    "_sse_128_32", "_sse_128_16",
+    "_avx_256_32", "_avx_256_16",
+    "_32", "_16"
+    ]
+for i in isa:
+    print "    parasail_profile_create_blocked"+i
+
+# packed profile creation functions (7 impl)
+isa = [
+    "",
+    "_sse_128_16", "_sse_128_8",
+    "_avx_256_16", "_avx_256_8",
+    "_16", "_8"
+    ]
+for i in isa:
+    print "    parasail_profile_create_packed"+i
+
 # dispatching saturation check implementations (3x2x3x3 = 54 impl)
 alg = ["nw", "sg", "sw"]
 stats = ["", "_stats"]
@@ -156,3 +227,51 @@ for a in alg:
             for p in par:
                 print "    parasail_"+a+s+t+p+"_sat"
 
+# inter-sequence (swipe) batch implementations (3x13 = 39 impl)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for i in isa:
+        print "    parasail_"+a+"_swipe"+i
+
+# packed multi-query implementations (3x2x10 = 60 impl)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "",
+    "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for i in isa:
+        print "    parasail_"+a+"_packed"+i
+        print "    parasail_"+a+"_packed_profile"+i
+
+# banded implementations (3x3x12 = 108 impl)
+alg = ["nw", "sg", "sw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print "    parasail_"+a+t+"_banded"+i
+
+# traceback implementations (3x12 = 36 impl)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for i in isa:
+        print "    parasail_"+a+"_trace_scan"+i
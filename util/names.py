@@ -77,12 +77,17 @@ for a in alg:
                     print " "*8+"const char * const restrict s2, const int s2Len,"
                     print " "*8+"const int open, const int gap);"
 
-# vectorized implementations of blocked (1x1x3x1x2 = 6 impl)
-alg = ["sw"]
-stats = [""]
+# vectorized profile implementations with workspace (3x2x3x2x13 = 468 impl)
+alg = ["nw", "sg", "sw"]
+stats = ["", "_stats"]
 table = ["", "_table", "_rowcol"]
-par = ["_blocked"]
-isa = ["_sse41_128_32", "_sse41_128_16"]
+par = ["_scan_profile", "_striped_profile"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_knc_512_32"
+    ]
 for a in alg:
     for s in stats:
         for t in table:
@@ -90,11 +95,78 @@ for a in alg:
                 for i in isa:
                     print ""
                     print "extern"
-                    print "parasail_result_t* parasail_"+a+s+t+p+i+'('
-                    print " "*8+"const char * const restrict s1, const int s1Len,"
+                    print "parasail_result_t* parasail_"+a+s+t+p+i+'_ws('
+                    print " "*8+"const parasail_profile_t * const restrict profile,"
                     print " "*8+"const char * const restrict s2, const int s2Len,"
                     print " "*8+"const int open, const int gap,"
-                    print " "*8+"const parasail_matrix_t* matrix);"
+                    print " "*8+"parasail_workspace_t * const restrict workspace);"
+
+# vectorized implementations of blocked, and their dispatchers
+# (3x3x6 = 54 impl, each with a profile and a workspace variant)
+alg = ["nw", "sg", "sw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_32", "_16"
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_blocked"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"const parasail_matrix_t* matrix);"
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_blocked_profile"+i+'('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap);"
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_blocked_profile"+i+'_ws('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace);"
+
+# vectorized implementations of short, and their dispatchers (3x3x9 =
+# 81 impl, each with a profile and a workspace variant); they take the
+# striped profiles and queries no longer than one vector
+alg = ["nw", "sg", "sw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8",
+    "_32", "_16", "_8"
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_short"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"const parasail_matrix_t* matrix);"
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_short_profile"+i+'('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap);"
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_short_profile"+i+'_ws('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace);"
 
 # dispatching implementations (3x2x3x3x4 = 216 impl)
 alg = ["nw", "sg", "sw"]
@@ -133,6 +205,25 @@ for a in alg:
                     print " "*8+"const char * const restrict s2, const int s2Len,"
                     print " "*8+"const int open, const int gap);"
 
+# dispatching profile implementations with workspace (3x2x3x2x4 = 144 impl)
+alg = ["nw", "sg", "sw"]
+stats = ["", "_stats"]
+table = ["", "_table", "_rowcol"]
+par = ["_scan_profile", "_striped_profile"]
+width = ["_64", "_32", "_16", "_8", "_sat"]
+for a in alg:
+    for s in stats:
+        for t in table:
+            for p in par:
+                for w in width:
+                    print ""
+                    print "extern"
+                    print "parasail_result_t* parasail_"+a+s+t+p+w+'_ws('
+                    print " "*8+"const parasail_profile_t * const restrict profile,"
+                    print " "*8+"const char * const restrict s2, const int s2Len,"
+                    print " "*8+"const int open, const int gap,"
+                    print " "*8+"parasail_workspace_t * const restrict workspace);"
+
 # profile creation functions (2x13 = 26 impl)
 stats = ["", "_stats"]
 isa = [
@@ -149,6 +240,36 @@ for s in stats:
         print " "*8+"const char * const restrict s1, const int s1Len,"
         print " "*8+"const parasail_matrix_t* matrix);"
 
+# blocked profile creation functions (6 impl); the blocked kernels
+# need these rather than the striped profiles above
+isa = [
+    "_sse_128_32", "_sse_128_16",
+    "_avx_256_32", "_avx_256_16",
+    "_32", "_16"
+    ]
+for i in isa:
+    print ""
+    print "extern"
+    print "parasail_profile_t* parasail_profile_create_blocked"+i+'('
+    print " "*8+"const char * const restrict s1, const int s1Len,"
+    print " "*8+"const parasail_matrix_t* matrix);"
+
+# packed profile creation functions (1 + 2x2 + 2 = 7 impl); the packed
+# kernels take several queries side by side in one vector
+isa = [
+    "",
+    "_sse_128_16", "_sse_128_8",
+    "_avx_256_16", "_avx_256_8",
+    "_16", "_8"
+    ]
+for i in isa:
+    print ""
+    print "extern"
+    print "parasail_profile_t* parasail_profile_create_packed"+i+'('
+    print " "*8+"const char * const * const restrict s1s,"
+    print " "*8+"const int * const restrict s1Lens, const int s1Count,"
+    print " "*8+"const parasail_matrix_t* matrix);"
+
 # dispatching saturation check implementations (3x2x3x3 = 54 impl)
 alg = ["nw", "sg", "sw"]
 stats = ["", "_stats"]
@@ -166,3 +287,98 @@ for a in alg:
                 print " "*8+"const int open, const int gap,"
                 print " "*8+"const parasail_matrix_t* matrix);"
 
+
+# inter-sequence (swipe) batch implementations (3x1 + 3x2x4 + 3x4 = 39 impl)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        print "extern"
+        print "parasail_result_t** parasail_"+a+"_swipe"+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const * const restrict s2s,"
+        print " "*8+"const int * const restrict s2Lens, const int s2Count,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix);"
+
+# packed multi-query implementations (3x1 + 3x2x3 + 3x3 = 30 impl,
+# each with a profile variant)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "",
+    "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        print "extern"
+        print "parasail_result_t** parasail_"+a+"_packed"+i+'('
+        print " "*8+"const char * const * const restrict s1s,"
+        print " "*8+"const int * const restrict s1Lens, const int s1Count,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix);"
+        print ""
+        print "extern"
+        print "parasail_result_t** parasail_"+a+"_packed_profile"+i+'('
+        print " "*8+"const parasail_profile_t * const restrict profile,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap);"
+
+# banded implementations (1x3x12 = 36 impl)
+alg = ["nw"]
+table = ["", "_table", "_rowcol"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_banded"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap, const int k,"
+            print " "*8+"const parasail_matrix_t* matrix);"
+
+# banded implementations centered on a diagonal (2x3x12 = 72 impl)
+alg = ["sg", "sw"]
+for a in alg:
+    for t in table:
+        for i in isa:
+            print ""
+            print "extern"
+            print "parasail_result_t* parasail_"+a+t+"_banded"+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"const int diag, const int k,"
+            print " "*8+"const parasail_matrix_t* matrix);"
+
+# traceback implementations (3x12 = 36 impl)
+alg = ["nw", "sg", "sw"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for i in isa:
+        print ""
+        print "extern"
+        print "parasail_result_t* parasail_"+a+"_trace_scan"+i+'('
+        print " "*8+"const char * const restrict s1, const int s1Len,"
+        print " "*8+"const char * const restrict s2, const int s2Len,"
+        print " "*8+"const int open, const int gap,"
+        print " "*8+"const parasail_matrix_t* matrix);"
@@ -5,6 +5,34 @@
 
 import os
 
+
+def sat_chain(call, indent="    ", setup=None, cleanup=None):
+    """Code that runs call, a format of the width, from the starting
+    width in bits until it no longer saturates, and records the width
+    that was used."""
+    lines = []
+    for bits, wider in [(8,16), (16,32), (32,None)]:
+        lines.append("if (%d == bits) {" % bits)
+        if setup:
+            lines.append("    " + setup % bits)
+        lines.append("    result = %s;" % (call % bits))
+        if wider:
+            lines.append("    if (result->saturated) {")
+            lines.append("        parasail_result_free(result);")
+            if cleanup:
+                lines.append("        " + cleanup)
+            lines.append("        bits = %d;" % wider)
+            lines.append("    }")
+        lines.append("}")
+    lines.append("result->width = bits;")
+    return "\n".join(indent + line for line in lines)
+
+
+# A _sat profile only holds its 8 bit vectors until a wider width is
+# asked for, see parasail_profile_width.
+WIDE = "wide = parasail_profile_width(profile, %d, &copy);"
+
+
 txt = """/**
  * @file
  *
@@ -14,11 +42,159 @@ txt = """/**
  */
 #include "config.h"
 
+#include <assert.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/memory.h"
+
+/* Narrowest width worth starting a _sat function at. A kernel flags
+ * saturation once a cell leaves its limits, so a width is skipped when
+ * a cheap bound puts the score itself outside them. The alignment along
+ * the main diagonal bounds the score from below, its best segment for
+ * sw; for nw, min(s1Len,s2Len)*matrix->max less the gap that unequal
+ * lengths force bounds it from above. A loose bound only costs the
+ * narrow pass that was always tried first. */
+static int sat_bits(
+        const int type,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    const int len = s1Len < s2Len ? s1Len : s2Len;
+    const int diff = s1Len < s2Len ? s2Len - s1Len : s1Len - s2Len;
+    const int64_t gapped = diff ? open + (int64_t)gap*(diff-1) : 0;
+    int64_t lower = 0;
+    int64_t upper = INT64_MAX;
+    int64_t sum = 0;
+    int64_t run = 0;
+    int bits = 8;
+    int i = 0;
+
+    if (NULL == s1 || NULL == s2) {
+        return bits;
+    }
+
+    for (i=0; i<len; ++i) {
+        int score = matrix->matrix[matrix->size*matrix->mapper[(unsigned char)s1[i]]
+            + matrix->mapper[(unsigned char)s2[i]]];
+        sum += score;
+        run = run + score > 0 ? run + score : 0;
+        if (run > lower) {
+            lower = run;
+        }
+    }
+    if (PARASAIL_TRACE_NW == type) {
+        lower = sum - gapped;
+        upper = (int64_t)len*(matrix->max > 0 ? matrix->max : 0) - gapped;
+    }
+    else if (PARASAIL_TRACE_SG == type) {
+        /* the rest of the longer sequence is a free end gap */
+        lower = sum;
+    }
+
+    for (bits=8; bits<32; bits*=2) {
+        const int64_t max = (INT64_C(1) << (bits-1)) - 1;
+        const int64_t min = -max - 1;
+        const int64_t pos_limit = max - matrix->max - 1;
+        const int64_t neg_limit = (-open < matrix->min ?
+                min + open : min - matrix->min) + 1;
+        if (lower <= pos_limit && upper >= neg_limit) {
+            break;
+        }
+    }
+
+    return bits;
+}
+
+static int sat_bits_profile(
+        const int type,
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    return sat_bits(type, profile->s1, profile->s1Len, s2, s2Len,
+            open, gap, profile->matrix);
+}
+
+/* Re-run only the saturated entries of a batch at a wider width. */
+static void swipe_retry(
+        parasail_bfunction_t *function, parasail_result_t **results,
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    int i = 0;
+    int count = 0;
+    const char **sub_s2s = NULL;
+    int *sub_s2Lens = NULL;
+    int *index = NULL;
+    parasail_result_t **retry = NULL;
+
+    for (i=0; i<s2Count; ++i) {
+        if (results[i]->saturated) {
+            ++count;
+        }
+    }
+    if (0 == count) {
+        return;
+    }
+
+    sub_s2s = (const char**)malloc(sizeof(const char*)*count);
+    sub_s2Lens = (int*)malloc(sizeof(int)*count);
+    index = (int*)malloc(sizeof(int)*count);
+    assert(sub_s2s);
+    assert(sub_s2Lens);
+    assert(index);
+    count = 0;
+    for (i=0; i<s2Count; ++i) {
+        if (results[i]->saturated) {
+            sub_s2s[count] = s2s[i];
+            sub_s2Lens[count] = s2Lens[i];
+            index[count] = i;
+            ++count;
+        }
+    }
+
+    retry = function(s1, s1Len, sub_s2s, sub_s2Lens, count, open, gap, matrix);
+    for (i=0; i<count; ++i) {
+        parasail_result_free(results[index[i]]);
+        results[index[i]] = retry[i];
+    }
+
+    free(retry);
+    free(index);
+    free(sub_s2Lens);
+    free(sub_s2s);
+}
+
+/* Re-run a saturated query of a packed batch on its own, at 16 bits and
+ * then at 32; the queries packed beside it keep their results. */
+static parasail_result_t* packed_retry(
+        parasail_function_t *function16, parasail_function_t *function32,
+        parasail_result_t *result,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = function16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (result->saturated) {
+        parasail_result_free(result);
+        result = function32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
 
 """
 for alg in ["nw", "sg", "sw"]:
@@ -26,6 +202,9 @@ for alg in ["nw", "sg", "sw"]:
         for stats in ["", "_stats"]:
             for par in ["_scan", "_striped", "_diag"]:
                 for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256"]:
+                    if (alg, table, stats) == ("sw", "", "") and "_striped" in par:
+                        # resumable, see below
+                        continue
                     prefix = "parasail_%s%s%s%s%s"%(alg, stats, table, par, isa)
                     if isa:
                         isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
@@ -34,6 +213,9 @@ for alg in ["nw", "sg", "sw"]:
                         isa_pre = ""
                         isa_post = ""
                     params = {"PREFIX":prefix,
+                            "TYPE":"PARASAIL_TRACE_%s" % alg.upper(),
+                            "CHAIN":sat_chain(prefix +
+                                "_%d(s1, s1Len, s2, s2Len, open, gap, matrix)"),
                             "ISA_PRE":isa_pre,
                             "ISA_POST":isa_post}
                     txt += """
@@ -45,16 +227,9 @@ parasail_result_t* %(PREFIX)s_sat(
         const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
-    
-    result = %(PREFIX)s_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = %(PREFIX)s_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (result->saturated) {
-        parasail_result_free(result);
-        result = %(PREFIX)s_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
+    int bits = sat_bits(%(TYPE)s, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+%(CHAIN)s
 
     return result;
 }
@@ -66,6 +241,9 @@ for alg in ["nw", "sg", "sw"]:
         for stats in ["", "_stats"]:
             for par in ["_scan_profile", "_striped_profile"]:
                 for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256"]:
+                    if (alg, table, stats) == ("sw", "", "") and "_striped" in par:
+                        # resumable, see below
+                        continue
                     prefix = "parasail_%s%s%s%s%s"%(alg, stats, table, par, isa)
                     if isa:
                         isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
@@ -74,6 +252,13 @@ for alg in ["nw", "sg", "sw"]:
                         isa_pre = ""
                         isa_post = ""
                     params = {"PREFIX":prefix,
+                            "TYPE":"PARASAIL_TRACE_%s" % alg.upper(),
+                            "CHAIN":sat_chain(prefix +
+                                "_%d(wide, s2, s2Len, open, gap)",
+                                setup=WIDE),
+                            "CHAIN_WS":sat_chain(prefix +
+                                "_%d_ws(wide, s2, s2Len, open, gap, workspace)",
+                                setup=WIDE),
                             "ISA_PRE":isa_pre,
                             "ISA_POST":isa_post}
                     txt += """
@@ -84,17 +269,394 @@ parasail_result_t* %(PREFIX)s_sat(
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(%(TYPE)s, profile, s2, s2Len, open, gap);
+
+%(CHAIN)s
+
+    return result;
+}
+
+parasail_result_t* %(PREFIX)s_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    int bits = sat_bits_profile(%(TYPE)s, profile, s2, s2Len, open, gap);
+
+%(CHAIN_WS)s
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+# The plain sw striped kernels can hand the last column they computed
+# exactly to the next wider kernel, so the work done before the
+# saturation point is kept instead of being recomputed.
+for isa in ["_sse2_128", "_sse41_128", "_avx2_256"]:
+    prefix = "parasail_sw_striped%s"%isa
+    pprefix = "parasail_sw_striped_profile%s"%isa
+    pcreate = "parasail_profile_create_%s"%(
+            "avx_256" if "avx2" in isa else "sse_128")
+    params = {"PREFIX":prefix,
+            "PPREFIX":pprefix,
+            "CHAIN":sat_chain(pprefix +
+                "_%d_resume(profile, s2, s2Len, open, gap, &workspace, &resume)",
+                setup="profile = " + pcreate + "_%d(s1, s1Len, matrix);",
+                cleanup="parasail_profile_free(profile);"),
+            "CHAIN_WS":sat_chain(pprefix +
+                "_%d_resume(wide, s2, s2Len, open, gap, workspace, &resume)",
+                setup=WIDE),
+            "ISA_PRE":"#if HAVE_" + isa.split('_')[1].upper(),
+            "ISA_POST":"#endif"}
+    txt += """
+%(ISA_PRE)s
+extern parasail_result_t* %(PPREFIX)s_8_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* %(PPREFIX)s_16_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+extern parasail_result_t* %(PPREFIX)s_32_resume(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_resume_t * const restrict resume);
+
+parasail_result_t* %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t * profile = NULL;
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+    parasail_resume_t resume;
+    int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+    parasail_workspace_init(&workspace);
+    parasail_resume_init(&resume);
+%(CHAIN)s
+    parasail_profile_free(profile);
+    parasail_resume_clear(&resume);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* %(PPREFIX)s_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+    parasail_workspace_t workspace;
+
+    parasail_workspace_init(&workspace);
+    result = %(PPREFIX)s_sat_ws(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+
+    return result;
+}
+
+parasail_result_t* %(PPREFIX)s_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    parasail_result_t * result = NULL;
+    parasail_profile_t copy;
+    const parasail_profile_t *wide = NULL;
+    parasail_resume_t resume;
+    int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+    parasail_resume_init(&resume);
+%(CHAIN_WS)s
+    parasail_resume_clear(&resume);
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+# The dispatching versions pick the resumable implementation for the
+# best available ISA and otherwise fall back to recomputing.
+dispatch_pre = """#if HAVE_KNC
+    if (0) {
+    }
+    else
+#else
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return %(PREFIX)s_avx2_256_sat(%(ARGS)s);
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return %(PREFIX)s_sse41_128_sat(%(ARGS)s);
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return %(PREFIX)s_sse2_128_sat(%(ARGS)s);
+    }
+    else
+#endif
+#endif
+    {
+        parasail_result_t * result = NULL;
+"""
+params = {"PREFIX":"parasail_sw_striped",
+        "ARGS":"s1, s1Len, s2, s2Len, open, gap, matrix",
+        "CHAIN":sat_chain(
+            "parasail_sw_striped_%d(s1, s1Len, s2, s2Len, open, gap, matrix)",
+            "        ")}
+txt += """
+parasail_result_t* %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+""" % params + dispatch_pre % params + """\
+        int bits = sat_bits(PARASAIL_TRACE_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+%(CHAIN)s
+
+        return result;
+    }
+}
+""" % params
+
+params = {"PREFIX":"parasail_sw_striped_profile",
+        "ARGS":"profile, s2, s2Len, open, gap",
+        "CHAIN":sat_chain(
+            "parasail_sw_striped_profile_%d(wide, s2, s2Len, open, gap)",
+            "        ", setup=WIDE)}
+txt += """
+parasail_result_t* %(PREFIX)s_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+""" % params + dispatch_pre % params + """\
+        parasail_profile_t copy;
+        const parasail_profile_t *wide = NULL;
+        int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+%(CHAIN)s
+
+        return result;
+    }
+}
+""" % params
+
+params = {"PREFIX":"parasail_sw_striped_profile",
+        "ARGS":"profile, s2, s2Len, open, gap, workspace",
+        "CHAIN":sat_chain(
+            "parasail_sw_striped_profile_%d_ws(wide, s2, s2Len, open, gap, workspace)",
+            "        ", setup=WIDE)}
+txt += """
+parasail_result_t* %(PREFIX)s_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+""" % params + dispatch_pre.replace("_sat(", "_sat_ws(") % params + """\
+        parasail_profile_t copy;
+        const parasail_profile_t *wide = NULL;
+        int bits = sat_bits_profile(PARASAIL_TRACE_SW, profile, s2, s2Len, open, gap);
+
+%(CHAIN)s
+
+        return result;
+    }
+}
+""" % params
+
+# the global band follows from the sequence lengths, the others are
+# centered on diag
+banded_params = {
+    "nw": ("const int k", "k"),
+    "sg": ("const int diag, const int k", "diag, k"),
+    "sw": ("const int diag, const int k", "diag, k"),
+}
+for alg in ["nw", "sg", "sw"]:
+    for table in ["", "_table", "_rowcol"]:
+        for isa in ["", "_sse41_128", "_avx2_256"]:
+            prefix = "parasail_%s%s_banded%s"%(alg, table, isa)
+            if isa:
+                isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+                isa_post = "#endif"
+            else:
+                isa_pre = ""
+                isa_post = ""
+            params = {"PREFIX":prefix,
+                    "BAND":banded_params[alg][0],
+                    "BAND_ARGS":banded_params[alg][1],
+                    "ISA_PRE":isa_pre,
+                    "ISA_POST":isa_post}
+            txt += """
+%(ISA_PRE)s
+parasail_result_t* %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, %(BAND)s,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
     
-    result = %(PREFIX)s_8(profile, s2, s2Len, open, gap);
+    result = %(PREFIX)s_8(s1, s1Len, s2, s2Len, open, gap, %(BAND_ARGS)s, matrix);
     if (result->saturated) {
         parasail_result_free(result);
-        result = %(PREFIX)s_16(profile, s2, s2Len, open, gap);
+        result = %(PREFIX)s_16(s1, s1Len, s2, s2Len, open, gap, %(BAND_ARGS)s, matrix);
     }
     if (result->saturated) {
         parasail_result_free(result);
-        result = %(PREFIX)s_32(profile, s2, s2Len, open, gap);
+        result = %(PREFIX)s_32(s1, s1Len, s2, s2Len, open, gap, %(BAND_ARGS)s, matrix);
+    }
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+for alg in ["nw", "sg", "sw"]:
+    for isa in ["", "_sse41_128", "_avx2_256"]:
+        prefix = "parasail_%s_swipe%s"%(alg, isa)
+        if isa:
+            isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+            isa_post = "#endif"
+        else:
+            isa_pre = ""
+            isa_post = ""
+        params = {"PREFIX":prefix,
+                "ISA_PRE":isa_pre,
+                "ISA_POST":isa_post}
+        txt += """
+%(ISA_PRE)s
+parasail_result_t** %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    
+    results = %(PREFIX)s_8(s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(%(PREFIX)s_16, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+    swipe_retry(%(PREFIX)s_32, results,
+            s1, s1Len, s2s, s2Lens, s2Count, open, gap, matrix);
+
+    return results;
+}
+%(ISA_POST)s
+""" % params
+
+for alg in ["nw", "sg", "sw"]:
+    for isa in ["", "_sse41_128", "_avx2_256"]:
+        prefix = "parasail_%s_packed%s"%(alg, isa)
+        if isa:
+            isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+            isa_post = "#endif"
+        else:
+            isa_pre = ""
+            isa_post = ""
+        params = {"PREFIX":prefix,
+                "PPREFIX":"parasail_%s_packed_profile%s"%(alg, isa),
+                "SHORT":"parasail_%s_short%s"%(alg, isa),
+                "ISA_PRE":isa_pre,
+                "ISA_POST":isa_post}
+        txt += """
+%(ISA_PRE)s
+parasail_result_t** %(PREFIX)s_sat(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = %(PREFIX)s_8(s1s, s1Lens, s1Count, s2, s2Len, open, gap, matrix);
+    for (q=0; q<s1Count; ++q) {
+        results[q] = packed_retry(%(SHORT)s_16, %(SHORT)s_32, results[q],
+                s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+    }
+
+    return results;
+}
+
+parasail_result_t** %(PPREFIX)s_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+    int q = 0;
+
+    results = %(PPREFIX)s_8(profile, s2, s2Len, open, gap);
+    for (q=0; q<profile->packed_count; ++q) {
+        results[q] = packed_retry(%(SHORT)s_16, %(SHORT)s_32, results[q],
+                profile->packed_s1[q],
+                profile->packed_begin[q+1] - profile->packed_begin[q],
+                s2, s2Len, open, gap, profile->matrix);
     }
 
+    return results;
+}
+%(ISA_POST)s
+""" % params
+
+for alg in ["nw", "sg", "sw"]:
+    for isa in ["", "_sse41_128", "_avx2_256"]:
+        prefix = "parasail_%s_trace_scan%s"%(alg, isa)
+        if isa:
+            isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+            isa_post = "#endif"
+        else:
+            isa_pre = ""
+            isa_post = ""
+        params = {"PREFIX":prefix,
+                "TYPE":"PARASAIL_TRACE_%s" % alg.upper(),
+                "CHAIN":sat_chain(prefix +
+                    "_%d(s1, s1Len, s2, s2Len, open, gap, matrix)"),
+                "ISA_PRE":isa_pre,
+                "ISA_POST":isa_post}
+        txt += """
+%(ISA_PRE)s
+parasail_result_t* %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+    int bits = sat_bits(%(TYPE)s, s1, s1Len, s2, s2Len, open, gap, matrix);
+
+%(CHAIN)s
+
     return result;
 }
 %(ISA_POST)s
@@ -0,0 +1,196 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+%(FIXES)s
+
+#ifdef PARASAIL_TABLE
+#define FNAME %(NAME_TABLE)s
+#define PNAME %(PNAME_TABLE)s
+#define WNAME %(PNAME_TABLE)s_ws
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME %(NAME_ROWCOL)s
+#define PNAME %(PNAME_ROWCOL)s
+#define WNAME %(PNAME_ROWCOL)s_ws
+#else
+#define FNAME %(NAME)s
+#define PNAME %(PNAME)s
+#define WNAME %(PNAME)s_ws
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_blocked_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = 0;
+    %(INDEX)s end_ref = 0;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+    %(VTYPE)s* const restrict pvH = parasail_workspace_%(VTYPE)s(workspace, 0, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_workspace_%(VTYPE)s(workspace, 1, segLen);
+    const %(INT)s * const restrict h = (const %(INT)s*)pvH;
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vFront[%(BLOCKED_STEPS)s];
+    const %(INT)s NEG_LIMIT = (-open < matrix->min ?
+        INT%(WIDTH)s_MIN + open : INT%(WIDTH)s_MIN - matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(INT)s score = NEG_INF;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* initialize H and E */
+    {
+        %(INT)s * const restrict e = (%(INT)s*)pvE;
+        for (i=0; i<segLen*segWidth; ++i) {
+            int64_t tmp = -open-gap*(int64_t)i;
+            ((%(INT)s*)pvH)[i] = tmp < NEG_INF ? NEG_INF : tmp;
+            tmp = tmp - open;
+            e[i] = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+    }
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * leaves empty have nothing above them in the block */
+    for (k=0; k<%(BLOCKED_STEPS)s; ++k) {
+        %(VTYPE)s_%(WIDTH)s_t front;
+        const %(INDEX)s lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            int64_t tmp = -(int64_t)lanes*gap;
+            front.v[i] = (i < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = front.m;
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        const %(VTYPE)s* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+        /* the upper boundary: H above row 0 in columns j-1 and j */
+        const int64_t diag = 0 == j ? 0 : -open-gap*(int64_t)(j-1);
+        const int64_t above = -open-gap*(int64_t)j;
+        %(VTYPE)s vHp = %(VSET1)s(diag < NEG_INF ? NEG_INF : diag);
+        %(VTYPE)s vFin = %(VSET1)s(above-open < NEG_INF ? NEG_INF : above-open);
+
+        /* each block of query rows sees the row above it through the
+         * last lane of vHp (diagonal) and of vFin (vertical gap) */
+        for (i=0; i<segLen; ++i) {
+            %(VTYPE)s vHold = %(VLOAD)s(pvH + i);
+            %(VTYPE)s vE = %(VLOAD)s(pvE + i);
+            %(VTYPE)s vH = %(VALIGNR)s(vHold, vHp, %(CARRY_BYTES)s);
+            %(VTYPE)s vF;
+            vHp = vHold;
+
+            vH = %(VADD)s(vH, %(VLOAD)s(vP + i));
+            vH = %(VMAX)s(vH, vE);
+
+            /* resolve F down the block with a log-step prefix max */
+            vF = %(VALIGNR)s(%(VSUB)s(vH, vGapO), vFin, %(CARRY_BYTES)s);
+%(BLOCKED_SCAN)s
+            vH = %(VMAX)s(vH, vF);
+            %(VSTORE)s(pvH + i, vH);
+            vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+            vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+
+            vH = %(VSUB)s(vH, vGapO);
+            vFin = %(VMAX)s(%(VSUB)s(vF, vGapE), vH);
+            vE = %(VMAX)s(%(VSUB)s(vE, vGapE), vH);
+            %(VSTORE)s(pvE + i, vE);
+        }
+
+#ifdef PARASAIL_TABLE
+        for (i=0; i<segLen*segWidth; ++i) {
+            result->score_table[i*s2Len + j] = h[i];
+        }
+#endif
+
+#ifdef PARASAIL_ROWCOL
+        result->score_row[j] = h[s1Len-1];
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen*segWidth; ++i) {
+        result->score_col[i] = h[i];
+    }
+#endif
+
+    score = h[s1Len-1];
+    end_query = s1Len - 1;
+    end_ref = s2Len - 1;
+
+    if (%(VMOVEMASK)s(%(VOR)s(
+            %(VCMPLT)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = INT%(WIDTH)s_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    return result;
+}
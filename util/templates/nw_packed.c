@@ -0,0 +1,185 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+%(FIXES)s
+
+#define FNAME %(NAME)s
+#define PNAME %(PNAME)s
+#define SNAME %(SNAME)s
+
+parasail_result_t** FNAME(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int segWidth = %(LANES)s; /* number of values in vector unit */
+    parasail_result_t **results = NULL;
+    int q = 0;
+    int i = 0;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s1Count);
+    assert(NULL != results || 0 == s1Count);
+    while (q < s1Count) {
+        parasail_profile_t *profile = NULL;
+        parasail_result_t **packed = NULL;
+        /* a query too long to share a vector is aligned on its own */
+        if (s1Lens[q] > segWidth) {
+            results[q] = SNAME(s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+            ++q;
+            continue;
+        }
+        profile = parasail_profile_create_packed_%(ISA)s_%(BITS)s_%(WIDTH)s(
+                s1s + q, s1Lens + q, s1Count - q, matrix);
+        packed = PNAME(profile, s2, s2Len, open, gap);
+        for (i=0; i<profile->packed_count; ++i) {
+            results[q++] = packed[i];
+        }
+        free(packed);
+        parasail_profile_free(profile);
+    }
+
+    return results;
+}
+
+/* Several queries sit side by side in one vector, each as in the short
+ * kernel. The diagonal and the F carry are cut at the first lane of
+ * every query and vFront never reaches across one, so no cell sees a
+ * row of its neighbour. */
+parasail_result_t** PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    int q = 0;
+    const int count = profile->packed_count;
+    const int * const restrict begin = profile->packed_begin;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vFront[%(BLOCKED_STEPS)s];
+    %(VTYPE)s vFirst;
+    %(VTYPE)s vH;
+    %(VTYPE)s vE;
+    %(VTYPE)s_%(WIDTH)s_t h;
+    %(VTYPE)s_%(WIDTH)s_t lo;
+    %(VTYPE)s_%(WIDTH)s_t hi;
+    int lane_row[%(LANES)s];
+    const %(INT)s NEG_LIMIT = (-open < matrix->min ?
+        INT%(WIDTH)s_MIN + open : INT%(WIDTH)s_MIN - matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(VTYPE)s vSaturationCheckMin = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMax = %(VSET1)s(NEG_LIMIT);
+    parasail_result_t **results = NULL;
+
+    /* the row of each lane within its query, the lanes past the last
+     * query counting on from it */
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+    assert(results);
+    for (q=0; q<count; ++q) {
+        results[q] = parasail_result_new();
+        for (i=begin[q]; i<begin[q+1]; ++i) {
+            lane_row[i] = i - begin[q];
+        }
+    }
+    for (i=begin[count]; i<segWidth; ++i) {
+        lane_row[i] = i - begin[count];
+    }
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * fills from above the first row of their query get nothing */
+    for (k=0; k<%(BLOCKED_STEPS)s; ++k) {
+        const %(INDEX)s lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            int64_t tmp = -(int64_t)lanes*gap;
+            h.v[i] = (lane_row[i] < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = h.m;
+    }
+
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = 0 == lane_row[i] ? -1 : 0;
+    }
+    vFirst = h.m;
+
+    /* initialize H and E */
+    for (i=0; i<segWidth; ++i) {
+        int64_t tmp = -open-gap*(int64_t)lane_row[i];
+        h.v[i] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+    vH = h.m;
+    for (i=0; i<segWidth; ++i) {
+        int64_t tmp = -open-gap*(int64_t)lane_row[i] - open;
+        h.v[i] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+    vE = h.m;
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        /* the upper boundary: H above row 0 in columns j-1 and j */
+        const int64_t diag = 0 == j ? 0 : -open-gap*(int64_t)(j-1);
+        const int64_t above = -open-gap*(int64_t)j;
+        %(VTYPE)s vHp = %(VSET1)s(diag < NEG_INF ? NEG_INF : diag);
+        %(VTYPE)s vFin = %(VSET1)s(above-open < NEG_INF ? NEG_INF : above-open);
+        %(VTYPE)s vF;
+        %(VTYPE)s vT;
+
+        vH = %(VALIGNR)s(vH, vHp, %(CARRY_BYTES)s);
+        vH = %(VBLEND)s(vH, vHp, vFirst);
+        vH = %(VADD)s(vH, %(VLOAD)s(vProfile + matrix->mapper[(unsigned char)s2[j]]));
+        vH = %(VMAX)s(vH, vE);
+
+        /* resolve F down each query with a log-step prefix max */
+        vF = %(VALIGNR)s(%(VSUB)s(vH, vGapO), vFin, %(CARRY_BYTES)s);
+        vF = %(VBLEND)s(vF, vFin, vFirst);
+%(SHORT_SCAN)s
+        vH = %(VMAX)s(vH, vF);
+        vE = %(VMAX)s(%(VSUB)s(vE, vGapE), %(VSUB)s(vH, vGapO));
+        vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+        vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+    }
+
+    h.m = vH;
+    lo.m = vSaturationCheckMin;
+    hi.m = vSaturationCheckMax;
+    for (q=0; q<count; ++q) {
+        parasail_result_t *result = results[q];
+        result->score = h.v[begin[q+1]-1];
+        result->end_query = begin[q+1] - begin[q] - 1;
+        result->end_ref = s2Len - 1;
+        /* only the lanes of this query */
+        for (i=begin[q]; i<begin[q+1]; ++i) {
+            if (lo.v[i] < NEG_LIMIT || hi.v[i] > POS_LIMIT) {
+                result->saturated = 1;
+                result->score = INT%(WIDTH)s_MAX;
+                result->end_query = 0;
+                result->end_ref = 0;
+                break;
+            }
+        }
+    }
+
+    return results;
+}
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -29,6 +30,8 @@ static inline void arr_store_si%(BITS)s(
 {
 %(PRINTER)s
 }
+
+%(PRINTER_TABLE)s
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -45,13 +48,16 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME %(NAME_TABLE)s
 #define PNAME %(PNAME_TABLE)s
+#define WNAME %(PNAME_TABLE)s_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME %(NAME_ROWCOL)s
 #define PNAME %(PNAME_ROWCOL)s
+#define WNAME %(PNAME_ROWCOL)s_ws
 #else
 #define FNAME %(NAME)s
 #define PNAME %(PNAME)s
+#define WNAME %(PNAME)s_ws
 #endif
 #endif
 
@@ -70,6 +76,21 @@ parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -83,11 +104,11 @@ parasail_result_t* PNAME(
     const %(INDEX)s offset = (s1Len - 1) %% segLen;
     const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
     %(VTYPE)s* const restrict pvP = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
-    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
-    %(VTYPE)s* const restrict pvHt= parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvH = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvGapper = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_workspace_%(VTYPE)s(workspace, 0, segLen);
+    %(INT)s* const restrict boundary = parasail_workspace_%(INT)s(workspace, 1, s2Len+1);
+    %(VTYPE)s* const restrict pvHt = parasail_workspace_%(VTYPE)s(workspace, 2, segLen);
+    %(VTYPE)s* const restrict pvH = parasail_workspace_%(VTYPE)s(workspace, 3, segLen);
+    %(VTYPE)s* const restrict pvGapper = parasail_workspace_%(VTYPE)s(workspace, 4, segLen);
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     const %(INT)s NEG_LIMIT = (-open < matrix->min ?
@@ -103,7 +124,11 @@ parasail_result_t* PNAME(
     %(VTYPE)s vSegLenXgap = %(VADD)s(vNegInfFront,
             %(VSHIFT)s(%(VSET1)s(-segLen*gap), %(BYTES)s));
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table1_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? %(TABLE_TYPE)s : PARASAIL_TABLE_INT,
+            &profile->window);
+    %(VTYPE)s* const restrict pvHTable = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 4*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
@@ -205,10 +230,11 @@ parasail_result_t* PNAME(
             %(VSTORE)s(pvH+i, vH);
             vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+        } 
+
 #ifdef PARASAIL_TABLE
-            arr_store_si%(BITS)s(result->score_table, vH, i, segLen, j, s2Len);
+        arr_store_table(result->score_table, pvHTable, pvH, segLen, j, s2Len, result);
 #endif
-        } 
 
 
 #ifdef PARASAIL_ROWCOL
@@ -223,6 +249,10 @@ parasail_result_t* PNAME(
 #endif
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
     for (i=0; i<segLen; ++i) {
         %(VTYPE)s vH = %(VLOAD)s(pvH+i);
@@ -252,11 +282,9 @@ parasail_result_t* PNAME(
     result->end_query = end_query;
     result->end_ref = end_ref;
 
-    parasail_free(pvGapper);
-    parasail_free(pvH);
-    parasail_free(pvHt);
-    parasail_free(boundary);
-    parasail_free(pvE);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -29,6 +30,8 @@ static inline void arr_store_si%(BITS)s(
 {
 %(PRINTER)s
 }
+
+%(PRINTER_TABLE)s
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -45,13 +48,16 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME %(NAME_TABLE)s
 #define PNAME %(PNAME_TABLE)s
+#define WNAME %(PNAME_TABLE)s_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME %(NAME_ROWCOL)s
 #define PNAME %(PNAME_ROWCOL)s
+#define WNAME %(PNAME_ROWCOL)s_ws
 #else
 #define FNAME %(NAME)s
 #define PNAME %(PNAME)s
+#define WNAME %(PNAME)s_ws
 #endif
 #endif
 
@@ -70,6 +76,21 @@ parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -85,21 +106,21 @@ parasail_result_t* PNAME(
     %(VTYPE)s* const restrict pvP  = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
     %(VTYPE)s* const restrict pvPm = (%(VTYPE)s*)profile->profile%(WIDTH)s.matches;
     %(VTYPE)s* const restrict pvPs = (%(VTYPE)s*)profile->profile%(WIDTH)s.similar;
-    %(VTYPE)s* const restrict pvE  = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvEM = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvES = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvEL = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvH  = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvHM = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvHS = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvHL = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvHMax  = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvHMMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvHSMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvHLMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvGapper = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvGapperL = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+    %(VTYPE)s* const restrict pvE  = parasail_workspace_%(VTYPE)s(workspace, 0, segLen);
+    %(VTYPE)s* const restrict pvEM = parasail_workspace_%(VTYPE)s(workspace, 1, segLen);
+    %(VTYPE)s* const restrict pvES = parasail_workspace_%(VTYPE)s(workspace, 2, segLen);
+    %(VTYPE)s* const restrict pvEL = parasail_workspace_%(VTYPE)s(workspace, 3, segLen);
+    %(VTYPE)s* const restrict pvH  = parasail_workspace_%(VTYPE)s(workspace, 4, segLen);
+    %(VTYPE)s* const restrict pvHM = parasail_workspace_%(VTYPE)s(workspace, 5, segLen);
+    %(VTYPE)s* const restrict pvHS = parasail_workspace_%(VTYPE)s(workspace, 6, segLen);
+    %(VTYPE)s* const restrict pvHL = parasail_workspace_%(VTYPE)s(workspace, 7, segLen);
+    %(VTYPE)s* const restrict pvHMax  = parasail_workspace_%(VTYPE)s(workspace, 8, segLen);
+    %(VTYPE)s* const restrict pvHMMax = parasail_workspace_%(VTYPE)s(workspace, 9, segLen);
+    %(VTYPE)s* const restrict pvHSMax = parasail_workspace_%(VTYPE)s(workspace, 10, segLen);
+    %(VTYPE)s* const restrict pvHLMax = parasail_workspace_%(VTYPE)s(workspace, 11, segLen);
+    %(VTYPE)s* const restrict pvGapper = parasail_workspace_%(VTYPE)s(workspace, 12, segLen);
+    %(VTYPE)s* const restrict pvGapperL = parasail_workspace_%(VTYPE)s(workspace, 13, segLen);
+    %(INT)s* const restrict boundary = parasail_workspace_%(INT)s(workspace, 14, s2Len+1);
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     const %(INT)s NEG_LIMIT = (-open < matrix->min ?
@@ -120,7 +141,11 @@ parasail_result_t* PNAME(
             %(VSHIFT)s(%(VSET1)s(-segLen*gap), %(BYTES)s));
     %(VTYPE)s vSegLen = %(VSHIFT)s(%(VSET1)s(segLen), %(BYTES)s);
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table3(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table3_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? %(TABLE_TYPE)s : PARASAIL_TABLE_INT,
+            &profile->window);
+    %(VTYPE)s* const restrict pvHTable = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 16*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol3(segLen*segWidth, s2Len);
@@ -370,13 +395,14 @@ parasail_result_t* PNAME(
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHM);
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHS);
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHL);
+        } 
+
 #ifdef PARASAIL_TABLE
-            arr_store_si%(BITS)s(result->score_table, vH, i, segLen, j, s2Len);
-            arr_store_si%(BITS)s(result->matches_table, vHM, i, segLen, j, s2Len);
-            arr_store_si%(BITS)s(result->similar_table, vHS, i, segLen, j, s2Len);
-            arr_store_si%(BITS)s(result->length_table, vHL, i, segLen, j, s2Len);
+        arr_store_table(result->score_table, pvHTable, pvH, segLen, j, s2Len, result);
+        arr_store_table(result->matches_table, pvHTable + 4*segLen, pvHM, segLen, j, s2Len, result);
+        arr_store_table(result->similar_table, pvHTable + 8*segLen, pvHS, segLen, j, s2Len, result);
+        arr_store_table(result->length_table, pvHTable + 12*segLen, pvHL, segLen, j, s2Len, result);
 #endif
-        } 
 
 #ifdef PARASAIL_ROWCOL
         /* extract last value from the column */
@@ -399,6 +425,13 @@ parasail_result_t* PNAME(
 #endif
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result);
+    arr_store_table_end(result->matches_table, pvHTable + 4*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->similar_table, pvHTable + 8*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->length_table, pvHTable + 12*segLen, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
     for (i=0; i<segLen; ++i) {
         %(VTYPE)s vH = %(VLOAD)s(pvH+i);
@@ -449,21 +482,9 @@ parasail_result_t* PNAME(
     result->end_query = end_query;
     result->end_ref = end_ref;
 
-    parasail_free(boundary);
-    parasail_free(pvGapperL);
-    parasail_free(pvGapper);
-    parasail_free(pvHLMax);
-    parasail_free(pvHSMax);
-    parasail_free(pvHMMax);
-    parasail_free(pvHMax);
-    parasail_free(pvHL);
-    parasail_free(pvHS);
-    parasail_free(pvHM);
-    parasail_free(pvH);
-    parasail_free(pvEL);
-    parasail_free(pvES);
-    parasail_free(pvEM);
-    parasail_free(pvE);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -30,6 +31,8 @@ static inline void arr_store_si%(BITS)s(
 {
 %(PRINTER)s
 }
+
+%(PRINTER_TABLE)s
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -46,13 +49,16 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME %(NAME_TABLE)s
 #define PNAME %(PNAME_TABLE)s
+#define WNAME %(PNAME_TABLE)s_ws
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME %(NAME_ROWCOL)s
 #define PNAME %(PNAME_ROWCOL)s
+#define WNAME %(PNAME_ROWCOL)s_ws
 #else
 #define FNAME %(NAME)s
 #define PNAME %(PNAME)s
+#define WNAME %(PNAME)s_ws
 #endif
 #endif
 
@@ -71,6 +77,21 @@ parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -85,17 +106,21 @@ parasail_result_t* PNAME(
     const %(INDEX)s offset = (s1Len - 1) %% segLen;
     const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
     %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
-    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+    %(VTYPE)s* restrict pvHStore = parasail_workspace_%(VTYPE)s(workspace, 0, segLen);
+    %(VTYPE)s* restrict pvHLoad = parasail_workspace_%(VTYPE)s(workspace, 1, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_workspace_%(VTYPE)s(workspace, 2, segLen);
+    %(INT)s* const restrict boundary = parasail_workspace_%(INT)s(workspace, 3, s2Len+1);
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
     %(INT)s score = NEG_INF;
     %(SATURATION_CHECK_INIT)s
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table1_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? %(TABLE_TYPE)s : PARASAIL_TABLE_INT,
+            &profile->window);
+    %(VTYPE)s* const restrict pvHTable = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 4*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
@@ -163,9 +188,6 @@ parasail_result_t* PNAME(
             /* Save vH values. */
             %(VSTORE)s(pvHStore + i, vH);
             %(SATURATION_CHECK_MID)s
-#ifdef PARASAIL_TABLE
-            arr_store_si%(BITS)s(result->score_table, vH, i, segLen, j, s2Len);
-#endif
 
             /* Update vE value. */
             vH = %(VSUB)s(vH, vGapO);
@@ -193,9 +215,6 @@ parasail_result_t* PNAME(
                 vH = %(VMAX)s(vH,vF);
                 %(VSTORE)s(pvHStore + i, vH);
                 %(SATURATION_CHECK_MID)s
-#ifdef PARASAIL_TABLE
-                arr_store_si%(BITS)s(result->score_table, vH, i, segLen, j, s2Len);
-#endif
                 vH = %(VSUB)s(vH, vGapO);
                 vF = %(VSUB)s(vF, vGapE);
                 if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
@@ -206,6 +225,10 @@ end:
         {
         }
 
+#ifdef PARASAIL_TABLE
+        arr_store_table(result->score_table, pvHTable, pvHStore, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
         /* extract last value from the column */
         {
@@ -218,6 +241,10 @@ end:
 #endif
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result);
+#endif
+
 #ifdef PARASAIL_ROWCOL
     for (i=0; i<segLen; ++i) {
         %(VTYPE)s vH = %(VLOAD)s(pvHStore+i);
@@ -240,10 +267,9 @@ end:
     result->end_query = end_query;
     result->end_ref = end_ref;
 
-    parasail_free(boundary);
-    parasail_free(pvE);
-    parasail_free(pvHLoad);
-    parasail_free(pvHStore);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
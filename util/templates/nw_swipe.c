@@ -0,0 +1,221 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+%(FIXES)s
+
+#define FNAME %(NAME)s
+
+/* Inter-sequence (SWIPE-style) kernel. Each vector lane holds a
+ * different database sequence; the query is walked in the inner loop
+ * one residue at a time. When a lane reaches the end of its sequence
+ * its result is recorded and the next database sequence is loaded into
+ * that lane so all lanes stay busy until the batch is exhausted. */
+parasail_result_t** FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s l = 0;
+    %(INDEX)s next = 0;
+    %(INDEX)s active = 0;
+    const %(INDEX)s n = matrix->size; /* number of amino acids in table */
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    int32_t * const restrict s1 = parasail_memalign_int32_t(16, s1Len);
+    %(VTYPE)s* const restrict pvP = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, n);
+    %(VTYPE)s* const restrict pvH = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, s1Len);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, s1Len);
+    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(16, s1Len);
+    %(INDEX)s lane_seq[%(LANES)s];
+    %(INDEX)s lane_pos[%(LANES)s];
+    const int *lane_row[%(LANES)s];
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(VTYPE)s vOpen = %(VSET1)s(-open);
+    %(VTYPE)s vHDiag0 = vZero;
+    %(VTYPE)s vHUp0 = vOpen;
+    %(VTYPE)s vH = vZero;
+    %(SWIPE_SATURATION_CHECK_INIT)s
+    parasail_result_t **results = NULL;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s2Count);
+    assert(NULL != results || 0 == s2Count);
+
+    for (i=0; i<s1Len; ++i) {
+        int64_t tmp = -open - (int64_t)i*gap;
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+        boundary[i] = (%(INT)s)(tmp < NEG_INF ? NEG_INF : tmp);
+    }
+
+    for (l=0; l<segWidth; ++l) {
+        lane_seq[l] = -1;
+        lane_pos[l] = 0;
+        lane_row[l] = matrix->matrix;
+    }
+
+    /* initialize H and E */
+    for (i=0; i<s1Len; ++i) {
+        %(VSTORE)s(pvH+i, %(VSET1)s(boundary[i]));
+        %(VSTORE)s(pvE+i, vNegInf);
+    }
+
+    while (1) {
+        /* load new database sequences into idle lanes */
+        {
+            %(VTYPE)s_%(WIDTH)s_t mask;
+            int refill = 0;
+            mask.m = vZero;
+            for (l=0; l<segWidth; ++l) {
+                if (lane_seq[l] >= 0) {
+                    continue;
+                }
+                /* empty sequences never occupy a lane; s1 aligns to
+                 * them as a single gap */
+                while (next < s2Count && s2Lens[next] <= 0) {
+                    parasail_result_t *result = parasail_result_new();
+                    int64_t tmp = -open - (int64_t)(s1Len-1)*gap;
+                    if (tmp <= NEG_INF) {
+                        result->saturated = 1;
+                        result->score = INT%(WIDTH)s_MAX;
+                    }
+                    else {
+                        result->score = (int)tmp;
+                        result->end_query = s1Len-1;
+                    }
+                    results[next++] = result;
+                }
+                if (next >= s2Count) {
+                    break;
+                }
+                lane_seq[l] = next++;
+                lane_pos[l] = 0;
+                mask.v[l] = -1;
+                refill = 1;
+                ++active;
+            }
+            if (refill) {
+                for (i=0; i<s1Len; ++i) {
+                    %(VSTORE)s(pvH+i, %(VBLEND)s(%(VLOAD)s(pvH+i),
+                                %(VSET1)s(boundary[i]), mask.m));
+                    %(VSTORE)s(pvE+i, %(VBLEND)s(%(VLOAD)s(pvE+i),
+                                vNegInf, mask.m));
+                }
+                vHDiag0 = %(VBLEND)s(vHDiag0, vZero, mask.m);
+                vHUp0 = %(VBLEND)s(vHUp0, vOpen, mask.m);
+                %(SWIPE_SATURATION_CHECK_RESET)s
+            }
+        }
+
+        if (0 == active) {
+            break;
+        }
+
+        /* build the substitution scores for the current column */
+        for (l=0; l<segWidth; ++l) {
+            if (lane_seq[l] >= 0) {
+                const char c = s2s[lane_seq[l]][lane_pos[l]];
+                lane_row[l] = &matrix->matrix[n*matrix->mapper[(unsigned char)c]];
+            }
+        }
+        for (k=0; k<n; ++k) {
+            %(VTYPE)s_%(WIDTH)s_t t;
+            for (l=0; l<segWidth; ++l) {
+                t.v[l] = (%(INT)s)lane_row[l][k];
+            }
+            %(VSTORE)s(pvP+k, t.m);
+        }
+
+        /* inner loop to process the query sequence */
+        {
+            %(VTYPE)s vHDiag = vHDiag0;
+            %(VTYPE)s vHUp = vHUp0;
+            %(VTYPE)s vF = vNegInf;
+            for (i=0; i<s1Len; ++i) {
+                %(VTYPE)s vHLeft = %(VLOAD)s(pvH+i);
+                %(VTYPE)s vE = %(VLOAD)s(pvE+i);
+                vE = %(VMAX)s(
+                        %(VSUB)s(vHLeft, vGapO),
+                        %(VSUB)s(vE, vGapE));
+                vF = %(VMAX)s(
+                        %(VSUB)s(vHUp, vGapO),
+                        %(VSUB)s(vF, vGapE));
+                vH = %(VADD)s(vHDiag, %(VLOAD)s(pvP+s1[i]));
+                vH = %(VMAX)s(vH, vE);
+                vH = %(VMAX)s(vH, vF);
+                %(VSTORE)s(pvE+i, vE);
+                %(VSTORE)s(pvH+i, vH);
+                %(SWIPE_SATURATION_CHECK_MID)s
+                vHDiag = vHLeft;
+                vHUp = vH;
+            }
+        }
+
+        /* record finished lanes, advance the others */
+        {
+            %(VTYPE)s_%(WIDTH)s_t h;
+            %(SWIPE_SATURATION_CHECK_LANES)s
+            h.m = vH;
+            for (l=0; l<segWidth; ++l) {
+                %(INDEX)s index = lane_seq[l];
+                if (index < 0) {
+                    continue;
+                }
+                if (lane_pos[l] == s2Lens[index] - 1) {
+                    parasail_result_t *result = parasail_result_new();
+                    int saturated = 0;
+                    %(SWIPE_SATURATION_CHECK_FINAL)s
+                    if (saturated) {
+                        result->saturated = 1;
+                        result->score = INT%(WIDTH)s_MAX;
+                        result->end_query = 0;
+                        result->end_ref = 0;
+                    }
+                    else {
+                        result->score = h.v[l];
+                        result->end_query = s1Len-1;
+                        result->end_ref = lane_pos[l];
+                    }
+                    results[index] = result;
+                    lane_seq[l] = -1;
+                    --active;
+                }
+                else {
+                    ++lane_pos[l];
+                }
+            }
+        }
+
+        /* first row boundary for the next column */
+        vHDiag0 = vHUp0;
+        vHUp0 = %(VMAX)s(%(VSUB)s(vHUp0, vGapE), vNegInf);
+    }
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(pvP);
+    parasail_free(s1);
+
+    return results;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+%(FIXES)s
+
+/* pack the four direction masks of vector i of a column */
+static inline void trace_store(
+        uint64_t *bits,
+        %(INDEX)s i,
+        uint32_t m0,
+        uint32_t m1,
+        uint32_t m2,
+        uint32_t m3)
+{
+%(TRACE_STORE)s
+}
+
+#define FNAME %(NAME)s
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = s1Len-1;
+    %(INDEX)s end_ref = s2Len-1;
+    parasail_profile_t *profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    parasail_workspace_t workspace;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    const %(INDEX)s offset = (s1Len - 1) %% segLen;
+    const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
+    %(VTYPE)s* const restrict pvP = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+    %(VTYPE)s* restrict pvE = NULL;
+    %(INT)s* restrict boundary = NULL;
+    %(VTYPE)s* restrict pvHt = NULL;
+    %(VTYPE)s* restrict pvH = NULL;
+    %(VTYPE)s* restrict pvGapper = NULL;
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    const %(INT)s NEG_LIMIT = (-open < matrix->min ?
+        INT%(WIDTH)s_MIN + open : INT%(WIDTH)s_MIN - matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(INT)s score = NEG_LIMIT;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;
+    %(VTYPE)s vNegInfFront = %(VSET)s(%(SCAN_NEG_INF_FRONT)s);
+    %(VTYPE)s vSegLenXgap = %(VADD)s(vNegInfFront,
+            %(VSHIFT)s(%(VSET1)s(-segLen*gap), %(BYTES)s));
+    parasail_result_t *result = parasail_result_new_trace(
+            segLen, s2Len, segWidth, PARASAIL_TRACE_NW);
+    uint64_t * const restrict bits = result->trace->bits;
+    const %(INDEX)s words = result->trace->words;
+
+    parasail_workspace_init(&workspace);
+    pvE = parasail_workspace_%(VTYPE)s(&workspace, 0, segLen);
+    boundary = parasail_workspace_%(INT)s(&workspace, 1, s2Len+1);
+    pvHt = parasail_workspace_%(VTYPE)s(&workspace, 2, segLen);
+    pvH = parasail_workspace_%(VTYPE)s(&workspace, 3, segLen);
+    pvGapper = parasail_workspace_%(VTYPE)s(&workspace, 4, segLen);
+
+    /* initialize H and E */
+    {
+        %(INDEX)s index = 0;
+        for (i=0; i<segLen; ++i) {
+            %(INDEX)s segNum = 0;
+            %(VTYPE)s_%(WIDTH)s_t h;
+            %(VTYPE)s_%(WIDTH)s_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+            }
+            %(VSTORE)s(&pvH[index], h.m);
+            %(VSTORE)s(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+        }
+    }
+
+    {
+        %(VTYPE)s vGapper = %(VSUB)s(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            %(VSTORE)s(pvGapper+i, vGapper);
+            vGapper = %(VSUB)s(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        %(VTYPE)s vHt;
+        %(VTYPE)s vF;
+        %(VTYPE)s vH;
+        %(VTYPE)s vHp;
+        %(VTYPE)s *pvW;
+        %(VTYPE)s vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = %(VLOAD)s(pvH+(segLen-1));
+        vHp = %(VSHIFT)s(vHp, %(BYTES)s);
+        vHp = %(VINSERT)s(vHp, boundary[j], 0);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = %(VSUB)s(vNegLimit, pvGapper[0]);
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = %(VLOAD)s(pvH+i);
+            vE = %(VLOAD)s(pvE+i);
+            vW = %(VLOAD)s(pvW+i);
+            vE = %(VMAX)s(
+                    %(VSUB)s(vE, vGapE),
+                    %(VSUB)s(vH, vGapO));
+            vHp = %(VADD)s(vHp, vW);
+            vF = %(VMAX)s(vF, %(VADD)s(vHt, pvGapper[i]));
+            vHt = %(VMAX)s(vE, vHp);
+            %(VSTORE)s(pvE+i, vE);
+            %(VSTORE)s(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = %(VSHIFT)s(vHt, %(BYTES)s);
+        vHt = %(VINSERT)s(vHt, boundary[j+1], 0);
+        vF = %(VMAX)s(vF, %(VADD)s(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            %(VTYPE)s vFt = %(VSHIFT)s(vF, %(BYTES)s);
+            vFt = %(VADD)s(vFt, vSegLenXgap);
+            vF = %(VMAX)s(vF, vFt);
+        }
+
+        /* calculate final H and record where each cell came from */
+        vF = %(VSHIFT)s(vF, %(BYTES)s);
+        vF = %(VADD)s(vF, vNegInfFront);
+        vH = %(VMAX)s(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            %(VTYPE)s vHold = %(VLOAD)s(pvH+i);
+            %(VTYPE)s vFopen = %(VSUB)s(vH, vGapO);
+            %(VTYPE)s vCaseE;
+            %(VTYPE)s vCaseF;
+            vHt = %(VLOAD)s(pvHt+i);
+            vE = %(VLOAD)s(pvE+i);
+            vF = %(VMAX)s(%(VSUB)s(vF, vGapE), vFopen);
+            vH = %(VMAX)s(vHt, vF);
+            %(VSTORE)s(pvH+i, vH);
+            vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+            vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+            vCaseE = %(VCMPEQ)s(vH, vE);
+            vCaseF = %(VANDNOT)s(vCaseE, %(VCMPEQ)s(vH, vF));
+            trace_store(bits + j*words, i,
+                    (uint32_t)%(VMASKBITS)s(vCaseE),
+                    (uint32_t)%(VMASKBITS)s(vCaseF),
+                    (uint32_t)%(VMASKBITS)s(%(VCMPGT)s(vE, %(VSUB)s(vHold, vGapO))),
+                    (uint32_t)%(VMASKBITS)s(%(VCMPGT)s(vF, vFopen)));
+        }
+    }
+
+    /* extract last value from the last column */
+    {
+        %(VTYPE)s vH = %(VLOAD)s(pvH + offset);
+        for (k=0; k<position; ++k) {
+            vH = %(VSHIFT)s(vH, %(BYTES)s);
+        }
+        score = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+    }
+
+    /* the scan also overflows when a gap spanning a segment does not
+     * fit in a lane */
+    if ((int64_t)segLen*gap > INT%(WIDTH)s_MAX
+            || %(VMOVEMASK)s(%(VOR)s(
+            %(VCMPLT)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_workspace_clear(&workspace);
+    parasail_profile_free(profile);
+
+    return result;
+}
@@ -0,0 +1,323 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+%(FIXES)s
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store_si%(BITS)s(
+        int *array,
+        %(VTYPE)s vWH,
+        %(INDEX)s i,
+        %(INDEX)s s1Len,
+        %(INDEX)s j,
+        %(INDEX)s s2Len)
+{
+%(PRINTER)s
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_rowcol(
+        int *row,
+        int *col,
+        %(VTYPE)s vWH,
+        %(INDEX)s i,
+        %(INDEX)s s1Len,
+        %(INDEX)s j,
+        %(INDEX)s s2Len)
+{
+%(PRINTER_ROWCOL)s
+}
+#endif
+
+#ifdef PARASAIL_TABLE
+#define FNAME %(NAME_TABLE)s
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME %(NAME_ROWCOL)s
+#else
+#define FNAME %(NAME)s
+#endif
+#endif
+
+/* floor(x/2), also for negative x */
+static inline %(INDEX)s half_floor(%(INDEX)s x)
+{
+    return x >= 0 ? x/2 : -((1-x)/2);
+}
+
+/* keep band limits within one diagonal of the table */
+static inline %(INDEX)s band_limit(int64_t d, %(INDEX)s s1Len, %(INDEX)s s2Len)
+{
+    return d < -s2Len-1 ? -s2Len-1 : d > s1Len+1 ? s1Len+1 : (%(INDEX)s)d;
+}
+
+/* Same wavefront as the banded global kernels; the band is centered on
+ * the diagonal j-i == diag and spans k diagonals on either side. Gaps
+ * at the beginning and end of either sequence are free. */
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int diag, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const %(INDEX)s N = %(LANES)s; /* number of values in vector */
+    const %(INDEX)s PAD = N-1;
+    const %(INDEX)s PAD2 = PAD*2;
+    const %(INDEX)s s1Len_PAD = s1Len+PAD;
+    const %(INDEX)s s2Len_PAD = s2Len+PAD;
+    /* diagonals (row minus column) inside the band */
+    const %(INDEX)s dlo = band_limit(-(int64_t)diag - k, s1Len, s2Len);
+    const %(INDEX)s dhi = band_limit(-(int64_t)diag + k, s1Len, s2Len);
+    %(INT)s * const restrict s1 = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s1Len+PAD);
+    %(INT)s * const restrict s2B= parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict _H_pr = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict _F_pr = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(VTYPE)s * const restrict vLanes = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, N+1);
+    %(INT)s * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    %(INT)s * const restrict H_pr = _H_pr+PAD;
+    %(INT)s * const restrict F_pr = _F_pr+PAD;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s t = 0;
+    %(INDEX)s end_query = s1Len;
+    %(INDEX)s end_ref = s2Len;
+    %(INT)s score = NEG_INF;
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(VTYPE)s vOpen = %(VSET1)s(open);
+    %(VTYPE)s vGap  = %(VSET1)s(gap);
+    const %(INT)s NEG_LIMIT = INT%(WIDTH)s_MIN
+        + open + matrix->max - matrix->min + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;
+
+    /* vLanes[n] selects the first n rows of a stripe */
+    for (i=0; i<=N; ++i) {
+        %(VTYPE)s_%(WIDTH)s_t m;
+        for (t=0; t<N; ++t) {
+            m.v[%(LAST_POS)s-t] = t < i ? -1 : 0;
+        }
+        %(VSTORE)s(&vLanes[i], m.m);
+    }
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, only inside the band */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = -1-j >= dlo && -1-j <= dhi ? 0 : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+#ifdef PARASAIL_TABLE
+    /* cells outside of the band are reported as 0 */
+    parasail_memset_int(result->score_table, 0, (size_t)s1Len*s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+    parasail_memset_int(result->score_row, 0, s2Len);
+    parasail_memset_int(result->score_col, 0, s1Len);
+#endif
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* only the columns that intersect the band */
+        const %(INDEX)s jstart = i-dhi > 0 ? i-dhi : 0;
+        const %(INDEX)s jend = i+2*PAD-dlo+1 < s2Len_PAD ?
+            i+2*PAD-dlo+1 : s2Len_PAD;
+        %(VTYPE)s vNH = vNegInf;
+        %(VTYPE)s vWH = vNegInf;
+        %(VTYPE)s vE = vNegInf;
+        %(VTYPE)s vF = vNegInf;
+        %(VTYPE)s vIBoundary;
+        %(DIAG_MATROW_DECL)s
+        /* left boundary column, only inside the band */
+        {
+            %(VTYPE)s_%(WIDTH)s_t b;
+            for (t=0; t<N; ++t) {
+                b.v[%(LAST_POS)s-t] = i+t+1 >= dlo && i+t+1 <= dhi ?
+                    0 : NEG_INF;
+            }
+            vIBoundary = b.m;
+        }
+        if (jstart >= jend) {
+            continue;
+        }
+        vNH = %(VINSERT)s(vNH, H_pr[jstart-1], %(LAST_POS)s);
+        if (0 == jstart) {
+            vWH = %(VINSERT)s(vWH, i+1 >= dlo && i+1 <= dhi ?
+                    0 : NEG_INF, %(LAST_POS)s);
+        }
+        /* iterate over database sequence */
+        for (j=jstart; j<jend; ++j) {
+            %(VTYPE)s vMat;
+            %(VTYPE)s vNWH = vNH;
+            %(VTYPE)s vValid = vWH;
+            /* rows of this stripe inside the band and inside the table */
+            const %(INDEX)s tlo = half_floor(j-i+dlo+1);
+            const %(INDEX)s thi = half_floor(j-i+dhi);
+            %(INDEX)s vlo = j-s2Len+1;
+            %(INDEX)s vhi = s1Len-1-i;
+            vNH = %(VRSHIFT)s(vWH, %(BYTES)s);
+            vNH = %(VINSERT)s(vNH, H_pr[j], %(LAST_POS)s);
+            vF = %(VRSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, F_pr[j], %(LAST_POS)s);
+            vF = %(VMAX)s(
+                    %(VSUB)s(vNH, vOpen),
+                    %(VSUB)s(vF, vGap));
+            vE = %(VMAX)s(
+                    %(VSUB)s(vWH, vOpen),
+                    %(VSUB)s(vE, vGap));
+            vMat = %(VSET)s(
+                    %(DIAG_MATROW_USE)s
+                    );
+            vNWH = %(VADD)s(vNWH, vMat);
+            vWH = %(VMAX)s(vNWH, vE);
+            vWH = %(VMAX)s(vWH, vF);
+            /* as minor diagonal vector passes across the j=-1 boundary,
+             * assign the appropriate boundary conditions */
+            if (j+1 < N) {
+                %(VTYPE)s cond = %(VANDNOT)s(vLanes[j+1], vLanes[j+2]);
+                vWH = %(VBLEND)s(vWH, vIBoundary, cond);
+                vF = %(VBLEND)s(vF, vNegInf, cond);
+                vE = %(VBLEND)s(vE, vNegInf, cond);
+            }
+            if (vlo < tlo) vlo = tlo;
+            if (vlo < 0) vlo = 0;
+            if (vhi > thi) vhi = thi;
+            if (vhi > j) vhi = j;
+            if (vhi > PAD) vhi = PAD;
+            if (tlo > 0 || thi < PAD) {
+                /* part of the stripe is outside of the band */
+                %(VTYPE)s cond = %(VANDNOT)s(
+                        vLanes[tlo < 0 ? 0 : tlo > N ? N : tlo],
+                        vLanes[thi < 0 ? 0 : thi >= N ? N : thi+1]);
+                vWH = %(VBLEND)s(vNegInf, vWH, cond);
+                vF = %(VBLEND)s(vNegInf, vF, cond);
+                vE = %(VBLEND)s(vNegInf, vE, cond);
+            }
+            vValid = vWH;
+            if (vlo > 0 || vhi < PAD) {
+                /* only check and report cells of the band and table */
+                %(VTYPE)s cond = vlo <= vhi ?
+                    %(VANDNOT)s(vLanes[vlo], vLanes[vhi+1]) : vZero;
+                vValid = %(VBLEND)s(vZero, vWH, cond);
+            }
+            if (vlo <= vhi) {
+                vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vValid);
+                vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vValid);
+#ifdef PARASAIL_TABLE
+                arr_store_si%(BITS)s(result->score_table, vValid, i, s1Len, j, s2Len);
+#endif
+#ifdef PARASAIL_ROWCOL
+                arr_store_rowcol(result->score_row, result->score_col, vValid, i, s1Len, j, s2Len);
+#endif
+                /* the last column and the last row hold the candidates;
+                 * ties are won by the smaller database position */
+                if (vlo == j-s2Len+1 || vhi == s1Len-1-i) {
+                    %(VTYPE)s_%(WIDTH)s_t h;
+                    h.m = vWH;
+                    for (t=vlo; t<=vhi; ++t) {
+                        %(INT)s value = h.v[%(LAST_POS)s-t];
+                        if (j-t != s2Len-1 && i+t != s1Len-1) {
+                            continue;
+                        }
+                        if (value > score || (value == score
+                                    && (j-t < end_ref || (j-t == end_ref
+                                            && i+t < end_query)))) {
+                            score = value;
+                            end_query = i+t;
+                            end_ref = j-t;
+                        }
+                    }
+                }
+            }
+            H_pr[j-%(LAST_POS)s] = (%(INT)s)%(VEXTRACT)s(vWH,0);
+            F_pr[j-%(LAST_POS)s] = (%(INT)s)%(VEXTRACT)s(vF,0);
+        }
+    }
+
+    if (end_query == s1Len) {
+        /* the band does not intersect the table */
+        score = 0;
+    }
+
+    if (%(VMOVEMASK)s(%(VOR)s(
+            %(VCMPLT)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = INT%(WIDTH)s_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_free(vLanes);
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
@@ -175,9 +175,7 @@ parasail_result_t* FNAME(
             vE = %(VMAX)s(
                     %(VSUB)s(vWH, vOpen),
                     %(VSUB)s(vE, vGap));
-            vMat = %(VSET)s(
-                    %(DIAG_MATROW_USE)s
-                    );
+            %(DIAG_MAT)s
             vNWH = %(VADD)s(vNWH, vMat);
             vWH = %(VMAX)s(vNWH, vE);
             vWH = %(VMAX)s(vWH, vF);
@@ -257,9 +257,7 @@ parasail_result_t* FNAME(
             vEL = %(VADD)s(vEL, vOne);
             vs2 = %(VRSHIFT)s(vs2, %(BYTES)s);
             vs2 = %(VINSERT)s(vs2, s2[j], %(LAST_POS)s);
-            vMat = %(VSET)s(
-                    %(DIAG_MATROW_USE)s
-                    );
+            %(DIAG_MAT)s
             vNWH = %(VADD)s(vNWH, vMat);
             vWH = %(VMAX)s(vNWH, vE);
             vWH = %(VMAX)s(vWH, vF);
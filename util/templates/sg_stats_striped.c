@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -33,6 +34,8 @@ static inline void arr_store_si%(BITS)s(
 {
 %(PRINTER)s
 }
+
+%(PRINTER_TABLE)s
 #endif
 
 #ifdef PARASAIL_ROWCOL
@@ -49,22 +52,26 @@ static inline void arr_store_col(
 #ifdef PARASAIL_TABLE
 #define FNAME %(NAME_TABLE)s
 #define PNAME %(PNAME_TABLE)s
+#define WNAME %(PNAME_TABLE)s_ws
 #define INAME PNAME
 #define STATIC
 #else
 #ifdef PARASAIL_ROWCOL
 #define FNAME %(NAME_ROWCOL)s
 #define PNAME %(PNAME_ROWCOL)s
+#define WNAME %(PNAME_ROWCOL)s_ws
 #define INAME PNAME
 #define STATIC
 #else
 #define FNAME %(NAME)s
 #ifdef FASTSTATS
 #define PNAME %(PNAME)s_internal
+#define WNAME %(PNAME)s_ws
 #define INAME %(PNAME)s
 #define STATIC static
 #else
 #define PNAME %(PNAME)s
+#define WNAME %(PNAME)s_ws
 #define INAME PNAME
 #define STATIC
 #endif
@@ -86,6 +93,21 @@ STATIC parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace;
+    parasail_result_t *result = NULL;
+
+    parasail_workspace_init(&workspace);
+    result = WNAME(profile, s2, s2Len, open, gap, &workspace);
+    parasail_workspace_clear(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace)
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -101,18 +123,18 @@ STATIC parasail_result_t* PNAME(
     %(VTYPE)s* const restrict vProfile  = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
     %(VTYPE)s* const restrict vProfileM = (%(VTYPE)s*)profile->profile%(WIDTH)s.matches;
     %(VTYPE)s* const restrict vProfileS = (%(VTYPE)s*)profile->profile%(WIDTH)s.similar;
-    %(VTYPE)s* restrict pvHStore        = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHLoad         = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHMStore       = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHMLoad        = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHSStore       = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHSLoad        = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHLStore       = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* restrict pvHLLoad        = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvE       = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvEM      = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvES      = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
-    %(VTYPE)s* const restrict pvEL      = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHStore        = parasail_workspace_%(VTYPE)s(workspace, 0, segLen);
+    %(VTYPE)s* restrict pvHLoad         = parasail_workspace_%(VTYPE)s(workspace, 1, segLen);
+    %(VTYPE)s* restrict pvHMStore       = parasail_workspace_%(VTYPE)s(workspace, 2, segLen);
+    %(VTYPE)s* restrict pvHMLoad        = parasail_workspace_%(VTYPE)s(workspace, 3, segLen);
+    %(VTYPE)s* restrict pvHSStore       = parasail_workspace_%(VTYPE)s(workspace, 4, segLen);
+    %(VTYPE)s* restrict pvHSLoad        = parasail_workspace_%(VTYPE)s(workspace, 5, segLen);
+    %(VTYPE)s* restrict pvHLStore       = parasail_workspace_%(VTYPE)s(workspace, 6, segLen);
+    %(VTYPE)s* restrict pvHLLoad        = parasail_workspace_%(VTYPE)s(workspace, 7, segLen);
+    %(VTYPE)s* const restrict pvE       = parasail_workspace_%(VTYPE)s(workspace, 8, segLen);
+    %(VTYPE)s* const restrict pvEM      = parasail_workspace_%(VTYPE)s(workspace, 9, segLen);
+    %(VTYPE)s* const restrict pvES      = parasail_workspace_%(VTYPE)s(workspace, 10, segLen);
+    %(VTYPE)s* const restrict pvEL      = parasail_workspace_%(VTYPE)s(workspace, 11, segLen);
     const %(VTYPE)s vGapO = %(VSET1)s(open);
     const %(VTYPE)s vGapE = %(VSET1)s(gap);
     const %(INT)s NEG_LIMIT = (-open < matrix->min ?
@@ -135,7 +157,11 @@ STATIC parasail_result_t* PNAME(
     %(VTYPE)s vPosMask = %(VCMPEQ)s(%(VSET1)s(position),
             %(VSET)s(%(POSITION_MASK)s));
 #ifdef PARASAIL_TABLE
-    parasail_result_t *result = parasail_result_new_table3(segLen*segWidth, s2Len);
+    parasail_result_t *result = parasail_result_new_table3_window(
+            segLen*segWidth, s2Len,
+            profile->narrow_tables ? %(TABLE_TYPE)s : PARASAIL_TABLE_INT,
+            &profile->window);
+    %(VTYPE)s* const restrict pvHTable = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 16*segLen);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol3(segLen*segWidth, s2Len);
@@ -249,12 +275,6 @@ STATIC parasail_result_t* PNAME(
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHM);
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHS);
             vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHL);
-#ifdef PARASAIL_TABLE
-            arr_store_si%(BITS)s(result->matches_table, vHM, i, segLen, j, s2Len);
-            arr_store_si%(BITS)s(result->similar_table, vHS, i, segLen, j, s2Len);
-            arr_store_si%(BITS)s(result->length_table, vHL, i, segLen, j, s2Len);
-            arr_store_si%(BITS)s(result->score_table, vH, i, segLen, j, s2Len);
-#endif
             vEF_opn = %(VSUB)s(vH, vGapO);
 
             /* Update vE value. */
@@ -334,12 +354,6 @@ STATIC parasail_result_t* PNAME(
                 vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHM);
                 vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHS);
                 vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHL);
-#ifdef PARASAIL_TABLE
-                arr_store_si%(BITS)s(result->matches_table, vHM, i, segLen, j, s2Len);
-                arr_store_si%(BITS)s(result->similar_table, vHS, i, segLen, j, s2Len);
-                arr_store_si%(BITS)s(result->length_table, vHL, i, segLen, j, s2Len);
-                arr_store_si%(BITS)s(result->score_table, vH, i, segLen, j, s2Len);
-#endif
                 /* Update vF value. */
                 vEF_opn = %(VSUB)s(vH, vGapO);
                 vF_ext = %(VSUB)s(vF, vGapE);
@@ -364,6 +378,13 @@ end:
         {
         }
 
+#ifdef PARASAIL_TABLE
+        arr_store_table(result->score_table, pvHTable, pvHStore, segLen, j, s2Len, result);
+        arr_store_table(result->matches_table, pvHTable + 4*segLen, pvHMStore, segLen, j, s2Len, result);
+        arr_store_table(result->similar_table, pvHTable + 8*segLen, pvHSStore, segLen, j, s2Len, result);
+        arr_store_table(result->length_table, pvHTable + 12*segLen, pvHLStore, segLen, j, s2Len, result);
+#endif
+
         /* extract vector containing last value from the column */
         {
             %(VTYPE)s cond_max;
@@ -395,6 +416,13 @@ end:
 #endif
     }
 
+#ifdef PARASAIL_TABLE
+    arr_store_table_end(result->score_table, pvHTable, segLen, j, s2Len, result);
+    arr_store_table_end(result->matches_table, pvHTable + 4*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->similar_table, pvHTable + 8*segLen, segLen, j, s2Len, result);
+    arr_store_table_end(result->length_table, pvHTable + 12*segLen, segLen, j, s2Len, result);
+#endif
+
     {
         /* extract last value from the column maximums */
         for (k=0; k<position; ++k) {
@@ -487,18 +515,9 @@ end:
     result->similar = similar;
     result->length = length;
 
-    parasail_free(pvEL);
-    parasail_free(pvES);
-    parasail_free(pvEM);
-    parasail_free(pvE);
-    parasail_free(pvHLLoad);
-    parasail_free(pvHLStore);
-    parasail_free(pvHSLoad);
-    parasail_free(pvHSStore);
-    parasail_free(pvHMLoad);
-    parasail_free(pvHMStore);
-    parasail_free(pvHLoad);
-    parasail_free(pvHStore);
+#ifdef PARASAIL_TABLE
+    parasail_free(pvHTable);
+#endif
 
     return result;
 }
@@ -0,0 +1,177 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+%(FIXES)s
+
+#define FNAME %(NAME)s
+#define PNAME %(PNAME)s
+#define SNAME %(SNAME)s
+
+parasail_result_t** FNAME(
+        const char * const * const restrict s1s,
+        const int * const restrict s1Lens, const int s1Count,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int segWidth = %(LANES)s; /* number of values in vector unit */
+    parasail_result_t **results = NULL;
+    int q = 0;
+    int i = 0;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s1Count);
+    assert(NULL != results || 0 == s1Count);
+    while (q < s1Count) {
+        parasail_profile_t *profile = NULL;
+        parasail_result_t **packed = NULL;
+        /* a query too long to share a vector is aligned on its own */
+        if (s1Lens[q] > segWidth) {
+            results[q] = SNAME(s1s[q], s1Lens[q], s2, s2Len, open, gap, matrix);
+            ++q;
+            continue;
+        }
+        profile = parasail_profile_create_packed_%(ISA)s_%(BITS)s_%(WIDTH)s(
+                s1s + q, s1Lens + q, s1Count - q, matrix);
+        packed = PNAME(profile, s2, s2Len, open, gap);
+        for (i=0; i<profile->packed_count; ++i) {
+            results[q++] = packed[i];
+        }
+        free(packed);
+        parasail_profile_free(profile);
+    }
+
+    return results;
+}
+
+/* Several queries sit side by side in one vector, each as in the short
+ * kernel. The diagonal and the F carry are cut at the first lane of
+ * every query and vFront never reaches across one, so no cell sees a
+ * row of its neighbour. */
+parasail_result_t** PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    int q = 0;
+    const int count = profile->packed_count;
+    const int * const restrict begin = profile->packed_begin;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(VTYPE)s vFront[%(BLOCKED_STEPS)s];
+    %(VTYPE)s vFirst;
+    %(VTYPE)s vReal;
+    %(VTYPE)s vH = vZero;
+    %(VTYPE)s vE = %(VSET1)s(-open);
+    %(VTYPE)s vBest = %(VSET1)s(NEG_INF);
+    %(VTYPE)s_%(WIDTH)s_t h;
+    int lane_query[%(LANES)s];
+    %(INT)s maxp = INT%(WIDTH)s_MAX - (%(INT)s)(matrix->max+1);
+    parasail_result_t **results = NULL;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+    assert(results);
+    for (q=0; q<count; ++q) {
+        results[q] = parasail_result_new();
+        results[q]->score = NEG_INF;
+        for (i=begin[q]; i<begin[q+1]; ++i) {
+            lane_query[i] = q;
+        }
+    }
+    for (i=begin[count]; i<segWidth; ++i) {
+        lane_query[i] = -1;
+    }
+
+    /* vFront[k] extends a gap by 2^k more rows; the lanes the shift
+     * fills from above the first row of their query get nothing */
+    for (k=0; k<%(BLOCKED_STEPS)s; ++k) {
+        const %(INDEX)s lanes = 1 << k;
+        for (i=0; i<segWidth; ++i) {
+            const int first = lane_query[i] < 0 ? begin[count] : begin[lane_query[i]];
+            int64_t tmp = -(int64_t)lanes*gap;
+            h.v[i] = (i - first < lanes || tmp < NEG_INF) ? NEG_INF : tmp;
+        }
+        vFront[k] = h.m;
+    }
+
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = (i < begin[count] && i == begin[lane_query[i]]) ? -1 : 0;
+    }
+    vFirst = h.m;
+    for (i=0; i<segWidth; ++i) {
+        h.v[i] = i < begin[count] ? -1 : 0;
+    }
+    vReal = h.m;
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vF;
+        %(VTYPE)s vT;
+
+        /* row -1 of every query is zero */
+        vH = %(VALIGNR)s(vH, vZero, %(CARRY_BYTES)s);
+        vH = %(VANDNOT)s(vFirst, vH);
+        vH = %(VADD)s(vH, %(VLOAD)s(vProfile + matrix->mapper[(unsigned char)s2[j]]));
+        vH = %(VMAX)s(vH, vE);
+        vH = %(VMAX)s(vH, vZero);
+
+        /* resolve F down each query with a log-step prefix max,
+         * clamped at zero as in the short kernel */
+        vF = %(VALIGNR)s(%(VSUB)s(vH, vGapO), vZero, %(CARRY_BYTES)s);
+        vF = %(VANDNOT)s(vFirst, %(VMAX)s(vF, vZero));
+%(SHORT_SCAN)s
+        vH = %(VMAX)s(vH, vF);
+        vE = %(VMAX)s(%(VSUB)s(vE, vGapE), %(VSUB)s(vH, vGapO));
+
+        /* a query can only improve where one of its lanes beats the
+         * best that lane has held */
+        if (%(VMOVEMASK)s(%(VAND)s(vReal, %(VCMPGT)s(vH, vBest)))) {
+            vBest = %(VMAX)s(vBest, vH);
+            h.m = vH;
+            for (i=0; i<begin[count]; ++i) {
+                parasail_result_t *result = results[lane_query[i]];
+                if (h.v[i] > result->score) {
+                    result->score = h.v[i];
+                    result->end_query = i - begin[lane_query[i]];
+                    result->end_ref = j;
+                    /* if score has potential to overflow, flag it */
+                    if (h.v[i] > maxp) {
+                        result->saturated = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    for (q=0; q<count; ++q) {
+        if (results[q]->saturated) {
+            results[q]->score = INT%(WIDTH)s_MAX;
+            results[q]->end_query = 0;
+            results[q]->end_ref = 0;
+        }
+    }
+
+    return results;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+%(FIXES)s
+
+#define FNAME %(NAME)s
+
+/* Inter-sequence (SWIPE-style) kernel. Each vector lane holds a
+ * different database sequence; the query is walked in the inner loop
+ * one residue at a time. When a lane reaches the end of its sequence
+ * its result is recorded and the next database sequence is loaded into
+ * that lane so all lanes stay busy until the batch is exhausted. */
+parasail_result_t** FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int s2Count,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s l = 0;
+    %(INDEX)s next = 0;
+    %(INDEX)s active = 0;
+    const %(INDEX)s n = matrix->size; /* number of amino acids in table */
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    int32_t * const restrict s1 = parasail_memalign_int32_t(16, s1Len);
+    %(VTYPE)s* const restrict pvP = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, n);
+    %(VTYPE)s* const restrict pvH = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, s1Len);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, s1Len);
+    %(INDEX)s lane_seq[%(LANES)s];
+    %(INDEX)s lane_pos[%(LANES)s];
+    int lane_score[%(LANES)s];
+    %(INDEX)s lane_end_query[%(LANES)s];
+    %(INDEX)s lane_end_ref[%(LANES)s];
+    const int *lane_row[%(LANES)s];
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(VTYPE)s vH = vZero;
+    %(VTYPE)s vMaxH = vZero;
+    %(INT)s maxp = INT%(WIDTH)s_MAX - (%(INT)s)(matrix->max+1);
+    parasail_result_t **results = NULL;
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*s2Count);
+    assert(NULL != results || 0 == s2Count);
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+
+    for (l=0; l<segWidth; ++l) {
+        lane_seq[l] = -1;
+        lane_pos[l] = 0;
+        lane_score[l] = NEG_INF;
+        lane_end_query[l] = 0;
+        lane_end_ref[l] = 0;
+        lane_row[l] = matrix->matrix;
+    }
+
+    /* initialize H and E */
+    for (i=0; i<s1Len; ++i) {
+        %(VSTORE)s(pvH+i, vZero);
+        %(VSTORE)s(pvE+i, vNegInf);
+    }
+
+    while (1) {
+        /* load new database sequences into idle lanes */
+        {
+            %(VTYPE)s_%(WIDTH)s_t mask;
+            int refill = 0;
+            mask.m = vZero;
+            for (l=0; l<segWidth; ++l) {
+                if (lane_seq[l] >= 0) {
+                    continue;
+                }
+                /* empty sequences never occupy a lane; an empty
+                 * alignment scores 0 */
+                while (next < s2Count && s2Lens[next] <= 0) {
+                    results[next++] = parasail_result_new();
+                }
+                if (next >= s2Count) {
+                    break;
+                }
+                lane_seq[l] = next++;
+                lane_pos[l] = 0;
+                lane_score[l] = NEG_INF;
+                lane_end_query[l] = 0;
+                lane_end_ref[l] = 0;
+                mask.v[l] = -1;
+                refill = 1;
+                ++active;
+            }
+            if (refill) {
+                for (i=0; i<s1Len; ++i) {
+                    %(VSTORE)s(pvH+i, %(VBLEND)s(%(VLOAD)s(pvH+i),
+                                vZero, mask.m));
+                    %(VSTORE)s(pvE+i, %(VBLEND)s(%(VLOAD)s(pvE+i),
+                                vNegInf, mask.m));
+                }
+            }
+        }
+
+        if (0 == active) {
+            break;
+        }
+
+        /* build the substitution scores for the current column */
+        for (l=0; l<segWidth; ++l) {
+            if (lane_seq[l] >= 0) {
+                const char c = s2s[lane_seq[l]][lane_pos[l]];
+                lane_row[l] = &matrix->matrix[n*matrix->mapper[(unsigned char)c]];
+            }
+        }
+        for (k=0; k<n; ++k) {
+            %(VTYPE)s_%(WIDTH)s_t t;
+            for (l=0; l<segWidth; ++l) {
+                t.v[l] = (%(INT)s)lane_row[l][k];
+            }
+            %(VSTORE)s(pvP+k, t.m);
+        }
+
+        /* inner loop to process the query sequence */
+        {
+            %(VTYPE)s vHDiag = vZero;
+            %(VTYPE)s vHUp = vZero;
+            %(VTYPE)s vF = vNegInf;
+            vMaxH = vZero;
+            for (i=0; i<s1Len; ++i) {
+                %(VTYPE)s vHLeft = %(VLOAD)s(pvH+i);
+                %(VTYPE)s vE = %(VLOAD)s(pvE+i);
+                vE = %(VMAX)s(
+                        %(VSUB)s(vHLeft, vGapO),
+                        %(VSUB)s(vE, vGapE));
+                vF = %(VMAX)s(
+                        %(VSUB)s(vHUp, vGapO),
+                        %(VSUB)s(vF, vGapE));
+                vH = %(VADD)s(vHDiag, %(VLOAD)s(pvP+s1[i]));
+                vH = %(VMAX)s(vH, vE);
+                vH = %(VMAX)s(vH, vF);
+                vH = %(VMAX)s(vH, vZero);
+                %(VSTORE)s(pvE+i, vE);
+                %(VSTORE)s(pvH+i, vH);
+                vMaxH = %(VMAX)s(vMaxH, vH);
+                vHDiag = vHLeft;
+                vHUp = vH;
+            }
+        }
+
+        /* record finished lanes, advance the others */
+        {
+            %(VTYPE)s_%(WIDTH)s_t h;
+            h.m = vMaxH;
+            for (l=0; l<segWidth; ++l) {
+                %(INDEX)s index = lane_seq[l];
+                int saturated = 0;
+                if (index < 0) {
+                    continue;
+                }
+                if (h.v[l] > lane_score[l]) {
+                    /* find the first row holding the new column max */
+                    lane_score[l] = h.v[l];
+                    lane_end_ref[l] = lane_pos[l];
+                    for (i=0; i<s1Len; ++i) {
+                        %(VTYPE)s_%(WIDTH)s_t t;
+                        t.m = %(VLOAD)s(pvH+i);
+                        if (t.v[l] == h.v[l]) {
+                            lane_end_query[l] = i;
+                            break;
+                        }
+                    }
+                    /* if score has potential to overflow, abort early */
+                    if (lane_score[l] > maxp) {
+                        saturated = 1;
+                    }
+                }
+                if (saturated || lane_pos[l] == s2Lens[index] - 1) {
+                    parasail_result_t *result = parasail_result_new();
+                    if (saturated) {
+                        result->saturated = 1;
+                        result->score = INT%(WIDTH)s_MAX;
+                        result->end_query = 0;
+                        result->end_ref = 0;
+                    }
+                    else {
+                        result->score = lane_score[l];
+                        result->end_query = lane_end_query[l];
+                        result->end_ref = lane_end_ref[l];
+                    }
+                    results[index] = result;
+                    lane_seq[l] = -1;
+                    --active;
+                }
+                else {
+                    ++lane_pos[l];
+                }
+            }
+        }
+    }
+
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(pvP);
+    parasail_free(s1);
+
+    return results;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+%(FIXES)s
+
+/* pack the four direction masks of vector i of a column */
+static inline void trace_store(
+        uint64_t *bits,
+        %(INDEX)s i,
+        uint32_t m0,
+        uint32_t m1,
+        uint32_t m2,
+        uint32_t m3)
+{
+%(TRACE_STORE)s
+}
+
+#define FNAME %(NAME)s
+
+parasail_result_t* FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s end_query = 0;
+    %(INDEX)s end_ref = 0;
+    parasail_profile_t *profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    parasail_workspace_t workspace;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    %(VTYPE)s* const restrict pvP = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+    %(VTYPE)s* restrict pvE = NULL;
+    %(VTYPE)s* restrict pvHt = NULL;
+    %(VTYPE)s* restrict pvH = NULL;
+    %(VTYPE)s* restrict pvHMax = NULL;
+    %(VTYPE)s* restrict pvGapper = NULL;
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    const %(INT)s NEG_LIMIT = (-open < matrix->min ?
+        INT%(WIDTH)s_MIN + open : INT%(WIDTH)s_MIN - matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(INT)s score = NEG_LIMIT;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;
+    %(VTYPE)s vMaxH = vNegLimit;
+    %(VTYPE)s vMaxHUnit = vNegLimit;
+    %(VTYPE)s vNegInfFront = %(VSET)s(%(SCAN_NEG_INF_FRONT)s);
+    %(VTYPE)s vSegLenXgap = %(VADD)s(vNegInfFront,
+            %(VSHIFT)s(%(VSET1)s(-segLen*gap), %(BYTES)s));
+    parasail_result_t *result = parasail_result_new_trace(
+            segLen, s2Len, segWidth, PARASAIL_TRACE_SW);
+    uint64_t * const restrict bits = result->trace->bits;
+    const %(INDEX)s words = result->trace->words;
+
+    parasail_workspace_init(&workspace);
+    pvE = parasail_workspace_%(VTYPE)s(&workspace, 0, segLen);
+    pvHt = parasail_workspace_%(VTYPE)s(&workspace, 1, segLen);
+    pvH = parasail_workspace_%(VTYPE)s(&workspace, 2, segLen);
+    pvHMax = parasail_workspace_%(VTYPE)s(&workspace, 3, segLen);
+    pvGapper = parasail_workspace_%(VTYPE)s(&workspace, 4, segLen);
+
+    parasail_memset_%(VTYPE)s(pvH, vZero, segLen);
+    parasail_memset_%(VTYPE)s(pvE, vNegLimit, segLen);
+    {
+        %(VTYPE)s vGapper = %(VSUB)s(vZero,vGapO);
+        for (i=segLen-1; i>=0; --i) {
+            %(VSTORE)s(pvGapper+i, vGapper);
+            vGapper = %(VSUB)s(vGapper, vGapE);
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        %(VTYPE)s vHt;
+        %(VTYPE)s vF;
+        %(VTYPE)s vH;
+        %(VTYPE)s vHp;
+        %(VTYPE)s *pvW;
+        %(VTYPE)s vW;
+
+        /* calculate E */
+        /* calculate Ht */
+        /* calculate F and H first pass */
+        vHp = %(VLOAD)s(pvH+(segLen-1));
+        vHp = %(VSHIFT)s(vHp, %(BYTES)s);
+        pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+        vHt = vZero;
+        vF = vNegLimit;
+        for (i=0; i<segLen; ++i) {
+            vH = %(VLOAD)s(pvH+i);
+            vE = %(VLOAD)s(pvE+i);
+            vW = %(VLOAD)s(pvW+i);
+            vE = %(VMAX)s(
+                    %(VSUB)s(vE, vGapE),
+                    %(VSUB)s(vH, vGapO));
+            vHp = %(VADD)s(vHp, vW);
+            vF = %(VMAX)s(vF, %(VADD)s(vHt, pvGapper[i]));
+            vHt = %(VMAX)s(vE, vHp);
+            %(VSTORE)s(pvE+i, vE);
+            %(VSTORE)s(pvHt+i, vHt);
+            vHp = vH;
+        }
+
+        /* pseudo prefix scan on F and H */
+        vHt = %(VSHIFT)s(vHt, %(BYTES)s);
+        vF = %(VMAX)s(vF, %(VADD)s(vHt, pvGapper[0]));
+        for (i=0; i<segWidth-2; ++i) {
+            %(VTYPE)s vFt = %(VSHIFT)s(vF, %(BYTES)s);
+            vFt = %(VADD)s(vFt, vSegLenXgap);
+            vF = %(VMAX)s(vF, vFt);
+        }
+
+        /* calculate final H and record where each cell came from */
+        vF = %(VSHIFT)s(vF, %(BYTES)s);
+        vF = %(VADD)s(vF, vNegInfFront);
+        vH = %(VMAX)s(vHt, vF);
+        for (i=0; i<segLen; ++i) {
+            %(VTYPE)s vHold = %(VLOAD)s(pvH+i);
+            %(VTYPE)s vFopen = %(VSUB)s(vH, vGapO);
+            %(VTYPE)s vCaseZ;
+            %(VTYPE)s vCaseE;
+            %(VTYPE)s vCaseF;
+            vHt = %(VLOAD)s(pvHt+i);
+            vE = %(VLOAD)s(pvE+i);
+            vF = %(VMAX)s(%(VSUB)s(vF, vGapE), vFopen);
+            vH = %(VMAX)s(vHt, vF);
+            vH = %(VMAX)s(vH, vZero);
+            %(VSTORE)s(pvH+i, vH);
+            vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+            vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+            vMaxH = %(VMAX)s(vH, vMaxH);
+            /* a zero cell starts a new local alignment, code 11 */
+            vCaseZ = %(VCMPEQ)s(vH, vZero);
+            vCaseE = %(VANDNOT)s(vCaseZ, %(VCMPEQ)s(vH, vE));
+            vCaseF = %(VANDNOT)s(%(VOR)s(vCaseZ, vCaseE),
+                    %(VCMPEQ)s(vH, vF));
+            trace_store(bits + j*words, i,
+                    (uint32_t)%(VMASKBITS)s(%(VOR)s(vCaseZ, vCaseE)),
+                    (uint32_t)%(VMASKBITS)s(%(VOR)s(vCaseZ, vCaseF)),
+                    (uint32_t)%(VMASKBITS)s(%(VCMPGT)s(vE, %(VSUB)s(vHold, vGapO))),
+                    (uint32_t)%(VMASKBITS)s(%(VCMPGT)s(vF, vFopen)));
+        }
+
+        {
+            %(VTYPE)s vCompare = %(VCMPGT)s(vMaxH, vMaxHUnit);
+            if (%(VMOVEMASK)s(vCompare)) {
+                score = %(VHMAX)s(vMaxH);
+                vMaxHUnit = %(VSET1)s(score);
+                end_ref = j;
+                (void)memcpy(pvHMax, pvH, sizeof(%(VTYPE)s)*segLen);
+            }
+        }
+    }
+
+    /* Trace the alignment ending position on read. */
+    {
+        %(INT)s *t = (%(INT)s*)pvHMax;
+        %(INDEX)s column_len = segLen * segWidth;
+        end_query = s1Len;
+        for (i = 0; i<column_len; ++i, ++t) {
+            if (*t == score) {
+                %(INDEX)s temp = i / segWidth + i %% segWidth * segLen;
+                if (temp < end_query) {
+                    end_query = temp;
+                }
+            }
+        }
+    }
+
+    /* the scan also overflows when a gap spanning a segment does not
+     * fit in a lane */
+    if ((int64_t)segLen*gap > INT%(WIDTH)s_MAX
+            || %(VMOVEMASK)s(%(VOR)s(
+            %(VCMPLT)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
+        result->saturated = 1;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+
+    parasail_workspace_clear(&workspace);
+    parasail_profile_free(profile);
+
+    return result;
+}